@@ -0,0 +1,133 @@
+#include <cstring>
+#include <stdexcept>
+
+#include "BatchScheduler.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        BatchScheduler::BatchScheduler(const cntk::FunctionPtr & model, const cntk::DeviceDescriptor & device, size_t maxBatchSize, chrono::microseconds maxWait)
+            : mPredictor(model, device), mMaxBatchSize(maxBatchSize), mMaxWait(maxWait), mQueuedRows(0), mStop(false)
+        {
+            if (maxBatchSize == 0)
+                throw logic_error("The maximum batch size must be positive");
+
+            mThread = thread(&BatchScheduler::ThreadLoop, this);
+        }
+
+        BatchScheduler::~BatchScheduler()
+        {
+            {
+                lock_guard<mutex> lock(mMutex);
+                mStop = true;
+            }
+            mWork.notify_one();
+            mThread.join();
+        }
+
+        void BatchScheduler::Predict(const float * in, size_t n, float * out)
+        {
+            if (n == 0)
+                return;
+
+            Request request = { in, n, out, chrono::steady_clock::now(), false, nullptr };
+            {
+                lock_guard<mutex> lock(mMutex);
+                mQueue.push_back(&request);
+                mQueuedRows += n;
+            }
+            mWork.notify_one();
+
+            {
+                unique_lock<mutex> lock(mMutex);
+                mDone.wait(lock, [&request] { return request.done; });
+            }
+
+            if (request.error)
+                rethrow_exception(request.error);
+        }
+
+        void BatchScheduler::ThreadLoop()
+        {
+            vector<Request *> batch;
+            for (;;)
+            {
+                size_t rows = 0;
+                {
+                    unique_lock<mutex> lock(mMutex);
+                    mWork.wait(lock, [this] { return mStop || !mQueue.empty(); });
+                    // The pending requests are served before stopping
+                    if (mQueue.empty())
+                        return;
+
+                    auto deadline = mQueue.front()->arrival + mMaxWait;
+                    mWork.wait_until(lock, deadline, [this] { return mStop || mQueuedRows >= mMaxBatchSize; });
+
+                    // In order, the first request even when it's larger than a batch
+                    batch.clear();
+                    while (!mQueue.empty() && (batch.empty() || rows + mQueue.front()->n <= mMaxBatchSize))
+                    {
+                        batch.push_back(mQueue.front());
+                        rows += mQueue.front()->n;
+                        mQueue.pop_front();
+                    }
+                    mQueuedRows -= rows;
+                }
+
+                exception_ptr error;
+                try
+                {
+                    Evaluate(batch, rows);
+                }
+                catch (...)
+                {
+                    error = current_exception();
+                }
+
+                {
+                    lock_guard<mutex> lock(mMutex);
+                    for (auto request : batch)
+                    {
+                        request->error = error;
+                        request->done = true;
+                    }
+                }
+                mDone.notify_all();
+            }
+        }
+
+        void BatchScheduler::Evaluate(const vector<Request *> & batch, size_t rows)
+        {
+            if (batch.size() == 1)
+            {
+                mPredictor.Predict(batch[0]->in, batch[0]->n, batch[0]->out);
+                return;
+            }
+
+            size_t inputSize = InputSize();
+            size_t outputSize = OutputSize();
+            mInputs.resize(rows * inputSize);
+            mOutputs.resize(rows * outputSize);
+
+            float * p = &mInputs[0];
+            for (auto request : batch)
+            {
+                memcpy(p, request->in, request->n * inputSize * sizeof(float));
+                p += request->n * inputSize;
+            }
+
+            mPredictor.Predict(&mInputs[0], rows, &mOutputs[0]);
+
+            const float * q = &mOutputs[0];
+            for (auto request : batch)
+            {
+                memcpy(request->out, q, request->n * outputSize * sizeof(float));
+                q += request->n * outputSize;
+            }
+        }
+    }
+}
\ No newline at end of file
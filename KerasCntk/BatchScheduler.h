@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CNTKLibrary.h"
+
+#include "Keras.h"
+#include "Predictor.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // Dynamic batching of concurrent predictions: the callers' rows are queued and a single thread
+        // evaluates them together, up to maxBatchSize rows. The batch waits for more rows at most
+        // maxWait after its oldest request arrived; with no wait only the requests queued during the
+        // previous evaluation are coalesced. A request larger than maxBatchSize is evaluated alone.
+        class BatchScheduler
+        {
+        public:
+            KERAS_API BatchScheduler(const CNTK::FunctionPtr & model, const CNTK::DeviceDescriptor & device, size_t maxBatchSize, std::chrono::microseconds maxWait);
+            KERAS_API ~BatchScheduler();
+
+            size_t InputSize() const { return mPredictor.InputSize(); }
+            size_t OutputSize() const { return mPredictor.OutputSize(); }
+
+            size_t MaxBatchSize() const { return mMaxBatchSize; }
+            std::chrono::microseconds MaxWait() const { return mMaxWait; }
+
+            // Same as Predictor::Predict, blocks until the batch with the request is evaluated
+            KERAS_API void Predict(const float * in, size_t n, float * out);
+
+        private:
+            struct Request
+            {
+                const float * in;
+                size_t n;
+                float * out;
+                std::chrono::steady_clock::time_point arrival;
+                bool done;
+                std::exception_ptr error;
+            };
+
+            void ThreadLoop();
+            void Evaluate(const std::vector<Request *> & batch, size_t rows);
+
+            Predictor mPredictor;
+            size_t mMaxBatchSize;
+            std::chrono::microseconds mMaxWait;
+
+            // The coalesced rows, the evaluation thread's only
+            std::vector<float> mInputs;
+            std::vector<float> mOutputs;
+
+            std::mutex mMutex;
+            std::condition_variable mWork;
+            std::condition_variable mDone;
+            std::deque<Request *> mQueue;
+            size_t mQueuedRows;
+            bool mStop;
+            std::thread mThread;
+        };
+    }
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include <codecvt>
 
+#include "fmt/format.h"
+
 #include "BufferMinibatchSource.h"
 
 using namespace std;
@@ -8,36 +10,185 @@ namespace keras
 {
     namespace cntk_utils
     {
-        void BufferMinibatchSource::Add(const TensorProto & nda, const CNTK::NDShape & inputShape, const std::wstring name)
+        void BufferMinibatchSource::Add(const TensorProto & nda, const CNTK::NDShape & inputShape, const std::wstring name, bool packSequences)
         {
             CNTK::NDShape shape(vector<size_t>(nda.shape().cbegin(), nda.shape().cend()));
+            vector<size_t> sequenceLengths(nda.sequence_lengths().cbegin(), nda.sequence_lengths().cend());
+
+            // Fixed length sequences [nsamples x timesteps x input shape] are packed as well, for
+            // sequence inputs only: a batch-only input may legitimately have that rank
+            if (packSequences && sequenceLengths.empty() && shape.Rank() == inputShape.Rank() + 2)
+            {
+                sequenceLengths.assign(shape[0], shape[1]);
+                shape = CNTK::NDShape({ shape[0] * shape[1] }).AppendShape(shape.SubShape(2));
+            }
+
             if (shape.SubShape(1).TotalSize() != inputShape.TotalSize())
                 throw logic_error("The input shape is incompatible with the actual data shape");
 
-            mInputShapes.push_back(inputShape);
-
             if (shape.TotalSize()*sizeof(float) > nda.data().size())
                 throw logic_error("The shape is incompatible with the data size.");
 
             // std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> conversion;
             auto a = make_shared<DataBuffer>(shape, (float *)nda.data().data(), name);
+            if (!sequenceLengths.empty())
+                a->SetSequenceLengths(sequenceLengths);
+
+            AddArray(a, inputShape, CNTK::StorageFormat::Dense, name);
+        }
+
+        template <typename T>
+        static void CopyIndices(const string & data, size_t dimension, vector<size_t> & indices)
+        {
+            if (indices.size() * sizeof(T) > data.size())
+                throw logic_error("The shape is incompatible with the data size.");
+
+            const T * p = (const T *)data.data();
+            for (size_t i = 0; i < indices.size(); ++i)
+            {
+                if (p[i] < 0 || (size_t)p[i] >= dimension)
+                    throw runtime_error(fmt::format("Index {:d} is out of range [0, {:d})", (int64_t)p[i], dimension));
+                indices[i] = (size_t)p[i];
+            }
+        }
+
+        void BufferMinibatchSource::AddOneHot(const TensorProto & nda, size_t dimension, const std::wstring name)
+        {
+            // [nsamples x length] or packed with sequence_lengths, one index per step
+            vector<size_t> shape(nda.shape().cbegin(), nda.shape().cend());
+            if (shape.empty() || shape.size() > 2)
+                throw logic_error("One-hot inputs are either [nsamples] or [nsamples x length] indices");
+
+            vector<size_t> sequenceLengths(nda.sequence_lengths().cbegin(), nda.sequence_lengths().cend());
+            if (sequenceLengths.empty())
+                sequenceLengths.assign(shape[0], shape.size() == 2 ? shape[1] : 1);
+
+            vector<size_t> indices(shape.size() == 2 ? shape[0] * shape[1] : shape[0]);
+            switch (nda.type())
+            {
+            case DataType::Int32:
+                CopyIndices<int32_t>(nda.data(), dimension, indices);
+                break;
+
+            case DataType::Int64:
+                CopyIndices<int64_t>(nda.data(), dimension, indices);
+                break;
+
+            case DataType::Float:
+                CopyIndices<float>(nda.data(), dimension, indices);
+                break;
+
+            case DataType::Double:
+                CopyIndices<double>(nda.data(), dimension, indices);
+                break;
+
+            default:
+                throw logic_error("One-hot indices are either Int32, Int64, Float or Double");
+            }
+
+            auto a = make_shared<DataBuffer>(dimension, move(indices), name);
+            a->SetSequenceLengths(sequenceLengths);
+
+            AddArray(a, { dimension }, CNTK::StorageFormat::SparseCSC, name);
+        }
+
+        template <typename T>
+        static void HashKeys(const string & data, size_t dimension, size_t numHashes, vector<size_t> & indices)
+        {
+            size_t count = indices.size() / numHashes;
+            if (count * sizeof(T) > data.size())
+                throw logic_error("The shape is incompatible with the data size.");
+
+            const T * p = (const T *)data.data();
+            for (size_t i = 0; i < count; ++i)
+            for (size_t h = 0; h < numHashes; ++h)
+                indices[i * numHashes + h] = (size_t)(Hash((uint64_t)p[i], h) % dimension);
+        }
+
+        void BufferMinibatchSource::AddHashed(const TensorProto & nda, size_t dimension, size_t numHashes, const std::wstring name)
+        {
+            // The same layout as the one-hot indices, but any Int64/Int32 key or string
+            vector<size_t> shape(nda.shape().cbegin(), nda.shape().cend());
+            if (shape.empty() || shape.size() > 2)
+                throw logic_error("Hashed inputs are either [nsamples] or [nsamples x length] keys");
+
+            vector<size_t> sequenceLengths(nda.sequence_lengths().cbegin(), nda.sequence_lengths().cend());
+            if (sequenceLengths.empty())
+                sequenceLengths.assign(shape[0], shape.size() == 2 ? shape[1] : 1);
 
+            size_t count = shape.size() == 2 ? shape[0] * shape[1] : shape[0];
+            vector<size_t> indices(count * numHashes);
+
+            switch (nda.type())
+            {
+            case DataType::Int64:
+                HashKeys<int64_t>(nda.data(), dimension, numHashes, indices);
+                break;
+
+            case DataType::Int32:
+                HashKeys<int32_t>(nda.data(), dimension, numHashes, indices);
+                break;
+
+            case DataType::String:
+            {
+                // '\0' terminated UTF-8 strings
+                const char * p = nda.data().data();
+                const char * end = p + nda.data().size();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const char * s = p;
+                    while (p < end && *p != '\0')
+                        ++p;
+                    if (p == end)
+                        throw logic_error(fmt::format("Expected {:d} strings, found {:d}", count, i));
+
+                    for (size_t h = 0; h < numHashes; ++h)
+                        indices[i * numHashes + h] = (size_t)(Hash(s, p - s, h) % dimension);
+                    ++p;
+                }
+                break;
+            }
+
+            default:
+                throw logic_error("Hashed inputs are either Int64, Int32 or String");
+            }
+
+            auto a = make_shared<DataBuffer>(dimension, move(indices), name, numHashes);
+            a->SetSequenceLengths(sequenceLengths);
+
+            AddArray(a, { dimension }, CNTK::StorageFormat::SparseCSC, name);
+        }
+
+        void BufferMinibatchSource::Add(const TensorProto & nda, const CNTK::Variable & input, const std::wstring name)
+        {
+            if (!input.IsSparse())
+                Add(nda, input.Shape(), name, input.DynamicAxes().size() > 1);
+            else if (GetNumHashes(input) > 0)
+                AddHashed(nda, input.Shape().TotalSize(), GetNumHashes(input), name);
+            else
+                AddOneHot(nda, input.Shape().TotalSize(), name);
+        }
+
+        void BufferMinibatchSource::AddArray(const NDArrayPtr & a, const CNTK::NDShape & inputShape, CNTK::StorageFormat storageFormat, const std::wstring & name)
+        {
             CNTK::StreamInformation si;
             si.m_elementType = a->DataType();
             si.m_sampleLayout = inputShape;
-            si.m_storageFormat = CNTK::StorageFormat::Dense;
+            si.m_storageFormat = storageFormat;
             if (name.size() == 0)
                 si.m_name = CNTK::Internal::GenerateUid(L"StreamInformation");
             else
                 si.m_name = name;
 
             if (mArrays.empty())
-                mSamples = a->Shape()[0];
-            else if (mSamples != a->Shape()[0])
+                mSamples = a->NumSamples();
+            else if (mSamples != a->NumSamples())
                 throw std::runtime_error("Inputs with different number of samples.");
 
             si.m_id = mInfos.size();
 
+            mInputShapes.push_back(inputShape);
+
             // mData.insert({si, CNTK::MinibatchData(CNTK::MakeSharedObject<CNTK::Value>(a), a->Shape()[0])});
             mInfos.emplace_back(si);
             mInfosSet.emplace(si);
@@ -45,6 +196,19 @@ namespace keras
         }
 
         const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData> & BufferMinibatchSource::GetNextMinibatch(size_t batchSize, const CNTK::DeviceDescriptor & device)
+        {
+            return GetNextMinibatch(0, batchSize, 1, 0, device);
+        }
+
+        // Every worker takes its shard of the same global minibatch, so all the workers go through
+        // the epochs in lockstep. A worker's shard is empty when the minibatch has fewer samples
+        // than workers, as CNTK's distributed learners expect.
+        const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData>& BufferMinibatchSource::GetNextMinibatch(
+            size_t minibatchSizeInSequences,
+            size_t batchSize,
+            size_t numberOfWorkers,
+            size_t workerRank,
+            const CNTK::DeviceDescriptor & device)
         {
             bool eof;
             size_t nsamples;
@@ -68,27 +232,36 @@ namespace keras
                 eof = false;
             }
 
+            size_t start = mPos + nsamples * workerRank / numberOfWorkers;
+            size_t end = mPos + nsamples * (workerRank + 1) / numberOfWorkers;
+
             mResult.clear();
-            for (auto i = 0; i < mArrays.size(); ++i)
+            for (auto i = 0; i < mArrays.size() && start < end; ++i)
             {
                 const auto & nda = mArrays[i];
-                CNTK::ValuePtr view = nda->GetBatch(mPos, mPos + nsamples, mInputShapes[i]);
-                mResult.insert({ mInfos[i], CNTK::MinibatchData(view, nsamples, eof) });
+                CNTK::ValuePtr view = nda->GetBatch(start, end, mInputShapes[i]);
+                mResult.insert({ mInfos[i], CNTK::MinibatchData(view, end - start, nda->NumSteps(start, end), eof) });
             }
 
             mPos += nsamples;
+            mLastBatchSize = nsamples;
 
             return mResult;
         }
 
-        const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData>& BufferMinibatchSource::GetNextMinibatch(
-            size_t minibatchSizeInSequences,
-            size_t minibatchSizeInSamples,
-            size_t numberOfWorkers,
-            size_t workerRank,
-            const CNTK::DeviceDescriptor & device)
+        CNTK::Dictionary BufferMinibatchSource::GetCheckpointState() const
+        {
+            CNTK::Dictionary checkpoint;
+            checkpoint[L"position"] = mPos;
+            return checkpoint;
+        }
+
+        void BufferMinibatchSource::RestoreFromCheckpoint(const CNTK::Dictionary & checkpoint)
         {
-            return GetNextMinibatch(minibatchSizeInSamples);
+            size_t position = checkpoint[L"position"].Value<size_t>();
+            if (position > mSamples)
+                throw logic_error("The checkpoint doesn't match the data");
+            mPos = position;
         }
     }
 }
\ No newline at end of file
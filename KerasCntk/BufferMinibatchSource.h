@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "CNTKLibrary.h"
 
+#include "CntkUtils.h"
 #include "Globals.h"
 #include "DataBuffer.h"
+#include "Keras.h"
 
 #pragma warning (push)
 #pragma warning (disable: 4251)
@@ -23,14 +26,20 @@ namespace keras
         {
         public:
             BufferMinibatchSource::BufferMinibatchSource(bool infinitelyRepeat = true, bool fullDataSweep = true)
-                : mPos(0), mInfinitelyRepeat(infinitelyRepeat)
+                : mPos(0), mLastBatchSize(0), mInfinitelyRepeat(infinitelyRepeat)
             {}
 
-            void Add(const TensorProto & nda, const CNTK::NDShape & inputShape, const std::wstring name = L"");
+            // With packSequences, [nsamples x timesteps x input shape] is fed as fixed length sequences
+            KERAS_API void Add(const TensorProto & nda, const CNTK::NDShape & inputShape, const std::wstring name = L"", bool packSequences = false);
 
-            const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData> & GetNextMinibatch(size_t batchSize, const CNTK::DeviceDescriptor & device = globals::device);
+            // Sparse inputs are fed as one-hot vectors from the indices in nda
+            KERAS_API void Add(const TensorProto & nda, const CNTK::Variable & input, const std::wstring name = L"");
+            KERAS_API void AddOneHot(const TensorProto & nda, size_t dimension, const std::wstring name = L"");
+            KERAS_API void AddHashed(const TensorProto & nda, size_t dimension, size_t numHashes, const std::wstring name = L"");
 
-            const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData>& GetNextMinibatch(
+            KERAS_API const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData> & GetNextMinibatch(size_t batchSize, const CNTK::DeviceDescriptor & device = globals::device);
+
+            KERAS_API const std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData>& GetNextMinibatch(
                 size_t minibatchSizeInSequences,
                 size_t minibatchSizeInSamples,
                 size_t numberOfWorkers,
@@ -46,15 +55,28 @@ namespace keras
             const std::unordered_set<CNTK::StreamInformation>& StreamInfos() { return mInfosSet; }
 
             size_t GetPos() const { return mPos; }
+
+            KERAS_API CNTK::Dictionary GetCheckpointState() const override;
+            KERAS_API void RestoreFromCheckpoint(const CNTK::Dictionary & checkpoint) override;
             size_t GetNumSamples() const { return mSamples; }
+            // The samples of the last minibatch, over all the workers
+            size_t GetLastBatchSize() const { return mLastBatchSize; }
+
+            bool HasSequences() const
+            {
+                return std::any_of(mArrays.cbegin(), mArrays.cend(), [](const NDArrayPtr & a) { return a->HasSequences(); });
+            }
 
         private:
+            void AddArray(const NDArrayPtr & a, const CNTK::NDShape & inputShape, CNTK::StorageFormat storageFormat, const std::wstring & name);
+
             std::unordered_map<CNTK::StreamInformation, CNTK::MinibatchData> mResult;
             std::unordered_set<CNTK::StreamInformation> mInfosSet;
             std::vector<CNTK::StreamInformation> mInfos;
             std::vector<NDArrayPtr> mArrays;
             std::vector<CNTK::NDShape> mInputShapes;
             size_t mPos;
+            size_t mLastBatchSize;
             size_t mSamples;
             bool mInfinitelyRepeat;
         };
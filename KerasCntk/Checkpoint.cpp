@@ -0,0 +1,130 @@
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+#include <fstream>
+#include <stdexcept>
+
+#include "Checkpoint.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        static const wchar_t * VersionKey = L"version";
+        static const wchar_t * ModelKey = L"model";
+        static const wchar_t * LearnersKey = L"learners";
+        static const wchar_t * StateKey = L"state";
+
+        static const size_t CurrentVersion = 1;
+
+        CheckpointWriter::CheckpointWriter(const wstring & path)
+            : mPath(path), mWriting(false), mStop(false)
+        {
+            mThread = thread(&CheckpointWriter::ThreadLoop, this);
+        }
+
+        CheckpointWriter::~CheckpointWriter()
+        {
+            {
+                lock_guard<mutex> lock(mMutex);
+                mStop = true;
+            }
+            mWork.notify_one();
+            mThread.join();
+        }
+
+        void CheckpointWriter::Write(Checkpoint && checkpoint)
+        {
+            lock_guard<mutex> lock(mMutex);
+            if (mError)
+                rethrow_exception(mError);
+
+            mPending.reset(new Checkpoint(move(checkpoint)));
+            mWork.notify_one();
+        }
+
+        void CheckpointWriter::Flush()
+        {
+            unique_lock<mutex> lock(mMutex);
+            mDone.wait(lock, [this] { return !mPending && !mWriting; });
+            if (mError)
+                rethrow_exception(mError);
+        }
+
+        void CheckpointWriter::ThreadLoop()
+        {
+            for (;;)
+            {
+                unique_ptr<Checkpoint> checkpoint;
+                {
+                    unique_lock<mutex> lock(mMutex);
+                    // The pending checkpoint is written before stopping
+                    mWork.wait(lock, [this] { return mStop || mPending; });
+                    if (!mPending)
+                        return;
+                    checkpoint = move(mPending);
+                    mWriting = true;
+                }
+
+                exception_ptr error;
+                try
+                {
+                    Save(*checkpoint);
+                }
+                catch (...)
+                {
+                    error = current_exception();
+                }
+
+                {
+                    lock_guard<mutex> lock(mMutex);
+                    mWriting = false;
+                    if (error)
+                        mError = error;
+                }
+                mDone.notify_all();
+            }
+        }
+
+        void CheckpointWriter::Save(const Checkpoint & checkpoint)
+        {
+            vector<cntk::DictionaryValue> learners(checkpoint.learners.cbegin(), checkpoint.learners.cend());
+
+            cntk::Dictionary dictionary;
+            dictionary[VersionKey] = CurrentVersion;
+            dictionary[ModelKey] = checkpoint.model->Serialize();
+            dictionary[LearnersKey] = learners;
+            dictionary[StateKey] = checkpoint.state;
+
+            auto tempPath = mPath + L".tmp";
+            dictionary.Save(tempPath);
+
+            // Replaces the previous checkpoint in one step, a crash leaves one or the other
+            if (!MoveFileExW(tempPath.c_str(), mPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+                throw runtime_error("Failed to write the checkpoint");
+        }
+
+        bool CheckpointWriter::Exists(const wstring & path)
+        {
+            return ifstream(path).good();
+        }
+
+        Checkpoint CheckpointWriter::Read(const wstring & path, const cntk::DeviceDescriptor & device)
+        {
+            auto dictionary = cntk::Dictionary::Load(path);
+            if (dictionary[VersionKey].Value<size_t>() > CurrentVersion)
+                throw runtime_error("The checkpoint was written by a newer version");
+
+            Checkpoint checkpoint;
+            checkpoint.model = cntk::Function::Deserialize(dictionary[ModelKey].Value<cntk::Dictionary>(), device);
+            for (const auto & learner : dictionary[LearnersKey].Value<vector<cntk::DictionaryValue>>())
+                checkpoint.learners.push_back(learner.Value<cntk::Dictionary>());
+            checkpoint.state = dictionary[StateKey].Value<cntk::Dictionary>();
+            return checkpoint;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CNTKLibrary.h"
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // A snapshot of the training: a copy of the model [its parameters], the learners' state
+        // and the position in the data and in the epochs.
+        struct Checkpoint
+        {
+            CNTK::FunctionPtr model;
+            std::vector<CNTK::Dictionary> learners;
+            CNTK::Dictionary state;
+        };
+
+        // Writes the checkpoints on a background thread so that training doesn't wait for the
+        // serialization and the disk. A checkpoint is written to a temporary file first and then
+        // renamed, the file always holds a complete checkpoint. A checkpoint waiting for a write
+        // in progress is replaced by a newer one.
+        class CheckpointWriter
+        {
+        public:
+            KERAS_API CheckpointWriter(const std::wstring & path);
+            KERAS_API ~CheckpointWriter();
+
+            KERAS_API void Write(Checkpoint && checkpoint);
+
+            // Waits for the pending checkpoint, and throws if a write failed
+            KERAS_API void Flush();
+
+            KERAS_API static bool Exists(const std::wstring & path);
+            KERAS_API static Checkpoint Read(const std::wstring & path, const CNTK::DeviceDescriptor & device);
+
+        private:
+            void Save(const Checkpoint & checkpoint);
+            void ThreadLoop();
+
+            std::wstring mPath;
+
+            std::unique_ptr<Checkpoint> mPending;
+            bool mWriting;
+            bool mStop;
+            std::exception_ptr mError;
+
+            std::mutex mMutex;
+            std::condition_variable mWork;
+            std::condition_variable mDone;
+            std::thread mThread;
+        };
+    }
+}
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "CntkUtils.h"
 
+#include <cwchar>
 #include <iostream>
-#include <fstream>
+#include <string>
+#include <vector>
 
 using namespace std;
 
@@ -11,14 +13,51 @@ namespace keras
     {
         CNTK::FunctionPtr LoadModel(const char * buffer, size_t len)
         {
-            auto tempPath = _wtmpnam(nullptr);
-            ofstream outStream(tempPath, ofstream::trunc | ofstream::binary);
-            outStream.write(buffer, len);
-            outStream.close();
-            auto result = CNTK::Function::Load(tempPath, globals::device);
-            _wunlink(tempPath);
-
-            return result;
+            return CNTK::Function::Load(buffer, len, globals::device);
+        }
+
+        void SaveModel(const CNTK::FunctionPtr & model, std::string & buffer)
+        {
+            vector<char> result;
+            model->Save(result);
+            buffer.assign(result.data(), result.size());
+        }
+
+        static const wchar_t * HASHED_INPUT_PREFIX = L"HashedFeatures";
+
+        std::wstring HashedInputName(size_t numHashes)
+        {
+            return HASHED_INPUT_PREFIX + to_wstring(numHashes);
+        }
+
+        size_t GetNumHashes(const CNTK::Variable & input)
+        {
+            const auto & name = input.Name();
+            size_t prefixLen = wcslen(HASHED_INPUT_PREFIX);
+            if (name.compare(0, prefixLen, HASHED_INPUT_PREFIX) != 0 || name.size() == prefixLen)
+                return 0;
+            return stoul(name.substr(prefixLen));
+        }
+
+        uint64_t Hash(uint64_t key, uint64_t seed)
+        {
+            // splitmix64's finalizer, a different stream per seed
+            uint64_t x = key + 0x9E3779B97F4A7C15ULL * (seed + 1);
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+            return x ^ (x >> 31);
+        }
+
+        uint64_t Hash(const char * str, size_t len, uint64_t seed)
+        {
+            // FNV-1a, then mixed with the seed
+            uint64_t h = 0xCBF29CE484222325ULL;
+            for (size_t i = 0; i < len; ++i)
+            {
+                h ^= (uint8_t)str[i];
+                h *= 0x100000001B3ULL;
+            }
+            return Hash(h, seed);
         }
     }
 }
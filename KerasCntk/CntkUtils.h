@@ -2,6 +2,7 @@
 
 #include "CNTKLibrary.h"
 
+#include "Keras.h"
 #include "Globals.h"
 #include "DataBuffer.h"
 
@@ -47,6 +48,16 @@ namespace keras
             std::vector<size_t> mUpdates;
         };
 
-        CNTK::FunctionPtr LoadModel(const char * buffer, size_t len);
+        // The models are serialized in memory, no temporary files
+        KERAS_API CNTK::FunctionPtr LoadModel(const char * buffer, size_t len);
+        KERAS_API void SaveModel(const CNTK::FunctionPtr & model, std::string & buffer);
+
+        // A hashed input keeps the number of hash functions in its name: the saved model
+        // then has everything Predict needs to hash the inputs the same way.
+        KERAS_API std::wstring HashedInputName(size_t numHashes);
+        KERAS_API size_t GetNumHashes(const CNTK::Variable & input);
+
+        KERAS_API uint64_t Hash(uint64_t key, uint64_t seed);
+        KERAS_API uint64_t Hash(const char * str, size_t len, uint64_t seed);
     }
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <stdexcept>
+#include <vector>
+
+// CNTK headers
+#include "CNTKLibrary.h"
+
+// Keras headers
+#include "Globals.h"
+#include "Keras.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    // The most groups convolved as separate slices
+    static const size_t gMaxGroupSlices = 4;
+
+    __declspec(dllexport) cntk::FunctionPtr Convolution2D(const cntk::Variable & input, size_t filters, const cntk::NDShape & kernelShape, const cntk::NDShape & strides,
+        bool samePadding, size_t groups, const cntk::ParameterInitializer & kernelInitializer, const wstring & name)
+    {
+        // TODO [ivpop] Implement Keras' logic for channels first/last
+        auto channelAxis = cntk::Axis(input.Shape().Rank() - 1);
+        size_t nchannels = input.Shape()[input.Shape().Rank() - 1];
+
+        if (groups == 0 || nchannels % groups != 0 || filters % groups != 0)
+            throw runtime_error("The channels and the filters of a grouped convolution must be divisible by the groups");
+
+        size_t groupChannels = nchannels / groups;
+        size_t groupFilters = filters / groups;
+
+        // The convolution is really slow on CPU without full sharing.
+        vector<bool> sharing = { true };
+
+        // Up to a few groups, each group only sees its own slice of the channels, so the
+        // kernels are groups times smaller and so is the number of multiply-adds.
+        if (groups <= gMaxGroupSlices)
+        {
+            vector<cntk::Variable> outputs;
+            for (size_t g = 0; g < groups; ++g)
+            {
+                cntk::Variable x = input;
+                if (groups > 1)
+                    x = cntk::Slice(input, { channelAxis }, { (int)(g * groupChannels) }, { (int)((g + 1) * groupChannels) });
+
+                auto kernel = cntk::Parameter({ kernelShape[0], kernelShape[1], groupChannels, groupFilters }, globals::dataType, kernelInitializer, globals::device);
+                outputs.push_back(cntk::Convolution(kernel, x, { strides[0], strides[1], groupChannels }, sharing, { samePadding, samePadding, false }));
+            }
+
+            if (outputs.size() == 1)
+                return cntk::Alias(outputs[0], name);
+            return cntk::Splice(outputs, channelAxis, name);
+        }
+
+        // Beyond that (e.g. depthwise) a slice and a convolution per group would make the graph
+        // as large as the channels, so this is a single dense convolution of a block diagonal
+        // kernel. The weights [rows x cols x group channels x filters] are tiled over the groups
+        // and masked, input channel c = i + g * groupChannels only feeding the filters of group g.
+        auto weights = cntk::Parameter({ kernelShape[0], kernelShape[1], groupChannels, filters }, globals::dataType, kernelInitializer, globals::device);
+
+        vector<float> mask(groups * filters, 0.0f);
+        for (size_t f = 0; f < filters; ++f)
+            mask[f / groupFilters + f * groups] = 1.0f;
+        auto maskView = cntk::MakeSharedObject<cntk::NDArrayView>(cntk::NDShape({ 1, 1, 1, groups, filters }), mask, false);
+        auto maskConstant = cntk::Constant(maskView->DeepClone(globals::device, true));
+
+        auto tiled = cntk::ElementTimes(cntk::Reshape(weights, { kernelShape[0], kernelShape[1], groupChannels, 1, filters }), maskConstant);
+        auto kernel = cntk::Reshape(tiled, { kernelShape[0], kernelShape[1], nchannels, filters });
+        return cntk::Convolution(kernel, input, { strides[0], strides[1], nchannels }, sharing, { samePadding, samePadding, false }, { 1 }, 1, 0, name);
+    }
+
+    __declspec(dllexport) cntk::FunctionPtr DepthwiseConvolution2D(const cntk::Variable & input, const cntk::NDShape & kernelShape, const cntk::NDShape & strides,
+        bool samePadding, size_t depthMultiplier, const cntk::ParameterInitializer & kernelInitializer, const wstring & name)
+    {
+        // One group per channel: the output channels are c * depthMultiplier + m, as in Keras
+        size_t nchannels = input.Shape()[input.Shape().Rank() - 1];
+        return Convolution2D(input, nchannels * depthMultiplier, kernelShape, strides, samePadding, nchannels, kernelInitializer, name);
+    }
+
+    __declspec(dllexport) cntk::FunctionPtr SeparableConvolution2D(const cntk::Variable & input, size_t filters, const cntk::NDShape & kernelShape, const cntk::NDShape & strides,
+        bool samePadding, size_t depthMultiplier, const cntk::ParameterInitializer & depthwiseInitializer, const cntk::ParameterInitializer & pointwiseInitializer,
+        const wstring & name)
+    {
+        auto depthwise = DepthwiseConvolution2D(input, kernelShape, strides, samePadding, depthMultiplier, depthwiseInitializer);
+        // The pointwise convolution mixes the channels with a 1x1 kernel
+        return Convolution2D(depthwise, filters, { 1, 1 }, { 1, 1 }, false, 1, pointwiseInitializer, name);
+    }
+}
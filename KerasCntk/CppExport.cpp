@@ -0,0 +1,430 @@
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "fmt/format.h"
+
+#include "CppExport.h"
+#include "Utils.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        static const char * PRELUDE = R"(// Generated by NativeKeras: the outputs of Predict without CNTK. Build it as a shared library,
+// e.g. cl /O2 /arch:AVX2 /LD model.cpp or g++ -O3 -march=native -shared -fPIC model.cpp
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#ifdef _WIN32
+#define KERAS_EXPORT extern "C" __declspec(dllexport)
+#else
+#define KERAS_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+)";
+
+        // The kernels' text, reindented: stringizing leaves it on a single line without the comments
+        static string FormatKernels(const string & code)
+        {
+            string result;
+            size_t indent = 0;
+            size_t parens = 0;
+            bool lineStart = true;
+
+            auto newLine = [&]()
+            {
+                while (!result.empty() && result.back() == ' ')
+                    result.pop_back();
+                result += '\n';
+                lineStart = true;
+            };
+
+            for (size_t i = 0; i < code.size(); ++i)
+            {
+                char c = code[i];
+                if (lineStart && c == ' ')
+                    continue;
+
+                if (c == '{' && i + 1 < code.size() && code[i + 1] == '}')
+                {
+                    // An empty initializer
+                    if (lineStart)
+                        result.append(indent * 4, ' ');
+                    result += "{}";
+                    lineStart = false;
+                    ++i;
+                    continue;
+                }
+
+                if (c == '{' || c == '}')
+                {
+                    if (!lineStart)
+                        newLine();
+                    if (c == '}')
+                    {
+                        --indent;
+                        while (result.size() > 1 && result[result.size() - 2] == '\n')
+                            result.pop_back();
+                    }
+                    result.append(indent * 4, ' ');
+                    result += c;
+                    newLine();
+                    if (c == '{')
+                        ++indent;
+                    else if (indent == 1)
+                        result += '\n';
+                    continue;
+                }
+
+                if (lineStart)
+                {
+                    result.append(indent * 4, ' ');
+                    lineStart = false;
+                }
+
+                result += c;
+                if (c == '(')
+                    ++parens;
+                else if (c == ')')
+                    --parens;
+                else if (c == ';' && parens == 0)
+                    newLine();
+            }
+            return result;
+        }
+
+#define KERAS_KERNELS(...) static const string KERNELS = FormatKernels(#__VA_ARGS__);
+#include "CppExportKernels.h"
+#undef KERAS_KERNELS
+
+        class CppExporter
+        {
+        public:
+            CppExporter(const cntk::FunctionPtr & model, const string & prefix)
+                : mModel(model), mPrefix(prefix), mWorkspace(0), mNextId(0)
+            {
+                auto arguments = model->Arguments();
+                if (arguments.size() != 1)
+                    throw runtime_error("Only the models with a single input can be exported");
+                mInput = arguments[0];
+                if (mInput.IsSparse() || mInput.GetDataType() != cntk::DataType::Float || mInput.DynamicAxes().size() > 1)
+                    throw runtime_error("The exported model's input must be dense, single precision samples");
+            }
+
+            string Export()
+            {
+                auto output = mModel->Output();
+                if (output.GetDataType() != cntk::DataType::Float)
+                    throw runtime_error("The exported model's output must be single precision");
+
+                size_t inputSize = mInput.Shape().TotalSize();
+                size_t outputSize = output.Shape().TotalSize();
+
+                // Predict's rows are row major, the kernels' tensors column major like CNTK's
+                const auto & inputShape = mInput.Shape();
+                if (inputShape.Rank() > 1)
+                {
+                    mWeights << "static const size_t input_shape[] = {";
+                    for (size_t i = 0; i < inputShape.Rank(); ++i)
+                        mWeights << (i == 0 ? " " : ", ") << inputShape[i];
+                    mWeights << " };\n\n";
+
+                    mTensors[mInput] = Allocate(inputSize);
+                    Emit(fmt::format("Transpose(input_shape, x, {});", mTensors[mInput]));
+                }
+                else
+                {
+                    mTensors[mInput] = "x";
+                }
+                auto result = Tensor(output);
+
+                ostringstream source;
+                source << PRELUDE << "\n" << KERNELS << "using namespace keras_kernels;\n\n" << mWeights.str();
+                source << fmt::format("\nKERAS_EXPORT size_t {}_input_size() {{ return {}; }}\n", mPrefix, inputSize);
+                source << fmt::format("KERAS_EXPORT size_t {}_output_size() {{ return {}; }}\n\n", mPrefix, outputSize);
+                source << fmt::format("KERAS_EXPORT void {}_predict(const float * in, size_t n, float * out)\n{{\n", mPrefix);
+                source << fmt::format("    std::vector<float> workspace({});\n", max<size_t>(mWorkspace, 1));
+                source << "    float * t = workspace.data();\n";
+                source << "    for (size_t s = 0; s < n; ++s)\n    {\n";
+                source << fmt::format("        const float * x = in + s * {};\n", inputSize);
+                source << mCode.str();
+                source << fmt::format("        std::copy({0}, {0} + {1}, out + s * {1});\n", result, outputSize);
+                source << "    }\n}\n";
+                return source.str();
+            }
+
+        private:
+            // The expression of the variable's values for one sample, its code emitted first
+            string Tensor(const cntk::Variable & variable)
+            {
+                auto it = mTensors.find(variable);
+                if (it != mTensors.end())
+                    return it->second;
+
+                string result;
+                if (variable.IsParameter() || variable.IsConstant())
+                    result = Weights(variable);
+                else if (variable.IsOutput())
+                    result = Compile(variable);
+                else
+                    throw runtime_error("The variable [" + utils::ToString(variable.AsString()) + "] can't be exported");
+
+                mTensors[variable] = result;
+                return result;
+            }
+
+            string Weights(const cntk::Variable & variable)
+            {
+                if (variable.GetDataType() != cntk::DataType::Float)
+                    throw runtime_error("The exported model's weights must be single precision");
+
+                auto value = variable.IsParameter() ? cntk::Parameter(variable).Value() : cntk::Constant(variable).Value();
+                value = value->DeepClone(cntk::DeviceDescriptor::CPUDevice(), true);
+                const float * data = value->DataBuffer<float>();
+                size_t size = variable.Shape().TotalSize();
+
+                string name = fmt::format("w{}", mNextId++);
+                mWeights << fmt::format("alignas(32) static const float {}[{}] =\n{{", name, size);
+                for (size_t i = 0; i < size; ++i)
+                    mWeights << (i % 8 == 0 ? "\n    " : " ") << fmt::format("{:.9g}f,", data[i]);
+                mWeights << "\n};\n\n";
+                return name;
+            }
+
+            string Allocate(size_t size)
+            {
+                string result = fmt::format("(t + {})", mWorkspace);
+                mWorkspace += size;
+                return result;
+            }
+
+            void Emit(const string & line)
+            {
+                mCode << "        " << line << "\n";
+            }
+
+            string Compile(const cntk::Variable & variable)
+            {
+                auto function = variable.Owner();
+                if (function->Outputs().size() != 1)
+                    throw runtime_error("Only the single output ops can be exported");
+
+                auto op = utils::ToString(function->OpName());
+                auto inputs = function->Inputs();
+                const auto & shape = variable.Shape();
+                size_t size = shape.TotalSize();
+
+                // Same values, a different shape or a no-op at inference
+                if (op == "NoOp" || op == "Reshape" || op == "Dropout" || op == "Combine")
+                    return Tensor(inputs[0]);
+
+                if (op == "Times")
+                    return CompileTimes(inputs, shape);
+                if (op == "Convolution")
+                    return CompileConvolution(function, inputs, shape);
+                if (op == "Pooling")
+                    return CompilePooling(function, inputs, shape);
+
+                if (op == "Plus" || op == "Minus" || op == "ElementTimes")
+                {
+                    auto a = Broadcast(inputs[0], shape);
+                    auto b = Broadcast(inputs[1], shape);
+                    auto symbol = op == "Plus" ? "+" : op == "Minus" ? "-" : "*";
+                    auto y = Allocate(size);
+                    Emit(fmt::format("for (size_t i = 0; i < {}; ++i) {}[i] = {} {} {};", size, y, a, symbol, b));
+                    return y;
+                }
+
+                if (op == "Clip")
+                {
+                    auto x = Tensor(inputs[0]);
+                    auto low = Broadcast(inputs[1], shape);
+                    auto high = Broadcast(inputs[2], shape);
+                    auto y = Allocate(size);
+                    Emit(fmt::format("for (size_t i = 0; i < {}; ++i) {}[i] = std::min(std::max({}[i], {}), {});", size, y, x, low, high));
+                    return y;
+                }
+
+                if (op == "Softmax")
+                {
+                    if (inputs[0].Shape().Rank() != 1)
+                        throw runtime_error("Only the softmax of vectors can be exported");
+                    auto x = Tensor(inputs[0]);
+                    auto y = Allocate(size);
+                    Emit(fmt::format("Softmax<{}>({}, {});", size, x, y));
+                    return y;
+                }
+
+                static const unordered_map<string, string> elementwise =
+                {
+                    { "ReLU", "std::max(v, 0.0f)" },
+                    { "Sigmoid", "1.0f / (1.0f + std::exp(-v))" },
+                    { "StableSigmoid", "1.0f / (1.0f + std::exp(-v))" },
+                    { "Tanh", "std::tanh(v)" },
+                    { "ELU", "v > 0.0f ? v : std::exp(v) - 1.0f" },
+                    { "Exp", "std::exp(v)" },
+                    { "Negate", "-v" },
+                };
+                auto it = elementwise.find(op);
+                if (it != elementwise.end())
+                {
+                    auto x = Tensor(inputs[0]);
+                    auto y = Allocate(size);
+                    Emit(fmt::format("for (size_t i = 0; i < {}; ++i) {{ float v = {}[i]; {}[i] = {}; }}", size, x, y, it->second));
+                    return y;
+                }
+
+                throw runtime_error("'" + op + "' can't be exported [yet].");
+            }
+
+            // The operand's value at the output's element i: the same shape, a scalar or a vector along
+            // the last axis [the biases]
+            string Broadcast(const cntk::Variable & operand, const cntk::NDShape & shape)
+            {
+                auto x = Tensor(operand);
+                const auto & operandShape = operand.Shape();
+                if (operandShape.TotalSize() == 1)
+                    return x + "[0]";
+                if (operandShape.TotalSize() == shape.TotalSize())
+                    return x + "[i]";
+
+                size_t last = shape.Rank() - 1;
+                if (operandShape.Rank() == shape.Rank() && operandShape[last] == shape[last] && operandShape.TotalSize() == shape[last])
+                    return fmt::format("{}[i / {}]", x, shape.TotalSize() / shape[last]);
+                if (operandShape.Rank() == 1 && shape.Rank() == 1 && operandShape[0] == shape[0])
+                    return x + "[i]";
+
+                throw runtime_error("The broadcast of [" + utils::ToString(operandShape.AsString()) + "] to [" + utils::ToString(shape.AsString()) + "] can't be exported");
+            }
+
+            string CompileTimes(const vector<cntk::Variable> & inputs, const cntk::NDShape & shape)
+            {
+                const auto & weightsShape = inputs[0].Shape();
+                const auto & inputShape = inputs[1].Shape();
+                if (weightsShape.Rank() != 2 || inputShape.Rank() != 1 || shape.Rank() != 1)
+                    throw runtime_error("Only the dense layers' products can be exported");
+
+                auto w = Tensor(inputs[0]);
+                auto x = Tensor(inputs[1]);
+                auto y = Allocate(shape.TotalSize());
+                Emit(fmt::format("Dense<{}, {}>({}, {}, {});", weightsShape[0], weightsShape[1], w, x, y));
+                return y;
+            }
+
+            static bool AutoPadding(const cntk::Dictionary & attributes, size_t axis)
+            {
+                if (!attributes.Contains(L"autoPadding"))
+                    return false;
+                const auto & values = attributes[L"autoPadding"].Value<vector<cntk::DictionaryValue>>();
+                if (values.empty())
+                    return false;
+                return values[min(axis, values.size() - 1)].Value<bool>();
+            }
+
+            static size_t Dimension(const cntk::NDShape & shape, size_t axis)
+            {
+                return axis < shape.Rank() ? shape[axis] : 1;
+            }
+
+            // The padding before the first element: none, or the 'same' padding of stride one, odd windows
+            static size_t Padding(const cntk::Dictionary & attributes, size_t axis, size_t window, size_t stride)
+            {
+                if (attributes.Contains(L"lowerPad"))
+                {
+                    const auto & lowerPad = attributes[L"lowerPad"].Value<cntk::NDShape>();
+                    const auto & upperPad = attributes[L"upperPad"].Value<cntk::NDShape>();
+                    for (size_t i = 0; i < lowerPad.Rank(); ++i)
+                        if (lowerPad[i] != 0 || (i < upperPad.Rank() && upperPad[i] != 0))
+                            throw runtime_error("Explicit padding can't be exported");
+                }
+
+                if (!AutoPadding(attributes, axis))
+                    return 0;
+                if (stride != 1 || window % 2 == 0)
+                    throw runtime_error("'same' padding is only exported with a stride of one and odd windows");
+                return (window - 1) / 2;
+            }
+
+            string CompileConvolution(const cntk::FunctionPtr & function, const vector<cntk::Variable> & inputs, const cntk::NDShape & shape)
+            {
+                auto attributes = function->Attributes();
+                const auto & kernelShape = inputs[0].Shape();
+                const auto & inputShape = inputs[1].Shape();
+                if (kernelShape.Rank() != 4 || inputShape.Rank() != 3 || shape.Rank() != 3)
+                    throw runtime_error("Only the 2D convolutions can be exported");
+                if (attributes.Contains(L"transpose") && attributes[L"transpose"].Value<bool>())
+                    throw runtime_error("Transposed convolutions can't be exported");
+                if (attributes.Contains(L"dilation"))
+                {
+                    const auto & dilation = attributes[L"dilation"].Value<cntk::NDShape>();
+                    for (size_t i = 0; i < dilation.Rank(); ++i)
+                        if (dilation[i] != 1)
+                            throw runtime_error("Dilated convolutions can't be exported");
+                }
+
+                const auto & strides = attributes[L"strides"].Value<cntk::NDShape>();
+                size_t s0 = Dimension(strides, 0);
+                size_t s1 = Dimension(strides, 1);
+                size_t p0 = Padding(attributes, 0, kernelShape[0], s0);
+                size_t p1 = Padding(attributes, 1, kernelShape[1], s1);
+
+                auto w = Tensor(inputs[0]);
+                auto x = Tensor(inputs[1]);
+                auto y = Allocate(shape.TotalSize());
+                Emit(fmt::format("Conv2D<{}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}>({}, {}, {});",
+                    inputShape[0], inputShape[1], inputShape[2], kernelShape[0], kernelShape[1], kernelShape[3], s0, s1, p0, p1, shape[0], shape[1], w, x, y));
+                return y;
+            }
+
+            string CompilePooling(const cntk::FunctionPtr & function, const vector<cntk::Variable> & inputs, const cntk::NDShape & shape)
+            {
+                auto attributes = function->Attributes();
+                const auto & inputShape = inputs[0].Shape();
+                const auto & window = attributes[L"poolingWindowShape"].Value<cntk::NDShape>();
+                const auto & strides = attributes[L"strides"].Value<cntk::NDShape>();
+                if (inputShape.Rank() > 3 || Dimension(window, 2) != 1 || Dimension(strides, 2) != 1)
+                    throw runtime_error("Only the 1D and 2D poolings can be exported");
+                if (attributes.Contains(L"ceilOutDim") && attributes[L"ceilOutDim"].Value<bool>())
+                    throw runtime_error("Poolings with ceilOutDim can't be exported");
+
+                bool max = (cntk::PoolingType)attributes[L"poolingType"].Value<size_t>() == cntk::PoolingType::Max;
+                bool includePad = attributes.Contains(L"includePad") && attributes[L"includePad"].Value<bool>();
+
+                size_t w0 = Dimension(window, 0), w1 = Dimension(window, 1);
+                size_t s0 = Dimension(strides, 0), s1 = Dimension(strides, 1);
+                size_t p0 = Padding(attributes, 0, w0, s0);
+                size_t p1 = Padding(attributes, 1, w1, s1);
+
+                auto x = Tensor(inputs[0]);
+                auto y = Allocate(shape.TotalSize());
+                Emit(fmt::format("Pool2D<{}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}>({}, {});",
+                    max, includePad, Dimension(inputShape, 0), Dimension(inputShape, 1), Dimension(inputShape, 2), w0, w1, s0, s1, p0, p1,
+                    Dimension(shape, 0), Dimension(shape, 1), x, y));
+                return y;
+            }
+
+            cntk::FunctionPtr mModel;
+            string mPrefix;
+            cntk::Variable mInput;
+
+            unordered_map<cntk::Variable, string> mTensors;
+            ostringstream mWeights;
+            ostringstream mCode;
+            size_t mWorkspace;
+            size_t mNextId;
+        };
+
+        string ExportCpp(const cntk::FunctionPtr & model, const string & prefix)
+        {
+            return CppExporter(model, prefix).Export();
+        }
+    }
+}
\ No newline at end of file
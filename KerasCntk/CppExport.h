@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+
+#include "CNTKLibrary.h"
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // Ahead-of-time compilation of a Dense/Conv2D/pooling model into self-contained C++: the shapes
+        // are template arguments, the weights are embedded, and the inner loops are contiguous so the
+        // compiler vectorizes them. The source exports
+        //   void <prefix>_predict(const float * in, size_t n, float * out)
+        //   size_t <prefix>_input_size(), <prefix>_output_size()
+        // where in and out are n samples in the layout of Predict's input and output rows. Throws for
+        // the ops it can't compile, e.g. the recurrent layers and the embeddings.
+        KERAS_API std::string ExportCpp(const CNTK::FunctionPtr & model, const std::string & prefix);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+// The kernels of the sources generated by ExportCpp. CppExport.cpp defines KERAS_KERNELS to embed
+// their text in the generated source, the unit tests include them as they are. The shapes are
+// template arguments and the inner loops contiguous, so the compiler unrolls and vectorizes them.
+// Nothing in the kernels may need the preprocessor: the generated source has the #includes.
+#ifndef KERAS_KERNELS
+#define KERAS_KERNELS(...) __VA_ARGS__
+#endif
+
+KERAS_KERNELS(
+namespace keras_kernels
+{
+    // A row major sample [the last axis moves the fastest, Predict's rows] in CNTK's column major order
+    template <size_t R>
+    inline void Transpose(const size_t (&shape)[R], const float * x, float * y)
+    {
+        size_t strides[R];
+        size_t size = 1;
+        for (size_t j = 0; j < R; ++j)
+        {
+            strides[j] = size;
+            size *= shape[j];
+        }
+
+        size_t index[R] = {};
+        size_t offset = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            y[offset] = x[i];
+            for (size_t j = R; j-- > 0;)
+            {
+                offset += strides[j];
+                if (++index[j] < shape[j])
+                    break;
+                offset -= strides[j] * shape[j];
+                index[j] = 0;
+            }
+        }
+    }
+
+    // y = w x, w is [M x K] in column major order
+    template <size_t M, size_t K>
+    inline void Dense(const float * w, const float * x, float * y)
+    {
+        std::fill(y, y + M, 0.0f);
+        for (size_t k = 0; k < K; ++k)
+        {
+            const float xk = x[k];
+            const float * wk = w + k * M;
+            for (size_t m = 0; m < M; ++m)
+                y[m] += wk[m] * xk;
+        }
+    }
+
+    // The first output index that reads the input at offset - P >= 0
+    template <size_t S, size_t P>
+    inline size_t First(size_t offset)
+    {
+        return offset >= P ? 0 : (P - offset + S - 1) / S;
+    }
+
+    // One past the last output index that reads the input at i * S + offset - P < D
+    template <size_t S, size_t P, size_t D, size_t O>
+    inline size_t Last(size_t offset)
+    {
+        return D + P <= offset ? 0 : std::min(O, (D + P - offset + S - 1) / S);
+    }
+
+    // x is [D0 x D1 x C], w is [K0 x K1 x C x F] and y is [O0 x O1 x F], all column major
+    template <size_t D0, size_t D1, size_t C, size_t K0, size_t K1, size_t F, size_t S0, size_t S1, size_t P0, size_t P1, size_t O0, size_t O1>
+    inline void Conv2D(const float * w, const float * x, float * y)
+    {
+        std::fill(y, y + O0 * O1 * F, 0.0f);
+        for (size_t f = 0; f < F; ++f)
+            for (size_t c = 0; c < C; ++c)
+                for (size_t b = 0; b < K1; ++b)
+                    for (size_t a = 0; a < K0; ++a)
+                    {
+                        const float wv = w[a + K0 * (b + K1 * (c + C * f))];
+                        const size_t i0 = First<S0, P0>(a), i1 = Last<S0, P0, D0, O0>(a);
+                        for (size_t j = First<S1, P1>(b); j < Last<S1, P1, D1, O1>(b); ++j)
+                        {
+                            const float * xr = x + D0 * (j * S1 + b - P1 + D1 * c);
+                            float * yr = y + O0 * (j + O1 * f);
+                            for (size_t i = i0; i < i1; ++i)
+                                yr[i] += wv * xr[i * S0 + a - P0];
+                        }
+                    }
+    }
+
+    // x is [D0 x D1 x C] and y is [O0 x O1 x C], the padding is left out of the max and, unless
+    // IncludePad, of the average
+    template <bool Max, bool IncludePad, size_t D0, size_t D1, size_t C, size_t W0, size_t W1, size_t S0, size_t S1, size_t P0, size_t P1, size_t O0, size_t O1>
+    inline void Pool2D(const float * x, float * y)
+    {
+        for (size_t c = 0; c < C; ++c)
+            for (size_t j = 0; j < O1; ++j)
+                for (size_t i = 0; i < O0; ++i)
+                {
+                    float result = Max ? -std::numeric_limits<float>::infinity() : 0.0f;
+                    size_t count = 0;
+                    for (size_t b = 0; b < W1; ++b)
+                    {
+                        size_t v = j * S1 + b;
+                        if (v < P1 || v - P1 >= D1)
+                            continue;
+                        for (size_t a = 0; a < W0; ++a)
+                        {
+                            size_t u = i * S0 + a;
+                            if (u < P0 || u - P0 >= D0)
+                                continue;
+                            float value = x[u - P0 + D0 * (v - P1 + D1 * c)];
+                            result = Max ? std::max(result, value) : result + value;
+                            ++count;
+                        }
+                    }
+                    y[i + O0 * (j + O1 * c)] = Max ? result : result / (IncludePad ? W0 * W1 : count);
+                }
+    }
+
+    template <size_t N>
+    inline void Softmax(const float * x, float * y)
+    {
+        float max = *std::max_element(x, x + N);
+        float sum = 0.0f;
+        for (size_t i = 0; i < N; ++i)
+        {
+            y[i] = std::exp(x[i] - max);
+            sum += y[i];
+        }
+        for (size_t i = 0; i < N; ++i)
+            y[i] /= sum;
+    }
+}
+)
\ No newline at end of file
@@ -22,7 +22,9 @@ namespace keras
               mDataTypeSize(sizeof(float)),
               mTransform(true),
               mPos(0),
-              mFloatTensor(nullptr)
+              mFloatTensor(nullptr),
+              mDimension(0),
+              mHotsPerStep(1)
         {
             mFloatTensor = CreateFloatTensor(shape, data);
         }
@@ -33,11 +35,69 @@ namespace keras
               mName(name),
               mTransform(true),
               mPos(0),
-              mFloatTensor(nullptr)
+              mFloatTensor(nullptr),
+              mDimension(0),
+              mHotsPerStep(1)
         {
             mDataTypeSize = dataType == CNTK::DataType::Double ? sizeof(double) : sizeof(float);
         }
 
+        DataBuffer::DataBuffer(size_t dimension, std::vector<size_t> && indices, const std::wstring & name, size_t hotsPerStep)
+            : mShape({ indices.size() / hotsPerStep }),
+              mDataType(globals::dataType),
+              mName(name),
+              mDataTypeSize(sizeof(float)),
+              mTransform(false),
+              mPos(0),
+              mFloatTensor(nullptr),
+              mDimension(dimension),
+              mHotsPerStep(hotsPerStep),
+              mIndices(move(indices))
+        {
+        }
+
+        CNTK::ValuePtr DataBuffer::GetMultiHotBatch(size_t start, size_t end)
+        {
+            // Sparse CSC sequences, one column per step. Colliding indices add up.
+            vector<CNTK::NDArrayViewPtr> sequences;
+            vector<int> colStarts;
+            vector<int> rowIndices;
+            vector<float> values;
+            vector<size_t> hots(mHotsPerStep);
+
+            for (size_t i = start; i < end; ++i)
+            {
+                size_t steps = mSequenceOffsets[i + 1] - mSequenceOffsets[i];
+                colStarts.assign(1, 0);
+                rowIndices.clear();
+                values.clear();
+
+                for (size_t step = mSequenceOffsets[i]; step < mSequenceOffsets[i + 1]; ++step)
+                {
+                    auto begin = mIndices.cbegin() + step * mHotsPerStep;
+                    hots.assign(begin, begin + mHotsPerStep);
+                    sort(hots.begin(), hots.end());
+
+                    for (size_t j = 0; j < hots.size(); ++j)
+                    {
+                        if (j > 0 && hots[j] == hots[j - 1])
+                        {
+                            values.back() += 1.0f;
+                            continue;
+                        }
+                        rowIndices.push_back((int)hots[j]);
+                        values.push_back(1.0f);
+                    }
+                    colStarts.push_back((int)rowIndices.size());
+                }
+
+                sequences.push_back(CNTK::MakeSharedObject<CNTK::NDArrayView>(CNTK::NDShape({ mDimension, steps }),
+                    colStarts.data(), rowIndices.data(), values.data(), values.size(), CNTK::DeviceDescriptor::CPUDevice(), true));
+            }
+
+            return CNTK::Value::Create(CNTK::NDShape({ mDimension }), sequences, vector<bool>(sequences.size(), true), globals::device, false);
+        }
+
         void DataBuffer::TransformIfNecessary(const CNTK::NDShape & shape)
         {
             if (!mTransform)
@@ -76,16 +136,60 @@ namespace keras
             mTransform = false;
         }
 
+        void DataBuffer::SetSequenceLengths(const std::vector<size_t> & lengths)
+        {
+            mSequenceOffsets.resize(lengths.size() + 1);
+            mSequenceOffsets[0] = 0;
+            for (size_t i = 0; i < lengths.size(); ++i)
+            {
+                if (lengths[i] == 0)
+                    throw runtime_error("Empty sequences are not supported.");
+                mSequenceOffsets[i + 1] = mSequenceOffsets[i] + lengths[i];
+            }
+
+            if (mSequenceOffsets.back() != mShape[0])
+                throw runtime_error(fmt::format("The sequence lengths add up to {:d} steps, the data has {:d}", mSequenceOffsets.back(), mShape[0]));
+        }
+
         CNTK::ValuePtr DataBuffer::GetBatch(size_t start, size_t end, const CNTK::NDShape & inputShape)
         {
             if(mDataType != CNTK::DataType::Float)
                 throw runtime_error("Not implemented.");
 
-            if (end > mShape[0])
-                throw runtime_error(fmt::format("end [== {:d}] is out of range [max == {:d}]", end, mShape[0]));
+            if (end > NumSamples())
+                throw runtime_error(fmt::format("end [== {:d}] is out of range [max == {:d}]", end, NumSamples()));
+
+            if (mDimension > 0 && mHotsPerStep > 1)
+                return GetMultiHotBatch(start, end);
+
+            if (mDimension > 0)
+            {
+                // Sparse one-hot sequences, the dense vectors are never materialized
+                mIndexSequences.resize(end - start);
+                for (size_t i = start; i < end; ++i)
+                    mIndexSequences[i - start].assign(mIndices.cbegin() + mSequenceOffsets[i], mIndices.cbegin() + mSequenceOffsets[i + 1]);
+
+                return CNTK::Value::CreateBatchOfSequences<float>(mDimension, mIndexSequences, globals::device, false);
+            }
 
             TransformIfNecessary(inputShape);
 
+            if (HasSequences())
+            {
+                // Each sequence is copied with its own length, no padding to the longest one
+                size_t sampleSize = inputShape.TotalSize();
+                const float * data = mFloatTensor->storage->data + mFloatTensor->storageOffset;
+
+                mSequences.resize(end - start);
+                for (size_t i = start; i < end; ++i)
+                {
+                    const float * begin = data + mSequenceOffsets[i] * sampleSize;
+                    mSequences[i - start].assign(begin, begin + (mSequenceOffsets[i + 1] - mSequenceOffsets[i]) * sampleSize);
+                }
+
+                return CNTK::Value::CreateBatchOfSequences(inputShape, mSequences, globals::device, false);
+            }
+
             THFloatTensor * view = THFloatTensor_newNarrow(mFloatTensor, 0, (long)start, (long)(end-start));
             view = THFloatTensor_newContiguous(view);
             size_t batchSize = 1;
@@ -26,6 +26,9 @@ namespace keras
         public:
             KERAS_API DataBuffer(const CNTK::NDShape & shape, const float * data, const std::wstring & name = L"");
             KERAS_API DataBuffer(CNTK::DataType dataType, const CNTK::NDShape & shape, const std::wstring & name = L"");
+            // One-hot vectors of the given dimension, the data are the indices of the hot elements.
+            // With several hot elements per step [hashed inputs] their indices are consecutive.
+            KERAS_API DataBuffer(size_t dimension, std::vector<size_t> && indices, const std::wstring & name = L"", size_t hotsPerStep = 1);
 
             ~DataBuffer()
             {
@@ -33,19 +36,33 @@ namespace keras
                     THFloatTensor_free(mFloatTensor);
             }
 
+            // Packed sequences: the first axis holds the steps of all the sequences, back to back
+            KERAS_API void SetSequenceLengths(const std::vector<size_t> & lengths);
+
             KERAS_API CNTK::ValuePtr GetBatch(size_t start, size_t end, const CNTK::NDShape & inputShape);
 
             const CNTK::NDShape & Shape() const { return mShape; }
             const CNTK::DataType DataType() const { return mDataType; }
 
+            bool HasSequences() const { return !mSequenceOffsets.empty(); }
+
+            // Samples are sequences for packed sequences
+            size_t NumSamples() const { return HasSequences() ? mSequenceOffsets.size() - 1 : mShape[0]; }
+
+            size_t NumSteps(size_t start, size_t end) const
+            {
+                return HasSequences() ? mSequenceOffsets[end] - mSequenceOffsets[start] : end - start;
+            }
+
             size_t CalcSampleSize(size_t start, size_t batchSize) const
             {
-                size_t left = mShape[0] - start;
+                size_t left = NumSamples() - start;
                 return std::min(batchSize, left);
             }
 
         private:
             void TransformIfNecessary(const CNTK::NDShape & shape);
+            CNTK::ValuePtr GetMultiHotBatch(size_t start, size_t end);
 
             bool mTransform;
 
@@ -56,6 +73,13 @@ namespace keras
             std::vector<uint8_t> mBatch;
 
             std::vector<float> mFloats;
+            std::vector<std::vector<float>> mSequences;
+            std::vector<size_t> mSequenceOffsets;
+
+            size_t mDimension;
+            size_t mHotsPerStep;
+            std::vector<size_t> mIndices;
+            std::vector<std::vector<size_t>> mIndexSequences;
             std::vector<double> mDoubles;
 
             THFloatTensor * mFloatTensor;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include "CNTKLibrary.h"
@@ -15,6 +16,28 @@
 namespace keras
 {
     KERAS_API CNTK::FunctionPtr CategoricalCrossEntropy(const CNTK::Variable & prediction, const CNTK::Variable & targets, const std::wstring & name = L"");
+    KERAS_API CNTK::FunctionPtr SoftmaxCrossEntropy(const CNTK::Variable & prediction, const CNTK::Variable & targets, const std::wstring & name = L"");
     KERAS_API CNTK::FunctionPtr CategoricalAccuracy(const CNTK::Variable & prediction, const CNTK::Variable & targets, const CNTK::Axis & axis, const std::wstring & name = L"");
     KERAS_API CNTK::FunctionPtr Embedding(const CNTK::Variable & prediction, size_t embeddingDim, const CNTK::Axis & axis, const std::wstring & name = L"");
+
+    typedef std::function<CNTK::FunctionPtr(const CNTK::Variable &)> UnaryOp;
+
+    // Recurrent layers over the sequence axis of the input. Without returnSequences only
+    // the last step [the first one with goBackwards] is returned.
+    KERAS_API CNTK::FunctionPtr LSTM(const CNTK::Variable & input, size_t units, const UnaryOp & activation, const UnaryOp & recurrentActivation,
+        const CNTK::ParameterInitializer & kernelInitializer, const CNTK::ParameterInitializer & recurrentInitializer,
+        bool useBias = true, bool unitForgetBias = true, bool returnSequences = false, bool goBackwards = false, const std::wstring & name = L"");
+    KERAS_API CNTK::FunctionPtr GRU(const CNTK::Variable & input, size_t units, const UnaryOp & activation, const UnaryOp & recurrentActivation,
+        const CNTK::ParameterInitializer & kernelInitializer, const CNTK::ParameterInitializer & recurrentInitializer,
+        bool useBias = true, bool returnSequences = false, bool goBackwards = false, const std::wstring & name = L"");
+
+    // 2D convolutions of [rows x cols x channels] inputs. With groups > 1 the channels are split in
+    // groups convolved separately, the depthwise convolution has a group per channel.
+    KERAS_API CNTK::FunctionPtr Convolution2D(const CNTK::Variable & input, size_t filters, const CNTK::NDShape & kernelShape, const CNTK::NDShape & strides,
+        bool samePadding, size_t groups, const CNTK::ParameterInitializer & kernelInitializer, const std::wstring & name = L"");
+    KERAS_API CNTK::FunctionPtr DepthwiseConvolution2D(const CNTK::Variable & input, const CNTK::NDShape & kernelShape, const CNTK::NDShape & strides,
+        bool samePadding, size_t depthMultiplier, const CNTK::ParameterInitializer & kernelInitializer, const std::wstring & name = L"");
+    KERAS_API CNTK::FunctionPtr SeparableConvolution2D(const CNTK::Variable & input, size_t filters, const CNTK::NDShape & kernelShape, const CNTK::NDShape & strides,
+        bool samePadding, size_t depthMultiplier, const CNTK::ParameterInitializer & depthwiseInitializer, const CNTK::ParameterInitializer & pointwiseInitializer,
+        const std::wstring & name = L"");
 }
@@ -5,4 +5,52 @@
 extern "C" __declspec(dllimport) void KerasFitModel(
     const char * inData, unsigned inLen,
     char ** outData, unsigned * outLen,
-    uint64_t * outPtr);
\ No newline at end of file
+    uint64_t * outPtr);
+
+extern "C" __declspec(dllimport) void KerasSessionCreate(
+    const char * inData, unsigned inLen,
+    uint64_t * session,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr);
+
+extern "C" __declspec(dllimport) void KerasSessionTrainOnBatch(
+    uint64_t session,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr);
+
+extern "C" __declspec(dllimport) void KerasSessionPredictOnBatch(
+    uint64_t session,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr);
+
+extern "C" __declspec(dllimport) void KerasSessionSave(
+    uint64_t session,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr);
+
+extern "C" __declspec(dllimport) void KerasSessionDestroy(uint64_t session);
+
+extern "C" __declspec(dllimport) void KerasPredictorCreate(
+    const char * model, unsigned modelLen,
+    uint64_t * predictor,
+    unsigned * inputSize, unsigned * outputSize,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr);
+
+extern "C" __declspec(dllimport) void KerasPredict(
+    uint64_t predictor,
+    const float * in, unsigned n,
+    float * out,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr);
+
+extern "C" __declspec(dllimport) void KerasPredictorDestroy(uint64_t predictor);
\ No newline at end of file
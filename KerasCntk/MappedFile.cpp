@@ -0,0 +1,57 @@
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+#include <stdexcept>
+
+#include "MappedFile.h"
+#include "Utils.h"
+
+using namespace std;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        MappedFile::MappedFile(const wstring & path)
+            : mFile(INVALID_HANDLE_VALUE), mMapping(nullptr), mData(nullptr), mSize(0)
+        {
+            mFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (mFile == INVALID_HANDLE_VALUE)
+                throw runtime_error("Can't open [" + utils::ToString(path) + "]");
+
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(mFile, &size))
+            {
+                CloseHandle(mFile);
+                throw runtime_error("Can't read the size of [" + utils::ToString(path) + "]");
+            }
+            mSize = (size_t)size.QuadPart;
+
+            // Empty files can't be mapped
+            if (mSize == 0)
+                return;
+
+            mMapping = CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mMapping != nullptr)
+                mData = (const char *)MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+
+            if (mData == nullptr)
+            {
+                if (mMapping != nullptr)
+                    CloseHandle(mMapping);
+                CloseHandle(mFile);
+                throw runtime_error("Can't map [" + utils::ToString(path) + "]");
+            }
+        }
+
+        MappedFile::~MappedFile()
+        {
+            if (mData != nullptr)
+                UnmapViewOfFile(mData);
+            if (mMapping != nullptr)
+                CloseHandle(mMapping);
+            CloseHandle(mFile);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // A read-only mapping of a whole file. The pages are the file cache's, shared by all the
+        // processes mapping the same file, and read in on first touch.
+        class MappedFile
+        {
+        public:
+            KERAS_API explicit MappedFile(const std::wstring & path);
+            KERAS_API ~MappedFile();
+
+            MappedFile(const MappedFile &) = delete;
+            MappedFile & operator=(const MappedFile &) = delete;
+
+            const char * Data() const { return mData; }
+            size_t Size() const { return mSize; }
+
+        private:
+            void * mFile;
+            void * mMapping;
+            const char * mData;
+            size_t mSize;
+        };
+    }
+}
\ No newline at end of file
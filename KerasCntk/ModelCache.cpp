@@ -0,0 +1,295 @@
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <bcrypt.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "ModelCache.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        ModelCache::Lease & ModelCache::Lease::operator=(Lease && other)
+        {
+            if (this != &other)
+            {
+                Release();
+                mEntry = move(other.mEntry);
+                mModel = move(other.mModel);
+            }
+            return *this;
+        }
+
+        ModelCache::Lease::~Lease()
+        {
+            Release();
+        }
+
+        void ModelCache::Lease::Release()
+        {
+            if (mEntry == nullptr)
+                return;
+
+            lock_guard<mutex> lock(mEntry->mutex);
+            mEntry->instances.push_back(mModel);
+            mEntry = nullptr;
+            mModel = nullptr;
+        }
+
+        ModelCache::ModelCache()
+            : mBytes(0), mBudget(0), mHits(0), mMisses(0), mEvictions(0)
+        {
+        }
+
+        void ModelCache::Insert(const string & uuid, const cntk::FunctionPtr & model, const string & contentKey)
+        {
+            auto entry = make_shared<Entry>();
+            entry->model = model;
+            entry->bytes = ModelBytes(model);
+            entry->contentKey = contentKey;
+            entry->pinned = false;
+            // The first instance is a clone as well, the cached model is cloned while others evaluate
+            entry->instances.push_back(model->Clone(cntk::ParameterCloningMethod::Share));
+
+            lock_guard<mutex> lock(mMutex);
+            if (mEntries.count(uuid))
+                Erase(uuid);
+
+            mLru.push_front(uuid);
+            entry->lru = mLru.begin();
+            mEntries[uuid] = entry;
+            mBytes += entry->bytes;
+            if (!contentKey.empty())
+                mContents[contentKey] = uuid;
+
+            Evict(uuid);
+        }
+
+        cntk::FunctionPtr ModelCache::Find(const string & uuid)
+        {
+            lock_guard<mutex> lock(mMutex);
+            auto entry = Touch(uuid);
+            return entry == nullptr ? nullptr : entry->model;
+        }
+
+        string ModelCache::FindContent(const string & contentKey)
+        {
+            lock_guard<mutex> lock(mMutex);
+            auto it = mContents.find(contentKey);
+            if (it == mContents.end())
+            {
+                ++mMisses;
+                return "";
+            }
+            Touch(it->second, false);
+            return it->second;
+        }
+
+        bool ModelCache::HasContentSize(size_t size)
+        {
+            // The keys start with the size
+            uint64_t size64 = size;
+            lock_guard<mutex> lock(mMutex);
+            for (const auto & content : mContents)
+                if (memcmp(content.first.data(), &size64, sizeof(size64)) == 0)
+                    return true;
+            return false;
+        }
+
+        shared_ptr<ModelCache::Entry> ModelCache::FindEntry(const string & uuid)
+        {
+            lock_guard<mutex> lock(mMutex);
+            auto it = mEntries.find(uuid);
+            if (it == mEntries.end())
+                throw runtime_error("The cached model [" + uuid + "] was not found");
+            return it->second;
+        }
+
+        shared_ptr<ModelCache::Entry> ModelCache::Touch(const string & uuid, bool count)
+        {
+            auto it = mEntries.find(uuid);
+            if (it == mEntries.end())
+            {
+                if (count)
+                    ++mMisses;
+                return nullptr;
+            }
+
+            if (count)
+                ++mHits;
+            mLru.splice(mLru.begin(), mLru, it->second->lru);
+            return it->second;
+        }
+
+        ModelCache::Lease ModelCache::Acquire(const string & uuid)
+        {
+            Lease lease;
+            if (!TryAcquire(uuid, lease))
+                throw runtime_error("The cached model [" + uuid + "] was not found");
+            return lease;
+        }
+
+        bool ModelCache::TryAcquire(const string & uuid, Lease & lease)
+        {
+            shared_ptr<Entry> entry;
+            {
+                lock_guard<mutex> lock(mMutex);
+                entry = Touch(uuid);
+                if (entry == nullptr)
+                    return false;
+            }
+
+            cntk::FunctionPtr model;
+            {
+                lock_guard<mutex> lock(entry->mutex);
+                if (entry->instances.empty())
+                {
+                    model = entry->model->Clone(cntk::ParameterCloningMethod::Share);
+                }
+                else
+                {
+                    model = entry->instances.back();
+                    entry->instances.pop_back();
+                }
+            }
+
+            lease = Lease();
+            lease.mEntry = entry;
+            lease.mModel = model;
+            return true;
+        }
+
+        shared_ptr<BatchScheduler> ModelCache::Scheduler(const string & uuid, size_t maxBatchSize, chrono::microseconds maxWait, const cntk::DeviceDescriptor & device)
+        {
+            auto entry = FindEntry(uuid);
+
+            // Callers with other limits get their own scheduler instead of replacing this one
+            lock_guard<mutex> lock(entry->mutex);
+            auto & scheduler = entry->schedulers[{ maxBatchSize, (int64_t)maxWait.count() }];
+            if (scheduler == nullptr)
+                scheduler = make_shared<BatchScheduler>(entry->model->Clone(cntk::ParameterCloningMethod::Share), device, maxBatchSize, maxWait);
+            return scheduler;
+        }
+
+        bool ModelCache::Unload(const string & uuid)
+        {
+            lock_guard<mutex> lock(mMutex);
+            if (!mEntries.count(uuid))
+                return false;
+            Erase(uuid);
+            return true;
+        }
+
+        void ModelCache::Pin(const string & uuid, bool pinned)
+        {
+            lock_guard<mutex> lock(mMutex);
+            auto it = mEntries.find(uuid);
+            if (it == mEntries.end())
+                throw runtime_error("The cached model [" + uuid + "] was not found");
+            it->second->pinned = pinned;
+            if (!pinned)
+                Evict("");
+        }
+
+        void ModelCache::SetBudget(size_t budget)
+        {
+            lock_guard<mutex> lock(mMutex);
+            mBudget = budget;
+            Evict("");
+        }
+
+        ModelCache::Stats ModelCache::GetStats()
+        {
+            lock_guard<mutex> lock(mMutex);
+            return { mHits, mMisses, mEvictions, mEntries.size(), mBytes, mBudget };
+        }
+
+        void ModelCache::Erase(const string & uuid)
+        {
+            auto it = mEntries.find(uuid);
+            auto entry = it->second;
+
+            mLru.erase(entry->lru);
+            mBytes -= entry->bytes;
+            auto content = mContents.find(entry->contentKey);
+            if (content != mContents.end() && content->second == uuid)
+                mContents.erase(content);
+            mEntries.erase(it);
+        }
+
+        void ModelCache::Evict(const string & keep)
+        {
+            if (mBudget == 0)
+                return;
+
+            // The least recently used first, the model just inserted stays even when it's over the budget
+            auto it = mLru.end();
+            while (mBytes > mBudget && it != mLru.begin())
+            {
+                --it;
+                auto entry = mEntries.at(*it);
+                if (entry->pinned || *it == keep)
+                    continue;
+
+                auto uuid = *it++;
+                Erase(uuid);
+                ++mEvictions;
+            }
+        }
+
+        size_t ModelCache::ModelBytes(const cntk::FunctionPtr & model)
+        {
+            size_t bytes = 0;
+            auto add = [&bytes](const cntk::Variable & variable)
+            {
+                size_t elementSize = variable.GetDataType() == cntk::DataType::Double ? 8 : variable.GetDataType() == cntk::DataType::Float16 ? 2 : 4;
+                bytes += variable.Shape().TotalSize() * elementSize;
+            };
+
+            for (const auto & parameter : model->Parameters())
+                add(parameter);
+            for (const auto & constant : model->Constants())
+                add(constant);
+            return bytes;
+        }
+
+        // The size then the SHA-256 of the bytes [CNG]: two models share an entry only when their
+        // bytes are the same, not when a 64 bit hash of them happens to collide
+        string ModelCache::ContentKey(const char * data, size_t size)
+        {
+            BCRYPT_ALG_HANDLE algorithm = nullptr;
+            BCRYPT_HASH_HANDLE hash = nullptr;
+            string key(sizeof(uint64_t) + 32, '\0');
+            uint64_t size64 = size;
+            memcpy(&key[0], &size64, sizeof(size64));
+
+            bool ok = BCRYPT_SUCCESS(BCryptOpenAlgorithmProvider(&algorithm, BCRYPT_SHA256_ALGORITHM, nullptr, 0)) &&
+                BCRYPT_SUCCESS(BCryptCreateHash(algorithm, &hash, nullptr, 0, nullptr, 0, 0));
+
+            // BCryptHashData takes at most 4GB at a time
+            for (size_t offset = 0; ok && offset < size;)
+            {
+                ULONG chunk = (ULONG)min<size_t>(size - offset, 1UL << 30);
+                ok = BCRYPT_SUCCESS(BCryptHashData(hash, (PUCHAR)(data + offset), chunk, 0));
+                offset += chunk;
+            }
+            ok = ok && BCRYPT_SUCCESS(BCryptFinishHash(hash, (PUCHAR)&key[sizeof(uint64_t)], 32, 0));
+
+            if (hash != nullptr)
+                BCryptDestroyHash(hash);
+            if (algorithm != nullptr)
+                BCryptCloseAlgorithmProvider(algorithm, 0);
+
+            if (!ok)
+                throw runtime_error("Can't hash the model's content");
+            return key;
+        }
+    }
+}
\ No newline at end of file
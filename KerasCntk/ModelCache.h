@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CNTKLibrary.h"
+
+#include "BatchScheduler.h"
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // The models cached by uuid for Predict. CNTK's evaluation state lives in the function, so
+        // concurrent calls can't share one: every call leases an instance of its own from the
+        // model's pool. The pool grows with clones sharing the parameters, as many as the
+        // concurrent calls.
+        //
+        // With a budget, the least recently used models that aren't pinned are evicted once the
+        // parameters of the cached models take more bytes than that. Evicted and unloaded models
+        // live on until the calls using them return. Models loaded from the same bytes are cached
+        // once, under the first uuid.
+        class ModelCache
+        {
+        private:
+            struct Entry
+            {
+                CNTK::FunctionPtr model;
+                size_t bytes;
+                std::string contentKey;
+                bool pinned;
+                std::list<std::string>::iterator lru;
+
+                std::mutex mutex;
+                std::vector<CNTK::FunctionPtr> instances;
+                // Keyed by the limits, max batch size and max wait in microseconds
+                std::map<std::pair<size_t, int64_t>, std::shared_ptr<BatchScheduler>> schedulers;
+            };
+
+        public:
+            struct Stats
+            {
+                size_t hits;
+                size_t misses;
+                size_t evictions;
+                size_t models;
+                size_t bytes;
+                size_t budget;
+            };
+
+            // An instance of a cached model for the exclusive use of the holder
+            class Lease
+            {
+            public:
+                Lease() = default;
+                Lease(Lease && other) = default;
+                KERAS_API Lease & operator=(Lease && other);
+                KERAS_API ~Lease();
+
+                const CNTK::FunctionPtr & Model() const { return mModel; }
+
+            private:
+                friend class ModelCache;
+
+                void Release();
+
+                std::shared_ptr<Entry> mEntry;
+                CNTK::FunctionPtr mModel;
+            };
+
+            KERAS_API ModelCache();
+
+            // contentKey is ContentKey() of the serialized model, empty when unknown
+            KERAS_API void Insert(const std::string & uuid, const CNTK::FunctionPtr & model, const std::string & contentKey = "");
+
+            // The cached model itself, null when not cached. Not to be evaluated, only cloned.
+            KERAS_API CNTK::FunctionPtr Find(const std::string & uuid);
+
+            // The uuid of the model with the same content, empty when there's none. Only the misses
+            // count, the hit is the Acquire that follows.
+            KERAS_API std::string FindContent(const std::string & contentKey);
+            // Whether a cached model's content has this size, a lookup that needs no content key
+            KERAS_API bool HasContentSize(size_t size);
+
+            // Throws when the model isn't cached
+            KERAS_API Lease Acquire(const std::string & uuid);
+            KERAS_API bool TryAcquire(const std::string & uuid, Lease & lease);
+
+            // The model's batching scheduler for these limits, shared by all the calls using the
+            // same ones. Throws when the model isn't cached.
+            KERAS_API std::shared_ptr<BatchScheduler> Scheduler(const std::string & uuid, size_t maxBatchSize, std::chrono::microseconds maxWait,
+                const CNTK::DeviceDescriptor & device);
+
+            KERAS_API bool Unload(const std::string & uuid);
+            // Pinned models are never evicted. Throws when the model isn't cached.
+            KERAS_API void Pin(const std::string & uuid, bool pinned);
+
+            // In bytes, 0 for no limit
+            KERAS_API void SetBudget(size_t budget);
+            KERAS_API Stats GetStats();
+
+            // The bytes of the parameters and the constants
+            KERAS_API static size_t ModelBytes(const CNTK::FunctionPtr & model);
+            // The size and the SHA-256 of the serialized model
+            KERAS_API static std::string ContentKey(const char * data, size_t size);
+
+        private:
+            std::shared_ptr<Entry> FindEntry(const std::string & uuid);
+
+            // The caller holds mMutex
+            std::shared_ptr<Entry> Touch(const std::string & uuid, bool count = true);
+            void Erase(const std::string & uuid);
+            void Evict(const std::string & keep);
+
+            std::mutex mMutex;
+            std::unordered_map<std::string, std::shared_ptr<Entry>> mEntries;
+            std::unordered_map<std::string, std::string> mContents;
+            // The most recently used first
+            std::list<std::string> mLru;
+
+            size_t mBytes;
+            size_t mBudget;
+            size_t mHits;
+            size_t mMisses;
+            size_t mEvictions;
+        };
+    }
+}
\ No newline at end of file
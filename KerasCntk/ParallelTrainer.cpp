@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "Globals.h"
+#include "ParallelTrainer.h"
+#include "Utils.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        ParallelTrainer::ParallelTrainer(const cntk::FunctionPtr & model, const cntk::FunctionPtr & loss, const cntk::FunctionPtr & evaluation,
+            const vector<cntk::Variable> & inputs, const cntk::Variable & labels,
+            const function<cntk::LearnerPtr()> & createLearner, size_t workers, Mode mode, size_t accumulationSteps)
+            : mParameters(model->Parameters()), mLabels(labels), mMode(mode), mAccumulationSteps(accumulationSteps), mEvaluated(evaluation != nullptr),
+            mLoss(0.0), mEvaluation(0.0), mSamples(0),
+            mGeneration(0), mPending(0), mStop(false)
+        {
+            if (workers == 0)
+                throw logic_error("The number of workers must be positive");
+            if (accumulationSteps == 0)
+                throw logic_error("The gradient accumulation steps must be positive");
+            if (accumulationSteps > 1 && mode == Mode::Hogwild)
+                throw logic_error("Gradient accumulation is not supported with Hogwild training");
+
+            // The clones keep the inputs, so every worker is fed with the same variables
+            unordered_map<cntk::Variable, cntk::Variable> replacements;
+            for (const auto & input : inputs)
+                replacements.insert({ input, input });
+            replacements.insert({ labels, labels });
+
+            // No metric [or e.g. a regression loss] has no evaluation function
+            auto root = mEvaluated ? cntk::Combine({ model, loss, evaluation }) : cntk::Combine({ model, loss });
+
+            mWorkers.resize(workers);
+            for (auto & worker : mWorkers)
+            {
+                auto clone = root->Clone(cntk::ParameterCloningMethod::Share, replacements);
+                auto cloneModel = cntk::AsComposite(clone->Outputs()[0].Owner());
+                auto cloneLoss = cntk::AsComposite(clone->Outputs()[1].Owner());
+                auto cloneEvaluation = mEvaluated ? cntk::AsComposite(clone->Outputs()[2].Owner()) : nullptr;
+
+                if (mode == Mode::Hogwild)
+                {
+                    worker.trainer = cntk::CreateTrainer(cloneModel, cloneLoss, cloneEvaluation, { createLearner() });
+                }
+                else
+                {
+                    // What the trainer minimizes: the sums over the minibatch
+                    vector<cntk::Variable> sums = { cntk::ReduceSum(cloneLoss, cntk::Axis::AllAxes()) };
+                    if (mEvaluated)
+                        sums.push_back(cntk::ReduceSum(cloneEvaluation, cntk::Axis::AllAxes()));
+                    worker.aggregated = cntk::Combine(sums);
+                    worker.loss = worker.aggregated->Outputs()[0];
+                    if (mEvaluated)
+                        worker.evaluation = worker.aggregated->Outputs()[1];
+                }
+            }
+
+            if (mode == Mode::AllReduce)
+                mLearner = createLearner();
+
+            for (size_t id = 0; id < workers; ++id)
+                mThreads.emplace_back(&ParallelTrainer::ThreadLoop, this, id);
+        }
+
+        ParallelTrainer::~ParallelTrainer()
+        {
+            {
+                lock_guard<mutex> lock(mMutex);
+                mStop = true;
+            }
+            mWork.notify_all();
+            for (auto & thread : mThreads)
+                thread.join();
+        }
+
+        vector<cntk::LearnerPtr> ParallelTrainer::Learners() const
+        {
+            if (mMode == Mode::AllReduce)
+                return { mLearner };
+
+            vector<cntk::LearnerPtr> result;
+            for (const auto & worker : mWorkers)
+                result.push_back(worker.trainer->ParameterLearners().front());
+            return result;
+        }
+
+        ParallelTrainer::Mode ParallelTrainer::ParseMode(const string & mode)
+        {
+            auto lower = utils::ToLower(mode);
+            if (lower.empty() || lower == "allreduce")
+                return Mode::AllReduce;
+            if (lower == "hogwild")
+                return Mode::Hogwild;
+            throw logic_error("'" + mode + "' parallel training mode is not supported [yet].");
+        }
+
+        void ParallelTrainer::TrainMinibatches(const vector<MinibatchArguments> & minibatches, const cntk::DeviceDescriptor & device)
+        {
+            if (minibatches.size() > MinibatchesPerUpdate())
+                throw logic_error("More minibatches than workers and accumulation steps");
+
+            size_t active = min(minibatches.size(), mWorkers.size());
+
+            Run([&](size_t id)
+            {
+                if (id >= active)
+                    return;
+
+                if (mMode == Mode::Hogwild)
+                {
+                    auto & worker = mWorkers[id];
+                    worker.trainer->TrainMinibatch(minibatches[id], device);
+                    worker.samples = worker.trainer->PreviousMinibatchSampleCount();
+                    worker.lossValue = worker.trainer->PreviousMinibatchLossAverage() * worker.samples;
+                    worker.evaluationValue = mEvaluated ? worker.trainer->PreviousMinibatchEvaluationAverage() * worker.samples : 0.0;
+                }
+                else
+                {
+                    ComputeGradients(id, minibatches, device);
+                }
+            });
+
+            mLoss = 0.0;
+            mEvaluation = 0.0;
+            mSamples = 0;
+            for (size_t id = 0; id < active; ++id)
+            {
+                mLoss += mWorkers[id].lossValue;
+                mEvaluation += mWorkers[id].evaluationValue;
+                mSamples += mWorkers[id].samples;
+            }
+
+            if (mMode == Mode::AllReduce && mSamples > 0)
+            {
+                // Every thread sums a slice of the gradients into the first worker's
+                if (active > 1)
+                    Run([&](size_t id) { ReduceGradients(id, active); });
+
+                unordered_map<cntk::Parameter, cntk::NDArrayViewPtr> gradients;
+                for (const auto & parameter : mParameters)
+                    gradients[parameter] = mWorkers[0].gradients.at(parameter)->Data();
+                mLearner->Update(gradients, mSamples);
+            }
+        }
+
+        static double AsScalar(const cntk::ValuePtr & value)
+        {
+            if (value->GetDataType() == cntk::DataType::Double)
+                return value->Data()->AsScalar<double>();
+            return value->Data()->AsScalar<float>();
+        }
+
+        template <typename T>
+        static void Accumulate(const cntk::NDArrayViewPtr & result, const cntk::NDArrayViewPtr & gradient, size_t start, size_t end)
+        {
+            T * p = result->WritableDataBuffer<T>();
+            const T * q = gradient->DataBuffer<T>();
+            for (size_t i = start; i < end; ++i)
+                p[i] += q[i];
+        }
+
+        static void Accumulate(const cntk::NDArrayViewPtr & result, const cntk::NDArrayViewPtr & gradient, size_t start, size_t end)
+        {
+            if (result->GetDataType() == cntk::DataType::Double)
+                Accumulate<double>(result, gradient, start, end);
+            else
+                Accumulate<float>(result, gradient, start, end);
+        }
+
+        // The worker's minibatches are id, id + workers, ... Only one minibatch's activations
+        // are alive at a time, the gradients are summed as they come.
+        void ParallelTrainer::ComputeGradients(size_t id, const vector<MinibatchArguments> & minibatches, const cntk::DeviceDescriptor & device)
+        {
+            auto & worker = mWorkers[id];
+
+            worker.lossValue = 0.0;
+            worker.evaluationValue = 0.0;
+            worker.samples = 0;
+            worker.gradients.clear();
+
+            auto rootGradient = cntk::MakeSharedObject<cntk::Value>(worker.loss.GetDataType() == cntk::DataType::Double ?
+                cntk::MakeSharedObject<cntk::NDArrayView>(1.0, worker.loss.Shape(), device) :
+                cntk::MakeSharedObject<cntk::NDArrayView>(1.0f, worker.loss.Shape(), device));
+
+            for (size_t i = id; i < minibatches.size(); i += mWorkers.size())
+            {
+                unordered_map<cntk::Variable, cntk::ValuePtr> arguments;
+                for (const auto & kv : minibatches[i])
+                    arguments[kv.first] = kv.second.data;
+
+                unordered_map<cntk::Variable, cntk::ValuePtr> outputs = { { worker.loss, nullptr } };
+                if (mEvaluated)
+                    outputs[worker.evaluation] = nullptr;
+                auto state = worker.aggregated->Forward(arguments, outputs, device, { worker.loss });
+
+                unordered_map<cntk::Variable, cntk::ValuePtr> gradients;
+                for (const auto & parameter : mParameters)
+                    gradients[parameter] = nullptr;
+                worker.aggregated->Backward(state, { { worker.loss, rootGradient } }, gradients);
+
+                bool last = i + mWorkers.size() >= minibatches.size();
+                for (const auto & parameter : mParameters)
+                {
+                    if (!worker.gradients.count(parameter))
+                        // The values may be the network's own buffers, reused by the next minibatch
+                        worker.gradients[parameter] = last ? gradients[parameter] : gradients[parameter]->DeepClone();
+                    else
+                        Accumulate(worker.gradients[parameter]->Data(), gradients[parameter]->Data(), 0, gradients[parameter]->Shape().TotalSize());
+                }
+
+                worker.lossValue += AsScalar(outputs[worker.loss]);
+                if (mEvaluated)
+                    worker.evaluationValue += AsScalar(outputs[worker.evaluation]);
+                worker.samples += minibatches[i].at(mLabels).numberOfSamples;
+            }
+        }
+
+        void ParallelTrainer::ReduceGradients(size_t id, size_t active)
+        {
+            size_t workers = mWorkers.size();
+            for (const auto & parameter : mParameters)
+            {
+                auto result = mWorkers[0].gradients.at(parameter)->Data();
+                size_t size = result->Shape().TotalSize();
+                size_t start = size * id / workers;
+                size_t end = size * (id + 1) / workers;
+
+                for (size_t w = 1; w < active; ++w)
+                    Accumulate(result, mWorkers[w].gradients.at(parameter)->Data(), start, end);
+            }
+        }
+
+        void ParallelTrainer::Run(const function<void(size_t)> & task)
+        {
+            unique_lock<mutex> lock(mMutex);
+            mTask = task;
+            mPending = mThreads.size();
+            mError = nullptr;
+            ++mGeneration;
+            mWork.notify_all();
+
+            mDone.wait(lock, [this] { return mPending == 0; });
+            mTask = nullptr;
+
+            if (mError)
+                rethrow_exception(mError);
+        }
+
+        void ParallelTrainer::ThreadLoop(size_t id)
+        {
+            size_t generation = 0;
+            for (;;)
+            {
+                function<void(size_t)> task;
+                {
+                    unique_lock<mutex> lock(mMutex);
+                    mWork.wait(lock, [&] { return mStop || mGeneration != generation; });
+                    if (mStop)
+                        return;
+                    generation = mGeneration;
+                    task = mTask;
+                }
+
+                exception_ptr error;
+                try
+                {
+                    task(id);
+                }
+                catch (...)
+                {
+                    error = current_exception();
+                }
+
+                lock_guard<mutex> lock(mMutex);
+                if (error && !mError)
+                    mError = error;
+                if (--mPending == 0)
+                    mDone.notify_one();
+            }
+        }
+    }
+}
\ No newline at end of file
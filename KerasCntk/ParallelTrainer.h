@@ -0,0 +1,97 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "CNTKLibrary.h"
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        typedef std::unordered_map<CNTK::Variable, CNTK::MinibatchData> MinibatchArguments;
+
+        // Local data parallel training: one worker thread per minibatch, every worker with its own
+        // clone of the loss and evaluation functions sharing the model's parameters.
+        //  - AllReduce: the workers' gradients are summed in shared memory and a single learner
+        //    updates the parameters, the same as training on the union of the minibatches. With
+        //    gradient accumulation every worker goes through accumulationSteps minibatches, one
+        //    at a time, before the update.
+        //  - Hogwild: every worker has its own learner and updates the shared parameters without
+        //    any synchronization.
+        class ParallelTrainer
+        {
+        public:
+            enum class Mode { AllReduce, Hogwild };
+
+            // evaluation may be null, the evaluation average is then zero
+            KERAS_API ParallelTrainer(const CNTK::FunctionPtr & model, const CNTK::FunctionPtr & loss, const CNTK::FunctionPtr & evaluation,
+                const std::vector<CNTK::Variable> & inputs, const CNTK::Variable & labels,
+                const std::function<CNTK::LearnerPtr()> & createLearner, size_t workers, Mode mode, size_t accumulationSteps = 1);
+            KERAS_API ~ParallelTrainer();
+
+            size_t Workers() const { return mWorkers.size(); }
+            size_t MinibatchesPerUpdate() const { return mWorkers.size() * mAccumulationSteps; }
+
+            std::vector<CNTK::LearnerPtr> Learners() const;
+
+            // At most MinibatchesPerUpdate() minibatches
+            KERAS_API void TrainMinibatches(const std::vector<MinibatchArguments> & minibatches, const CNTK::DeviceDescriptor & device);
+
+            double PreviousMinibatchLossAverage() const { return mSamples == 0 ? 0.0 : mLoss / mSamples; }
+            double PreviousMinibatchEvaluationAverage() const { return mSamples == 0 ? 0.0 : mEvaluation / mSamples; }
+            size_t PreviousMinibatchSampleCount() const { return mSamples; }
+
+            static Mode ParseMode(const std::string & mode);
+
+        private:
+            struct Worker
+            {
+                CNTK::FunctionPtr aggregated;
+                CNTK::Variable loss;
+                CNTK::Variable evaluation;
+                CNTK::TrainerPtr trainer;
+                std::unordered_map<CNTK::Variable, CNTK::ValuePtr> gradients;
+                double lossValue;
+                double evaluationValue;
+                size_t samples;
+            };
+
+            void ComputeGradients(size_t id, const std::vector<MinibatchArguments> & minibatches, const CNTK::DeviceDescriptor & device);
+            void ReduceGradients(size_t id, size_t active);
+
+            // Runs task(worker id) on every thread and waits for all of them
+            void Run(const std::function<void(size_t)> & task);
+            void ThreadLoop(size_t id);
+
+            std::vector<Worker> mWorkers;
+            std::vector<CNTK::Parameter> mParameters;
+            CNTK::LearnerPtr mLearner;
+            CNTK::Variable mLabels;
+            Mode mMode;
+            size_t mAccumulationSteps;
+            bool mEvaluated;
+
+            double mLoss;
+            double mEvaluation;
+            size_t mSamples;
+
+            std::vector<std::thread> mThreads;
+            std::mutex mMutex;
+            std::condition_variable mWork;
+            std::condition_variable mDone;
+            std::function<void(size_t)> mTask;
+            size_t mGeneration;
+            size_t mPending;
+            bool mStop;
+            std::exception_ptr mError;
+        };
+    }
+}
\ No newline at end of file
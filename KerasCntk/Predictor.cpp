@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "Predictor.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        Predictor::Predictor(const cntk::FunctionPtr & model, const cntk::DeviceDescriptor & device)
+            : mModel(model), mOutput(model->Output()), mDevice(device), mDeviceRows(0), mBoundInput(nullptr), mBoundOutput(nullptr), mBoundRows(0)
+        {
+            auto arguments = model->Arguments();
+            if (arguments.size() != 1)
+                throw runtime_error("The predictor's model must have a single input");
+            mInput = arguments[0];
+
+            if (mInput.IsSparse())
+                throw runtime_error("The predictor's input must be dense");
+            if (mInput.GetDataType() != cntk::DataType::Float || mOutput.GetDataType() != cntk::DataType::Float)
+                throw runtime_error("The predictor's model must be single precision");
+
+            size_t stride = 1;
+            for (size_t i = 0; i < mInput.Shape().Rank(); ++i)
+            {
+                mStrides.push_back(stride);
+                stride *= mInput.Shape()[i];
+            }
+        }
+
+        void Predictor::Predict(const float * in, size_t n, float * out)
+        {
+            if (n == 0)
+                return;
+
+            const auto & shape = mInput.Shape();
+            if (shape.Rank() > 1)
+            {
+                mStaging.resize(n * InputSize());
+                Transpose(in, n, &mStaging[0]);
+                in = &mStaging[0];
+            }
+
+            // The staging buffer keeps its address for the same n
+            if (in != mBoundInput || out != mBoundOutput || n != mBoundRows)
+            {
+                // A sequence of one sample per row
+                auto inputShape = shape.AppendShape({ 1, n });
+                mHostInput = cntk::MakeSharedObject<cntk::NDArrayView>(cntk::DataType::Float, inputShape, (void *)in, n * InputSize() * sizeof(float), cntk::DeviceDescriptor::CPUDevice(), true);
+                auto input = mHostInput;
+                mBoundDeviceInput = nullptr;
+
+                if (mDevice != cntk::DeviceDescriptor::CPUDevice())
+                {
+                    if (mDeviceInput == nullptr || mDeviceRows < n)
+                    {
+                        mDeviceInput = cntk::MakeSharedObject<cntk::NDArrayView>(cntk::DataType::Float, inputShape, mDevice);
+                        mDeviceRows = n;
+                    }
+                    mBoundDeviceInput = mDeviceRows == n ? mDeviceInput : mDeviceInput->SliceView(vector<size_t>(inputShape.Rank(), 0), inputShape.Dimensions());
+                    input = mBoundDeviceInput;
+                }
+
+                auto output = cntk::MakeSharedObject<cntk::NDArrayView>(cntk::DataType::Float, mOutput.Shape().AppendShape({ 1, n }), out, n * OutputSize() * sizeof(float), cntk::DeviceDescriptor::CPUDevice());
+
+                mArguments[mInput] = cntk::MakeSharedObject<cntk::Value>(input);
+                mOutputs[mOutput] = cntk::MakeSharedObject<cntk::Value>(output);
+                mBoundInput = in;
+                mBoundOutput = out;
+                mBoundRows = n;
+            }
+
+            // On a GPU the samples are copied every call, the host buffer's contents change
+            if (mBoundDeviceInput != nullptr)
+                mBoundDeviceInput->CopyFrom(*mHostInput);
+
+            mModel->Evaluate(mArguments, mOutputs, mDevice);
+        }
+
+        void Predictor::Transpose(const float * in, size_t n, float * out) const
+        {
+            const auto & shape = mInput.Shape();
+            size_t rank = shape.Rank();
+            size_t size = InputSize();
+            vector<size_t> index(rank);
+
+            for (size_t s = 0; s < n; ++s)
+            {
+                const float * src = in + s * size;
+                float * dst = out + s * size;
+
+                // The row major index, the last axis moves the fastest
+                fill(index.begin(), index.end(), 0);
+                size_t offset = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    dst[offset] = src[i];
+                    for (size_t j = rank; j-- > 0;)
+                    {
+                        offset += mStrides[j];
+                        if (++index[j] < shape[j])
+                            break;
+                        offset -= mStrides[j] * shape[j];
+                        index[j] = 0;
+                    }
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
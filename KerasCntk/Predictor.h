@@ -0,0 +1,58 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "CNTKLibrary.h"
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // Low latency inference over raw, caller owned buffers: no protobuf envelope, no minibatch
+        // source. On the CPU the buffers are wrapped, not copied; the arguments and the outputs are
+        // bound to the buffers and only rebound when the buffers or n change, so a caller reusing
+        // its buffers allocates nothing per call. One sample per row, sequences go through Predict.
+        // Not thread safe.
+        class Predictor
+        {
+        public:
+            KERAS_API Predictor(const CNTK::FunctionPtr & model, const CNTK::DeviceDescriptor & device);
+
+            size_t InputSize() const { return mInput.Shape().TotalSize(); }
+            size_t OutputSize() const { return mOutput.Shape().TotalSize(); }
+
+            // in is [n x input shape] in row major order, out is [n x OutputSize()]
+            KERAS_API void Predict(const float * in, size_t n, float * out);
+
+        private:
+            // Row major samples into CNTK's column major order
+            void Transpose(const float * in, size_t n, float * out) const;
+
+            CNTK::FunctionPtr mModel;
+            CNTK::Variable mInput;
+            CNTK::Variable mOutput;
+            CNTK::DeviceDescriptor mDevice;
+
+            // The column strides of the input, and the transposed samples when its rank is above one
+            std::vector<size_t> mStrides;
+            std::vector<float> mStaging;
+
+            // The input on a GPU, reallocated only for a larger n
+            CNTK::NDArrayViewPtr mDeviceInput;
+            size_t mDeviceRows;
+
+            // What the arguments and the outputs are bound to
+            const float * mBoundInput;
+            float * mBoundOutput;
+            size_t mBoundRows;
+            CNTK::NDArrayViewPtr mHostInput;
+            CNTK::NDArrayViewPtr mBoundDeviceInput;
+
+            std::unordered_map<CNTK::Variable, CNTK::ValuePtr> mArguments;
+            std::unordered_map<CNTK::Variable, CNTK::ValuePtr> mOutputs;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <stdexcept>
+
+#include "ProgressReporter.h"
+
+using namespace std;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        ProgressReporter::ProgressReporter(const function<void(const Event &)> & deliver, size_t capacity)
+            : mDeliver(deliver), mEvents(capacity), mHead(0), mTail(0), mStop(false)
+        {
+            if (capacity == 0)
+                throw logic_error("The progress buffer capacity must be positive");
+
+            mThread = thread(&ProgressReporter::ThreadLoop, this);
+        }
+
+        ProgressReporter::~ProgressReporter()
+        {
+            mStop.store(true, memory_order_release);
+            Wake();
+            if (mThread.joinable())
+                mThread.join();
+        }
+
+        bool ProgressReporter::Post(Event && event, bool droppable)
+        {
+            size_t head = mHead.load(memory_order_relaxed);
+            while (head - mTail.load(memory_order_acquire) == mEvents.size())
+            {
+                if (droppable || !mThread.joinable())
+                    return false;
+                this_thread::yield();
+            }
+
+            mEvents[head % mEvents.size()] = move(event);
+            mHead.store(head + 1, memory_order_release);
+            Wake();
+            return true;
+        }
+
+        void ProgressReporter::Wake()
+        {
+            // Taking the lock orders the change before the thread's check of its wait condition,
+            // otherwise the notification could come between the check and the wait and be lost
+            {
+                lock_guard<mutex> lock(mMutex);
+            }
+            mWork.notify_one();
+        }
+
+        void ProgressReporter::Close()
+        {
+            if (!mThread.joinable())
+                return;
+
+            mStop.store(true, memory_order_release);
+            Wake();
+            mThread.join();
+
+            if (mError)
+            {
+                auto error = mError;
+                mError = nullptr;
+                rethrow_exception(error);
+            }
+        }
+
+        size_t ProgressReporter::Drain()
+        {
+            size_t tail = mTail.load(memory_order_relaxed);
+            size_t head = mHead.load(memory_order_acquire);
+            for (size_t i = tail; i < head; ++i)
+            {
+                auto & event = mEvents[i % mEvents.size()];
+
+                // After a failure the events are still consumed, the producer must not wait forever
+                if (!mError)
+                {
+                    try
+                    {
+                        mDeliver(event);
+                    }
+                    catch (...)
+                    {
+                        mError = current_exception();
+                    }
+                }
+
+                event.values.clear();
+                mTail.store(i + 1, memory_order_release);
+            }
+            return head - tail;
+        }
+
+        void ProgressReporter::ThreadLoop()
+        {
+            for (;;)
+            {
+                // Whatever was posted before the stop is still delivered
+                bool stop = mStop.load(memory_order_acquire);
+                if (Drain() == 0)
+                {
+                    if (stop)
+                        return;
+
+                    unique_lock<mutex> lock(mMutex);
+                    mWork.wait(lock, [this]
+                    {
+                        return mStop.load(memory_order_acquire) || mHead.load(memory_order_acquire) != mTail.load(memory_order_relaxed);
+                    });
+                }
+            }
+        }
+
+        ProgressThrottle::ProgressThrottle(size_t everyBatches, size_t everyMilliseconds, bool batches)
+            : mEveryBatches(everyBatches), mEveryMilliseconds(everyMilliseconds), mBatches(batches), mFirst(true), mSkipped(0)
+        {
+        }
+
+        bool ProgressThrottle::Next()
+        {
+            if (!mBatches)
+                return false;
+            if (mEveryBatches == 0 && mEveryMilliseconds == 0)
+                return true;
+
+            auto now = chrono::steady_clock::now();
+            ++mSkipped;
+            bool report = mFirst ||
+                (mEveryBatches > 0 && mSkipped >= mEveryBatches) ||
+                (mEveryMilliseconds > 0 && chrono::duration_cast<chrono::milliseconds>(now - mLast).count() >= (long long)mEveryMilliseconds);
+
+            if (report)
+            {
+                mFirst = false;
+                mSkipped = 0;
+                mLast = now;
+            }
+            return report;
+        }
+    }
+}
\ No newline at end of file
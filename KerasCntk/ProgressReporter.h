@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // Delivers the progress events from a background thread, so that training doesn't wait for
+        // the callback [and the marshalling into managed code]. The training thread only moves the
+        // event into a single producer, single consumer ring buffer and wakes the idle thread up.
+        // When the buffer is full the droppable [batch] events are dropped and the others wait for room.
+        class ProgressReporter
+        {
+        public:
+            struct Event
+            {
+                int type;
+                size_t id;
+                std::unordered_map<std::string, double> values;
+            };
+
+            KERAS_API ProgressReporter(const std::function<void(const Event &)> & deliver, size_t capacity = 256);
+            KERAS_API ~ProgressReporter();
+
+            // False when the event was dropped
+            KERAS_API bool Post(Event && event, bool droppable);
+
+            // Delivers the pending events and stops the thread, throws if a delivery failed
+            KERAS_API void Close();
+
+        private:
+            size_t Drain();
+            void Wake();
+            void ThreadLoop();
+
+            std::function<void(const Event &)> mDeliver;
+            std::vector<Event> mEvents;
+
+            // Monotonic counters, the slot is the counter modulo the capacity
+            std::atomic<size_t> mHead;
+            std::atomic<size_t> mTail;
+            std::atomic<bool> mStop;
+
+            // Only guards the thread's wait, the ring buffer is lock free
+            std::mutex mMutex;
+            std::condition_variable mWork;
+
+            // Only read after the thread has been joined
+            std::exception_ptr mError;
+            std::thread mThread;
+        };
+
+        // Which batches to report: every everyBatches batches or every everyMilliseconds, whichever
+        // comes first, starting with the first batch. Every batch without limits, none without batches.
+        class ProgressThrottle
+        {
+        public:
+            KERAS_API ProgressThrottle(size_t everyBatches = 0, size_t everyMilliseconds = 0, bool batches = true);
+
+            KERAS_API bool Next();
+
+        private:
+            size_t mEveryBatches;
+            size_t mEveryMilliseconds;
+            bool mBatches;
+
+            bool mFirst;
+            size_t mSkipped;
+            std::chrono::steady_clock::time_point mLast;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <vector>
+
+// CNTK headers
+#include "CNTKLibrary.h"
+
+// Keras headers
+#include "Globals.h"
+#include "Keras.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    // The gates are stacked along the first axis, in Keras' order
+    static cntk::FunctionPtr Gate(const cntk::Variable & operand, size_t units, size_t index)
+    {
+        return cntk::Slice(operand, { cntk::Axis(0) }, { (int)(index * units) }, { (int)((index + 1) * units) });
+    }
+
+    static cntk::FunctionPtr Delay(const cntk::Variable & operand, bool goBackwards)
+    {
+        return goBackwards ? cntk::FutureValue(operand) : cntk::PastValue(operand);
+    }
+
+    static cntk::FunctionPtr Output(const cntk::FunctionPtr & h, bool returnSequences, bool goBackwards, const wstring & name)
+    {
+        if (returnSequences)
+            return cntk::Alias(h, name);
+        return goBackwards ? cntk::Sequence::First(h, name) : cntk::Sequence::Last(h, name);
+    }
+
+    // The input projection of all the gates is a single Times over every step of every
+    // sequence in the minibatch; only the recurrent projection is left inside the loop.
+    static cntk::Variable InputProjection(const cntk::Variable & input, size_t size, const cntk::ParameterInitializer & kernelInitializer, bool useBias, vector<float> bias)
+    {
+        cntk::Variable x = input;
+        if (x.Shape().Rank() > 1)
+            x = cntk::Reshape(x, { x.Shape().TotalSize() });
+
+        auto kernel = cntk::Parameter({ size, x.Shape()[0] }, globals::dataType, kernelInitializer, globals::device);
+        cntk::Variable result = cntk::Times(kernel, x);
+
+        if (useBias)
+        {
+            auto view = cntk::MakeSharedObject<cntk::NDArrayView>(cntk::NDShape({ size }), bias, false);
+            auto biasParam = cntk::Parameter(view->DeepClone(globals::device, false));
+            result = cntk::Plus(biasParam, result);
+        }
+
+        return result;
+    }
+
+    __declspec(dllexport) cntk::FunctionPtr LSTM(const cntk::Variable & input, size_t units, const UnaryOp & activation, const UnaryOp & recurrentActivation,
+        const cntk::ParameterInitializer & kernelInitializer, const cntk::ParameterInitializer & recurrentInitializer,
+        bool useBias, bool unitForgetBias, bool returnSequences, bool goBackwards, const wstring & name)
+    {
+        // Gates: input, forget, cell, output
+        vector<float> bias(4 * units, 0.0f);
+        if (unitForgetBias)
+            fill(bias.begin() + units, bias.begin() + 2 * units, 1.0f);
+
+        auto x = InputProjection(input, 4 * units, kernelInitializer, useBias, bias);
+        auto recurrentKernel = cntk::Parameter({ 4 * units, units }, globals::dataType, recurrentInitializer, globals::device);
+
+        auto dh = cntk::PlaceholderVariable({ units }, input.DynamicAxes());
+        auto dc = cntk::PlaceholderVariable({ units }, input.DynamicAxes());
+
+        auto z = cntk::Plus(x, cntk::Times(recurrentKernel, dh));
+
+        auto i = recurrentActivation(Gate(z, units, 0));
+        auto f = recurrentActivation(Gate(z, units, 1));
+        auto g = activation(Gate(z, units, 2));
+        auto o = recurrentActivation(Gate(z, units, 3));
+
+        auto c = cntk::Plus(cntk::ElementTimes(f, dc), cntk::ElementTimes(i, g));
+        auto h = cntk::ElementTimes(o, activation(c));
+
+        h->ReplacePlaceholders({ { dh, Delay(h, goBackwards) }, { dc, Delay(c, goBackwards) } });
+
+        return Output(h, returnSequences, goBackwards, name);
+    }
+
+    __declspec(dllexport) cntk::FunctionPtr GRU(const cntk::Variable & input, size_t units, const UnaryOp & activation, const UnaryOp & recurrentActivation,
+        const cntk::ParameterInitializer & kernelInitializer, const cntk::ParameterInitializer & recurrentInitializer,
+        bool useBias, bool returnSequences, bool goBackwards, const wstring & name)
+    {
+        // Gates: update, reset, candidate
+        auto x = InputProjection(input, 3 * units, kernelInitializer, useBias, vector<float>(3 * units, 0.0f));
+        auto recurrentKernel = cntk::Parameter({ 2 * units, units }, globals::dataType, recurrentInitializer, globals::device);
+        auto candidateKernel = cntk::Parameter({ units, units }, globals::dataType, recurrentInitializer, globals::device);
+
+        auto dh = cntk::PlaceholderVariable({ units }, input.DynamicAxes());
+
+        auto zr = cntk::Plus(Gate(x, 2 * units, 0), cntk::Times(recurrentKernel, dh));
+        auto u = recurrentActivation(Gate(zr, units, 0));
+        auto r = recurrentActivation(Gate(zr, units, 1));
+
+        auto hh = activation(cntk::Plus(Gate(x, units, 2), cntk::Times(candidateKernel, cntk::ElementTimes(r, dh))));
+        auto h = cntk::Plus(cntk::ElementTimes(u, dh), cntk::ElementTimes(cntk::Minus(cntk::Constant::Scalar(1.0f), u), hh));
+
+        h->ReplacePlaceholders({ { dh, Delay(h, goBackwards) } });
+
+        return Output(h, returnSequences, goBackwards, name);
+    }
+}
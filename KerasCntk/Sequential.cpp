@@ -1,8 +1,17 @@
+#define _USE_MATH_DEFINES
+#include <algorithm>
+#include <cmath>
+#include <chrono>
 #include <codecvt>
 #include <cstdint>
 #include <exception>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 // TH headers [before anything else to avoid conflicts]
 #include "TH/THTensor.h"
@@ -17,6 +26,7 @@
 // Keras headers
 #include "CntkUtils.h"
 #include "Globals.h"
+#include "Keras.h"
 #include "Utils.h"
 
 #pragma warning (push)
@@ -27,8 +37,15 @@
 #pragma warning (pop)
 
 #include "BufferMinibatchSource.h"
+#include "Checkpoint.h"
+#include "CppExport.h"
 #include "DataBuffer.h"
+#include "MappedFile.h"
+#include "ModelCache.h"
+#include "ProgressReporter.h"
 #include "Sequential.h"
+#include "TopK.h"
+#include "WeightDecay.h"
 
 using namespace std;
 using namespace nlohmann;
@@ -38,12 +55,216 @@ namespace keras
 {
     static ProgressCallback gProgressCallback = nullptr;
 
-    typedef unordered_map<string, CNTK::FunctionPtr> ModelCache;
+    cntk_utils::ModelCache gModelCache;
 
-    ModelCache gModelCache;
+    // CNTK's thread limit is process wide, a Fit that lowers it restores it for the later calls
+    class MaxCPUThreadsScope
+    {
+    public:
+        MaxCPUThreadsScope() : mPrevious(cntk::GetMaxNumCPUThreads()) {}
+        ~MaxCPUThreadsScope() { cntk::SetMaxNumCPUThreads(mPrevious); }
+
+        MaxCPUThreadsScope(const MaxCPUThreadsScope &) = delete;
+        MaxCPUThreadsScope & operator=(const MaxCPUThreadsScope &) = delete;
+
+    private:
+        size_t mPrevious;
+    };
+
+    // Stops the asynchronous progress reporter however Fit ends. Close() on the success path
+    // rethrows a failed delivery; after an error the pending events are still delivered, and
+    // a failed delivery is ignored in favour of the error in flight.
+    class ProgressReporterScope
+    {
+    public:
+        ProgressReporterScope(unique_ptr<cntk_utils::ProgressReporter> & reporter) : mReporter(reporter) {}
+        ~ProgressReporterScope() { mReporter.reset(); }
+
+        ProgressReporterScope(const ProgressReporterScope &) = delete;
+        ProgressReporterScope & operator=(const ProgressReporterScope &) = delete;
+
+    private:
+        unique_ptr<cntk_utils::ProgressReporter> & mReporter;
+    };
+
+    typedef function<void(Sequential &, const json &)> LayerBuilder;
+
+    // Keyed by the lower case op
+    static const unordered_map<string, LayerBuilder> gLayerBuilders =
+    {
+        { "dense", [](Sequential & s, const json & j) { s.AddDense(j); } },
+        { "conv1d", [](Sequential & s, const json & j) { s.AddConv1D(j); } },
+        { "conv2d", [](Sequential & s, const json & j) { s.AddConv2D(j); } },
+        { "depthwiseconv2d", [](Sequential & s, const json & j) { s.AddDepthwiseConv2D(j); } },
+        { "separableconv2d", [](Sequential & s, const json & j) { s.AddSeparableConv2D(j); } },
+        { "activation", [](Sequential & s, const json & j) { s.AddActivation(j); } },
+        { "dropout", [](Sequential & s, const json & j) { s.AddDropout(j); } },
+        { "flatten", [](Sequential & s, const json & j) { s.AddFlatten(j); } },
+        { "maxpooling1d", [](Sequential & s, const json & j) { s.AddMaxPooling1D(j); } },
+        { "maxpooling2d", [](Sequential & s, const json & j) { s.AddMaxPooling2D(j); } },
+        { "averagepooling1d", [](Sequential & s, const json & j) { s.AddAveragePooling1D(j); } },
+        { "averagepooling2d", [](Sequential & s, const json & j) { s.AddAveragePooling2D(j); } },
+        { "globalmaxpooling1d", [](Sequential & s, const json & j) { s.AddGlobalMaxPooling1D(j); } },
+        { "embedding", [](Sequential & s, const json & j) { s.AddEmbedding(j); } },
+        { "lstm", [](Sequential & s, const json & j) { s.AddLSTM(j); } },
+        { "gru", [](Sequential & s, const json & j) { s.AddGRU(j); } }
+    };
+
+    // A single value is a scalar attribute (e.g. Conv1D's kernel_size), otherwise a list.
+    static json ToJson(const google::protobuf::RepeatedField<int32_t> & values)
+    {
+        if (values.size() == 1)
+            return values.Get(0);
+        return vector<int32_t>(values.cbegin(), values.cend());
+    }
+
+    static json ToJson(const InitializerProto & proto)
+    {
+        json result;
+        result["op"] = proto.op();
+        if (proto.value() != 0.0)
+            result["value"] = proto.value();
+        if (proto.scale() != 0.0)
+            result["scale"] = proto.scale();
+        if (proto.seed() != 0)
+            result["seed"] = proto.seed();
+        return result;
+    }
+
+    // The typed layer in the JSON form expected by the Add* builders. Zero (unset)
+    // scalars are left out, so the builders apply their usual defaults. This is a
+    // shim, not a direct build: it still allocates a small DOM per layer and the
+    // builders still look attributes up by name. It saves the JSON text parsing
+    // only, and keeps one builder per op for both the typed and the JSON graphs;
+    // its cost is a few allocations per layer against the graph construction.
+    static json ToJson(const LayerProto & proto)
+    {
+        json result;
+        result["op"] = proto.op();
+        result["use_bias"] = proto.use_bias();
+
+        if (proto.name().size() > 0)
+            result["name"] = proto.name();
+        if (proto.input_shape_size() > 0)
+            result["input_shape"] = vector<int32_t>(proto.input_shape().cbegin(), proto.input_shape().cend());
+        if (proto.units() > 0)
+            result["units"] = proto.units();
+        if (proto.activation().size() > 0)
+            result["activation"] = proto.activation();
+        if (proto.has_kernel_initializer())
+            result["kernel_initializer"] = ToJson(proto.kernel_initializer());
+        if (proto.has_bias_initializer())
+            result["bias_initializer"] = ToJson(proto.bias_initializer());
+        if (proto.filters() > 0)
+            result["filters"] = proto.filters();
+        if (proto.kernel_size_size() > 0)
+            result["kernel_size"] = ToJson(proto.kernel_size());
+        if (proto.strides_size() > 0)
+            result["strides"] = ToJson(proto.strides());
+        if (proto.padding().size() > 0)
+            result["padding"] = proto.padding();
+        if (proto.pool_size_size() > 0)
+            result["pool_size"] = ToJson(proto.pool_size());
+        // Dropout requires its rate, 0 included
+        if (proto.rate() != 0.0 || utils::ToLower(proto.op()) == "dropout")
+            result["rate"] = proto.rate();
+        if (proto.seed() != 0)
+            result["seed"] = proto.seed();
+        if (proto.input_dim() > 0)
+            result["input_dim"] = proto.input_dim();
+        if (proto.output_dim() > 0)
+            result["output_dim"] = proto.output_dim();
+        if (proto.input_length() > 0)
+            result["input_length"] = proto.input_length();
+        if (proto.recurrent_activation().size() > 0)
+            result["recurrent_activation"] = proto.recurrent_activation();
+        if (proto.has_recurrent_initializer())
+            result["recurrent_initializer"] = ToJson(proto.recurrent_initializer());
+        result["unit_forget_bias"] = proto.unit_forget_bias();
+        if (proto.return_sequences())
+            result["return_sequences"] = true;
+        if (proto.go_backwards())
+            result["go_backwards"] = true;
+        if (proto.dropout() != 0.0)
+            result["dropout"] = proto.dropout();
+        if (proto.recurrent_dropout() != 0.0)
+            result["recurrent_dropout"] = proto.recurrent_dropout();
+        if (proto.has_embeddings_initializer())
+            result["embeddings_initializer"] = ToJson(proto.embeddings_initializer());
+        if (proto.mask_zero())
+            result["mask_zero"] = true;
+        if (proto.hash_buckets() > 0)
+            result["hash_buckets"] = proto.hash_buckets();
+        if (proto.num_hashes() > 0)
+            result["num_hashes"] = proto.num_hashes();
+        if (proto.groups() > 0)
+            result["groups"] = proto.groups();
+        if (proto.depth_multiplier() > 0)
+            result["depth_multiplier"] = proto.depth_multiplier();
+        if (proto.has_depthwise_initializer())
+            result["depthwise_initializer"] = ToJson(proto.depthwise_initializer());
+        if (proto.has_pointwise_initializer())
+            result["pointwise_initializer"] = ToJson(proto.pointwise_initializer());
+
+        return result;
+    }
+
+    // The typed compile parameters in the JSON form read by CreateTrainer and
+    // Evaluate; the same shim as the layers, converted once per command.
+    static json ToJson(const CompileParamsProto & proto)
+    {
+        const auto & optimizer = proto.optimizer();
+
+        json joptimizer;
+        joptimizer["op"] = optimizer.op();
+        if (optimizer.lr() != 0.0)
+            joptimizer["lr"] = optimizer.lr();
+        if (optimizer.momentum() != 0.0)
+            joptimizer["momentum"] = optimizer.momentum();
+        if (optimizer.decay() != 0.0)
+            joptimizer["decay"] = optimizer.decay();
+        if (optimizer.nesterov())
+            joptimizer["nestorov"] = true;
+        if (optimizer.rho() != 0.0)
+            joptimizer["rho"] = optimizer.rho();
+        if (optimizer.epsilon() != 0.0)
+            joptimizer["epsilon"] = optimizer.epsilon();
+        if (optimizer.beta_1() != 0.0)
+            joptimizer["beta_1"] = optimizer.beta_1();
+        if (optimizer.beta_2() != 0.0)
+            joptimizer["beta_2"] = optimizer.beta_2();
+        if (optimizer.weight_decay() != 0.0)
+            joptimizer["weight_decay"] = optimizer.weight_decay();
+        if (optimizer.has_schedule())
+        {
+            const auto & schedule = optimizer.schedule();
+            json jschedule;
+            if (schedule.op().size() > 0)
+                jschedule["op"] = schedule.op();
+            jschedule["per_batch"] = schedule.per_batch();
+            if (schedule.gamma() != 0.0)
+                jschedule["gamma"] = schedule.gamma();
+            if (schedule.step_size() > 0)
+                jschedule["step_size"] = schedule.step_size();
+            if (schedule.warmup() > 0)
+                jschedule["warmup"] = schedule.warmup();
+            if (schedule.min_lr() != 0.0)
+                jschedule["min_lr"] = schedule.min_lr();
+            joptimizer["schedule"] = jschedule;
+        }
+
+        json result;
+        result["optimizer"] = joptimizer;
+        result["loss"] = proto.loss();
+        result["metrics"] = vector<string>(proto.metrics().cbegin(), proto.metrics().cend());
+        if (proto.top_k() > 0)
+            result["top_k"] = proto.top_k();
+        return result;
+    }
 
     Sequential::Sequential()
-        : _dataSource(false)
+        : _workers(1), _parallelMode(cntk_utils::ParallelTrainer::Mode::AllReduce), _accumulationSteps(1), _dataSource(false), _reportBatch(true), _topK(0),
+        _outputCallback(nullptr), _outputOffset(0)
     {
         _bufferMinibatchSource = make_shared<cntk_utils::BufferMinibatchSource>();
     }
@@ -64,6 +285,46 @@ namespace keras
 
         _verbose = 1;
 
+        if (_proto.workers() > 0)
+            _workers = _proto.workers();
+        if (_proto.gradient_accumulation_steps() > 0)
+            _accumulationSteps = _proto.gradient_accumulation_steps();
+        _parallelMode = cntk_utils::ParallelTrainer::ParseMode(_proto.parallel());
+
+        // The typed settings take the JSON form of the fit parameters, which Fit
+        // reads for both the typed and the JSON requests (see ParseFitParameters).
+        if (_proto.has_distributed())
+        {
+            const auto & distributed = _proto.distributed();
+            _distributed["op"] = distributed.op();
+            if (distributed.distribute_after_samples() > 0)
+                _distributed["distribute_after_samples"] = distributed.distribute_after_samples();
+            if (distributed.block_size() > 0)
+                _distributed["block_size"] = distributed.block_size();
+            if (distributed.quantization_bits() > 0)
+                _distributed["quantization_bits"] = distributed.quantization_bits();
+        }
+
+        if (_proto.has_checkpoint())
+        {
+            const auto & checkpoint = _proto.checkpoint();
+            _checkpoint["path"] = checkpoint.path();
+            _checkpoint["every_batches"] = checkpoint.every_batches();
+            _checkpoint["every_minutes"] = checkpoint.every_minutes();
+            _checkpoint["resume"] = checkpoint.resume();
+        }
+
+        if (_proto.has_progress())
+        {
+            const auto & progress = _proto.progress();
+            _progress["async"] = progress.async();
+            _progress["every_batches"] = progress.every_batches();
+            _progress["every_ms"] = progress.every_ms();
+            _progress["epochs_only"] = progress.epochs_only();
+        }
+
+        _frozenLayers.assign(_proto.frozen_layers().cbegin(), _proto.frozen_layers().cend());
+
         if (_proto.nsamples() > 0)
             _nsamples = (size_t)_proto.nsamples();
 
@@ -98,9 +359,60 @@ namespace keras
         case KerasCommand::Predict:
             Predict();
             break;
+
+        case KerasCommand::Evaluate:
+            Evaluate();
+            break;
+
+        case KerasCommand::UnloadModel:
+        case KerasCommand::PinModel:
+        case KerasCommand::UnpinModel:
+        case KerasCommand::CacheStats:
+        case KerasCommand::SetCacheBudget:
+            ManageModelCache();
+            break;
+
+        case KerasCommand::ExportCpp:
+            ExportCpp();
+            break;
         }
     }
 
+    void Sequential::ExportCpp()
+    {
+        LoadModel();
+        _proto.set_cpp_source(cntk_utils::ExportCpp(_model, _proto.cpp_prefix().size() > 0 ? _proto.cpp_prefix() : "keras"));
+        _proto.clear_model();
+    }
+
+    void Sequential::ManageModelCache()
+    {
+        switch (_proto.command())
+        {
+        case KerasCommand::UnloadModel:
+            gModelCache.Unload(_proto.model_uuid());
+            break;
+
+        case KerasCommand::PinModel:
+        case KerasCommand::UnpinModel:
+            gModelCache.Pin(_proto.model_uuid(), _proto.command() == KerasCommand::PinModel);
+            break;
+
+        case KerasCommand::SetCacheBudget:
+            gModelCache.SetBudget((size_t)_proto.cache_budget());
+            break;
+        }
+
+        auto stats = gModelCache.GetStats();
+        auto proto = _proto.mutable_cache_stats();
+        proto->set_hits(stats.hits);
+        proto->set_misses(stats.misses);
+        proto->set_evictions(stats.evictions);
+        proto->set_models(stats.models);
+        proto->set_bytes(stats.bytes);
+        proto->set_budget(stats.budget);
+    }
+
     void Sequential::GetOutput(char ** outData, unsigned * outLen)
     {
         string buffer;
@@ -149,6 +461,11 @@ namespace keras
                 return cntk::NormalInitializer(0.05);
             else if (str == "truncated_normal")
                 return cntk::TruncatedNormalInitializer(0.05);
+            else if (str == "uniform" || str == "random_uniform")
+                return cntk::UniformInitializer(0.05);
+            else if (str == "orthogonal")
+                // CNTK has no orthogonal initializer, Glorot is the closest
+                return cntk::GlorotUniformInitializer();
 
             throw logic_error("'" + str + "' initializer is not supported [yet].");
         }
@@ -170,6 +487,10 @@ namespace keras
                 return cntk::NormalInitializer(jnode.value<double>("scale", 0.05), cntk::SentinelValueForInferParamInitRank, cntk::SentinelValueForInferParamInitRank, jnode.value<unsigned long>("seed", cntk::SentinelValueForAutoSelectRandomSeed));
             else if (op == "truncated_normal")
                 return cntk::TruncatedNormalInitializer(jnode.value<double>("scale", 0.05), jnode.value<unsigned long>("seed", cntk::SentinelValueForAutoSelectRandomSeed));
+            else if (op == "uniform" || op == "random_uniform")
+                return cntk::UniformInitializer(jnode.value<double>("maxval", 0.05), jnode.value<unsigned long>("seed", cntk::SentinelValueForAutoSelectRandomSeed));
+            else if (op == "orthogonal")
+                return cntk::GlorotUniformInitializer(cntk::DefaultParamInitScale, cntk::SentinelValueForInferParamInitRank, cntk::SentinelValueForInferParamInitRank, jnode.value<unsigned long>("seed", cntk::SentinelValueForAutoSelectRandomSeed));
 
             throw logic_error("'" + op + "' initializer is not supported [yet].");
         }
@@ -177,6 +498,13 @@ namespace keras
         throw logic_error("Bad initializer '" + jnode.dump() + "'");
     }
 
+    // Keras' piecewise linear approximation: clip(0.2 * x + 0.5, 0, 1)
+    static cntk::FunctionPtr HardSigmoid(const cntk::Variable & operand)
+    {
+        auto result = cntk::Plus(cntk::ElementTimes(cntk::Constant::Scalar(0.2f), operand), cntk::Constant::Scalar(0.5f));
+        return cntk::Clip(result, cntk::Constant::Scalar(0.0f), cntk::Constant::Scalar(1.0f));
+    }
+
     cntk::FunctionPtr Sequential::GetActivation(const json & jnode, const cntk::Variable & operand)
     {
         if (jnode.is_string())
@@ -192,6 +520,8 @@ namespace keras
                 return cntk::Tanh(operand);
             else if (str == "sigmoid")
                 return cntk::Sigmoid(operand);
+            else if (str == "hard_sigmoid")
+                return HardSigmoid(operand);
 
             throw logic_error("'" + str + "' activation is not supported.");
         }
@@ -209,13 +539,15 @@ namespace keras
                 return cntk::Tanh(operand);
             else if (str == "sigmoid")
                 return cntk::Sigmoid(operand);
+            else if (str == "hard_sigmoid")
+                return HardSigmoid(operand);
 
             throw logic_error("'" + str + "' activation is not supported.");
         }
         throw logic_error("Bad activation '" + jnode.dump() + "'");
     }
 
-    cntk::Variable Sequential::GetInputLayer(const json &jnode)
+    cntk::Variable Sequential::GetInputLayer(const json &jnode, bool sequence)
     {
         cntk::Variable input;
         if (_model != nullptr)
@@ -227,7 +559,11 @@ namespace keras
             auto it = jnode.find("input_shape");
             if (it == jnode.end())
                 throw runtime_error("input_shape missing in the first network layer");
-            cntk::NDShape ndshape(jnode.at("input_shape").get<vector<size_t>>());
+            auto shape = jnode.at("input_shape").get<vector<size_t>>();
+            // Keras' (timesteps, ...) for recurrent layers, the steps are on the sequence axis
+            if (sequence && shape.size() > 1)
+                shape.erase(shape.begin());
+            cntk::NDShape ndshape(shape);
             // mFeatures = cntk::InputVariable(ndshape, Globals::dataType, L"Features", { cntk::Axis::DefaultBatchAxis() });
             _features = cntk::InputVariable(ndshape, globals::dataType, L"Features");
             input = _features;
@@ -315,8 +651,6 @@ namespace keras
 
     void Sequential::AddConv2D(const json & jnode)
     {
-        bool useBias = jnode.value("use_bias", false);
-
         cntk::Variable input = GetInputLayer(jnode);
 
         auto it = jnode.find("filters");
@@ -327,25 +661,57 @@ namespace keras
         if (it == jnode.end())
             throw runtime_error("kernel_size missing in the first network layer");
 
-        // TODO [ivpop] Implement Keras' logic for channels first/last
-        size_t nchannels = input.Shape()[input.Shape().Rank() - 1];
         size_t nfilters = jnode.at("filters").get<size_t>();
+        size_t groups = jnode.value<size_t>("groups", 1);
         cntk::NDShape kernelShape(jnode.at("kernel_size").get<vector<size_t>>());
+        cntk::NDShape strides(jnode.at("strides").get<vector<size_t>>());
 
-        auto strides2D = jnode.at("strides").get<vector<size_t>>();
-        strides2D.push_back(nchannels);
-        cntk::NDShape strides(strides2D);
+        auto padding = jnode.value<string>("padding", "valid");
 
-        // The convolution is really slow on CPU without full sharing.
-        vector<bool> sharing = { true };
+        auto kernelInitializer = CreateInitializer(NodeOrNull(jnode, "kernel_initializer"));
+        auto resultFunc = Convolution2D(input, nfilters, kernelShape, strides, padding == "same", groups, kernelInitializer);
+
+        AddConvBiasAndActivation(jnode, resultFunc, nfilters);
+    }
+
+    void Sequential::AddDepthwiseConv2D(const json & jnode)
+    {
+        cntk::Variable input = GetInputLayer(jnode);
+
+        size_t depthMultiplier = jnode.value<size_t>("depth_multiplier", 1);
+        size_t nchannels = input.Shape()[input.Shape().Rank() - 1];
+        cntk::NDShape kernelShape(jnode.at("kernel_size").get<vector<size_t>>());
+        cntk::NDShape strides(jnode.value<vector<size_t>>("strides", { 1, 1 }));
 
         auto padding = jnode.value<string>("padding", "valid");
 
-        auto kernelInitializer = cntk::GlorotUniformInitializer();
-        auto convolutionParam = cntk::Parameter({ kernelShape[0], kernelShape[1], nchannels, nfilters }, globals::dataType, kernelInitializer);
-        auto resultFunc = cntk::Convolution(convolutionParam, input, strides, sharing, { padding == "same", padding == "same", false });
+        auto depthwiseInitializer = CreateInitializer(NodeOrNull(jnode, "depthwise_initializer"));
+        auto resultFunc = DepthwiseConvolution2D(input, kernelShape, strides, padding == "same", depthMultiplier, depthwiseInitializer);
 
-        if (useBias)
+        AddConvBiasAndActivation(jnode, resultFunc, nchannels * depthMultiplier);
+    }
+
+    void Sequential::AddSeparableConv2D(const json & jnode)
+    {
+        cntk::Variable input = GetInputLayer(jnode);
+
+        size_t nfilters = jnode.at("filters").get<size_t>();
+        size_t depthMultiplier = jnode.value<size_t>("depth_multiplier", 1);
+        cntk::NDShape kernelShape(jnode.at("kernel_size").get<vector<size_t>>());
+        cntk::NDShape strides(jnode.value<vector<size_t>>("strides", { 1, 1 }));
+
+        auto padding = jnode.value<string>("padding", "valid");
+
+        auto depthwiseInitializer = CreateInitializer(NodeOrNull(jnode, "depthwise_initializer"));
+        auto pointwiseInitializer = CreateInitializer(NodeOrNull(jnode, "pointwise_initializer"));
+        auto resultFunc = SeparableConvolution2D(input, nfilters, kernelShape, strides, padding == "same", depthMultiplier, depthwiseInitializer, pointwiseInitializer);
+
+        AddConvBiasAndActivation(jnode, resultFunc, nfilters);
+    }
+
+    void Sequential::AddConvBiasAndActivation(const json & jnode, cntk::FunctionPtr resultFunc, size_t nfilters)
+    {
+        if (jnode.value("use_bias", false))
         {
             auto biasInitializer = CreateInitializer(NodeOrNull(jnode, "bias_initializer"));
             auto plusParam = cntk::Parameter({ 1, 1, nfilters }, globals::dataType, biasInitializer);
@@ -435,25 +801,49 @@ namespace keras
 
     json Sequential::AddEmbedding(const json & jnode)
     {
-        cntk::Variable input = GetInputLayer(jnode);
-
-        // Currently we don't use input_dim. We obtain the input dimension from the
-        // input variable. Unclear yet what is the role of input_dim in Keras.
-        size_t inputDim = jnode.at("input_dim").get<size_t>();
+        // The hashing trick: Int64 or String keys are hashed into hash_buckets rows,
+        // num_hashes times each, and the embedding is the sum of those rows.
+        size_t hashBuckets = jnode.value<size_t>("hash_buckets", 0);
+        size_t numHashes = jnode.value<size_t>("num_hashes", 1);
+        size_t inputDim = hashBuckets > 0 ? hashBuckets : jnode.at("input_dim").get<size_t>();
         size_t outputDim = jnode.at("output_dim").get<size_t>();
 
-        auto it = jnode.find("input_length");
-        if (it != jnode.end())
-            throw runtime_error("input_length is not supported yet in the embedding layer");
-        // size_t inputLength = it->get<size_t>();
+        if (hashBuckets > 0 && numHashes == 0)
+            throw runtime_error("num_hashes must be positive in the hashed embedding layer");
 
-        _features = cntk::InputVariable({ input.Shape()[0] }, globals::dataType, L"Features");
-        _inputVariables.push_back(_features);
+        if (jnode.value("mask_zero", false))
+            throw runtime_error("mask_zero is not supported yet in the embedding layer");
+
+        // input_length is implied by the data: the indices are on the sequence axis,
+        // [nsamples x input_length] or packed variable length sequences.
+        cntk::Variable input;
+        if (_model != nullptr)
+        {
+            if (hashBuckets > 0)
+                throw runtime_error("The hashed embedding layer must be the first layer");
+            input = _model;
+        }
+        else
+        {
+            // The indices are fed as sparse one-hot vectors. Times against a sparse input is
+            // a gather of the embedding columns, and its gradient only touches those columns.
+            wstring featuresName = hashBuckets > 0 ? cntk_utils::HashedInputName(numHashes) : L"Features";
+            _features = cntk::InputVariable({ inputDim }, true, globals::dataType, featuresName);
+            _inputVariables.push_back(_features);
+            input = _features;
+        }
+
+        if (input.Shape().TotalSize() != inputDim)
+            throw runtime_error("The embedding layer's input is not input_dim-dimensional");
 
         string name = GetOrCreateName(jnode);
 
-        auto embeddingParameters = cntk::Parameter({ outputDim, input.Shape()[0] }, globals::dataType, cntk::GlorotUniformInitializer(), globals::device);
-        _model = cntk::Times(embeddingParameters, _features, utils::ToWide(name));
+        auto initializer = NodeOrNull(jnode, "embeddings_initializer");
+        if (initializer.is_null())
+            initializer = NodeOrNull(jnode, "embedding_initializer");
+
+        auto embeddingParameters = cntk::Parameter({ outputDim, inputDim }, globals::dataType, CreateInitializer(initializer), globals::device);
+        _model = cntk::Times(embeddingParameters, input, utils::ToWide(name));
 
         _layersMap[name] = _model;
 
@@ -462,6 +852,178 @@ namespace keras
         return result;
     }
 
+    void Sequential::AddRecurrent(const json & jnode, bool gru)
+    {
+        cntk::Variable input = GetInputLayer(jnode, true);
+
+        if (jnode.value<double>("recurrent_dropout", 0.0) != 0.0)
+            throw runtime_error("recurrent_dropout is not supported yet in the recurrent layers");
+
+        auto rate = jnode.value<double>("dropout", 0.0);
+        if (rate > 0.0)
+            input = cntk::Dropout(input, rate, jnode.value<unsigned long>("seed", cntk::SentinelValueForAutoSelectRandomSeed));
+
+        size_t units = jnode.at("units").get<size_t>();
+        bool useBias = jnode.value("use_bias", true);
+        bool returnSequences = jnode.value("return_sequences", false);
+        bool goBackwards = jnode.value("go_backwards", false);
+
+        auto activationNode = NodeOrNull(jnode, "activation");
+        if (activationNode.is_null())
+            activationNode = "tanh";
+        auto recurrentActivationNode = NodeOrNull(jnode, "recurrent_activation");
+        if (recurrentActivationNode.is_null())
+            recurrentActivationNode = "hard_sigmoid";
+
+        UnaryOp activation = [this, activationNode](const cntk::Variable & operand) { return GetActivation(activationNode, operand); };
+        UnaryOp recurrentActivation = [this, recurrentActivationNode](const cntk::Variable & operand) { return GetActivation(recurrentActivationNode, operand); };
+
+        auto kernelInitializer = CreateInitializer(NodeOrNull(jnode, "kernel_initializer"));
+        auto recurrentInitializer = CreateInitializer(NodeOrNull(jnode, "recurrent_initializer"));
+
+        string name = GetOrCreateName(jnode);
+
+        if (gru)
+            _model = GRU(input, units, activation, recurrentActivation, kernelInitializer, recurrentInitializer, useBias, returnSequences, goBackwards, utils::ToWide(name));
+        else
+            _model = LSTM(input, units, activation, recurrentActivation, kernelInitializer, recurrentInitializer, useBias, jnode.value("unit_forget_bias", true), returnSequences, goBackwards, utils::ToWide(name));
+
+        _layersMap[name] = _model;
+    }
+
+    void Sequential::AddLSTM(const json & jnode)
+    {
+        AddRecurrent(jnode, false);
+    }
+
+    void Sequential::AddGRU(const json & jnode)
+    {
+        AddRecurrent(jnode, true);
+    }
+
+    void Sequential::AddLayer(const json & jnode)
+    {
+        auto op = utils::ToLower(jnode.at("op").get<string>());
+
+        auto it = gLayerBuilders.find(op);
+        if (it == gLayerBuilders.end())
+            throw logic_error("'" + op + "' layer is not supported [yet].");
+
+        auto below = _model != nullptr ? _model->Parameters() : vector<cntk::Parameter>();
+        it->second(*this, jnode);
+
+        // The layer's own parameters, to freeze it by name
+        auto name = jnode.find("name");
+        if (name != jnode.end())
+        {
+            // The name of the layer's output node too, so Predict finds it in the saved model
+            auto root = _model->RootFunction();
+            if (root->Name().empty())
+                root->SetName(utils::ToWide(name->get<string>()));
+            _layersMap[name->get<string>()] = _model;
+
+            unordered_set<cntk::Parameter> previous(below.begin(), below.end());
+            auto & parameters = _layerParameters[name->get<string>()];
+            for (const auto & parameter : _model->Parameters())
+                if (!previous.count(parameter))
+                    parameters.push_back(parameter);
+        }
+    }
+
+    // Keras' decay and the schedules are a piecewise constant CNTK schedule with a value per epoch or,
+    // with per_batch [and always with decay], per minibatch. warmup and step_size are in the same units.
+    cntk::LearningRateSchedule Sequential::CreateLearningRateSchedule(double learningRate, double decay, const json & jnode)
+    {
+        json schedule = jnode.is_string() ? json({ { "op", jnode.get<string>() } }) : jnode.is_object() ? jnode : json::object();
+
+        auto op = utils::ToLower(schedule.value<string>("op", "constant"));
+        if (op == "constant" && decay == 0.0)
+            return cntk::LearningRateSchedule(learningRate);
+
+        // With gradient accumulation a batch is an update, accumulationSteps minibatches
+        bool perBatch = decay != 0.0 || schedule.value("per_batch", false);
+        size_t updateSize = _batchSize * _accumulationSteps;
+        size_t batchesPerEpoch = max<size_t>(1, (_nsamples + updateSize - 1) / updateSize);
+        size_t steps = perBatch ? _nepochs * batchesPerEpoch : _nepochs;
+        size_t unit = perBatch ? updateSize : max<size_t>(1, _nsamples);
+        // Hogwild's learners only see their share of the samples
+        if (_workers > 1 && _parallelMode == cntk_utils::ParallelTrainer::Mode::Hogwild)
+            unit = max<size_t>(1, unit / _workers);
+
+        size_t warmup = schedule.value<size_t>("warmup", 0);
+        double gamma = schedule.value<double>("gamma", op == "step" ? 0.1 : 0.95);
+        size_t stepSize = max<size_t>(1, schedule.value<size_t>("step_size", 1));
+        double minLearningRate = schedule.value<double>("min_lr", 0.0);
+
+        vector<double> values(max<size_t>(1, steps));
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            double lr = learningRate;
+            if (i < warmup)
+            {
+                lr = learningRate * (i + 1) / warmup;
+            }
+            else if (op == "step")
+            {
+                lr = learningRate * pow(gamma, (double)((i - warmup) / stepSize));
+            }
+            else if (op == "exponential")
+            {
+                lr = learningRate * pow(gamma, (double)(i - warmup));
+            }
+            else if (op == "cosine")
+            {
+                double progress = steps > warmup ? (double)(i - warmup) / (steps - warmup) : 0.0;
+                lr = minLearningRate + (learningRate - minLearningRate) * 0.5 * (1.0 + cos(M_PI * progress));
+            }
+            else if (op != "constant")
+            {
+                throw logic_error("'" + op + "' learning rate schedule is not supported [yet].");
+            }
+
+            values[i] = lr / (1.0 + decay * i);
+        }
+
+        return cntk::LearningRateSchedule(values, unit);
+    }
+
+    // Every rank is a process started by mpiexec, on one or more hosts. The data parallel learners
+    // aggregate the gradients [quantized to quantization_bits with 1bit] every minibatch, block
+    // momentum aggregates the models every block_size samples.
+    cntk::LearnerPtr Sequential::CreateDistributedLearner(const cntk::LearnerPtr & learner)
+    {
+        if (_dataSource)
+            throw runtime_error("Distributed training needs in-memory inputs");
+
+        json distributed = _distributed.is_string() ? json({ { "op", _distributed.get<string>() } }) : _distributed;
+
+        auto op = utils::ToLower(distributed.value<string>("op", "data_parallel"));
+        size_t distributeAfterSamples = distributed.value<size_t>("distribute_after_samples", 0);
+
+        if (op == "data_parallel" || op.empty())
+        {
+            _communicator = cntk::MPICommunicator();
+            return cntk::CreateDataParallelDistributedLearner(_communicator, learner, distributeAfterSamples);
+        }
+        else if (op == "1bit")
+        {
+            // Needs a CNTK build with 1-bit SGD
+            auto communicator = cntk::QuantizedMPICommunicator(true, true, distributed.value<size_t>("quantization_bits", 1));
+            _communicator = communicator;
+            return cntk::CreateQuantizedDataParallelDistributedLearner(communicator, learner, distributeAfterSamples);
+        }
+        else if (op == "block_momentum")
+        {
+            if (distributed.find("block_size") == distributed.end())
+                throw runtime_error("block_size missing in the block momentum distributed learner");
+
+            _communicator = cntk::MPICommunicator();
+            return cntk::CreateBlockMomentumDistributedLearner(_communicator, learner, distributeAfterSamples, distributed.at("block_size").get<size_t>());
+        }
+
+        throw logic_error("'" + op + "' distributed learner is not supported [yet].");
+    }
+
     cntk::LearnerPtr Sequential::CreateLearner(json & jnode)
     {
         auto optimizer = jnode["optimizer"];
@@ -475,51 +1037,55 @@ namespace keras
         else
             throw logic_error("Bad optimizer '" + jnode.dump() + "'");
 
-        if (optimizerString == "sgd")
-        {
-            double learningRate = 0.01;
-            double momentum = 0.0;
-            double decay = 0.0;
-            bool nestorov = false;
+        // Keras' defaults, overridden by the optimizer's parameters
+        if (!optimizer.is_object())
+            optimizer = json::object();
 
-            cntk::AdditionalLearningOptions options;
+        auto value = [&optimizer](const char * name, double defaultValue) { return optimizer.value<double>(name, defaultValue); };
 
-            if (optimizer.is_object())
-            {
-                learningRate = optimizer.value<double>("lr", 0.01);
-                momentum = optimizer.value<double>("momentum", 0.0);
-                decay = optimizer.value<double>("decay", 0.0);
-                nestorov = optimizer.value<bool>("nestorov", false);
-            }
+        cntk::AdditionalLearningOptions options;
+        auto parameters = _model->Parameters();
 
-            auto lrs = cntk::LearningRateSchedule(learningRate);
+        if (optimizerString == "sgd")
+        {
+            double momentum = value("momentum", 0.0);
+            bool nestorov = optimizer.value<bool>("nestorov", false);
+            auto lrs = CreateLearningRateSchedule(value("lr", 0.01), value("decay", 0.0), NodeOrNull(optimizer, "schedule"));
 
-            auto result = cntk::SGDLearner(_model->Parameters(), lrs, options);
+            if (momentum == 0.0)
+                return cntk::SGDLearner(parameters, lrs, options);
 
-            return result;
+            // Keras' momentum doesn't scale the gradient by (1 - momentum)
+            if (nestorov)
+                return cntk::NesterovLearner(parameters, lrs, cntk::MomentumSchedule(momentum), false, options);
+            return cntk::MomentumSGDLearner(parameters, lrs, cntk::MomentumSchedule(momentum), false, options);
+        }
+        else if (optimizerString == "adam" || optimizerString == "adamw")
+        {
+            auto lrs = CreateLearningRateSchedule(value("lr", 0.001), value("decay", 0.0), NodeOrNull(optimizer, "schedule"));
+            auto adam = cntk::AdamLearner(parameters, lrs, cntk::MomentumSchedule(value("beta_1", 0.9)), true,
+                cntk::MomentumSchedule(value("beta_2", 0.999)), value("epsilon", 1e-08), false, options);
+
+            // CNTK's Adam has no decoupled weight decay, AdamW's scales the parameters after every update
+            if (optimizerString == "adamw")
+                return make_shared<cntk_utils::DecoupledWeightDecay>(adam, value("weight_decay", 0.01));
+            return adam;
+        }
+        else if (optimizerString == "rmsprop")
+        {
+            // A constant step multiplier [inc = dec = max = min = 1] is Keras' plain RMSProp
+            auto lrs = CreateLearningRateSchedule(value("lr", 0.001), value("decay", 0.0), NodeOrNull(optimizer, "schedule"));
+            return cntk::RMSPropLearner(parameters, lrs, value("rho", 0.9), 1.0, 1.0, 1.0, 1.0, false, options);
+        }
+        else if (optimizerString == "adagrad")
+        {
+            auto lrs = CreateLearningRateSchedule(value("lr", 0.01), value("decay", 0.0), NodeOrNull(optimizer, "schedule"));
+            return cntk::AdaGradLearner(parameters, lrs, false, options);
         }
         else if (optimizerString == "adadelta")
         {
-            double learningRate = 0.01;
-            double rho = 0.95;
-            double epsilon = 1e-08;
-            double decay = 0.0;
-
-            cntk::AdditionalLearningOptions options;
-
-            if (optimizer.is_object())
-            {
-                learningRate = optimizer.value<double>("lr", 0.01);
-                rho = optimizer.value<double>("rho", 0.95);
-                epsilon = optimizer.value<double>("epsilon", 1e-08);
-                decay = optimizer.value<double>("decay", 0.0);
-            }
-
-            auto lrs = cntk::LearningRateSchedule(learningRate);
-
-            auto result = cntk::AdaDeltaLearner(_model->Parameters(), lrs, rho, epsilon, options);
-
-            return result;
+            auto lrs = CreateLearningRateSchedule(value("lr", 0.01), value("decay", 0.0), NodeOrNull(optimizer, "schedule"));
+            return cntk::AdaDeltaLearner(parameters, lrs, value("rho", 0.95), value("epsilon", 1e-08), options);
         }
         else
         {
@@ -527,7 +1093,8 @@ namespace keras
         }
     }
 
-    void Sequential::CreateLabels(const wstring & name = L"Labels")
+    // Sparse labels are the class indices, fed as one-hot vectors of the output's size
+    void Sequential::CreateLabels(const wstring & name, bool sparse)
     {
         // The labels are the last input variable
         if (_proto.inputs_size() > 0)
@@ -535,12 +1102,23 @@ namespace keras
             _dataSource = false;
             auto id = _proto.inputs_size() - 1;
             CNTK::NDShape shape(std::vector<size_t>(_proto.inputs().Get(id).shape().cbegin(), _proto.inputs().Get(id).shape().cend()));
-            _labels = cntk::InputVariable(shape.SubShape(1), globals::dataType, name);
+            if (sparse)
+            {
+                if (_model->Output().DynamicAxes().size() == 1)
+                    _labels = cntk::InputVariable({ _model->Output().Shape().TotalSize() }, true, globals::dataType, name, { cntk::Axis::DefaultBatchAxis() });
+                else
+                    _labels = cntk::InputVariable({ _model->Output().Shape().TotalSize() }, true, globals::dataType, name);
+            }
+            // One label per sequence when the model reduces the sequence axis [e.g. the last step of a LSTM]
+            else if (_model->Output().DynamicAxes().size() == 1)
+                _labels = cntk::InputVariable(shape.SubShape(1), globals::dataType, name, { cntk::Axis::DefaultBatchAxis() });
+            else
+                _labels = cntk::InputVariable(shape.SubShape(1), globals::dataType, name);
         }
         else
         {
             _dataSource = true;
-            _labels = cntk::InputVariable({ _proto.nlabels() }, globals::dataType, name);
+            _labels = cntk::InputVariable({ _proto.nlabels() }, sparse, globals::dataType, name);
             _nsamples = _proto.nsamples();
         }
         _inputVariables.push_back(_labels);
@@ -555,19 +1133,48 @@ namespace keras
         return cntk::Minus(cntk::Constant::Scalar(0.0f), cntk::ReduceSum(result, cntk::Axis::AllStaticAxes()));
     }
 
+    // A softmax output is fused with the loss: CrossEntropyWithSoftmax of its input is a single,
+    // numerically stable pass. Other outputs go through softmax(log(p)) = p / sum(p), Keras'
+    // normalization. The targets can be sparse.
+    __declspec(dllexport) cntk::FunctionPtr SoftmaxCrossEntropy(const cntk::Variable & prediction, const cntk::Variable & targets, const wstring& name)
+    {
+        auto owner = prediction.Owner();
+        if (owner != nullptr && owner->OpName() == L"Softmax" && prediction.Shape().Rank() == 1)
+            return cntk::CrossEntropyWithSoftmax(owner->Inputs()[0], targets, name);
+
+        auto clipped = cntk::Clip(prediction, cntk::Constant::Scalar((float)globals::epsilon), cntk::Constant::Scalar(1.0f - (float)globals::epsilon));
+        return cntk::CrossEntropyWithSoftmax(cntk::Log(clipped), targets, name);
+    }
+
     __declspec(dllexport) cntk::FunctionPtr CategoricalAccuracy(const cntk::Variable & prediction, const cntk::Variable & targets, const cntk::Axis & axis, const wstring& name)
     {
         return cntk::Equal(cntk::Argmax(targets, axis), cntk::Argmax(prediction, axis));
     }
 
+    // A metric per sample, null when not supported
+    cntk::FunctionPtr Sequential::CreateMetric(const string & name, const json & jnode)
+    {
+        if (name == "accuracy" || name == "categorical_accuracy" || name == "sparse_categorical_accuracy")
+        {
+            // Argmax doesn't take sparse labels, the accuracy is one minus the classification error
+            if (_labels.IsSparse())
+                return cntk::Minus(cntk::Constant::Scalar(1.0f), cntk::ClassificationError(_model, _labels));
+            return CategoricalAccuracy(_model, _labels, cntk::Axis::AllStaticAxes());
+        }
+
+        if (name == "top_k_categorical_accuracy" || name == "sparse_top_k_categorical_accuracy")
+            return cntk::Minus(cntk::Constant::Scalar(1.0f), cntk::ClassificationError(_model, _labels, jnode.value<size_t>("top_k", 5)));
+
+        return nullptr;
+    }
+
     void Sequential::CreateErrorFunction(json & jnode)
     {
         for (json::iterator it = jnode["metrics"].begin(); it != jnode["metrics"].end(); ++it)
         {
-            auto & jobj = *it;
-
-            if (jobj.get<string>() == "accuracy")
-                _error = CategoricalAccuracy(_model, _labels, cntk::Axis::AllStaticAxes());
+            auto metric = CreateMetric(it->get<string>(), jnode);
+            if (metric != nullptr)
+                _error = metric;
         }
     }
 
@@ -584,8 +1191,13 @@ namespace keras
 
         cntk::FunctionPtr result = nullptr;
 
-        if (lossString == "categorical_crossentropy")
-            result = CategoricalCrossEntropy(_model, _labels);
+        auto owner = _model->Output().Owner();
+        bool softmax = owner != nullptr && owner->OpName() == L"Softmax";
+
+        if (lossString == "sparse_categorical_crossentropy")
+            result = SoftmaxCrossEntropy(_model, _labels);
+        else if (lossString == "categorical_crossentropy")
+            result = softmax ? SoftmaxCrossEntropy(_model, _labels) : CategoricalCrossEntropy(_model, _labels);
         else if (lossString == "binary_crossentropy")
             result = CNTK::BinaryCrossEntropy(_model, _labels);
         else
@@ -599,6 +1211,18 @@ namespace keras
         _batchSize = jnode.value<int>("batch_size", 32);
         _nepochs = jnode.value<int>("epochs", 10);
         _verbose = jnode.value<int>("verbose", 1);
+        _workers = max<size_t>(1, jnode.value<size_t>("workers", _workers));
+        _accumulationSteps = max<size_t>(1, jnode.value<size_t>("gradient_accumulation_steps", _accumulationSteps));
+        if (jnode.find("parallel") != jnode.end())
+            _parallelMode = cntk_utils::ParallelTrainer::ParseMode(jnode.at("parallel").get<string>());
+        if (jnode.find("distributed") != jnode.end())
+            _distributed = jnode.at("distributed");
+        if (jnode.find("checkpoint") != jnode.end())
+            _checkpoint = jnode.at("checkpoint");
+        if (jnode.find("progress") != jnode.end())
+            _progress = jnode.at("progress");
+        if (jnode.find("frozen_layers") != jnode.end())
+            _frozenLayers = jnode.at("frozen_layers").get<vector<string>>();
     }
 
     void Sequential::SetupInputs()
@@ -606,8 +1230,8 @@ namespace keras
         if (_proto.inputs_size() > 0)
         {
             for (auto i = 0; i < _proto.inputs_size(); ++i)
-                _bufferMinibatchSource->Add(_proto.inputs().Get(i), _inputVariables.at(i).Shape());
-            _nsamples = _proto.inputs().Get(0).shape().Get(0);
+                _bufferMinibatchSource->Add(_proto.inputs().Get(i), _inputVariables.at(i));
+            _nsamples = _bufferMinibatchSource->GetNumSamples();
         }
         else
         {
@@ -615,67 +1239,219 @@ namespace keras
         }
     }
 
-    void Sequential::UpdateProgress(HistoryCallbackType type, size_t id, const HistoryValues & historyValues)
+    static void DeliverProgress(const cntk_utils::ProgressReporter::Event & event)
     {
-        if (gProgressCallback == nullptr)
-            return;
-
         HistoryProto proto;
-        for (const auto & kv : historyValues)
+        for (const auto & kv : event.values)
         {
             proto.add_names(kv.first);
             proto.add_values(kv.second);
         }
-        proto.set_id((unsigned)id);
-        proto.set_type(type);
+        proto.set_id((unsigned)event.id);
+        proto.set_type((HistoryCallbackType)event.type);
 
         string buffer;
         proto.SerializeToString(&buffer);
         gProgressCallback(&buffer[0], (unsigned)buffer.size());
     }
 
+    void Sequential::UpdateProgress(HistoryCallbackType type, size_t id, const HistoryValues & historyValues)
+    {
+        if (gProgressCallback == nullptr)
+            return;
+
+        // Only the first rank reports the progress of distributed training
+        if (_communicator && _communicator->CurrentWorker().m_globalRank != 0)
+            return;
+
+        // A batch's end is reported with its beginning
+        bool batch = type == HistoryCallbackType::BatchBegin || type == HistoryCallbackType::BatchEnd;
+        if (type == HistoryCallbackType::BatchBegin)
+            _reportBatch = _progressThrottle.Next();
+        if (batch && !_reportBatch)
+            return;
+
+        if (_progressReporter)
+            _progressReporter->Post({ (int)type, id, historyValues }, batch);
+        else
+            DeliverProgress({ (int)type, id, historyValues });
+    }
+
+    // The parameters are copied on this thread, the checkpoint is serialized on the writer's
+    cntk_utils::Checkpoint Sequential::CreateCheckpoint(const vector<cntk::LearnerPtr> & learners, const cntk::MinibatchSourcePtr & minibatchSource,
+        size_t epoch, size_t batchId, size_t samples)
+    {
+        cntk_utils::Checkpoint checkpoint;
+        checkpoint.model = _model->Clone(cntk::ParameterCloningMethod::Clone);
+        for (const auto & learner : learners)
+            checkpoint.learners.push_back(learner->CreateCheckpoint());
+
+        // The end of an epoch is the beginning of the next one
+        if (samples >= _nsamples)
+        {
+            ++epoch;
+            batchId = 0;
+            samples = 0;
+        }
+
+        checkpoint.state[L"epoch"] = epoch;
+        checkpoint.state[L"batch"] = batchId;
+        checkpoint.state[L"samples"] = samples;
+        checkpoint.state[L"source"] = minibatchSource->GetCheckpointState();
+        return checkpoint;
+    }
+
+    void Sequential::RestoreCheckpoint(const cntk_utils::Checkpoint & checkpoint, const vector<cntk::LearnerPtr> & learners, const cntk::MinibatchSourcePtr & minibatchSource,
+        size_t & epoch, size_t & batchId, size_t & samples)
+    {
+        auto parameters = _model->Parameters();
+        auto savedParameters = checkpoint.model->Parameters();
+        if (parameters.size() != savedParameters.size() || learners.size() != checkpoint.learners.size())
+            throw runtime_error("The checkpoint doesn't match the model");
+
+        for (size_t i = 0; i < parameters.size(); ++i)
+        {
+            if (parameters[i].Shape() != savedParameters[i].Shape())
+                throw runtime_error("The checkpoint doesn't match the model");
+            parameters[i].Value()->CopyFrom(*savedParameters[i].Value());
+        }
+
+        for (size_t i = 0; i < learners.size(); ++i)
+            learners[i]->RestoreFromCheckpoint(checkpoint.learners[i]);
+
+        epoch = checkpoint.state[L"epoch"].Value<size_t>();
+        batchId = checkpoint.state[L"batch"].Value<size_t>();
+        samples = checkpoint.state[L"samples"].Value<size_t>();
+        minibatchSource->RestoreFromCheckpoint(checkpoint.state[L"source"].Value<cntk::Dictionary>());
+    }
+
+    // Warm start: the graph's layers, if any, are added on top of the loaded model
+    void Sequential::LoadBaseModel()
+    {
+        cntk::FunctionPtr model;
+        if (_proto.model_uuid().size() > 0)
+        {
+            model = gModelCache.Find(_proto.model_uuid());
+            if (model == nullptr)
+                throw runtime_error("The cached model [" + _proto.model_uuid() + "] was not found");
+        }
+        else if (_proto.model_path().size() > 0)
+        {
+            model = CNTK::Function::Load(utils::ToWide(_proto.model_path()), globals::device);
+        }
+        else
+        {
+            model = cntk_utils::LoadModel(_proto.model().data(), _proto.model().size());
+        }
+
+        // A copy, the cached model keeps its weights
+        _model = model->Clone(cntk::ParameterCloningMethod::Clone);
+
+        auto arguments = _model->Arguments();
+        if (arguments.size() != 1)
+            throw runtime_error("The model to fine-tune must have a single input");
+        _features = arguments[0];
+        _inputVariables.push_back(_features);
+
+        // The output is the fine-tuned model, not this one
+        _proto.clear_model();
+        _proto.clear_model_path();
+        _proto.clear_model_uuid();
+    }
+
+    // The frozen parameters become constants: the learner doesn't see them and no gradients are
+    // computed for them. The layers of a loaded model have no boundaries in the CNTK graph, freezing
+    // one of them freezes everything below it as well.
+    void Sequential::FreezeLayers()
+    {
+        if (_frozenLayers.empty())
+            return;
+
+        unordered_map<cntk::Variable, cntk::Variable> replacements;
+        for (const auto & argument : _model->Arguments())
+            replacements.insert({ argument, argument });
+
+        for (const auto & name : _frozenLayers)
+        {
+            vector<cntk::Parameter> parameters;
+            auto it = _layerParameters.find(name);
+            if (it != _layerParameters.end())
+            {
+                parameters = it->second;
+            }
+            else
+            {
+                auto layer = FindLayer(name);
+                if (layer == nullptr)
+                    throw runtime_error("The layer '" + name + "' to freeze was not found");
+                parameters = cntk::AsComposite(layer)->Parameters();
+            }
+
+            for (const auto & parameter : parameters)
+                replacements.insert({ parameter, cntk::Constant(parameter.Value()->DeepClone(), parameter.Name()) });
+        }
+
+        _model = _model->Clone(cntk::ParameterCloningMethod::Share, replacements);
+        if (_model->Parameters().empty())
+            throw runtime_error("All the layers are frozen, there is nothing to train");
+    }
+
+    // The model to train: the loaded model, if any, and the layers of the graph. Returns the JSON
+    // graph, null with the typed one.
+    json Sequential::BuildModel()
+    {
+        json jroot;
+
+        if (_proto.model_uuid().size() > 0 || _proto.model_path().size() > 0 || _proto.model().size() > 0)
+            LoadBaseModel();
+
+        if (_proto.layers_size() > 0)
+        {
+            // The typed graph, converted per layer without text parsing
+            for (const auto & layer : _proto.layers())
+                AddLayer(ToJson(layer));
+        }
+        else if (_proto.graph().size() > 0)
+        {
+            jroot = json::parse(_proto.graph().c_str());
+
+            // The operators are under the graph element
+            for (json::iterator it = jroot["graph"].begin(); it != jroot["graph"].end(); ++it)
+                AddLayer(*it);
+        }
+
+        if (_model == nullptr)
+            throw runtime_error("The model has no layers");
+        return jroot;
+    }
+
+    void Sequential::SaveModel()
+    {
+        cntk_utils::SaveModel(_model, *_proto.mutable_model());
+    }
+
     void Sequential::Fit()
     {
         cntk::DeviceDescriptor::TrySetDefaultDevice(globals::device);
 
-        auto jroot = json::parse(_proto.graph().c_str());
-
-        // The operators are under the graph element
-        for (json::iterator it = jroot["graph"].begin(); it != jroot["graph"].end(); ++it)
-        {
-            auto & jnode = *it;
-
-            auto op = utils::ToLower(jnode["op"].get<string>());
-
-            if (op == "dense")
-                AddDense(jnode);
-            else if (op == "conv2d")
-                AddConv2D(jnode);
-            else if (op == "conv1d")
-                AddConv1D(jnode);
-            else if (op == "activation")
-                AddActivation(jnode);
-            else if (op == "dropout")
-                AddDropout(jnode);
-            else if (op == "flatten")
-                AddFlatten(jnode);
-            else if (op == "maxpooling1d")
-                AddMaxPooling1D(jnode);
-            else if (op == "maxpooling2d")
-                AddMaxPooling2D(jnode);
-            else if (op == "averagepooling1d")
-                AddAveragePooling1D(jnode);
-            else if (op == "averagepooling2d")
-                AddAveragePooling2D(jnode);
-            else if (op == "embedding")
-                AddEmbedding(jnode);
-        }
-
-        CreateLabels();
-
-        // The compile parameters
-        auto jnode = jroot["compile_params"];
+        json jroot = BuildModel();
+
+        // The compile parameters, the loss decides the format of the labels
+        auto jcompile = _proto.has_compile() ? ToJson(_proto.compile()) : jroot["compile_params"];
+        auto jloss = NodeOrNull(jcompile, "loss");
+        CreateLabels(L"Labels", jloss.is_string() && jloss.get<string>() == "sparse_categorical_crossentropy");
+
+        // The learning rate schedules need the number of samples and epochs
+        auto jnode = NodeOrNull(jroot, "fit_params");
+        if (!jnode.is_null())
+            ParseFitParameters(jnode);
+        SetupInputs();
+        FreezeLayers();
+
+        jnode = jcompile;
         _learner = CreateLearner(jnode);
+        if (!_distributed.is_null())
+            _learner = CreateDistributedLearner(_learner);
         _loss = CreateLossFunction(jnode);
         CreateErrorFunction(jnode);
 
@@ -683,15 +1459,33 @@ namespace keras
         auto history = make_shared<cntk_utils::HistoryAccumulator>();
         auto trainer = cntk::CreateTrainer(_model, _loss, _error, { _learner }, { history });
 
-        jnode = NodeOrNull(jroot, "fit_params");
-        if (!jnode.is_null())
-            ParseFitParameters(jnode);
+        // Outlives the workers
+        MaxCPUThreadsScope maxCPUThreads;
+        unique_ptr<cntk_utils::ParallelTrainer> parallelTrainer;
+        size_t workerBatchSize = _batchSize;
+        if ((_workers > 1 || _accumulationSteps > 1) && _communicator)
+            throw runtime_error("Local parallel training and gradient accumulation can't be combined with distributed training");
+        if (_workers > 1 || _accumulationSteps > 1)
+        {
+            if (_dataSource)
+                throw runtime_error("Parallel training and gradient accumulation need in-memory inputs");
+
+            // CNTK's own threads would compete with the workers
+            if (_workers > 1)
+                cntk::SetMaxNumCPUThreads(max<size_t>(1, thread::hardware_concurrency() / _workers));
+
+            auto createLearner = [this, &jnode]() { return CreateLearner(jnode); };
+            parallelTrainer.reset(new cntk_utils::ParallelTrainer(_model, _loss, _error, { _features }, _labels, createLearner, _workers, _parallelMode, _accumulationSteps));
+
+            // AllReduce splits the minibatch between the workers, the update is the same as a single worker's
+            if (_parallelMode == cntk_utils::ParallelTrainer::Mode::AllReduce)
+                workerBatchSize = max<size_t>(1, (_batchSize + _workers - 1) / _workers);
+        }
 
         CNTK::StreamInformation featureStreamInfo;
         CNTK::StreamInformation labelStreamInfo;
 
         // The minibatch source
-        SetupInputs();
         CNTK::MinibatchSourcePtr minibatchSource;
         if (_dataSource)
         {
@@ -719,6 +1513,38 @@ namespace keras
         size_t numBatchesToTrain = (_nepochs * _nsamples) / _batchSize;
         size_t outputFrequencyInBatches = numBatchesToTrain;
 
+        // Checkpoints every every_batches batches and/or every_minutes minutes, resuming from the last one
+        auto learners = parallelTrainer ? parallelTrainer->Learners() : vector<cntk::LearnerPtr>{ _learner };
+        unique_ptr<cntk_utils::CheckpointWriter> checkpointWriter;
+        size_t checkpointBatches = 0;
+        double checkpointMinutes = 0.0;
+        size_t startEpoch = 0;
+        size_t startBatch = 0;
+        size_t startSamples = 0;
+        if (!_checkpoint.is_null())
+        {
+            auto checkpointPath = utils::ToWide(_checkpoint.at("path").get<string>());
+            checkpointBatches = _checkpoint.value<size_t>("every_batches", 0);
+            checkpointMinutes = _checkpoint.value<double>("every_minutes", 0.0);
+
+            if (_checkpoint.value("resume", true) && cntk_utils::CheckpointWriter::Exists(checkpointPath))
+                RestoreCheckpoint(cntk_utils::CheckpointWriter::Read(checkpointPath, globals::device), learners, minibatchSource, startEpoch, startBatch, startSamples);
+
+            // Every rank has the same checkpoint, the first one writes it
+            if (!_communicator || _communicator->CurrentWorker().m_globalRank == 0)
+                checkpointWriter.reset(new cntk_utils::CheckpointWriter(checkpointPath));
+        }
+
+        size_t batchesSinceCheckpoint = 0;
+        auto lastCheckpoint = chrono::steady_clock::now();
+
+        // Throttled batch events, optionally delivered from a background thread
+        auto progress = _progress.is_object() ? _progress : json::object();
+        _progressThrottle = cntk_utils::ProgressThrottle(progress.value<size_t>("every_batches", 0), progress.value<size_t>("every_ms", 0), !progress.value("epochs_only", false));
+        ProgressReporterScope progressReporter(_progressReporter);
+        if (progress.value("async", false) && gProgressCallback != nullptr)
+            _progressReporter.reset(new cntk_utils::ProgressReporter(DeliverProgress));
+
         UpdateProgress(HistoryCallbackType::TrainingBegin, 0, {});
 
         double trainLossValue = 0.0;
@@ -728,49 +1554,215 @@ namespace keras
         double epochSamples = 0.0;
         double batchSamples = 0.0;
 
-        for (size_t epoch = 0; epoch < _nepochs; ++epoch)
+        for (size_t epoch = startEpoch; epoch < _nepochs; ++epoch)
         {
             epochSamples = 0.0;
 
             UpdateProgress(HistoryCallbackType::EpochBegin, epoch, { { "acc", evaluationValue },{ "loss", trainLossValue } });
 
-            for (size_t samples = 0, batchId = 0; samples < _nsamples; ++batchId)
+            for (size_t samples = startSamples, batchId = startBatch; samples < _nsamples; ++batchId)
             {
                 UpdateProgress(HistoryCallbackType::BatchBegin, batchId, { { "acc", evaluationValue },{ "loss", trainLossValue } });
 
-                auto minibatchData = minibatchSource->GetNextMinibatch(_batchSize, globals::device);
-                trainer->TrainMinibatch({ { _features, minibatchData[featureStreamInfo] },{ _labels, minibatchData[labelStreamInfo] } }, globals::device);
-                double trainLossValue = trainer->PreviousMinibatchLossAverage();
-                double evaluationValue = trainer->PreviousMinibatchEvaluationAverage();
-
-                batchSamples = (double)trainer->PreviousMinibatchSampleCount();
-                samples += (unsigned long)trainer->PreviousMinibatchSampleCount();
+                double trainLossValue;
+                double evaluationValue;
+
+                if (parallelTrainer)
+                {
+                    // A minibatch per worker and accumulation step, fewer at the end of the epoch
+                    vector<cntk_utils::MinibatchArguments> minibatches;
+                    while (minibatches.size() < parallelTrainer->MinibatchesPerUpdate() && samples < _nsamples)
+                    {
+                        auto minibatchData = minibatchSource->GetNextMinibatch(workerBatchSize, globals::device);
+                        minibatches.push_back({ { _features, minibatchData[featureStreamInfo] },{ _labels, minibatchData[labelStreamInfo] } });
+                        samples += minibatchData[featureStreamInfo].numberOfSequences;
+                    }
+
+                    parallelTrainer->TrainMinibatches(minibatches, globals::device);
+                    trainLossValue = parallelTrainer->PreviousMinibatchLossAverage();
+                    evaluationValue = parallelTrainer->PreviousMinibatchEvaluationAverage();
+                    batchSamples = (double)parallelTrainer->PreviousMinibatchSampleCount();
+                }
+                else if (_communicator)
+                {
+                    // This rank's shard of the minibatch, possibly empty at the end of the epoch
+                    auto minibatchData = _bufferMinibatchSource->GetNextMinibatch(0, _batchSize, _communicator->Workers().size(), _communicator->CurrentWorker().m_globalRank, globals::device);
+                    if (minibatchData.empty())
+                        trainer->TrainMinibatch(unordered_map<cntk::Variable, cntk::MinibatchData>(), globals::device);
+                    else
+                        trainer->TrainMinibatch({ { _features, minibatchData[featureStreamInfo] },{ _labels, minibatchData[labelStreamInfo] } }, globals::device);
+
+                    batchSamples = (double)trainer->PreviousMinibatchSampleCount();
+                    trainLossValue = batchSamples > 0 ? trainer->PreviousMinibatchLossAverage() : 0.0;
+                    evaluationValue = batchSamples > 0 ? trainer->PreviousMinibatchEvaluationAverage() : 0.0;
+                    samples += _bufferMinibatchSource->GetLastBatchSize();
+                }
+                else
+                {
+                    auto minibatchData = minibatchSource->GetNextMinibatch(_batchSize, globals::device);
+                    trainer->TrainMinibatch({ { _features, minibatchData[featureStreamInfo] },{ _labels, minibatchData[labelStreamInfo] } }, globals::device);
+                    trainLossValue = trainer->PreviousMinibatchLossAverage();
+                    evaluationValue = trainer->PreviousMinibatchEvaluationAverage();
+
+                    batchSamples = (double)trainer->PreviousMinibatchSampleCount();
+                    // Sequences, not steps, when the inputs are sequences
+                    samples += minibatchData[featureStreamInfo].numberOfSequences;
+                }
                 epochSamples += batchSamples;
                 trainingSamples += batchSamples;
 
                 UpdateProgress(HistoryCallbackType::BatchEnd, batchId, { { "acc", evaluationValue },{ "loss", trainLossValue },{ "nsamples", batchSamples } });
+
+                ++batchesSinceCheckpoint;
+                auto now = chrono::steady_clock::now();
+                if (checkpointWriter && ((checkpointBatches > 0 && batchesSinceCheckpoint >= checkpointBatches) ||
+                    (checkpointMinutes > 0.0 && chrono::duration<double>(now - lastCheckpoint).count() >= 60.0 * checkpointMinutes)))
+                {
+                    checkpointWriter->Write(CreateCheckpoint(learners, minibatchSource, epoch, batchId + 1, samples));
+                    batchesSinceCheckpoint = 0;
+                    lastCheckpoint = now;
+                }
             }
 
             UpdateProgress(HistoryCallbackType::EpochEnd, epoch, { { "acc", evaluationValue },{ "loss", trainLossValue },{ "nsamples", epochSamples } });
+
+            startSamples = 0;
+            startBatch = 0;
         }
 
+        if (checkpointWriter)
+            checkpointWriter->Flush();
+
         UpdateProgress(HistoryCallbackType::TrainingEnd, 0, { { "acc", evaluationValue },{ "loss", trainLossValue },{ "nsamples", trainingSamples } });
+        if (_progressReporter)
+            _progressReporter->Close();
+
+        // MPI can't be initialized again: a single distributed Fit per process
+        if (_communicator)
+            cntk::DistributedCommunicator::Finalize();
+
+        SaveModel();
+    }
+
+    // A session keeps the model, the learner and the trainer between the calls. The labels have
+    // the shape of the model's output, the class index with sparse_categorical_crossentropy.
+    void Sequential::CreateSession()
+    {
+        cntk::DeviceDescriptor::TrySetDefaultDevice(globals::device);
+
+        json jroot = BuildModel();
+
+        auto jnode = _proto.has_compile() ? ToJson(_proto.compile()) : jroot["compile_params"];
+        auto jloss = NodeOrNull(jnode, "loss");
+        bool sparse = jloss.is_string() && jloss.get<string>() == "sparse_categorical_crossentropy";
+
+        auto output = _model->Output();
+        auto dynamicAxes = output.DynamicAxes().size() == 1 ? vector<cntk::Axis>{ cntk::Axis::DefaultBatchAxis() } : cntk::Axis::DefaultInputVariableDynamicAxes();
+        _labels = cntk::InputVariable(sparse ? cntk::NDShape({ output.Shape().TotalSize() }) : output.Shape(), sparse, globals::dataType, L"Labels", dynamicAxes);
+        _inputVariables.push_back(_labels);
+
+        auto jfit = NodeOrNull(jroot, "fit_params");
+        if (!jfit.is_null())
+            ParseFitParameters(jfit);
+
+        // An epoch of the learning rate schedules is nsamples samples, a batch without. After the
+        // fit parameters, which may set the batch size.
+        if (_proto.nsamples() == 0)
+            _nsamples = _batchSize;
+        FreezeLayers();
+
+        _learner = CreateLearner(jnode);
+        _loss = CreateLossFunction(jnode);
+        CreateErrorFunction(jnode);
+        _trainer = cntk::CreateTrainer(_model, _loss, _error, { _learner });
+    }
+
+    void Sequential::TrainOnBatch(const char * inData, unsigned inLen)
+    {
+        if (_trainer == nullptr)
+            throw logic_error("Not a session");
+
+        _proto.ParseFromArray(inData, inLen);
+        if (_proto.inputs_size() != 2)
+            throw runtime_error("A batch to train on has the inputs and the labels");
+
+        auto source = make_shared<cntk_utils::BufferMinibatchSource>();
+        source->Add(_proto.inputs(0), _features);
+        source->Add(_proto.inputs(1), _labels);
+
+        const auto & minibatchData = source->GetNextMinibatch(source->GetNumSamples(), globals::device);
+        _trainer->TrainMinibatch({ { _features, minibatchData.at(source->FeatureStreamInfo()) },{ _labels, minibatchData.at(source->LabelStreamInfo()) } }, globals::device);
+
+        auto evaluation = _proto.mutable_evaluation();
+        evaluation->add_names("loss");
+        evaluation->add_values(_trainer->PreviousMinibatchLossAverage());
+        if (_error != nullptr)
+        {
+            evaluation->add_names("acc");
+            evaluation->add_values(_trainer->PreviousMinibatchEvaluationAverage());
+        }
+        evaluation->set_nsamples(_trainer->PreviousMinibatchSampleCount());
+
+        _proto.clear_inputs();
+    }
+
+    void Sequential::PredictOnBatch(const char * inData, unsigned inLen)
+    {
+        if (_trainer == nullptr)
+            throw logic_error("Not a session");
+
+        _proto.ParseFromArray(inData, inLen);
+        if (_proto.inputs_size() != 1)
+            throw runtime_error("A batch to predict has the inputs only");
+
+        auto source = make_shared<cntk_utils::BufferMinibatchSource>();
+        source->Add(_proto.inputs(0), _features);
+
+        const auto & minibatchData = source->GetNextMinibatch(source->GetNumSamples(), globals::device);
+        unordered_map<cntk::Variable, cntk::ValuePtr> outputMap = { { _model->Output(), nullptr } };
+        _model->Evaluate({ { _features, minibatchData.at(source->FeatureStreamInfo()).data } }, outputMap, globals::device);
+
+        vector<vector<float>> valueData;
+        outputMap.begin()->second->CopyVariableValueTo(_model->Output(), valueData);
+
+        _proto.clear_inputs();
+        InitProtoOutput(globals::dataType, source->GetNumSamples(), _model->Output().Shape().TotalSize());
+        AppendProtoOutput(valueData, *source, _model->Output());
+    }
 
-        // Serialize the model. Not many options but to write to a file and load the file.
-        auto tempPath = tmpnam(nullptr);
-        _model->Save(utils::ToWide(tempPath));
+    // A snapshot of the session's model, in the model field of the output
+    void Sequential::SaveSession(const char * inData, unsigned inLen)
+    {
+        if (_trainer == nullptr)
+            throw logic_error("Not a session");
 
-        ifstream inStream(tempPath, ifstream::ate | ifstream::binary);
-        auto fileSize = inStream.tellg();
-        _proto.mutable_model()->resize(fileSize);
-        inStream.seekg(ifstream::beg);
-        inStream.read(&(*_proto.mutable_model())[0], fileSize);
-        _unlink(tempPath);
+        _proto.ParseFromArray(inData, inLen);
+        SaveModel();
     }
 
     void Sequential::InitProtoOutput(CNTK::DataType dataType, size_t nrows, size_t ncols)
     {
         _proto.mutable_outputs()->Clear();
+
+        // Streamed, the outputs hold a batch at a time
+        if (_outputCallback != nullptr)
+            nrows = min<size_t>(nrows, (size_t)_batchSize);
+
+        if (_topK > 0)
+        {
+            // The indices of the k largest outputs of every row, then their scores
+            cntk_utils::AddTopKOutputs(*_proto.mutable_outputs(), _topK, nrows, ncols);
+            return;
+        }
+
+        AddProtoOutput(dataType, nrows, ncols);
+    }
+
+    void Sequential::AddProtoOutput(CNTK::DataType dataType, size_t nrows, size_t ncols)
+    {
+        if (_outputCallback != nullptr)
+            nrows = min<size_t>(nrows, (size_t)_batchSize);
+
         auto o = _proto.mutable_outputs()->Add();
         o->mutable_data()->reserve(nrows*ncols*(dataType == CNTK::DataType::Double ? 8 : 4));
         o->add_shape(0);
@@ -779,13 +1771,30 @@ namespace keras
         o->set_type(dataType == CNTK::DataType::Double ? DataType::Double : DataType::Float);
     }
 
-    void Sequential::AppendProtoOutput(const std::vector<std::vector<float>> & output)
+    void Sequential::AppendProtoOutput(const std::vector<std::vector<float>> & output, const cntk_utils::BufferMinibatchSource & source, const CNTK::Variable & variable, int index)
     {
-        auto & proto = (*_proto.mutable_outputs())[0];
+        auto & proto = (*_proto.mutable_outputs())[index];
+
+        // Sequence outputs [return_sequences] are packed, one row per step
+        bool sequences = source.HasSequences() && variable.DynamicAxes().size() > 1;
+
+        if (_topK > 0)
+        {
+            size_t outputSize = variable.Shape().TotalSize();
+            for (const auto & seq : output)
+                cntk_utils::AppendTopK((*_proto.mutable_outputs())[0], (*_proto.mutable_outputs())[1], seq.data(), seq.size() / outputSize, outputSize, sequences);
+            return;
+        }
 
         size_t offset = proto.mutable_data()->size();
-        size_t nrows = output.size();
-        size_t ncols = output[0].size();
+        size_t ncols = proto.shape(1);
+        size_t nrows = 0;
+        for (const auto & seq : output)
+        {
+            if (sequences)
+                proto.add_sequence_lengths((int32_t)(seq.size() / ncols));
+            nrows += seq.size() / ncols;
+        }
         proto.mutable_data()->resize(proto.mutable_data()->size() + nrows*ncols * sizeof(float));
 
         char * p = &(*proto.mutable_data())[0] + offset;
@@ -800,50 +1809,324 @@ namespace keras
         proto.set_count(proto.shape()[0] * proto.shape()[1]);
     }
 
+    // Hands the outputs appended since the last call to the streaming callback, then empties them
+    // keeping their buffers, so the memory of a streamed Predict doesn't grow with its input
+    void Sequential::FlushProtoOutput()
+    {
+        if (_outputCallback == nullptr || _proto.outputs_size() == 0 || _proto.outputs(0).shape(0) == 0)
+            return;
+
+        OutputChunkProto chunk;
+        chunk.set_offset(_outputOffset);
+        *chunk.mutable_outputs() = _proto.outputs();
+        _outputOffset += _proto.outputs(0).shape(0);
+
+        string buffer;
+        chunk.SerializeToString(&buffer);
+        _outputCallback(&buffer[0], (unsigned)buffer.size());
+
+        for (auto & o : *_proto.mutable_outputs())
+        {
+            o.mutable_data()->clear();
+            (*o.mutable_shape())[0] = 0;
+            o.set_count(0);
+            o.clear_sequence_lengths();
+        }
+    }
+
     void Sequential::LoadModel()
     {
         if (_proto.model_uuid().size() > 0)
         {
-            // Load from the cache
-            auto it = gModelCache.find(_proto.model_uuid());
-            if (it == gModelCache.end())
+            // Load from the cache, an instance no other call evaluates
+            if (gModelCache.TryAcquire(_proto.model_uuid(), _lease))
+            {
+                _model = _lease.Model();
+                return;
+            }
+
+            // Evicted or unloaded, loaded again when the request has the model as well
+            if (_proto.model_path().size() == 0 && _proto.model().size() == 0)
                 throw runtime_error("The cached model [" + _proto.model_uuid() + "] was not found");
-            _model = it->second;
-            return;
+            _proto.clear_model_uuid();
         }
 
-        auto jroot = json::parse(_proto.predict_params().c_str());
-        bool cache = jroot.value<bool>("cache", true);
+        bool cache = true;
+        if (_proto.has_predict())
+            cache = !_proto.predict().no_cache();
+        else if (_proto.predict_params().size() > 0)
+            cache = json::parse(_proto.predict_params().c_str()).value<bool>("cache", true);
 
         if (_proto.model_path().size() > 0)
         {
-            // Load from path
-            auto path = utils::ToWide(_proto.model_path());
-            _model = CNTK::Function::Load(path, globals::device);
-            if (!cache) return;
-            string uuid = utils::GenerateUuid();
-            gModelCache[uuid] = _model;
-            _proto.set_model_uuid(uuid);
+            // Load from path, deserialized from the file's pages rather than from a copy read into
+            // memory. Only that copy is saved: CNTK still deserializes the parameters into buffers
+            // of their own, so every process has a private copy of the weights.
+            cntk_utils::MappedFile file(utils::ToWide(_proto.model_path()));
+            if (cache)
+                LoadCachedModel(file.Data(), file.Size());
+            else
+                _model = cntk_utils::LoadModel(file.Data(), file.Size());
             return;
         }
 
         if (_proto.model().size() > 0)
         {
-            _model = cntk_utils::LoadModel(_proto.model().data(), _proto.model().size());
-            if (!cache) return;
-            string uuid = utils::GenerateUuid();
-            gModelCache[uuid] = _model;
-            _proto.set_model_uuid(uuid);
+            if (cache)
+                LoadCachedModel(_proto.model().data(), _proto.model().size());
+            else
+                _model = cntk_utils::LoadModel(_proto.model().data(), _proto.model().size());
             return;
         }
 
         throw std::runtime_error("Bad model");
     }
 
-    void Sequential::Predict()
+    // The rows go through the model's scheduler, batched with the other calls' rows
+    void Sequential::PredictBatched(cntk_utils::BatchScheduler & scheduler)
+    {
+        if (_proto.inputs_size() != 1)
+            throw logic_error("Batched predictions take a single input");
+
+        const auto & input = _proto.inputs(0);
+        if (input.type() != DataType::Float || input.format() != TensorFormat::RowMajor || input.sequence_lengths_size() > 0 || input.shape_size() == 0)
+            throw logic_error("Batched predictions take dense float rows, one sample per row");
+
+        size_t nrows = (size_t)input.shape(0);
+        size_t inputSize = 1;
+        for (auto i = 1; i < input.shape_size(); ++i)
+            inputSize *= (size_t)input.shape(i);
+        if (inputSize != scheduler.InputSize())
+            throw logic_error("The input shape is incompatible with the actual data shape");
+        if (nrows * inputSize * sizeof(float) > input.data().size())
+            throw logic_error("The shape is incompatible with the data size.");
+
+        size_t outputSize = scheduler.OutputSize();
+        InitProtoOutput(CNTK::DataType::Float, nrows, outputSize);
+
+        // Streamed, the rows are scheduled a batch at a time
+        size_t chunk = _outputCallback != nullptr ? max<size_t>(1, _batchSize) : nrows;
+        for (size_t first = 0; first < nrows; first += chunk)
+        {
+            size_t n = min(chunk, nrows - first);
+            const float * rows = (const float *)input.data().data() + first * inputSize;
+
+            if (_topK > 0)
+            {
+                vector<float> output(n * outputSize);
+                scheduler.Predict(rows, n, &output[0]);
+                cntk_utils::AppendTopK((*_proto.mutable_outputs())[0], (*_proto.mutable_outputs())[1], &output[0], n, outputSize);
+            }
+            else
+            {
+                auto & output = (*_proto.mutable_outputs())[0];
+                output.mutable_data()->resize(n * outputSize * sizeof(float));
+                (*output.mutable_shape())[0] = (int32_t)n;
+                output.set_count(output.shape(0) * output.shape(1));
+
+                scheduler.Predict(rows, n, (float *)&(*output.mutable_data())[0]);
+            }
+
+            FlushProtoOutput();
+        }
+    }
+
+    // The content key reads all the bytes. Only a cached model of the same size can have the same
+    // content, so the lookup waits for the key then; otherwise [e.g. the first load of a model]
+    // the key is computed while the model loads, the load doesn't wait for a pass over the bytes.
+    void Sequential::LoadCachedModel(const char * data, size_t size)
+    {
+        if (gModelCache.HasContentSize(size))
+        {
+            auto contentKey = cntk_utils::ModelCache::ContentKey(data, size);
+            if (AcquireCachedContent(contentKey))
+                return;
+
+            _model = cntk_utils::LoadModel(data, size);
+            CacheModel(contentKey);
+            return;
+        }
+
+        auto contentKey = async(launch::async, [data, size]() { return cntk_utils::ModelCache::ContentKey(data, size); });
+        _model = cntk_utils::LoadModel(data, size);
+        CacheModel(contentKey.get());
+    }
+
+    // The same bytes are loaded once, every call gets the uuid of the first
+    bool Sequential::AcquireCachedContent(const string & contentKey)
+    {
+        auto uuid = gModelCache.FindContent(contentKey);
+        if (uuid.empty() || !gModelCache.TryAcquire(uuid, _lease))
+            return false;
+
+        _model = _lease.Model();
+        _proto.set_model_uuid(uuid);
+        return true;
+    }
+
+    void Sequential::CacheModel(const string & contentKey)
+    {
+        string uuid = utils::GenerateUuid();
+        gModelCache.Insert(uuid, _model, contentKey);
+        _lease = gModelCache.Acquire(uuid);
+        _model = _lease.Model();
+        _proto.set_model_uuid(uuid);
+    }
+
+    static double ScalarValue(const cntk::ValuePtr & value)
+    {
+        if (value->GetDataType() == cntk::DataType::Double)
+            return value->Data()->AsScalar<double>();
+        return value->Data()->AsScalar<float>();
+    }
+
+    // Forward only batches over the inputs and the labels, only the means of the loss and the
+    // metrics are returned
+    void Sequential::Evaluate()
     {
         LoadModel();
 
+        auto arguments = _model->Arguments();
+        if (arguments.size() != 1)
+            throw runtime_error("The model to evaluate must have a single input");
+        _features = arguments[0];
+        _inputVariables.push_back(_features);
+
+        json jroot;
+        if (_proto.graph().size() > 0)
+            jroot = json::parse(_proto.graph().c_str());
+        auto jnode = _proto.has_compile() ? ToJson(_proto.compile()) : jroot["compile_params"];
+        auto jloss = NodeOrNull(jnode, "loss");
+
+        CreateLabels(L"Labels", jloss.is_string() && jloss.get<string>() == "sparse_categorical_crossentropy");
+        SetupInputs();
+
+        // The sums over the minibatch
+        vector<string> names;
+        vector<cntk::Variable> sums;
+        if (jloss.is_string() && jloss.get<string>().size() > 0)
+        {
+            names.push_back("loss");
+            sums.push_back(cntk::ReduceSum(CreateLossFunction(jnode), cntk::Axis::AllAxes()));
+        }
+        for (const auto & jmetric : NodeOrNull(jnode, "metrics"))
+        {
+            auto name = jmetric.get<string>();
+            auto metric = CreateMetric(name, jnode);
+            if (metric == nullptr)
+                throw logic_error("'" + name + "' metric is not supported [yet].");
+            names.push_back(name);
+            sums.push_back(cntk::ReduceSum(metric, cntk::Axis::AllAxes()));
+        }
+        if (sums.empty())
+            throw runtime_error("Nothing to evaluate, the model needs to be compiled with a loss or metrics");
+        auto root = cntk::Combine(sums);
+
+        CNTK::StreamInformation featureStreamInfo;
+        CNTK::StreamInformation labelStreamInfo;
+
+        CNTK::MinibatchSourcePtr minibatchSource;
+        if (_dataSource)
+        {
+            auto featureStreamName = L"features";
+            auto labelsStreamName = L"labels";
+
+            minibatchSource = cntk::TextFormatMinibatchSource(
+                _path,
+                { { featureStreamName, _features.Shape().TotalSize(), true },
+                { labelsStreamName, _labels.Shape().TotalSize(), true } },
+                cntk::MinibatchSource::FullDataSweep,
+                false);
+
+            featureStreamInfo = minibatchSource->StreamInfo(featureStreamName);
+            labelStreamInfo = minibatchSource->StreamInfo(labelsStreamName);
+        }
+        else
+        {
+            featureStreamInfo = _bufferMinibatchSource->FeatureStreamInfo();
+            labelStreamInfo = _bufferMinibatchSource->LabelStreamInfo();
+
+            minibatchSource = _bufferMinibatchSource;
+        }
+
+        vector<double> totals(sums.size(), 0.0);
+        size_t nsamples = 0;
+        while (true)
+        {
+            auto minibatchData = minibatchSource->GetNextMinibatch(_batchSize, globals::device);
+            if (minibatchData.empty())
+                break;
+
+            unordered_map<cntk::Variable, cntk::ValuePtr> outputs;
+            for (const auto & sum : sums)
+                outputs[sum] = nullptr;
+            root->Evaluate({ { _features, minibatchData[featureStreamInfo].data },{ _labels, minibatchData[labelStreamInfo].data } }, outputs, globals::device);
+
+            for (size_t i = 0; i < sums.size(); ++i)
+                totals[i] += ScalarValue(outputs[sums[i]]);
+            nsamples += minibatchData[labelStreamInfo].numberOfSamples;
+
+            if (minibatchData[featureStreamInfo].sweepEnd)
+                break;
+        }
+
+        auto evaluation = _proto.mutable_evaluation();
+        for (size_t i = 0; i < sums.size(); ++i)
+        {
+            evaluation->add_names(names[i]);
+            evaluation->add_values(nsamples == 0 ? 0.0 : totals[i] / nsamples);
+        }
+        evaluation->set_nsamples(nsamples);
+
+        // Only the numbers go back
+        _proto.clear_inputs();
+        _proto.clear_model();
+        _proto.clear_graph();
+        _proto.clear_layers();
+    }
+
+    void Sequential::Predict()
+    {
+        size_t maxBatchSize = 0;
+        size_t maxWait = 0;
+        vector<string> outputLayers;
+        if (_proto.has_predict())
+        {
+            maxBatchSize = _proto.predict().max_batch_size();
+            maxWait = _proto.predict().max_wait_us();
+            _topK = _proto.predict().top_k();
+            outputLayers.assign(_proto.predict().output_layers().begin(), _proto.predict().output_layers().end());
+        }
+        else if (_proto.predict_params().size() > 0)
+        {
+            auto jparams = json::parse(_proto.predict_params().c_str());
+            maxBatchSize = jparams.value<size_t>("max_batch_size", 0);
+            maxWait = jparams.value<size_t>("max_wait_us", 0);
+            _topK = jparams.value<size_t>("top_k", 0);
+            outputLayers = jparams.value("output_layers", vector<string>());
+        }
+
+        _outputCallback = (OutputCallback)_proto.output_callback();
+        _outputOffset = 0;
+
+        if (!outputLayers.empty() && _topK > 0)
+            throw logic_error("top_k and output_layers can't be used together");
+
+        // The scheduler batches the model's output, the layers are evaluated on their own
+        if (maxBatchSize > 0 && outputLayers.empty())
+        {
+            // Caches the model, if it isn't
+            LoadModel();
+            if (_proto.model_uuid().size() > 0)
+            {
+                PredictBatched(*gModelCache.Scheduler(_proto.model_uuid(), maxBatchSize, chrono::microseconds(maxWait), globals::device));
+                return;
+            }
+        }
+
+        if (_model == nullptr)
+            LoadModel();
+
         // Setup the inputs and the outputs
         _inputVariables.clear();
 
@@ -857,8 +2140,14 @@ namespace keras
         }
 
         for (auto i = 0; i < _proto.inputs_size(); ++i)
-            _bufferMinibatchSource->Add(_proto.inputs().Get(i), _inputVariables.at(i).Shape());
-        _nsamples = _proto.inputs().Get(0).shape().Get(0);
+            _bufferMinibatchSource->Add(_proto.inputs().Get(i), _inputVariables.at(i));
+        _nsamples = _bufferMinibatchSource->GetNumSamples();
+
+        if (!outputLayers.empty())
+        {
+            PredictLayers(outputLayers);
+            return;
+        }
 
         for (auto output : _model->Outputs())
             _inputVariables.push_back(output);
@@ -877,7 +2166,68 @@ namespace keras
             _model->Evaluate({ { _inputVariables[0], minibatchData.begin()->second.data } }, outputMap);
 
             outputMap.begin()->second.get()->CopyVariableValueTo(_inputVariables.back(), valueData);
-            AppendProtoOutput(valueData);
+            AppendProtoOutput(valueData, *_bufferMinibatchSource, _inputVariables.back());
+            FlushProtoOutput();
+
+            if (minibatchData.begin()->second.sweepEnd)
+                break;
+        }
+    }
+
+    // The layers built by this instance by their names, else the nodes of the [loaded] model
+    cntk::FunctionPtr Sequential::FindLayer(const string & name) const
+    {
+        auto it = _layersMap.find(name);
+        if (it != _layersMap.end())
+            return it->second;
+        return _model->FindByName(utils::ToWide(name), true);
+    }
+
+    // The activations of the named layers, an output each in the order of the names. Combine makes
+    // a function of the subgraph below them, so the layers above the deepest one [e.g. the
+    // classifier of a feature extractor] aren't evaluated.
+    void Sequential::PredictLayers(const vector<string> & names)
+    {
+        vector<cntk::Variable> variables;
+        vector<size_t> indices;
+        for (const auto & name : names)
+        {
+            auto layer = FindLayer(name);
+            if (layer == nullptr)
+                throw runtime_error("The layer '" + name + "' was not found");
+
+            // A layer requested twice is evaluated once
+            auto variable = layer->Output();
+            auto it = find(variables.begin(), variables.end(), variable);
+            indices.push_back(it - variables.begin());
+            if (it == variables.end())
+                variables.push_back(variable);
+        }
+
+        auto extractor = cntk::Combine(variables);
+        auto outputs = extractor->Outputs();
+
+        _proto.mutable_outputs()->Clear();
+        for (auto index : indices)
+            AddProtoOutput(globals::dataType, _nsamples, outputs[index].Shape().TotalSize());
+
+        vector<vector<float>> valueData;
+
+        while (true)
+        {
+            auto minibatchData = _bufferMinibatchSource->GetNextMinibatch(_batchSize, globals::device);
+            unordered_map<cntk::Variable, cntk::ValuePtr> outputMap;
+            for (const auto & output : outputs)
+                outputMap[output] = nullptr;
+            extractor->Evaluate({ { _inputVariables[0], minibatchData.begin()->second.data } }, outputMap, globals::device);
+
+            for (size_t i = 0; i < indices.size(); ++i)
+            {
+                const auto & output = outputs[indices[i]];
+                outputMap.at(output)->CopyVariableValueTo(output, valueData);
+                AppendProtoOutput(valueData, *_bufferMinibatchSource, output, (int)i);
+            }
+            FlushProtoOutput();
 
             if (minibatchData.begin()->second.sweepEnd)
                 break;
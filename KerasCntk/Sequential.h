@@ -1,17 +1,25 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
 #include "CNTKLibrary.h"
 
 #include "json.hpp"
 
+#include "BatchScheduler.h"
 #include "BufferMinibatchSource.h"
+#include "Checkpoint.h"
 #include "CntkUtils.h"
+#include "ModelCache.h"
+#include "ParallelTrainer.h"
+#include "ProgressReporter.h"
 
 namespace keras
 {
     typedef void(__stdcall * ProgressCallback)(char * data, unsigned size);
+    typedef void(__stdcall * OutputCallback)(char * data, unsigned size);
 
     class Sequential
     {
@@ -24,13 +32,24 @@ namespace keras
 
         void GetOutput(char ** outData, unsigned * outLen);
 
+        // Sessions: the model, the learner and the trainer stay resident between the calls. A
+        // session isn't thread safe.
+        void CreateSession();
+        void TrainOnBatch(const char * inData, unsigned inLen);
+        void PredictOnBatch(const char * inData, unsigned inLen);
+        void SaveSession(const char * inData, unsigned inLen);
+
     public:
+        void AddLayer(const nlohmann::json & jnode);
+
         void AddActivation(const nlohmann::json & jnode);
 
         void AddDense(const nlohmann::json & jnode);
 
         void AddConv1D(const nlohmann::json & jnode);
         void AddConv2D(const nlohmann::json &jnode);
+        void AddDepthwiseConv2D(const nlohmann::json & jnode);
+        void AddSeparableConv2D(const nlohmann::json & jnode);
 
         void AddMaxPooling1D(const nlohmann::json & jnode);
         void AddMaxPooling2D(const nlohmann::json & jnode);
@@ -45,17 +64,31 @@ namespace keras
 
         nlohmann::json AddEmbedding(const nlohmann::json & jnode);
 
+        void AddLSTM(const nlohmann::json & jnode);
+        void AddGRU(const nlohmann::json & jnode);
+
     private:
         CNTK::ParameterInitializer CreateInitializer(const nlohmann::json & jnode);
         CNTK::FunctionPtr GetActivation(const nlohmann::json & jnode, const CNTK::Variable & operand);
 
-        CNTK::Variable GetInputLayer(const nlohmann::json &jnode);
+        CNTK::Variable GetInputLayer(const nlohmann::json &jnode, bool sequence = false);
+
+        void AddRecurrent(const nlohmann::json & jnode, bool gru);
+        void AddConvBiasAndActivation(const nlohmann::json & jnode, CNTK::FunctionPtr resultFunc, size_t nfilters);
 
+        CNTK::LearningRateSchedule CreateLearningRateSchedule(double learningRate, double decay, const nlohmann::json & jnode);
         CNTK::LearnerPtr CreateLearner(nlohmann::json & jnode);
+        CNTK::LearnerPtr CreateDistributedLearner(const CNTK::LearnerPtr & learner);
+
+        cntk_utils::Checkpoint CreateCheckpoint(const std::vector<CNTK::LearnerPtr> & learners, const CNTK::MinibatchSourcePtr & minibatchSource,
+            std::size_t epoch, std::size_t batchId, std::size_t samples);
+        void RestoreCheckpoint(const cntk_utils::Checkpoint & checkpoint, const std::vector<CNTK::LearnerPtr> & learners, const CNTK::MinibatchSourcePtr & minibatchSource,
+            std::size_t & epoch, std::size_t & batchId, std::size_t & samples);
         CNTK::FunctionPtr CreateLossFunction(nlohmann::json & jnode);
+        CNTK::FunctionPtr CreateMetric(const std::string & name, const nlohmann::json & jnode);
         void CreateErrorFunction(nlohmann::json & jnode);
 
-        void CreateLabels(const std::wstring & name);
+        void CreateLabels(const std::wstring & name, bool sparse);
 
         nlohmann::json NodeOrNull(const nlohmann::json & jnode, const std::string & name);
         std::string GetOrCreateName(const nlohmann::json & jnode);
@@ -64,26 +97,48 @@ namespace keras
 
         void SetupInputs();
 
+        nlohmann::json BuildModel();
+        void LoadBaseModel();
+        void FreezeLayers();
+        void SaveModel();
+
         void Fit();
+        void Evaluate();
         void Predict();
+        void ExportCpp();
 
         typedef std::unordered_map<std::string, double> HistoryValues;
         void UpdateProgress(HistoryCallbackType type, std::size_t id, const HistoryValues & historyValues);
 
         void InitProtoOutput(CNTK::DataType dataType = CNTK::DataType::Float, std::size_t nrows = 0, std::size_t ncols = 0);
-        void AppendProtoOutput(const std::vector<std::vector<float>> & output);
+        void AddProtoOutput(CNTK::DataType dataType, std::size_t nrows, std::size_t ncols);
+        // The output of variable on the inputs of source, to the index-th output tensor
+        void AppendProtoOutput(const std::vector<std::vector<float>> & output, const cntk_utils::BufferMinibatchSource & source, const CNTK::Variable & variable, int index = 0);
+        void FlushProtoOutput();
 
         void Sequential::LoadModel();
+        void LoadCachedModel(const char * data, std::size_t size);
+        bool AcquireCachedContent(const std::string & contentKey);
+        void CacheModel(const std::string & contentKey);
+        void ManageModelCache();
+        void PredictBatched(cntk_utils::BatchScheduler & scheduler);
+        void PredictLayers(const std::vector<std::string> & names);
+        CNTK::FunctionPtr FindLayer(const std::string & name) const;
 
     private:
 
         KerasProto _proto;
 
+        // Holds the cached model's instance _model points to, if any
+        cntk_utils::ModelCache::Lease _lease;
         CNTK::FunctionPtr _model;
         CNTK::LearnerPtr _learner;
         CNTK::FunctionPtr _loss;
         CNTK::FunctionPtr _error;
 
+        // Sessions only
+        CNTK::TrainerPtr _trainer;
+
         CNTK::Variable _features;
         CNTK::Variable _labels;
 
@@ -94,14 +149,45 @@ namespace keras
         int _nepochs;
         int _verbose;
 
+        // Local data parallel training
+        std::size_t _workers;
+        cntk_utils::ParallelTrainer::Mode _parallelMode;
+
+        // Minibatches of _batchSize per learner update
+        std::size_t _accumulationSteps;
+
+        // Distributed training over MPI, null when training in a single process
+        nlohmann::json _distributed;
+        CNTK::DistributedCommunicatorPtr _communicator;
+
+        // Periodic checkpoints, null without
+        nlohmann::json _checkpoint;
+
+        // Progress reporting: the throttling and the background delivery, null when synchronous
+        nlohmann::json _progress;
+        cntk_utils::ProgressThrottle _progressThrottle;
+        std::unique_ptr<cntk_utils::ProgressReporter> _progressReporter;
+        bool _reportBatch;
+
         std::wstring _path;
 
         std::size_t _nsamples;
 
+        // Predict's top k classes, all the outputs when 0
+        std::size_t _topK;
+
+        // Streamed Predict's callback, if any, and the rows it was handed
+        OutputCallback _outputCallback;
+        std::size_t _outputOffset;
+
         bool _dataSource;
 
         std::shared_ptr<cntk_utils::BufferMinibatchSource> _bufferMinibatchSource;
 
         std::unordered_map<std::string, CNTK::FunctionPtr> _layersMap;
+
+        // The parameters of the named layers and the layers not to train
+        std::unordered_map<std::string, std::vector<CNTK::Parameter>> _layerParameters;
+        std::vector<std::string> _frozenLayers;
     };
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "TopK.h"
+
+using namespace std;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        void AddTopKOutputs(google::protobuf::RepeatedPtrField<TensorProto> & outputs, size_t k, size_t nrows, size_t ncols)
+        {
+            k = min(k, ncols);
+            for (auto type : { DataType::Int32, DataType::Float })
+            {
+                auto o = outputs.Add();
+                o->mutable_data()->reserve(nrows*k*4);
+                o->add_shape(0);
+                o->add_shape((int32_t)k);
+                o->set_format(TensorFormat::RowMajor);
+                o->set_type(type);
+            }
+        }
+
+        void AppendTopK(TensorProto & indices, TensorProto & scores, const float * rows, size_t nrows, size_t ncols, bool sequence)
+        {
+            size_t k = indices.shape(1);
+
+            if (sequence)
+            {
+                indices.add_sequence_lengths((int32_t)nrows);
+                scores.add_sequence_lengths((int32_t)nrows);
+            }
+
+            size_t offset = indices.shape(0) * k;
+            indices.mutable_data()->resize((offset + nrows*k) * sizeof(int32_t));
+            scores.mutable_data()->resize((offset + nrows*k) * sizeof(float));
+            int32_t * pi = (int32_t *)&(*indices.mutable_data())[0] + offset;
+            float * ps = (float *)&(*scores.mutable_data())[0] + offset;
+
+            vector<int32_t> order(ncols);
+            for (size_t r = 0; r < nrows; ++r)
+            {
+                const float * row = rows + r*ncols;
+                for (size_t i = 0; i < ncols; ++i)
+                    order[i] = (int32_t)i;
+                partial_sort(order.begin(), order.begin() + k, order.end(), [row](int32_t a, int32_t b) { return row[a] > row[b] || (row[a] == row[b] && a < b); });
+
+                for (size_t j = 0; j < k; ++j)
+                {
+                    *pi++ = order[j];
+                    *ps++ = row[order[j]];
+                }
+            }
+
+            for (auto o : { &indices, &scores })
+            {
+                (*o->mutable_shape())[0] += (int32_t)nrows;
+                o->set_count(o->shape()[0] * o->shape()[1]);
+            }
+        }
+    }
+}
\ No newline at end of file
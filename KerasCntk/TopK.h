@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Keras.h"
+
+#pragma warning (push)
+#pragma warning (disable: 4251)
+#pragma warning (disable: 4751)
+#pragma warning (disable: 4800)
+#include "KerasProto.pb.h"
+#pragma warning (pop)
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // Predict's top k outputs: adds the [0 x k] tensors of the indices [Int32] and of the scores
+        // [Float] to outputs, k no more than the ncols classes
+        KERAS_API void AddTopKOutputs(google::protobuf::RepeatedPtrField<TensorProto> & outputs, size_t k, size_t nrows, size_t ncols);
+
+        // Appends the indices and the scores of the k largest values of every row, the largest first
+        // and the lower index of equal values first. The rows of a sequence add its length to both.
+        KERAS_API void AppendTopK(TensorProto & indices, TensorProto & scores, const float * rows, size_t nrows, size_t ncols, bool sequence = false);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include "WeightDecay.h"
+
+using namespace std;
+namespace cntk = CNTK;
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        DecoupledWeightDecay::DecoupledWeightDecay(const cntk::LearnerPtr & learner, double weightDecay)
+            : cntk::Learner(learner->Parameters(), cntk::LearningRateSchedule(learner->LearningRate())),
+            mLearner(learner), mDecay(cntk::SGDLearner(learner->Parameters(), cntk::LearningRateSchedule(0.0))), mWeightDecay(weightDecay)
+        {}
+
+        bool DecoupledWeightDecay::Update(unordered_map<cntk::Parameter, cntk::NDArrayViewPtr> & gradientValues, size_t trainingSampleCount, bool sweepEnd)
+        {
+            // The learning rate of this update, before the learner moves along its schedule
+            double decay = mLearner->LearningRate() * mWeightDecay;
+
+            bool result = mLearner->Update(gradientValues, trainingSampleCount, sweepEnd);
+            if (decay == 0.0 || trainingSampleCount == 0)
+                return result;
+
+            // p -= decay * p, the elementwise SGD update reads and writes the same view
+            unordered_map<cntk::Parameter, cntk::NDArrayViewPtr> parameters;
+            for (const auto & p : mLearner->Parameters())
+                parameters.insert({ p, p.Value() });
+
+            mDecay->ResetLearningRate(cntk::LearningRateSchedule(decay));
+            mDecay->Update(parameters, trainingSampleCount, sweepEnd);
+            return result;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "CNTKLibrary.h"
+
+#include "Keras.h"
+
+namespace keras
+{
+    namespace cntk_utils
+    {
+        // Decoupled weight decay [AdamW]: after every update of the wrapped learner the parameters
+        // are scaled by (1 - lr * weightDecay), lr the learner's current learning rate. Unlike the
+        // learners' L2 regularization the decay doesn't go through the gradient, so Adam's second
+        // moments don't rescale it. The decay is a plain SGD step whose gradient is the parameters
+        // themselves, on the parameters' device.
+        class DecoupledWeightDecay : public CNTK::Learner
+        {
+        public:
+            KERAS_API DecoupledWeightDecay(const CNTK::LearnerPtr & learner, double weightDecay);
+
+            bool Update(std::unordered_map<CNTK::Parameter, CNTK::NDArrayViewPtr> & gradientValues, size_t trainingSampleCount, bool sweepEnd = false) override;
+
+            CNTK::Dictionary CreateCheckpoint() override { return mLearner->CreateCheckpoint(); }
+            void RestoreFromCheckpoint(const CNTK::Dictionary & checkpoint) override { mLearner->RestoreFromCheckpoint(checkpoint); }
+
+            void ResetLearningRate(const CNTK::LearningRateSchedule & learningRateSchedule) override { mLearner->ResetLearningRate(learningRateSchedule); }
+            double LearningRate() override { return mLearner->LearningRate(); }
+
+            void ResetSmoothedGradients() override { mLearner->ResetSmoothedGradients(); }
+
+        private:
+            CNTK::LearnerPtr mLearner;
+            CNTK::LearnerPtr mDecay;
+            double mWeightDecay;
+        };
+    }
+}
\ No newline at end of file
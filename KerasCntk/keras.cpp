@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <exception>
 #include <fstream>
+#include <memory>
 #include <unordered_map>
 
 // TH headers [before anything else to avoid conflicts]
@@ -29,11 +30,28 @@
 
 #include "DataBuffer.h"
 #include "BufferMinibatchSource.h"
+#include "Predictor.h"
 
 using namespace std;
 using namespace nlohmann;
 namespace cntk = CNTK;
 
+static void ClearException(char ** exceptionString, unsigned * exceptionLen, uint64_t * outExceptionPtr)
+{
+    *exceptionString = nullptr;
+    *exceptionLen = 0;
+    *outExceptionPtr = 0;
+}
+
+// The message is released with KerasDeletePointer
+static void SetException(const exception & e, char ** exceptionString, unsigned * exceptionLen, uint64_t * outExceptionPtr)
+{
+    *exceptionLen = (unsigned)strlen(e.what());
+    *exceptionString = new char[*exceptionLen + 1];
+    strcpy(*exceptionString, e.what());
+    *outExceptionPtr = (uint64_t)*exceptionString;
+}
+
 extern "C" __declspec(dllexport) void KerasFitModel(
     const char * inData, unsigned inLen,
     char ** outData, unsigned * outLen,
@@ -51,9 +69,7 @@ extern "C" __declspec(dllexport) void KerasFitModel(
         model.GetOutput(outData, outLen);
         *outPtr = (uint64_t)*outData;
 
-        *exceptionString = nullptr;
-        *exceptionLen = 0;
-        *outExceptionPtr = 0;
+        ClearException(exceptionString, exceptionLen, outExceptionPtr);
     }
     catch (const exception & e)
     {
@@ -61,14 +77,166 @@ extern "C" __declspec(dllexport) void KerasFitModel(
         *outLen = 0;
         *outPtr = 0;
 
-        *exceptionLen = (unsigned)strlen(e.what());
-        *exceptionString = new char[*exceptionLen + 1];
-        strcpy(*exceptionString, e.what());
-        *outExceptionPtr = (uint64_t)*exceptionString;
+        SetException(e, exceptionString, exceptionLen, outExceptionPtr);
     }
 }
 
 extern "C" __declspec(dllexport) void KerasDeletePointer(void * ptr)
 {
     delete[] ptr;
+}
+
+// Sessions for online learning: the model, the learner and the trainer stay resident between
+// the calls. The session is created from the same KerasProto as Fit [the graph or the layers,
+// the compile parameters and optionally a model to start from]. The batches are KerasProtos
+// with the inputs [and the labels], the outputs are KerasProtos as well: the loss and the
+// metrics in evaluation, the predictions in outputs and the snapshot in model.
+extern "C" __declspec(dllexport) void KerasSessionCreate(
+    const char * inData, unsigned inLen,
+    uint64_t * session,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    try
+    {
+        unique_ptr<keras::Sequential> model(new keras::Sequential());
+        model->Init(inData, inLen);
+        model->CreateSession();
+        *session = (uint64_t)model.release();
+
+        ClearException(exceptionString, exceptionLen, outExceptionPtr);
+    }
+    catch (const exception & e)
+    {
+        *session = 0;
+
+        SetException(e, exceptionString, exceptionLen, outExceptionPtr);
+    }
+}
+
+typedef void (keras::Sequential::*SessionCall)(const char *, unsigned);
+
+static void CallSession(
+    uint64_t session, SessionCall call,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    try
+    {
+        auto model = (keras::Sequential *)session;
+        if (model == nullptr)
+            throw invalid_argument("Bad session");
+
+        (model->*call)(inData, inLen);
+
+        model->GetOutput(outData, outLen);
+        *outPtr = (uint64_t)*outData;
+
+        ClearException(exceptionString, exceptionLen, outExceptionPtr);
+    }
+    catch (const exception & e)
+    {
+        *outData = nullptr;
+        *outLen = 0;
+        *outPtr = 0;
+
+        SetException(e, exceptionString, exceptionLen, outExceptionPtr);
+    }
+}
+
+extern "C" __declspec(dllexport) void KerasSessionTrainOnBatch(
+    uint64_t session,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    CallSession(session, &keras::Sequential::TrainOnBatch, inData, inLen, outData, outLen, outPtr, exceptionString, exceptionLen, outExceptionPtr);
+}
+
+extern "C" __declspec(dllexport) void KerasSessionPredictOnBatch(
+    uint64_t session,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    CallSession(session, &keras::Sequential::PredictOnBatch, inData, inLen, outData, outLen, outPtr, exceptionString, exceptionLen, outExceptionPtr);
+}
+
+extern "C" __declspec(dllexport) void KerasSessionSave(
+    uint64_t session,
+    const char * inData, unsigned inLen,
+    char ** outData, unsigned * outLen,
+    uint64_t * outPtr,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    CallSession(session, &keras::Sequential::SaveSession, inData, inLen, outData, outLen, outPtr, exceptionString, exceptionLen, outExceptionPtr);
+}
+
+extern "C" __declspec(dllexport) void KerasSessionDestroy(uint64_t session)
+{
+    delete (keras::Sequential *)session;
+}
+
+// Low latency inference over a saved model: the inputs [n x input size] and the outputs
+// [n x output size] are raw float buffers owned by the caller
+extern "C" __declspec(dllexport) void KerasPredictorCreate(
+    const char * model, unsigned modelLen,
+    uint64_t * predictor,
+    unsigned * inputSize, unsigned * outputSize,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    try
+    {
+        cntk::DeviceDescriptor::TrySetDefaultDevice(keras::globals::device);
+
+        unique_ptr<keras::cntk_utils::Predictor> result(new keras::cntk_utils::Predictor(keras::cntk_utils::LoadModel(model, modelLen), keras::globals::device));
+        *inputSize = (unsigned)result->InputSize();
+        *outputSize = (unsigned)result->OutputSize();
+        *predictor = (uint64_t)result.release();
+
+        ClearException(exceptionString, exceptionLen, outExceptionPtr);
+    }
+    catch (const exception & e)
+    {
+        *predictor = 0;
+
+        SetException(e, exceptionString, exceptionLen, outExceptionPtr);
+    }
+}
+
+extern "C" __declspec(dllexport) void KerasPredict(
+    uint64_t predictor,
+    const float * in, unsigned n,
+    float * out,
+    char ** exceptionString, unsigned * exceptionLen,
+    uint64_t * outExceptionPtr)
+{
+    try
+    {
+        auto p = (keras::cntk_utils::Predictor *)predictor;
+        if (p == nullptr)
+            throw invalid_argument("Bad predictor");
+
+        p->Predict(in, n, out);
+
+        ClearException(exceptionString, exceptionLen, outExceptionPtr);
+    }
+    catch (const exception & e)
+    {
+        SetException(e, exceptionString, exceptionLen, outExceptionPtr);
+    }
+}
+
+extern "C" __declspec(dllexport) void KerasPredictorDestroy(uint64_t predictor)
+{
+    delete (keras::cntk_utils::Predictor *)predictor;
 }
\ No newline at end of file
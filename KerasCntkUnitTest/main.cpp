@@ -1,11 +1,31 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <thread>
 
 #include "gtest/gtest.h"
 
 #include "TH/THTensor.h"
 
 #include "Keras.h"
+#include "BatchScheduler.h"
+#include "BufferMinibatchSource.h"
+#include "Checkpoint.h"
+#include "CntkUtils.h"
+#include "CppExport.h"
+#include "CppExportKernels.h"
 #include "DataBuffer.h"
+#include "MappedFile.h"
+#include "ModelCache.h"
+#include "ParallelTrainer.h"
+#include "Predictor.h"
+#include "ProgressReporter.h"
+#include "TopK.h"
+#include "WeightDecay.h"
 
 using namespace std;
 using namespace keras;
@@ -124,6 +144,589 @@ TEST(KerasFunctions, CategoricalCrossEntropy)
         ASSERT_NEAR(resultData[i], expected[i], 0.0001);
 }
 
+TEST(KerasFunctions, SoftmaxCrossEntropy)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+
+    vector<float> logitsData = { 1.0f, 2.0f, 11.0f, 4.0f };
+    vector<float> truthData = { 0.0f, 0.0f, 1.0f, 0.0f };
+
+    CNTK::Variable logitsVar = CNTK::InputVariable(CNTK::NDShape({ logitsData.size() }), CNTK::DataType::Float, "LogitsVar");
+    CNTK::Variable truthVar = CNTK::InputVariable(CNTK::NDShape({ truthData.size() }), CNTK::DataType::Float, "TruthVar");
+
+    auto logitsVal = CNTK::MakeSharedObject<CNTK::Value>(CNTK::MakeSharedObject<CNTK::NDArrayView>(CNTK::NDShape({ logitsData.size() }), logitsData, false));
+    auto truthVal = CNTK::MakeSharedObject<CNTK::Value>(CNTK::MakeSharedObject<CNTK::NDArrayView>(CNTK::NDShape({ truthData.size() }), truthData, false));
+
+    // The fused loss of a softmax output and the loss of unnormalized probabilities are the same
+    auto fused = keras::SoftmaxCrossEntropy(CNTK::Softmax(logitsVar), truthVar);
+    auto normalized = keras::SoftmaxCrossEntropy(CNTK::ElementTimes(CNTK::Constant::Scalar(0.5f), CNTK::Softmax(logitsVar)), truthVar);
+
+    for (const auto & func : { fused, normalized })
+    {
+        std::unordered_map<CNTK::Variable, CNTK::ValuePtr> resultMap = { { func->Output(), nullptr } };
+        func->Evaluate({ { logitsVar, logitsVal },{ truthVar, truthVal } }, resultMap, device);
+
+        vector<vector<float>> resultData;
+        resultMap[func->Output()]->CopyVariableValueTo(func->Output(), resultData);
+        ASSERT_NEAR(resultData[0][0], 0.00108f, 0.0001);
+    }
+}
+
+TEST(KerasFunctions, LSTM)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+
+    const size_t inputDim = 3;
+    const size_t units = 2;
+
+    // Two sequences of different lengths, no padding
+    vector<vector<float>> sequences = { vector<float>(2 * inputDim, 0.5f), vector<float>(4 * inputDim, -0.5f) };
+
+    CNTK::Variable inputVar = CNTK::InputVariable(CNTK::NDShape({ inputDim }), CNTK::DataType::Float, L"Input");
+    auto inputVal = CNTK::Value::CreateBatchOfSequences(CNTK::NDShape({ inputDim }), sequences, device, true);
+
+    keras::UnaryOp tanh = [](const CNTK::Variable & x) { return CNTK::Tanh(x); };
+    keras::UnaryOp sigmoid = [](const CNTK::Variable & x) { return CNTK::Sigmoid(x); };
+
+    for (auto returnSequences : { false, true })
+    {
+        auto func = keras::LSTM(inputVar, units, tanh, sigmoid, CNTK::GlorotUniformInitializer(), CNTK::GlorotUniformInitializer(), true, true, returnSequences);
+        ASSERT_EQ(func->Output().Shape().TotalSize(), units);
+
+        std::unordered_map<CNTK::Variable, CNTK::ValuePtr> resultMap = { { func->Output(), nullptr } };
+        func->Evaluate({ { inputVar, inputVal } }, resultMap);
+
+        vector<vector<float>> result;
+        resultMap[func->Output()]->CopyVariableValueTo(func->Output(), result);
+
+        ASSERT_EQ(result.size(), sequences.size());
+        for (auto i = 0; i < result.size(); ++i)
+        {
+            size_t steps = returnSequences ? sequences[i].size() / inputDim : 1;
+            ASSERT_EQ(result[i].size(), steps * units);
+            for (auto v : result[i])
+                ASSERT_LT(fabs(v), 1.0f);
+        }
+    }
+
+    auto gru = keras::GRU(inputVar, units, tanh, sigmoid, CNTK::GlorotUniformInitializer(), CNTK::GlorotUniformInitializer());
+    ASSERT_EQ(gru->Output().Shape().TotalSize(), units);
+}
+
+TEST(KerasFunctions, GroupedConvolution)
+{
+    CNTK::Variable inputVar = CNTK::InputVariable(CNTK::NDShape({ 8, 8, 4 }), CNTK::DataType::Float, L"Input");
+
+    auto grouped = keras::Convolution2D(inputVar, 6, { 3, 3 }, { 1, 1 }, false, 2, CNTK::GlorotUniformInitializer());
+    ASSERT_EQ(grouped->Output().Shape(), CNTK::NDShape({ 6, 6, 6 }));
+    ASSERT_EQ(grouped->Parameters().size(), 2);
+    for (auto & p : grouped->Parameters())
+        ASSERT_EQ(p.Shape(), CNTK::NDShape({ 3, 3, 2, 3 }));
+
+    auto depthwise = keras::DepthwiseConvolution2D(inputVar, { 3, 3 }, { 1, 1 }, true, 2, CNTK::GlorotUniformInitializer());
+    ASSERT_EQ(depthwise->Output().Shape(), CNTK::NDShape({ 8, 8, 8 }));
+
+    auto separable = keras::SeparableConvolution2D(inputVar, 16, { 3, 3 }, { 1, 1 }, true, 1, CNTK::GlorotUniformInitializer(), CNTK::GlorotUniformInitializer());
+    ASSERT_EQ(separable->Output().Shape(), CNTK::NDShape({ 8, 8, 16 }));
+    ASSERT_THROW(keras::Convolution2D(inputVar, 6, { 3, 3 }, { 1, 1 }, false, 3, CNTK::GlorotUniformInitializer()), runtime_error);
+
+    // Many groups are a single convolution of a masked kernel: only the first channel is set,
+    // so only its filters (the first depthMultiplier channels of the output) see anything
+    const size_t channels = 8;
+    CNTK::Variable wideVar = CNTK::InputVariable(CNTK::NDShape({ 8, 8, channels }), CNTK::DataType::Float, L"Wide");
+    auto wide = keras::DepthwiseConvolution2D(wideVar, { 3, 3 }, { 1, 1 }, true, 2, CNTK::GlorotUniformInitializer());
+    ASSERT_EQ(wide->Output().Shape(), CNTK::NDShape({ 8, 8, 2 * channels }));
+    ASSERT_EQ(wide->Parameters().size(), 1);
+    ASSERT_EQ(wide->Parameters()[0].Shape(), CNTK::NDShape({ 3, 3, 1, 2 * channels }));
+
+    vector<float> image(8 * 8 * channels, 0.0f);
+    fill(image.begin(), image.begin() + 8 * 8, 1.0f);
+    auto imageVal = CNTK::Value::CreateBatch(wideVar.Shape(), image, CNTK::DeviceDescriptor::CPUDevice(), true);
+    std::unordered_map<CNTK::Variable, CNTK::ValuePtr> resultMap = { { wide->Output(), nullptr } };
+    wide->Evaluate({ { wideVar, imageVal } }, resultMap);
+
+    vector<vector<float>> result;
+    resultMap[wide->Output()]->CopyVariableValueTo(wide->Output(), result);
+    ASSERT_EQ(result.size(), 1);
+    float seen = 0.0f;
+    for (size_t i = 0; i < result[0].size(); ++i)
+    {
+        if (i < 2 * 8 * 8)
+            seen += fabs(result[0][i]);
+        else
+            ASSERT_EQ(result[0][i], 0.0f);
+    }
+    ASSERT_GT(seen, 0.0f);
+}
+
+TEST(DataBuffer, OneHotSequences)
+{
+    const size_t dimension = 5;
+
+    // Two sequences of lengths 1 and 3
+    cntk_utils::DataBuffer buffer(dimension, { 1, 3, 4, 0 });
+    buffer.SetSequenceLengths({ 1, 3 });
+
+    ASSERT_EQ(buffer.NumSamples(), 2);
+    ASSERT_EQ(buffer.NumSteps(0, 2), 4);
+
+    CNTK::Variable var = CNTK::InputVariable(CNTK::NDShape({ dimension }), true, CNTK::DataType::Float, L"Indices");
+    auto value = buffer.GetBatch(0, 2, var.Shape());
+    ASSERT_TRUE(value->IsSparse());
+
+    vector<vector<size_t>> result;
+    value->CopyVariableValueTo(var, result);
+
+    vector<vector<size_t>> expected = { { 1 }, { 3, 4, 0 } };
+    ASSERT_EQ(result, expected);
+}
+
+TEST(DataBuffer, MultiHotSequences)
+{
+    const size_t dimension = 5;
+
+    // Two hashes per step, the second step's collide and add up
+    cntk_utils::DataBuffer buffer(dimension, { 4, 1, 2, 2 }, L"", 2);
+    buffer.SetSequenceLengths({ 2 });
+
+    ASSERT_EQ(buffer.NumSamples(), 1);
+    ASSERT_EQ(buffer.NumSteps(0, 1), 2);
+
+    CNTK::Variable var = CNTK::InputVariable(CNTK::NDShape({ dimension }), true, CNTK::DataType::Float, L"Indices");
+    auto value = buffer.GetBatch(0, 1, var.Shape());
+    ASSERT_TRUE(value->IsSparse());
+
+    vector<vector<float>> result;
+    value->CopyVariableValueTo(var, result);
+
+    vector<vector<float>> expected = { { 0, 1, 0, 0, 1, 0, 0, 2, 0, 0 } };
+    ASSERT_EQ(result, expected);
+}
+
+TEST(CntkUtils, Hash)
+{
+    const string key = "user:42";
+    ASSERT_EQ(cntk_utils::Hash(key.data(), key.size(), 0), cntk_utils::Hash(key.data(), key.size(), 0));
+    ASSERT_NE(cntk_utils::Hash(key.data(), key.size(), 0), cntk_utils::Hash(key.data(), key.size(), 1));
+    ASSERT_NE(cntk_utils::Hash(42, 0), cntk_utils::Hash(43, 0));
+
+    ASSERT_EQ(cntk_utils::GetNumHashes(CNTK::InputVariable({ 8 }, true, CNTK::DataType::Float, cntk_utils::HashedInputName(3))), 3);
+    ASSERT_EQ(cntk_utils::GetNumHashes(CNTK::InputVariable({ 8 }, true, CNTK::DataType::Float, L"Features")), 0);
+}
+
+TEST(BufferMinibatchSource, Shards)
+{
+    vector<float> data = { 0, 1, 2, 3, 4 };
+    TensorProto proto;
+    proto.set_type(DataType::Float);
+    proto.add_shape((int)data.size());
+    proto.add_shape(1);
+    proto.set_data(string((const char *)&data[0], data.size() * sizeof(float)));
+
+    for (size_t rank = 0; rank < 2; ++rank)
+    {
+        cntk_utils::BufferMinibatchSource source;
+        source.Add(proto, CNTK::NDShape({ 1 }), L"Features");
+
+        // The ranks split every minibatch of 4, the second one only has a sample for the last rank
+        auto minibatch = source.GetNextMinibatch(0, 4, 2, rank);
+        ASSERT_EQ(minibatch.at(source.FeatureStreamInfo()).numberOfSequences, 2);
+        ASSERT_EQ(source.GetLastBatchSize(), 4);
+
+        minibatch = source.GetNextMinibatch(0, 4, 2, rank);
+        ASSERT_EQ(minibatch.empty(), rank == 0);
+        ASSERT_EQ(source.GetLastBatchSize(), 1);
+    }
+}
+
+TEST(Checkpoint, RoundTrip)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+    auto createModel = [&device](double value)
+    {
+        auto input = CNTK::InputVariable({ 3 }, CNTK::DataType::Float, L"Features");
+        return CNTK::ElementTimes(CNTK::Parameter({ 3 }, CNTK::DataType::Float, value, device), input);
+    };
+
+    vector<float> data = { 0, 1, 2, 3, 4 };
+    TensorProto proto;
+    proto.set_type(DataType::Float);
+    proto.add_shape((int)data.size());
+    proto.add_shape(1);
+    proto.set_data(string((const char *)&data[0], data.size() * sizeof(float)));
+
+    cntk_utils::BufferMinibatchSource source;
+    source.Add(proto, CNTK::NDShape({ 1 }), L"Features");
+    source.GetNextMinibatch(2, device);
+
+    wstring path = _wtmpnam(nullptr);
+    {
+        // The second checkpoint replaces the first one
+        cntk_utils::CheckpointWriter writer(path);
+        writer.Write({ createModel(1.0), {}, CNTK::Dictionary() });
+        writer.Flush();
+
+        cntk_utils::Checkpoint checkpoint = { createModel(2.0), {}, CNTK::Dictionary() };
+        checkpoint.state[L"source"] = source.GetCheckpointState();
+        writer.Write(move(checkpoint));
+        writer.Flush();
+    }
+    ASSERT_TRUE(cntk_utils::CheckpointWriter::Exists(path));
+    ASSERT_FALSE(cntk_utils::CheckpointWriter::Exists(path + L".tmp"));
+
+    auto checkpoint = cntk_utils::CheckpointWriter::Read(path, device);
+    _wunlink(path.c_str());
+
+    // Restored into a fresh model and source
+    auto model = createModel(0.0);
+    auto parameter = model->Parameters()[0];
+    parameter.Value()->CopyFrom(*checkpoint.model->Parameters()[0].Value());
+    vector<float> values(parameter.Value()->DataBuffer<float>(), parameter.Value()->DataBuffer<float>() + 3);
+    ASSERT_EQ(values, vector<float>({ 2.0f, 2.0f, 2.0f }));
+
+    cntk_utils::BufferMinibatchSource restored;
+    restored.Add(proto, CNTK::NDShape({ 1 }), L"Features");
+    restored.RestoreFromCheckpoint(checkpoint.state[L"source"].Value<CNTK::Dictionary>());
+    ASSERT_EQ(restored.GetPos(), 2);
+
+    const auto & minibatch = restored.GetNextMinibatch(1, device);
+    ASSERT_EQ(minibatch.at(restored.FeatureStreamInfo()).data->Data()->DataBuffer<float>()[0], 2.0f);
+}
+
+TEST(BatchScheduler, ConcurrentRequests)
+{
+    auto input = CNTK::InputVariable({ 2 }, CNTK::DataType::Float, L"Features");
+    cntk_utils::BatchScheduler scheduler(CNTK::Negate(input), CNTK::DeviceDescriptor::CPUDevice(), 4, chrono::microseconds(1000));
+
+    // Every request gets its own rows back, whichever batch they were evaluated in
+    vector<thread> threads;
+    vector<vector<float>> outputs(16, vector<float>(2));
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        threads.emplace_back([&scheduler, &outputs, i]
+        {
+            vector<float> in = { (float)i, (float)(i + 100) };
+            scheduler.Predict(&in[0], 1, &outputs[i][0]);
+        });
+    }
+    for (auto & t : threads)
+        t.join();
+
+    for (size_t i = 0; i < outputs.size(); ++i)
+        ASSERT_EQ(outputs[i], vector<float>({ -(float)i, -(float)(i + 100) }));
+
+    // Larger than a batch
+    vector<float> in(12), out(12);
+    for (size_t i = 0; i < in.size(); ++i)
+        in[i] = (float)i;
+    scheduler.Predict(&in[0], 6, &out[0]);
+    ASSERT_EQ(out[11], -11.0f);
+}
+
+TEST(KerasFunctions, ExportCpp)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+
+    // The kernels of the exported sources against CNTK, on Predict's rows
+    auto input = CNTK::InputVariable({ 3 }, CNTK::DataType::Float, L"Features");
+    auto weights = CNTK::Parameter({ 2, 3 }, CNTK::DataType::Float, CNTK::GlorotUniformInitializer(), device);
+    auto dense = CNTK::Times(weights, input);
+
+    vector<float> x = { 0.5f, -1.0f, 2.0f };
+    vector<float> y(2), expected(2);
+    cntk_utils::Predictor(dense, device).Predict(&x[0], 1, &expected[0]);
+    keras_kernels::Dense<2, 3>(weights.Value()->DataBuffer<float>(), &x[0], &y[0]);
+    for (size_t i = 0; i < y.size(); ++i)
+        ASSERT_NEAR(y[i], expected[i], 1e-5f);
+
+    auto source = cntk_utils::ExportCpp(CNTK::Softmax(dense), "mlp");
+    ASSERT_NE(source.find("Dense<2, 3>"), string::npos);
+    ASSERT_NE(source.find("Softmax<2>"), string::npos);
+    ASSERT_NE(source.find("mlp_predict"), string::npos);
+    ASSERT_EQ(source.find("Transpose(input_shape"), string::npos);
+
+    // The row major image is transposed to CNTK's column major order first
+    auto image = CNTK::InputVariable({ 5, 4, 2 }, CNTK::DataType::Float, L"Image");
+    auto conv = keras::Convolution2D(image, 3, { 3, 3 }, { 1, 1 }, false, 1, CNTK::GlorotUniformInitializer());
+    ASSERT_EQ(conv->Output().Shape(), CNTK::NDShape({ 3, 2, 3 }));
+
+    vector<float> pixels(5 * 4 * 2), columns(pixels.size());
+    for (size_t i = 0; i < pixels.size(); ++i)
+        pixels[i] = sin((float)i);
+    vector<float> features(3 * 2 * 3), expectedFeatures(features.size());
+    cntk_utils::Predictor(conv, device).Predict(&pixels[0], 1, &expectedFeatures[0]);
+
+    static const size_t shape[] = { 5, 4, 2 };
+    keras_kernels::Transpose(shape, &pixels[0], &columns[0]);
+    keras_kernels::Conv2D<5, 4, 2, 3, 3, 3, 1, 1, 0, 0, 3, 2>(conv->Parameters()[0].Value()->DataBuffer<float>(), &columns[0], &features[0]);
+    for (size_t i = 0; i < features.size(); ++i)
+        ASSERT_NEAR(features[i], expectedFeatures[i], 1e-4f);
+
+    source = cntk_utils::ExportCpp(conv, "cnn");
+    ASSERT_NE(source.find("static const size_t input_shape[] = { 5, 4, 2 };"), string::npos);
+    ASSERT_NE(source.find("Transpose(input_shape, x, (t + 0));"), string::npos);
+    ASSERT_NE(source.find("Conv2D<5, 4, 2, 3, 3, 3, 1, 1, 0, 0, 3, 2>"), string::npos);
+
+    ASSERT_THROW(cntk_utils::ExportCpp(CNTK::Log(input), "log"), runtime_error);
+}
+
+TEST(KerasFunctions, SaveLoadInMemory)
+{
+    auto input = CNTK::InputVariable({ 3 }, CNTK::DataType::Float, L"Features");
+    auto weights = CNTK::Parameter({ 1 }, CNTK::DataType::Float, 2.0, CNTK::DeviceDescriptor::CPUDevice(), L"Weights");
+    auto model = CNTK::ElementTimes(weights, input);
+
+    string buffer;
+    cntk_utils::SaveModel(model, buffer);
+    ASSERT_GT(buffer.size(), 0);
+
+    auto loaded = cntk_utils::LoadModel(buffer.data(), buffer.size());
+    ASSERT_EQ(loaded->Parameters().size(), 1);
+    ASSERT_EQ(loaded->Parameters()[0].Name(), L"Weights");
+    ASSERT_EQ(loaded->Parameters()[0].Value()->AsScalar<float>(), 2.0f);
+}
+
+TEST(MappedFile, Contents)
+{
+    auto path = _wtmpnam(nullptr);
+    {
+        ofstream outStream(path, ofstream::trunc | ofstream::binary);
+        outStream << "model bytes";
+    }
+
+    {
+        cntk_utils::MappedFile file(path);
+        ASSERT_EQ(string(file.Data(), file.Size()), "model bytes");
+    }
+    _wunlink(path);
+
+    ASSERT_THROW(cntk_utils::MappedFile file(path), runtime_error);
+}
+
+TEST(ModelCache, Leases)
+{
+    auto input = CNTK::InputVariable({ 3 }, CNTK::DataType::Float, L"Features");
+    auto weights = CNTK::Parameter({ 3 }, CNTK::DataType::Float, 2.0, CNTK::DeviceDescriptor::CPUDevice());
+    auto model = CNTK::ElementTimes(weights, input);
+
+    cntk_utils::ModelCache cache;
+    cache.Insert("model", model);
+    ASSERT_EQ(cache.Find("model"), model);
+    ASSERT_EQ(cache.Find("other"), nullptr);
+    ASSERT_THROW(cache.Acquire("other"), runtime_error);
+
+    CNTK::FunctionPtr first;
+    {
+        // Concurrent leases get their own instances, all of them sharing the parameters
+        auto a = cache.Acquire("model");
+        auto b = cache.Acquire("model");
+        ASSERT_NE(a.Model(), b.Model());
+        ASSERT_NE(a.Model(), model);
+        ASSERT_EQ(a.Model()->Parameters()[0], weights);
+        ASSERT_EQ(b.Model()->Parameters()[0], weights);
+        first = a.Model();
+    }
+
+    // Released instances are reused
+    auto c = cache.Acquire("model");
+    auto d = cache.Acquire("model");
+    ASSERT_TRUE(c.Model() == first || d.Model() == first);
+
+    // A scheduler per limits, the callers with other limits don't replace it
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+    auto scheduler = cache.Scheduler("model", 4, chrono::microseconds(100), device);
+    auto other = cache.Scheduler("model", 8, chrono::microseconds(100), device);
+    ASSERT_NE(scheduler, other);
+    ASSERT_EQ(cache.Scheduler("model", 4, chrono::microseconds(100), device), scheduler);
+    ASSERT_EQ(cache.Scheduler("model", 8, chrono::microseconds(100), device), other);
+}
+
+TEST(ModelCache, Budget)
+{
+    auto createModel = [](size_t size)
+    {
+        auto input = CNTK::InputVariable({ size }, CNTK::DataType::Float, L"Features");
+        return CNTK::ElementTimes(CNTK::Parameter({ size }, CNTK::DataType::Float, 1.0, CNTK::DeviceDescriptor::CPUDevice()), input);
+    };
+    ASSERT_EQ(cntk_utils::ModelCache::ModelBytes(createModel(10)), 40);
+
+    cntk_utils::ModelCache cache;
+    cache.SetBudget(100);
+    cache.Insert("a", createModel(10));
+    cache.Insert("b", createModel(10));
+    cache.Pin("a", true);
+
+    // Over the budget, the least recently used model that isn't pinned goes
+    cache.Insert("c", createModel(10));
+    ASSERT_NE(cache.Find("a"), nullptr);
+    ASSERT_EQ(cache.Find("b"), nullptr);
+    ASSERT_NE(cache.Find("c"), nullptr);
+
+    auto stats = cache.GetStats();
+    ASSERT_EQ(stats.hits, 2);
+    ASSERT_EQ(stats.misses, 1);
+    ASSERT_EQ(stats.evictions, 1);
+    ASSERT_EQ(stats.models, 2);
+    ASSERT_EQ(stats.bytes, 80);
+
+    ASSERT_TRUE(cache.Unload("c"));
+    ASSERT_FALSE(cache.Unload("c"));
+    ASSERT_EQ(cache.GetStats().bytes, 40);
+
+    // The same content is cached once
+    string content = "model bytes";
+    auto key = cntk_utils::ModelCache::ContentKey(content.data(), content.size());
+    cache.Insert("d", createModel(1), key);
+    ASSERT_EQ(cache.FindContent(key), "d");
+    ASSERT_EQ(cache.FindContent(cntk_utils::ModelCache::ContentKey("other", 5)), "");
+    ASSERT_TRUE(cache.HasContentSize(content.size()));
+    ASSERT_FALSE(cache.HasContentSize(content.size() + 1));
+
+    // The key is the size then the SHA-256 of the bytes
+    auto empty = cntk_utils::ModelCache::ContentKey("", 0);
+    ASSERT_EQ(empty.size(), 40);
+    const unsigned char emptyDigest[] = { 0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+        0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55 };
+    ASSERT_EQ(empty, string(8, '\0') + string((const char *)emptyDigest, sizeof(emptyDigest)));
+}
+
+TEST(Predictor, RawBuffers)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+
+    // Row major [2 x 3] samples, the model's output is the input in CNTK's column major order
+    auto input = CNTK::InputVariable({ 2, 3 }, CNTK::DataType::Float, L"Features");
+    cntk_utils::Predictor predictor(CNTK::Negate(input), device);
+    ASSERT_EQ(predictor.InputSize(), 6);
+    ASSERT_EQ(predictor.OutputSize(), 6);
+
+    vector<float> in = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    vector<float> out(in.size());
+    predictor.Predict(&in[0], 2, &out[0]);
+
+    vector<float> expected = { 0, -3, -1, -4, -2, -5, -6, -9, -7, -10, -8, -11 };
+    ASSERT_EQ(out, expected);
+
+    // The same buffers stay bound and see the new samples, a different n is rebound
+    for (auto & v : in)
+        v += 1;
+    predictor.Predict(&in[0], 2, &out[0]);
+    for (auto & v : expected)
+        v -= 1;
+    ASSERT_EQ(out, expected);
+
+    vector<float> single(6);
+    predictor.Predict(&in[6], 1, &single[0]);
+    ASSERT_EQ(single, vector<float>(expected.begin() + 6, expected.end()));
+}
+
+TEST(ProgressReporter, Throttle)
+{
+    cntk_utils::ProgressThrottle throttle(3);
+    vector<bool> reported;
+    for (size_t i = 0; i < 7; ++i)
+        reported.push_back(throttle.Next());
+    ASSERT_EQ(reported, vector<bool>({ true, false, false, true, false, false, true }));
+
+    cntk_utils::ProgressThrottle epochsOnly(0, 0, false);
+    ASSERT_FALSE(epochsOnly.Next());
+}
+
+TEST(ProgressReporter, DeliversInOrder)
+{
+    vector<size_t> ids;
+    cntk_utils::ProgressReporter reporter([&ids](const cntk_utils::ProgressReporter::Event & event) { ids.push_back(event.id); }, 4);
+
+    // The buffer is smaller than the events, the ones that can't be dropped wait for room
+    for (size_t id = 0; id < 100; ++id)
+        ASSERT_TRUE(reporter.Post({ 0, id, { { "loss", 1.0 } } }, false));
+    reporter.Close();
+
+    ASSERT_EQ(ids.size(), 100);
+    for (size_t id = 0; id < ids.size(); ++id)
+        ASSERT_EQ(ids[id], id);
+}
+
+TEST(TopK, Rows)
+{
+    vector<float> rows = { 0.5f, 0.5f, 0.1f, 0.2f, 0.9f, 0.9f };
+
+    // k is clamped to the classes, equal scores keep the lower index first
+    google::protobuf::RepeatedPtrField<TensorProto> outputs;
+    cntk_utils::AddTopKOutputs(outputs, 5, 2, 3);
+    ASSERT_EQ(outputs.size(), 2);
+    ASSERT_EQ(outputs[0].type(), DataType::Int32);
+    ASSERT_EQ(outputs[1].type(), DataType::Float);
+    ASSERT_EQ(outputs[0].shape(1), 3);
+
+    cntk_utils::AppendTopK(outputs[0], outputs[1], &rows[0], 2, 3);
+    const int32_t * indices = (const int32_t *)outputs[0].data().data();
+    const float * scores = (const float *)outputs[1].data().data();
+    ASSERT_EQ(vector<int32_t>(indices, indices + 6), vector<int32_t>({ 0, 1, 2, 1, 2, 0 }));
+    ASSERT_EQ(vector<float>(scores, scores + 6), vector<float>({ 0.5f, 0.5f, 0.1f, 0.9f, 0.9f, 0.2f }));
+    ASSERT_EQ(outputs[0].shape(0), 2);
+    ASSERT_EQ(outputs[1].count(), 6);
+    ASSERT_EQ(outputs[0].sequence_lengths_size(), 0);
+
+    // The argmax, a sequence's length on both tensors
+    google::protobuf::RepeatedPtrField<TensorProto> argmax;
+    cntk_utils::AddTopKOutputs(argmax, 1, 2, 3);
+    cntk_utils::AppendTopK(argmax[0], argmax[1], &rows[0], 2, 3, true);
+    cntk_utils::AppendTopK(argmax[0], argmax[1], &rows[0], 1, 3, true);
+    indices = (const int32_t *)argmax[0].data().data();
+    ASSERT_EQ(vector<int32_t>(indices, indices + 3), vector<int32_t>({ 0, 1, 0 }));
+    ASSERT_EQ(argmax[1].shape(0), 3);
+    for (const auto & o : argmax)
+        ASSERT_EQ(vector<int32_t>(o.sequence_lengths().begin(), o.sequence_lengths().end()), vector<int32_t>({ 2, 1 }));
+}
+
+TEST(ParallelTrainer, NoEvaluation)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+    auto x = CNTK::InputVariable(CNTK::NDShape({ 2 }), CNTK::DataType::Float, L"X");
+    auto y = CNTK::InputVariable(CNTK::NDShape({ 1 }), CNTK::DataType::Float, L"Y");
+    auto w = CNTK::Parameter(CNTK::NDShape({ 1, 2 }), CNTK::DataType::Float, 0.0, device, L"W");
+    auto model = CNTK::Times(w, x);
+    auto loss = CNTK::SquaredError(model, y);
+
+    vector<float> features = { 1.0f, 0.0f, 0.0f, 1.0f };
+    vector<float> labels = { 1.0f, 1.0f };
+    cntk_utils::MinibatchArguments minibatch = {
+        { x, CNTK::MinibatchData(CNTK::Value::CreateBatch(x.Shape(), features, device, true), 2, 2, false) },
+        { y, CNTK::MinibatchData(CNTK::Value::CreateBatch(y.Shape(), labels, device, true), 2, 2, false) } };
+
+    // A regression loss without a metric: no evaluation function in either mode
+    for (auto mode : { cntk_utils::ParallelTrainer::Mode::AllReduce, cntk_utils::ParallelTrainer::Mode::Hogwild })
+    {
+        auto createLearner = [&]() { return CNTK::SGDLearner(model->Parameters(), CNTK::LearningRateSchedule(0.1)); };
+        cntk_utils::ParallelTrainer trainer(model, loss, nullptr, { x }, y, createLearner, 2, mode);
+        trainer.TrainMinibatches({ minibatch, minibatch }, device);
+
+        ASSERT_EQ(trainer.PreviousMinibatchSampleCount(), 4);
+        ASSERT_GT(trainer.PreviousMinibatchLossAverage(), 0.0);
+        ASSERT_EQ(trainer.PreviousMinibatchEvaluationAverage(), 0.0);
+    }
+}
+
+TEST(DecoupledWeightDecay, Update)
+{
+    auto device = CNTK::DeviceDescriptor::CPUDevice();
+    auto w = CNTK::Parameter(CNTK::NDShape({ 2 }), CNTK::DataType::Float, 1.0, device, L"W");
+    auto sgd = CNTK::SGDLearner({ w }, CNTK::LearningRateSchedule(0.1));
+    CNTK::LearnerPtr learner = make_shared<cntk_utils::DecoupledWeightDecay>(sgd, 0.5);
+
+    // w -= 0.1 * g, then w *= (1 - 0.1 * 0.5), independently of the gradient's scale
+    vector<float> gradient = { 0.0f, 1.0f };
+    auto gradientView = CNTK::MakeSharedObject<CNTK::NDArrayView>(CNTK::NDShape({ 2 }), gradient, false);
+    unordered_map<CNTK::Parameter, CNTK::NDArrayViewPtr> gradients = { { w, gradientView } };
+    learner->Update(gradients, 1);
+
+    vector<float> values(w.Value()->DataBuffer<float>(), w.Value()->DataBuffer<float>() + 2);
+    ASSERT_NEAR(values[0], 0.95f, 1e-6f);
+    ASSERT_NEAR(values[1], 0.9f * 0.95f, 1e-6f);
+    ASSERT_DOUBLE_EQ(learner->LearningRate(), 0.1);
+}
+
 static inline THLongStorage * CreateLongStorage(const vector<int> & shape)
 {
     THLongStorage * storage = THLongStorage_newWithSize(shape.size());
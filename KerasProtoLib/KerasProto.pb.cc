@@ -45,6 +45,61 @@ class HistoryProtoDefaultTypeInternal {
   ::google::protobuf::internal::ExplicitlyConstructed<HistoryProto>
       _instance;
 } _HistoryProto_default_instance_;
+class InitializerProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<InitializerProto>
+      _instance;
+} _InitializerProto_default_instance_;
+class LayerProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<LayerProto>
+      _instance;
+} _LayerProto_default_instance_;
+class OptimizerProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<OptimizerProto>
+      _instance;
+} _OptimizerProto_default_instance_;
+class CompileParamsProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<CompileParamsProto>
+      _instance;
+} _CompileParamsProto_default_instance_;
+class PredictParamsProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<PredictParamsProto>
+      _instance;
+} _PredictParamsProto_default_instance_;
+class LearningRateScheduleProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<LearningRateScheduleProto>
+      _instance;
+} _LearningRateScheduleProto_default_instance_;
+class DistributedParamsProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<DistributedParamsProto>
+      _instance;
+} _DistributedParamsProto_default_instance_;
+class CheckpointParamsProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<CheckpointParamsProto>
+      _instance;
+} _CheckpointParamsProto_default_instance_;
+class ProgressParamsProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ProgressParamsProto>
+      _instance;
+} _ProgressParamsProto_default_instance_;
+class CacheStatsProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<CacheStatsProto>
+      _instance;
+} _CacheStatsProto_default_instance_;
+class OutputChunkProtoDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<OutputChunkProto>
+      _instance;
+} _OutputChunkProto_default_instance_;
 }  // namespace keras
 namespace protobuf_KerasProto_2eproto {
 void InitDefaultsKerasProtoImpl() {
@@ -56,6 +111,14 @@ void InitDefaultsKerasProtoImpl() {
   ::google::protobuf::internal::InitProtobufDefaults();
 #endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
   protobuf_KerasProto_2eproto::InitDefaultsTensorProto();
+  protobuf_KerasProto_2eproto::InitDefaultsLayerProto();
+  protobuf_KerasProto_2eproto::InitDefaultsCompileParamsProto();
+  protobuf_KerasProto_2eproto::InitDefaultsPredictParamsProto();
+  protobuf_KerasProto_2eproto::InitDefaultsDistributedParamsProto();
+  protobuf_KerasProto_2eproto::InitDefaultsCheckpointParamsProto();
+  protobuf_KerasProto_2eproto::InitDefaultsProgressParamsProto();
+  protobuf_KerasProto_2eproto::InitDefaultsHistoryProto();
+  protobuf_KerasProto_2eproto::InitDefaultsCacheStatsProto();
   {
     void* ptr = &::keras::_KerasProto_default_instance_;
     new (ptr) ::keras::KerasProto();
@@ -154,7 +217,242 @@ void InitDefaultsHistoryProto() {
   ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsHistoryProtoImpl);
 }
 
-::google::protobuf::Metadata file_level_metadata[5];
+void InitDefaultsInitializerProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_InitializerProto_default_instance_;
+    new (ptr) ::keras::InitializerProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::InitializerProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsInitializerProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsInitializerProtoImpl);
+}
+
+void InitDefaultsLayerProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_KerasProto_2eproto::InitDefaultsInitializerProto();
+  {
+    void* ptr = &::keras::_LayerProto_default_instance_;
+    new (ptr) ::keras::LayerProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::LayerProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsLayerProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsLayerProtoImpl);
+}
+
+void InitDefaultsOptimizerProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_KerasProto_2eproto::InitDefaultsLearningRateScheduleProto();
+  {
+    void* ptr = &::keras::_OptimizerProto_default_instance_;
+    new (ptr) ::keras::OptimizerProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::OptimizerProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsOptimizerProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsOptimizerProtoImpl);
+}
+
+void InitDefaultsCompileParamsProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_KerasProto_2eproto::InitDefaultsOptimizerProto();
+  {
+    void* ptr = &::keras::_CompileParamsProto_default_instance_;
+    new (ptr) ::keras::CompileParamsProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::CompileParamsProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsCompileParamsProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsCompileParamsProtoImpl);
+}
+
+void InitDefaultsPredictParamsProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_PredictParamsProto_default_instance_;
+    new (ptr) ::keras::PredictParamsProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::PredictParamsProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsPredictParamsProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsPredictParamsProtoImpl);
+}
+
+void InitDefaultsLearningRateScheduleProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_LearningRateScheduleProto_default_instance_;
+    new (ptr) ::keras::LearningRateScheduleProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::LearningRateScheduleProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsLearningRateScheduleProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsLearningRateScheduleProtoImpl);
+}
+
+void InitDefaultsDistributedParamsProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_DistributedParamsProto_default_instance_;
+    new (ptr) ::keras::DistributedParamsProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::DistributedParamsProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsDistributedParamsProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsDistributedParamsProtoImpl);
+}
+
+void InitDefaultsCheckpointParamsProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_CheckpointParamsProto_default_instance_;
+    new (ptr) ::keras::CheckpointParamsProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::CheckpointParamsProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsCheckpointParamsProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsCheckpointParamsProtoImpl);
+}
+
+void InitDefaultsProgressParamsProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_ProgressParamsProto_default_instance_;
+    new (ptr) ::keras::ProgressParamsProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::ProgressParamsProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsProgressParamsProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsProgressParamsProtoImpl);
+}
+
+void InitDefaultsCacheStatsProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::keras::_CacheStatsProto_default_instance_;
+    new (ptr) ::keras::CacheStatsProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::CacheStatsProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsCacheStatsProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsCacheStatsProtoImpl);
+}
+
+void InitDefaultsOutputChunkProtoImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_KerasProto_2eproto::InitDefaultsTensorProto();
+  {
+    void* ptr = &::keras::_OutputChunkProto_default_instance_;
+    new (ptr) ::keras::OutputChunkProto();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::keras::OutputChunkProto::InitAsDefaultInstance();
+}
+
+void InitDefaultsOutputChunkProto() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsOutputChunkProtoImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[16];
 const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[4];
 
 const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
@@ -181,6 +479,22 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUT
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, outputs_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, progress_callback_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, command_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, layers_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, compile_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, predict_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, workers_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, parallel_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, distributed_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, gradient_accumulation_steps_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, checkpoint_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, frozen_layers_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, progress_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, evaluation_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, cache_budget_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, cache_stats_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, cpp_prefix_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, cpp_source_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::KerasProto, output_callback_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::TensorProto, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -192,6 +506,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUT
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::TensorProto, shape_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::TensorProto, indices_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::TensorProto, data_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::TensorProto, sequence_lengths_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::StreamConfigurationProto, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -217,13 +532,162 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUT
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::HistoryProto, names_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::HistoryProto, values_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::HistoryProto, nsamples_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::InitializerProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::InitializerProto, op_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::InitializerProto, value_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::InitializerProto, scale_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::InitializerProto, seed_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, op_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, input_shape_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, units_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, activation_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, use_bias_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, kernel_initializer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, bias_initializer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, filters_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, kernel_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, strides_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, padding_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, pool_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, rate_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, seed_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, input_dim_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, output_dim_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, input_length_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, recurrent_activation_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, recurrent_initializer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, unit_forget_bias_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, return_sequences_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, go_backwards_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, dropout_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, recurrent_dropout_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, embeddings_initializer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, mask_zero_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, hash_buckets_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, num_hashes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, groups_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, depth_multiplier_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, depthwise_initializer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LayerProto, pointwise_initializer_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, op_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, lr_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, momentum_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, decay_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, nesterov_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, rho_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, epsilon_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, beta_1_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, beta_2_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, weight_decay_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OptimizerProto, schedule_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CompileParamsProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CompileParamsProto, optimizer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CompileParamsProto, loss_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CompileParamsProto, metrics_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CompileParamsProto, top_k_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::PredictParamsProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::PredictParamsProto, no_cache_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::PredictParamsProto, max_batch_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::PredictParamsProto, max_wait_us_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::PredictParamsProto, top_k_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::PredictParamsProto, output_layers_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, op_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, gamma_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, step_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, warmup_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, min_lr_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::LearningRateScheduleProto, per_batch_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::DistributedParamsProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::DistributedParamsProto, op_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::DistributedParamsProto, distribute_after_samples_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::DistributedParamsProto, block_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::DistributedParamsProto, quantization_bits_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CheckpointParamsProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CheckpointParamsProto, path_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CheckpointParamsProto, every_batches_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CheckpointParamsProto, every_minutes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CheckpointParamsProto, resume_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::ProgressParamsProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::ProgressParamsProto, async_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::ProgressParamsProto, every_batches_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::ProgressParamsProto, every_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::ProgressParamsProto, epochs_only_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, hits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, misses_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, evictions_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, models_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::CacheStatsProto, budget_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OutputChunkProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OutputChunkProto, offset_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::keras::OutputChunkProto, outputs_),
 };
 static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::keras::KerasProto)},
-  { 23, -1, sizeof(::keras::TensorProto)},
-  { 34, -1, sizeof(::keras::StreamConfigurationProto)},
-  { 42, -1, sizeof(::keras::TextDataSourceProto)},
-  { 49, -1, sizeof(::keras::HistoryProto)},
+  { 39, -1, sizeof(::keras::TensorProto)},
+  { 51, -1, sizeof(::keras::StreamConfigurationProto)},
+  { 59, -1, sizeof(::keras::TextDataSourceProto)},
+  { 66, -1, sizeof(::keras::HistoryProto)},
+  { 76, -1, sizeof(::keras::InitializerProto)},
+  { 85, -1, sizeof(::keras::LayerProto)},
+  { 123, -1, sizeof(::keras::OptimizerProto)},
+  { 139, -1, sizeof(::keras::CompileParamsProto)},
+  { 148, -1, sizeof(::keras::PredictParamsProto)},
+  { 158, -1, sizeof(::keras::LearningRateScheduleProto)},
+  { 169, -1, sizeof(::keras::DistributedParamsProto)},
+  { 178, -1, sizeof(::keras::CheckpointParamsProto)},
+  { 187, -1, sizeof(::keras::ProgressParamsProto)},
+  { 196, -1, sizeof(::keras::CacheStatsProto)},
+  { 207, -1, sizeof(::keras::OutputChunkProto)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -232,6 +696,17 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_StreamConfigurationProto_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_TextDataSourceProto_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_HistoryProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_InitializerProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_LayerProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_OptimizerProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_CompileParamsProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_PredictParamsProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_LearningRateScheduleProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_DistributedParamsProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_CheckpointParamsProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_ProgressParamsProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_CacheStatsProto_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::keras::_OutputChunkProto_default_instance_),
 };
 
 void protobuf_AssignDescriptors() {
@@ -250,13 +725,13 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 5);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 16);
 }
 
 void AddDescriptorsImpl() {
   InitDefaults();
   static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\020KerasProto.proto\022\005keras\"\231\003\n\nKerasProto"
+      "\n\020KerasProto.proto\022\005keras\"\264\007\n\nKerasProto"
       "\022\r\n\005graph\030\001 \001(\t\022\r\n\005model\030\002 \001(\014\022\022\n\nmodel_"
       "path\030\003 \001(\t\022\022\n\nmodel_uuid\030\004 \001(\t\022\026\n\016compil"
       "e_params\030\005 \001(\t\022\022\n\nfit_params\030\006 \001(\t\022\026\n\016pr"
@@ -266,31 +741,99 @@ void AddDescriptorsImpl() {
       "(\r\022\017\n\007verbose\030\016 \001(\r\022\"\n\006inputs\030\017 \003(\0132\022.ke"
       "ras.TensorProto\022#\n\007outputs\030\020 \003(\0132\022.keras"
       ".TensorProto\022\031\n\021progress_callback\030\021 \001(\004\022"
-      "$\n\007command\030\022 \001(\0162\023.keras.KerasCommand\"\216\001"
-      "\n\013TensorProto\022\035\n\004type\030\001 \001(\0162\017.keras.Data"
-      "Type\022#\n\006format\030\002 \001(\0162\023.keras.TensorForma"
-      "t\022\r\n\005count\030\003 \001(\005\022\r\n\005shape\030\004 \003(\005\022\017\n\007indic"
-      "es\030\005 \003(\005\022\014\n\004data\030\006 \001(\014\"E\n\030StreamConfigur"
-      "ationProto\022\014\n\004name\030\001 \001(\t\022\013\n\003dim\030\002 \001(\003\022\016\n"
-      "\006sparse\030\003 \001(\010\"U\n\023TextDataSourceProto\022\014\n\004"
-      "path\030\001 \001(\t\0220\n\007streams\030\002 \003(\0132\037.keras.Stre"
-      "amConfigurationProto\"u\n\014HistoryProto\022(\n\004"
-      "type\030\001 \001(\0162\032.keras.HistoryCallbackType\022\n"
-      "\n\002id\030\002 \001(\r\022\r\n\005names\030\003 \003(\t\022\016\n\006values\030\004 \003("
-      "\001\022\020\n\010nsamples\030\005 \001(\004*$\n\014KerasCommand\022\007\n\003F"
-      "it\020\000\022\013\n\007Predict\020\001*-\n\014TensorFormat\022\014\n\010Row"
-      "Major\020\000\022\017\n\013ColumnMajor\020\001*\240\001\n\010DataType\022\t\n"
-      "\005Float\020\000\022\n\n\006Double\020\001\022\t\n\005Int32\020\002\022\t\n\005Int64"
-      "\020\003\022\n\n\006UInt32\020\004\022\n\n\006UInt64\020\005\022\n\n\006String\020\006\022\010"
-      "\n\004Int8\020\007\022\t\n\005Int16\020\010\022\t\n\005UInt8\020\t\022\n\n\006UInt16"
-      "\020\n\022\010\n\004Bool\020\013\022\r\n\tUndefined\020\014*u\n\023HistoryCa"
-      "llbackType\022\021\n\rTrainingBegin\020\000\022\017\n\013Trainin"
-      "gEnd\020\001\022\016\n\nBatchBegin\020\002\022\014\n\010BatchEnd\020\003\022\016\n\n"
-      "EpochBegin\020\004\022\014\n\010EpochEnd\020\005B\010\252\002\005Kerasb\006pr"
-      "oto3"
+      "$\n\007command\030\022 \001(\0162\023.keras.KerasCommand\022!\n"
+      "\006layers\030\023 \003(\0132\021.keras.LayerProto\022*\n\007comp"
+      "ile\030\024 \001(\0132\031.keras.CompileParamsProto\022*\n\007"
+      "predict\030\025 \001(\0132\031.keras.PredictParamsProto"
+      "\022\017\n\007workers\030\026 \001(\r\022\020\n\010parallel\030\027 \001(\t\0222\n\013d"
+      "istributed\030\030 \001(\0132\035.keras.DistributedPara"
+      "msProto\022#\n\033gradient_accumulation_steps\030\031"
+      " \001(\r\0220\n\ncheckpoint\030\032 \001(\0132\034.keras.Checkpo"
+      "intParamsProto\022\025\n\rfrozen_layers\030\033 \003(\t\022,\n"
+      "\010progress\030\034 \001(\0132\032.keras.ProgressParamsPr"
+      "oto\022\'\n\nevaluation\030\035 \001(\0132\023.keras.HistoryP"
+      "roto\022\024\n\014cache_budget\030\036 \001(\004\022+\n\013cache_stat"
+      "s\030\037 \001(\0132\026.keras.CacheStatsProto\022\022\n\ncpp_p"
+      "refix\030  \001(\t\022\022\n\ncpp_source\030! \001(\t\022\027\n\017outpu"
+      "t_callback\030\" \001(\004\"\250\001\n\013TensorProto\022\035\n\004type"
+      "\030\001 \001(\0162\017.keras.DataType\022#\n\006format\030\002 \001(\0162"
+      "\023.keras.TensorFormat\022\r\n\005count\030\003 \001(\005\022\r\n\005s"
+      "hape\030\004 \003(\005\022\017\n\007indices\030\005 \003(\005\022\014\n\004data\030\006 \001("
+      "\014\022\030\n\020sequence_lengths\030\007 \003(\005\"E\n\030StreamCon"
+      "figurationProto\022\014\n\004name\030\001 \001(\t\022\013\n\003dim\030\002 \001"
+      "(\003\022\016\n\006sparse\030\003 \001(\010\"U\n\023TextDataSourceProt"
+      "o\022\014\n\004path\030\001 \001(\t\0220\n\007streams\030\002 \003(\0132\037.keras"
+      ".StreamConfigurationProto\"u\n\014HistoryProt"
+      "o\022(\n\004type\030\001 \001(\0162\032.keras.HistoryCallbackT"
+      "ype\022\n\n\002id\030\002 \001(\r\022\r\n\005names\030\003 \003(\t\022\016\n\006values"
+      "\030\004 \003(\001\022\020\n\010nsamples\030\005 \001(\004\"J\n\020InitializerP"
+      "roto\022\n\n\002op\030\001 \001(\t\022\r\n\005value\030\002 \001(\001\022\r\n\005scale"
+      "\030\003 \001(\001\022\014\n\004seed\030\004 \001(\004\"\350\006\n\nLayerProto\022\n\n\002o"
+      "p\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\022\023\n\013input_shape\030\003 \003"
+      "(\005\022\r\n\005units\030\004 \001(\r\022\022\n\nactivation\030\005 \001(\t\022\020\n"
+      "\010use_bias\030\006 \001(\010\0223\n\022kernel_initializer\030\007 "
+      "\001(\0132\027.keras.InitializerProto\0221\n\020bias_ini"
+      "tializer\030\010 \001(\0132\027.keras.InitializerProto\022"
+      "\017\n\007filters\030\t \001(\r\022\023\n\013kernel_size\030\n \003(\005\022\017\n"
+      "\007strides\030\013 \003(\005\022\017\n\007padding\030\014 \001(\t\022\021\n\tpool_"
+      "size\030\r \003(\005\022\014\n\004rate\030\016 \001(\001\022\014\n\004seed\030\017 \001(\004\022\021"
+      "\n\tinput_dim\030\020 \001(\r\022\022\n\noutput_dim\030\021 \001(\r\022\024\n"
+      "\014input_length\030\022 \001(\r\022\034\n\024recurrent_activat"
+      "ion\030\023 \001(\t\0226\n\025recurrent_initializer\030\024 \001(\013"
+      "2\027.keras.InitializerProto\022\030\n\020unit_forget"
+      "_bias\030\025 \001(\010\022\030\n\020return_sequences\030\026 \001(\010\022\024\n"
+      "\014go_backwards\030\027 \001(\010\022\017\n\007dropout\030\030 \001(\001\022\031\n\021"
+      "recurrent_dropout\030\031 \001(\001\0227\n\026embeddings_in"
+      "itializer\030\032 \001(\0132\027.keras.InitializerProto"
+      "\022\021\n\tmask_zero\030\033 \001(\010\022\024\n\014hash_buckets\030\034 \001("
+      "\r\022\022\n\nnum_hashes\030\035 \001(\r\022\016\n\006groups\030\036 \001(\r\022\030\n"
+      "\020depth_multiplier\030\037 \001(\r\0226\n\025depthwise_ini"
+      "tializer\030  \001(\0132\027.keras.InitializerProto\022"
+      "6\n\025pointwise_initializer\030! \001(\0132\027.keras.I"
+      "nitializerProto\"\343\001\n\016OptimizerProto\022\n\n\002op"
+      "\030\001 \001(\t\022\n\n\002lr\030\002 \001(\001\022\020\n\010momentum\030\003 \001(\001\022\r\n\005"
+      "decay\030\004 \001(\001\022\020\n\010nesterov\030\005 \001(\010\022\013\n\003rho\030\006 \001"
+      "(\001\022\017\n\007epsilon\030\007 \001(\001\022\016\n\006beta_1\030\010 \001(\001\022\016\n\006b"
+      "eta_2\030\t \001(\001\022\024\n\014weight_decay\030\n \001(\001\0222\n\010sch"
+      "edule\030\013 \001(\0132 .keras.LearningRateSchedule"
+      "Proto\"l\n\022CompileParamsProto\022(\n\toptimizer"
+      "\030\001 \001(\0132\025.keras.OptimizerProto\022\014\n\004loss\030\002 "
+      "\001(\t\022\017\n\007metrics\030\003 \003(\t\022\r\n\005top_k\030\004 \001(\r\"y\n\022P"
+      "redictParamsProto\022\020\n\010no_cache\030\001 \001(\010\022\026\n\016m"
+      "ax_batch_size\030\002 \001(\r\022\023\n\013max_wait_us\030\003 \001(\r"
+      "\022\r\n\005top_k\030\004 \001(\r\022\025\n\routput_layers\030\005 \003(\t\"|"
+      "\n\031LearningRateScheduleProto\022\n\n\002op\030\001 \001(\t\022"
+      "\r\n\005gamma\030\002 \001(\001\022\021\n\tstep_size\030\003 \001(\r\022\016\n\006war"
+      "mup\030\004 \001(\r\022\016\n\006min_lr\030\005 \001(\001\022\021\n\tper_batch\030\006"
+      " \001(\010\"u\n\026DistributedParamsProto\022\n\n\002op\030\001 \001"
+      "(\t\022 \n\030distribute_after_samples\030\002 \001(\004\022\022\n\n"
+      "block_size\030\003 \001(\004\022\031\n\021quantization_bits\030\004 "
+      "\001(\r\"c\n\025CheckpointParamsProto\022\014\n\004path\030\001 \001"
+      "(\t\022\025\n\revery_batches\030\002 \001(\r\022\025\n\revery_minut"
+      "es\030\003 \001(\001\022\016\n\006resume\030\004 \001(\010\"b\n\023ProgressPara"
+      "msProto\022\r\n\005async\030\001 \001(\010\022\025\n\revery_batches\030"
+      "\002 \001(\r\022\020\n\010every_ms\030\003 \001(\r\022\023\n\013epochs_only\030\004"
+      " \001(\010\"q\n\017CacheStatsProto\022\014\n\004hits\030\001 \001(\004\022\016\n"
+      "\006misses\030\002 \001(\004\022\021\n\tevictions\030\003 \001(\004\022\016\n\006mode"
+      "ls\030\004 \001(\004\022\r\n\005bytes\030\005 \001(\004\022\016\n\006budget\030\006 \001(\004\""
+      "G\n\020OutputChunkProto\022\016\n\006offset\030\001 \001(\004\022#\n\007o"
+      "utputs\030\002 \003(\0132\022.keras.TensorProto*\224\001\n\014Ker"
+      "asCommand\022\007\n\003Fit\020\000\022\013\n\007Predict\020\001\022\014\n\010Evalu"
+      "ate\020\002\022\017\n\013UnloadModel\020\003\022\014\n\010PinModel\020\004\022\016\n\n"
+      "UnpinModel\020\005\022\016\n\nCacheStats\020\006\022\022\n\016SetCache"
+      "Budget\020\007\022\r\n\tExportCpp\020\010*-\n\014TensorFormat\022"
+      "\014\n\010RowMajor\020\000\022\017\n\013ColumnMajor\020\001*\240\001\n\010DataT"
+      "ype\022\t\n\005Float\020\000\022\n\n\006Double\020\001\022\t\n\005Int32\020\002\022\t\n"
+      "\005Int64\020\003\022\n\n\006UInt32\020\004\022\n\n\006UInt64\020\005\022\n\n\006Stri"
+      "ng\020\006\022\010\n\004Int8\020\007\022\t\n\005Int16\020\010\022\t\n\005UInt8\020\t\022\n\n\006"
+      "UInt16\020\n\022\010\n\004Bool\020\013\022\r\n\tUndefined\020\014*u\n\023His"
+      "toryCallbackType\022\021\n\rTrainingBegin\020\000\022\017\n\013T"
+      "rainingEnd\020\001\022\016\n\nBatchBegin\020\002\022\014\n\010BatchEnd"
+      "\020\003\022\016\n\nEpochBegin\020\004\022\014\n\010EpochEnd\020\005B\010\252\002\005Ker"
+      "asb\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1244);
+      descriptor, 3970);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "KerasProto.proto", &protobuf_RegisterTypes);
 }
@@ -315,6 +858,13 @@ bool KerasCommand_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
       return true;
     default:
       return false;
@@ -382,6 +932,20 @@ bool HistoryCallbackType_IsValid(int value) {
 // ===================================================================
 
 void KerasProto::InitAsDefaultInstance() {
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->compile_ = const_cast< ::keras::CompileParamsProto*>(
+      ::keras::CompileParamsProto::internal_default_instance());
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->predict_ = const_cast< ::keras::PredictParamsProto*>(
+      ::keras::PredictParamsProto::internal_default_instance());
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->distributed_ = const_cast< ::keras::DistributedParamsProto*>(
+      ::keras::DistributedParamsProto::internal_default_instance());
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->checkpoint_ = const_cast< ::keras::CheckpointParamsProto*>(
+      ::keras::CheckpointParamsProto::internal_default_instance());
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->progress_ = const_cast< ::keras::ProgressParamsProto*>(
+      ::keras::ProgressParamsProto::internal_default_instance());
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->evaluation_ = const_cast< ::keras::HistoryProto*>(
+      ::keras::HistoryProto::internal_default_instance());
+  ::keras::_KerasProto_default_instance_._instance.get_mutable()->cache_stats_ = const_cast< ::keras::CacheStatsProto*>(
+      ::keras::CacheStatsProto::internal_default_instance());
 }
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int KerasProto::kGraphFieldNumber;
@@ -402,6 +966,22 @@ const int KerasProto::kInputsFieldNumber;
 const int KerasProto::kOutputsFieldNumber;
 const int KerasProto::kProgressCallbackFieldNumber;
 const int KerasProto::kCommandFieldNumber;
+const int KerasProto::kLayersFieldNumber;
+const int KerasProto::kCompileFieldNumber;
+const int KerasProto::kPredictFieldNumber;
+const int KerasProto::kWorkersFieldNumber;
+const int KerasProto::kParallelFieldNumber;
+const int KerasProto::kDistributedFieldNumber;
+const int KerasProto::kGradientAccumulationStepsFieldNumber;
+const int KerasProto::kCheckpointFieldNumber;
+const int KerasProto::kFrozenLayersFieldNumber;
+const int KerasProto::kProgressFieldNumber;
+const int KerasProto::kEvaluationFieldNumber;
+const int KerasProto::kCacheBudgetFieldNumber;
+const int KerasProto::kCacheStatsFieldNumber;
+const int KerasProto::kCppPrefixFieldNumber;
+const int KerasProto::kCppSourceFieldNumber;
+const int KerasProto::kOutputCallbackFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 KerasProto::KerasProto()
@@ -417,6 +997,8 @@ KerasProto::KerasProto(const KerasProto& from)
       _internal_metadata_(NULL),
       inputs_(from.inputs_),
       outputs_(from.outputs_),
+      layers_(from.layers_),
+      frozen_layers_(from.frozen_layers_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   graph_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -451,9 +1033,56 @@ KerasProto::KerasProto(const KerasProto& from)
   if (from.path().size() > 0) {
     path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
   }
+  parallel_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.parallel().size() > 0) {
+    parallel_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.parallel_);
+  }
+  cpp_prefix_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.cpp_prefix().size() > 0) {
+    cpp_prefix_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cpp_prefix_);
+  }
+  cpp_source_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.cpp_source().size() > 0) {
+    cpp_source_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cpp_source_);
+  }
+  if (from.has_compile()) {
+    compile_ = new ::keras::CompileParamsProto(*from.compile_);
+  } else {
+    compile_ = NULL;
+  }
+  if (from.has_predict()) {
+    predict_ = new ::keras::PredictParamsProto(*from.predict_);
+  } else {
+    predict_ = NULL;
+  }
+  if (from.has_distributed()) {
+    distributed_ = new ::keras::DistributedParamsProto(*from.distributed_);
+  } else {
+    distributed_ = NULL;
+  }
+  if (from.has_checkpoint()) {
+    checkpoint_ = new ::keras::CheckpointParamsProto(*from.checkpoint_);
+  } else {
+    checkpoint_ = NULL;
+  }
+  if (from.has_progress()) {
+    progress_ = new ::keras::ProgressParamsProto(*from.progress_);
+  } else {
+    progress_ = NULL;
+  }
+  if (from.has_evaluation()) {
+    evaluation_ = new ::keras::HistoryProto(*from.evaluation_);
+  } else {
+    evaluation_ = NULL;
+  }
+  if (from.has_cache_stats()) {
+    cache_stats_ = new ::keras::CacheStatsProto(*from.cache_stats_);
+  } else {
+    cache_stats_ = NULL;
+  }
   ::memcpy(&nsamples_, &from.nsamples_,
-    static_cast<size_t>(reinterpret_cast<char*>(&command_) -
-    reinterpret_cast<char*>(&nsamples_)) + sizeof(command_));
+    static_cast<size_t>(reinterpret_cast<char*>(&gradient_accumulation_steps_) -
+    reinterpret_cast<char*>(&nsamples_)) + sizeof(gradient_accumulation_steps_));
   // @@protoc_insertion_point(copy_constructor:keras.KerasProto)
 }
 
@@ -466,9 +1095,12 @@ void KerasProto::SharedCtor() {
   fit_params_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   predict_params_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&nsamples_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&command_) -
-      reinterpret_cast<char*>(&nsamples_)) + sizeof(command_));
+  parallel_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpp_prefix_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpp_source_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&compile_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&gradient_accumulation_steps_) -
+      reinterpret_cast<char*>(&compile_)) + sizeof(gradient_accumulation_steps_));
   _cached_size_ = 0;
 }
 
@@ -486,6 +1118,16 @@ void KerasProto::SharedDtor() {
   fit_params_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   predict_params_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  parallel_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpp_prefix_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpp_source_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete compile_;
+  if (this != internal_default_instance()) delete predict_;
+  if (this != internal_default_instance()) delete distributed_;
+  if (this != internal_default_instance()) delete checkpoint_;
+  if (this != internal_default_instance()) delete progress_;
+  if (this != internal_default_instance()) delete evaluation_;
+  if (this != internal_default_instance()) delete cache_stats_;
 }
 
 void KerasProto::SetCachedSize(int size) const {
@@ -519,6 +1161,8 @@ void KerasProto::Clear() {
 
   inputs_.Clear();
   outputs_.Clear();
+  layers_.Clear();
+  frozen_layers_.Clear();
   graph_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   model_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   model_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -527,9 +1171,40 @@ void KerasProto::Clear() {
   fit_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   predict_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  parallel_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpp_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpp_source_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && compile_ != NULL) {
+    delete compile_;
+  }
+  compile_ = NULL;
+  if (GetArenaNoVirtual() == NULL && predict_ != NULL) {
+    delete predict_;
+  }
+  predict_ = NULL;
+  if (GetArenaNoVirtual() == NULL && distributed_ != NULL) {
+    delete distributed_;
+  }
+  distributed_ = NULL;
+  if (GetArenaNoVirtual() == NULL && checkpoint_ != NULL) {
+    delete checkpoint_;
+  }
+  checkpoint_ = NULL;
+  if (GetArenaNoVirtual() == NULL && progress_ != NULL) {
+    delete progress_;
+  }
+  progress_ = NULL;
+  if (GetArenaNoVirtual() == NULL && evaluation_ != NULL) {
+    delete evaluation_;
+  }
+  evaluation_ = NULL;
+  if (GetArenaNoVirtual() == NULL && cache_stats_ != NULL) {
+    delete cache_stats_;
+  }
+  cache_stats_ = NULL;
   ::memset(&nsamples_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&command_) -
-      reinterpret_cast<char*>(&nsamples_)) + sizeof(command_));
+      reinterpret_cast<char*>(&gradient_accumulation_steps_) -
+      reinterpret_cast<char*>(&nsamples_)) + sizeof(gradient_accumulation_steps_));
   _internal_metadata_.Clear();
 }
 
@@ -802,6 +1477,222 @@ bool KerasProto::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated .keras.LayerProto layers = 19;
+      case 19: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(154u /* 154 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_layers()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.CompileParamsProto compile = 20;
+      case 20: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(162u /* 162 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_compile()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.PredictParamsProto predict = 21;
+      case 21: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(170u /* 170 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_predict()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 workers = 22;
+      case 22: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(176u /* 176 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &workers_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string parallel = 23;
+      case 23: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(186u /* 186 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_parallel()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->parallel().data(), static_cast<int>(this->parallel().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.KerasProto.parallel"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.DistributedParamsProto distributed = 24;
+      case 24: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(194u /* 194 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_distributed()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 gradient_accumulation_steps = 25;
+      case 25: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(200u /* 200 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &gradient_accumulation_steps_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.CheckpointParamsProto checkpoint = 26;
+      case 26: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(210u /* 210 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_checkpoint()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string frozen_layers = 27;
+      case 27: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(218u /* 218 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_frozen_layers()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->frozen_layers(this->frozen_layers_size() - 1).data(),
+            static_cast<int>(this->frozen_layers(this->frozen_layers_size() - 1).length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.KerasProto.frozen_layers"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.ProgressParamsProto progress = 28;
+      case 28: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(226u /* 226 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_progress()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.HistoryProto evaluation = 29;
+      case 29: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(234u /* 234 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_evaluation()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 cache_budget = 30;
+      case 30: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(240u /* 240 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &cache_budget_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.CacheStatsProto cache_stats = 31;
+      case 31: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(250u /* 250 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_cache_stats()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string cpp_prefix = 32;
+      case 32: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(2u /* 258 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_cpp_prefix()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->cpp_prefix().data(), static_cast<int>(this->cpp_prefix().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.KerasProto.cpp_prefix"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string cpp_source = 33;
+      case 33: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 266 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_cpp_source()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->cpp_source().data(), static_cast<int>(this->cpp_source().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.KerasProto.cpp_source"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 output_callback = 34;
+      case 34: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 272 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &output_callback_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -959,6 +1850,115 @@ void KerasProto::SerializeWithCachedSizes(
       18, this->command(), output);
   }
 
+  // repeated .keras.LayerProto layers = 19;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->layers_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      19, this->layers(static_cast<int>(i)), output);
+  }
+
+  // .keras.CompileParamsProto compile = 20;
+  if (this->has_compile()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      20, *this->compile_, output);
+  }
+
+  // .keras.PredictParamsProto predict = 21;
+  if (this->has_predict()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      21, *this->predict_, output);
+  }
+
+  // uint32 workers = 22;
+  if (this->workers() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(22, this->workers(), output);
+  }
+
+  // string parallel = 23;
+  if (this->parallel().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->parallel().data(), static_cast<int>(this->parallel().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.parallel");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      23, this->parallel(), output);
+  }
+
+  // .keras.DistributedParamsProto distributed = 24;
+  if (this->has_distributed()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      24, *this->distributed_, output);
+  }
+
+  // uint32 gradient_accumulation_steps = 25;
+  if (this->gradient_accumulation_steps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(25, this->gradient_accumulation_steps(), output);
+  }
+
+  // .keras.CheckpointParamsProto checkpoint = 26;
+  if (this->has_checkpoint()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      26, *this->checkpoint_, output);
+  }
+
+  // repeated string frozen_layers = 27;
+  for (int i = 0, n = this->frozen_layers_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->frozen_layers(i).data(), static_cast<int>(this->frozen_layers(i).length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.frozen_layers");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      27, this->frozen_layers(i), output);
+  }
+
+  // .keras.ProgressParamsProto progress = 28;
+  if (this->has_progress()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      28, *this->progress_, output);
+  }
+
+  // .keras.HistoryProto evaluation = 29;
+  if (this->has_evaluation()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      29, *this->evaluation_, output);
+  }
+
+  // uint64 cache_budget = 30;
+  if (this->cache_budget() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(30, this->cache_budget(), output);
+  }
+
+  // .keras.CacheStatsProto cache_stats = 31;
+  if (this->has_cache_stats()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      31, *this->cache_stats_, output);
+  }
+
+  // string cpp_prefix = 32;
+  if (this->cpp_prefix().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->cpp_prefix().data(), static_cast<int>(this->cpp_prefix().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.cpp_prefix");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      32, this->cpp_prefix(), output);
+  }
+
+  // string cpp_source = 33;
+  if (this->cpp_source().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->cpp_source().data(), static_cast<int>(this->cpp_source().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.cpp_source");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      33, this->cpp_source(), output);
+  }
+
+  // uint64 output_callback = 34;
+  if (this->output_callback() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(34, this->output_callback(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -1114,62 +2114,201 @@ void KerasProto::SerializeWithCachedSizes(
       18, this->command(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // repeated .keras.LayerProto layers = 19;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->layers_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        19, this->layers(static_cast<int>(i)), deterministic, target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:keras.KerasProto)
-  return target;
-}
 
-size_t KerasProto::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:keras.KerasProto)
-  size_t total_size = 0;
+  // .keras.CompileParamsProto compile = 20;
+  if (this->has_compile()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        20, *this->compile_, deterministic, target);
+  }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  // .keras.PredictParamsProto predict = 21;
+  if (this->has_predict()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        21, *this->predict_, deterministic, target);
   }
-  // repeated .keras.TensorProto inputs = 15;
-  {
-    unsigned int count = static_cast<unsigned int>(this->inputs_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->inputs(static_cast<int>(i)));
-    }
+
+  // uint32 workers = 22;
+  if (this->workers() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(22, this->workers(), target);
   }
 
-  // repeated .keras.TensorProto outputs = 16;
-  {
-    unsigned int count = static_cast<unsigned int>(this->outputs_size());
-    total_size += 2UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->outputs(static_cast<int>(i)));
-    }
+  // string parallel = 23;
+  if (this->parallel().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->parallel().data(), static_cast<int>(this->parallel().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.parallel");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        23, this->parallel(), target);
   }
 
-  // string graph = 1;
-  if (this->graph().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->graph());
+  // .keras.DistributedParamsProto distributed = 24;
+  if (this->has_distributed()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        24, *this->distributed_, deterministic, target);
   }
 
-  // bytes model = 2;
-  if (this->model().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->model());
+  // uint32 gradient_accumulation_steps = 25;
+  if (this->gradient_accumulation_steps() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(25, this->gradient_accumulation_steps(), target);
   }
 
-  // string model_path = 3;
-  if (this->model_path().size() > 0) {
-    total_size += 1 +
+  // .keras.CheckpointParamsProto checkpoint = 26;
+  if (this->has_checkpoint()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        26, *this->checkpoint_, deterministic, target);
+  }
+
+  // repeated string frozen_layers = 27;
+  for (int i = 0, n = this->frozen_layers_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->frozen_layers(i).data(), static_cast<int>(this->frozen_layers(i).length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.frozen_layers");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(27, this->frozen_layers(i), target);
+  }
+
+  // .keras.ProgressParamsProto progress = 28;
+  if (this->has_progress()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        28, *this->progress_, deterministic, target);
+  }
+
+  // .keras.HistoryProto evaluation = 29;
+  if (this->has_evaluation()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        29, *this->evaluation_, deterministic, target);
+  }
+
+  // uint64 cache_budget = 30;
+  if (this->cache_budget() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(30, this->cache_budget(), target);
+  }
+
+  // .keras.CacheStatsProto cache_stats = 31;
+  if (this->has_cache_stats()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        31, *this->cache_stats_, deterministic, target);
+  }
+
+  // string cpp_prefix = 32;
+  if (this->cpp_prefix().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->cpp_prefix().data(), static_cast<int>(this->cpp_prefix().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.cpp_prefix");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        32, this->cpp_prefix(), target);
+  }
+
+  // string cpp_source = 33;
+  if (this->cpp_source().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->cpp_source().data(), static_cast<int>(this->cpp_source().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.KerasProto.cpp_source");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        33, this->cpp_source(), target);
+  }
+
+  // uint64 output_callback = 34;
+  if (this->output_callback() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(34, this->output_callback(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.KerasProto)
+  return target;
+}
+
+size_t KerasProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.KerasProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated .keras.TensorProto inputs = 15;
+  {
+    unsigned int count = static_cast<unsigned int>(this->inputs_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->inputs(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .keras.TensorProto outputs = 16;
+  {
+    unsigned int count = static_cast<unsigned int>(this->outputs_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->outputs(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .keras.LayerProto layers = 19;
+  {
+    unsigned int count = static_cast<unsigned int>(this->layers_size());
+    total_size += 2UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->layers(static_cast<int>(i)));
+    }
+  }
+
+  // repeated string frozen_layers = 27;
+  total_size += 2 *
+      ::google::protobuf::internal::FromIntSize(this->frozen_layers_size());
+  for (int i = 0, n = this->frozen_layers_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->frozen_layers(i));
+  }
+
+  // string graph = 1;
+  if (this->graph().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->graph());
+  }
+
+  // bytes model = 2;
+  if (this->model().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->model());
+  }
+
+  // string model_path = 3;
+  if (this->model_path().size() > 0) {
+    total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
         this->model_path());
   }
@@ -1209,6 +2348,76 @@ size_t KerasProto::ByteSizeLong() const {
         this->path());
   }
 
+  // string parallel = 23;
+  if (this->parallel().size() > 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->parallel());
+  }
+
+  // string cpp_prefix = 32;
+  if (this->cpp_prefix().size() > 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->cpp_prefix());
+  }
+
+  // string cpp_source = 33;
+  if (this->cpp_source().size() > 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->cpp_source());
+  }
+
+  // .keras.CompileParamsProto compile = 20;
+  if (this->has_compile()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->compile_);
+  }
+
+  // .keras.PredictParamsProto predict = 21;
+  if (this->has_predict()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->predict_);
+  }
+
+  // .keras.DistributedParamsProto distributed = 24;
+  if (this->has_distributed()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->distributed_);
+  }
+
+  // .keras.CheckpointParamsProto checkpoint = 26;
+  if (this->has_checkpoint()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->checkpoint_);
+  }
+
+  // .keras.ProgressParamsProto progress = 28;
+  if (this->has_progress()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->progress_);
+  }
+
+  // .keras.HistoryProto evaluation = 29;
+  if (this->has_evaluation()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->evaluation_);
+  }
+
+  // .keras.CacheStatsProto cache_stats = 31;
+  if (this->has_cache_stats()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->cache_stats_);
+  }
+
   // uint32 nsamples = 9;
   if (this->nsamples() != 0) {
     total_size += 1 +
@@ -1264,6 +2473,34 @@ size_t KerasProto::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormatLite::EnumSize(this->command());
   }
 
+  // uint32 workers = 22;
+  if (this->workers() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->workers());
+  }
+
+  // uint64 cache_budget = 30;
+  if (this->cache_budget() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->cache_budget());
+  }
+
+  // uint64 output_callback = 34;
+  if (this->output_callback() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->output_callback());
+  }
+
+  // uint32 gradient_accumulation_steps = 25;
+  if (this->gradient_accumulation_steps() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->gradient_accumulation_steps());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -1295,6 +2532,8 @@ void KerasProto::MergeFrom(const KerasProto& from) {
 
   inputs_.MergeFrom(from.inputs_);
   outputs_.MergeFrom(from.outputs_);
+  layers_.MergeFrom(from.layers_);
+  frozen_layers_.MergeFrom(from.frozen_layers_);
   if (from.graph().size() > 0) {
 
     graph_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.graph_);
@@ -1327,6 +2566,39 @@ void KerasProto::MergeFrom(const KerasProto& from) {
 
     path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
   }
+  if (from.parallel().size() > 0) {
+
+    parallel_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.parallel_);
+  }
+  if (from.cpp_prefix().size() > 0) {
+
+    cpp_prefix_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cpp_prefix_);
+  }
+  if (from.cpp_source().size() > 0) {
+
+    cpp_source_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cpp_source_);
+  }
+  if (from.has_compile()) {
+    mutable_compile()->::keras::CompileParamsProto::MergeFrom(from.compile());
+  }
+  if (from.has_predict()) {
+    mutable_predict()->::keras::PredictParamsProto::MergeFrom(from.predict());
+  }
+  if (from.has_distributed()) {
+    mutable_distributed()->::keras::DistributedParamsProto::MergeFrom(from.distributed());
+  }
+  if (from.has_checkpoint()) {
+    mutable_checkpoint()->::keras::CheckpointParamsProto::MergeFrom(from.checkpoint());
+  }
+  if (from.has_progress()) {
+    mutable_progress()->::keras::ProgressParamsProto::MergeFrom(from.progress());
+  }
+  if (from.has_evaluation()) {
+    mutable_evaluation()->::keras::HistoryProto::MergeFrom(from.evaluation());
+  }
+  if (from.has_cache_stats()) {
+    mutable_cache_stats()->::keras::CacheStatsProto::MergeFrom(from.cache_stats());
+  }
   if (from.nsamples() != 0) {
     set_nsamples(from.nsamples());
   }
@@ -1351,6 +2623,18 @@ void KerasProto::MergeFrom(const KerasProto& from) {
   if (from.command() != 0) {
     set_command(from.command());
   }
+  if (from.workers() != 0) {
+    set_workers(from.workers());
+  }
+  if (from.cache_budget() != 0) {
+    set_cache_budget(from.cache_budget());
+  }
+  if (from.output_callback() != 0) {
+    set_output_callback(from.output_callback());
+  }
+  if (from.gradient_accumulation_steps() != 0) {
+    set_gradient_accumulation_steps(from.gradient_accumulation_steps());
+  }
 }
 
 void KerasProto::CopyFrom(const ::google::protobuf::Message& from) {
@@ -1379,6 +2663,8 @@ void KerasProto::InternalSwap(KerasProto* other) {
   using std::swap;
   inputs_.InternalSwap(&other->inputs_);
   outputs_.InternalSwap(&other->outputs_);
+  layers_.InternalSwap(&other->layers_);
+  frozen_layers_.InternalSwap(&other->frozen_layers_);
   graph_.Swap(&other->graph_);
   model_.Swap(&other->model_);
   model_path_.Swap(&other->model_path_);
@@ -1387,6 +2673,16 @@ void KerasProto::InternalSwap(KerasProto* other) {
   fit_params_.Swap(&other->fit_params_);
   predict_params_.Swap(&other->predict_params_);
   path_.Swap(&other->path_);
+  parallel_.Swap(&other->parallel_);
+  cpp_prefix_.Swap(&other->cpp_prefix_);
+  cpp_source_.Swap(&other->cpp_source_);
+  swap(compile_, other->compile_);
+  swap(predict_, other->predict_);
+  swap(distributed_, other->distributed_);
+  swap(checkpoint_, other->checkpoint_);
+  swap(progress_, other->progress_);
+  swap(evaluation_, other->evaluation_);
+  swap(cache_stats_, other->cache_stats_);
   swap(nsamples_, other->nsamples_);
   swap(nfeatures_, other->nfeatures_);
   swap(nlabels_, other->nlabels_);
@@ -1395,6 +2691,10 @@ void KerasProto::InternalSwap(KerasProto* other) {
   swap(verbose_, other->verbose_);
   swap(progress_callback_, other->progress_callback_);
   swap(command_, other->command_);
+  swap(workers_, other->workers_);
+  swap(cache_budget_, other->cache_budget_);
+  swap(output_callback_, other->output_callback_);
+  swap(gradient_accumulation_steps_, other->gradient_accumulation_steps_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -1416,6 +2716,7 @@ const int TensorProto::kCountFieldNumber;
 const int TensorProto::kShapeFieldNumber;
 const int TensorProto::kIndicesFieldNumber;
 const int TensorProto::kDataFieldNumber;
+const int TensorProto::kSequenceLengthsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 TensorProto::TensorProto()
@@ -1431,6 +2732,7 @@ TensorProto::TensorProto(const TensorProto& from)
       _internal_metadata_(NULL),
       shape_(from.shape_),
       indices_(from.indices_),
+      sequence_lengths_(from.sequence_lengths_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -1491,6 +2793,7 @@ void TensorProto::Clear() {
 
   shape_.Clear();
   indices_.Clear();
+  sequence_lengths_.Clear();
   data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&type_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&count_) -
@@ -1602,6 +2905,25 @@ bool TensorProto::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated int32 sequence_lengths = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_sequence_lengths())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 58u, input, this->mutable_sequence_lengths())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -1673,6 +2995,17 @@ void TensorProto::SerializeWithCachedSizes(
       6, this->data(), output);
   }
 
+  // repeated int32 sequence_lengths = 7;
+  if (this->sequence_lengths_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(7, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _sequence_lengths_cached_byte_size_));
+  }
+  for (int i = 0, n = this->sequence_lengths_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->sequence_lengths(i), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -1737,6 +3070,19 @@ void TensorProto::SerializeWithCachedSizes(
         6, this->data(), target);
   }
 
+  // repeated int32 sequence_lengths = 7;
+  if (this->sequence_lengths_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      7,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _sequence_lengths_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->sequence_lengths_, target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -1786,6 +3132,22 @@ size_t TensorProto::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // repeated int32 sequence_lengths = 7;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->sequence_lengths_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _sequence_lengths_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
   // bytes data = 6;
   if (this->data().size() > 0) {
     total_size += 1 +
@@ -1843,6 +3205,7 @@ void TensorProto::MergeFrom(const TensorProto& from) {
 
   shape_.MergeFrom(from.shape_);
   indices_.MergeFrom(from.indices_);
+  sequence_lengths_.MergeFrom(from.sequence_lengths_);
   if (from.data().size() > 0) {
 
     data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
@@ -1884,6 +3247,7 @@ void TensorProto::InternalSwap(TensorProto* other) {
   using std::swap;
   shape_.InternalSwap(&other->shape_);
   indices_.InternalSwap(&other->indices_);
+  sequence_lengths_.InternalSwap(&other->sequence_lengths_);
   data_.Swap(&other->data_);
   swap(type_, other->type_);
   swap(format_, other->format_);
@@ -2961,6 +4325,5699 @@ void HistoryProto::InternalSwap(HistoryProto* other) {
 }
 
 
+// ===================================================================
+
+void InitializerProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int InitializerProto::kOpFieldNumber;
+const int InitializerProto::kValueFieldNumber;
+const int InitializerProto::kScaleFieldNumber;
+const int InitializerProto::kSeedFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InitializerProto::InitializerProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsInitializerProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.InitializerProto)
+}
+InitializerProto::InitializerProto(const InitializerProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.op().size() > 0) {
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  ::memcpy(&value_, &from.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&seed_) -
+    reinterpret_cast<char*>(&value_)) + sizeof(seed_));
+  // @@protoc_insertion_point(copy_constructor:keras.InitializerProto)
+}
+
+void InitializerProto::SharedCtor() {
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&seed_) -
+      reinterpret_cast<char*>(&value_)) + sizeof(seed_));
+  _cached_size_ = 0;
+}
+
+InitializerProto::~InitializerProto() {
+  // @@protoc_insertion_point(destructor:keras.InitializerProto)
+  SharedDtor();
+}
+
+void InitializerProto::SharedDtor() {
+  op_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void InitializerProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InitializerProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const InitializerProto& InitializerProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsInitializerProto();
+  return *internal_default_instance();
+}
+
+InitializerProto* InitializerProto::New(::google::protobuf::Arena* arena) const {
+  InitializerProto* n = new InitializerProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void InitializerProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.InitializerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&seed_) -
+      reinterpret_cast<char*>(&value_)) + sizeof(seed_));
+  _internal_metadata_.Clear();
+}
+
+bool InitializerProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.InitializerProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string op = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_op()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->op().data(), static_cast<int>(this->op().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.InitializerProto.op"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double value = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &value_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double scale = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(25u /* 25 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &scale_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 seed = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &seed_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.InitializerProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.InitializerProto)
+  return false;
+#undef DO_
+}
+
+void InitializerProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.InitializerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.InitializerProto.op");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->op(), output);
+  }
+
+  // double value = 2;
+  if (this->value() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->value(), output);
+  }
+
+  // double scale = 3;
+  if (this->scale() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->scale(), output);
+  }
+
+  // uint64 seed = 4;
+  if (this->seed() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->seed(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.InitializerProto)
+}
+
+::google::protobuf::uint8* InitializerProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.InitializerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.InitializerProto.op");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->op(), target);
+  }
+
+  // double value = 2;
+  if (this->value() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->value(), target);
+  }
+
+  // double scale = 3;
+  if (this->scale() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->scale(), target);
+  }
+
+  // uint64 seed = 4;
+  if (this->seed() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->seed(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.InitializerProto)
+  return target;
+}
+
+size_t InitializerProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.InitializerProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // string op = 1;
+  if (this->op().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->op());
+  }
+
+  // double value = 2;
+  if (this->value() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double scale = 3;
+  if (this->scale() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 seed = 4;
+  if (this->seed() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->seed());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void InitializerProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.InitializerProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InitializerProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitializerProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.InitializerProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.InitializerProto)
+    MergeFrom(*source);
+  }
+}
+
+void InitializerProto::MergeFrom(const InitializerProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.InitializerProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.op().size() > 0) {
+
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  if (from.value() != 0) {
+    set_value(from.value());
+  }
+  if (from.scale() != 0) {
+    set_scale(from.scale());
+  }
+  if (from.seed() != 0) {
+    set_seed(from.seed());
+  }
+}
+
+void InitializerProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.InitializerProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InitializerProto::CopyFrom(const InitializerProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.InitializerProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitializerProto::IsInitialized() const {
+  return true;
+}
+
+void InitializerProto::Swap(InitializerProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InitializerProto::InternalSwap(InitializerProto* other) {
+  using std::swap;
+  op_.Swap(&other->op_);
+  swap(value_, other->value_);
+  swap(scale_, other->scale_);
+  swap(seed_, other->seed_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata InitializerProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void LayerProto::InitAsDefaultInstance() {
+  ::keras::_LayerProto_default_instance_._instance.get_mutable()->kernel_initializer_ = const_cast< ::keras::InitializerProto*>(
+      ::keras::InitializerProto::internal_default_instance());
+  ::keras::_LayerProto_default_instance_._instance.get_mutable()->bias_initializer_ = const_cast< ::keras::InitializerProto*>(
+      ::keras::InitializerProto::internal_default_instance());
+  ::keras::_LayerProto_default_instance_._instance.get_mutable()->recurrent_initializer_ = const_cast< ::keras::InitializerProto*>(
+      ::keras::InitializerProto::internal_default_instance());
+  ::keras::_LayerProto_default_instance_._instance.get_mutable()->embeddings_initializer_ = const_cast< ::keras::InitializerProto*>(
+      ::keras::InitializerProto::internal_default_instance());
+  ::keras::_LayerProto_default_instance_._instance.get_mutable()->depthwise_initializer_ = const_cast< ::keras::InitializerProto*>(
+      ::keras::InitializerProto::internal_default_instance());
+  ::keras::_LayerProto_default_instance_._instance.get_mutable()->pointwise_initializer_ = const_cast< ::keras::InitializerProto*>(
+      ::keras::InitializerProto::internal_default_instance());
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int LayerProto::kOpFieldNumber;
+const int LayerProto::kNameFieldNumber;
+const int LayerProto::kInputShapeFieldNumber;
+const int LayerProto::kUnitsFieldNumber;
+const int LayerProto::kActivationFieldNumber;
+const int LayerProto::kUseBiasFieldNumber;
+const int LayerProto::kKernelInitializerFieldNumber;
+const int LayerProto::kBiasInitializerFieldNumber;
+const int LayerProto::kFiltersFieldNumber;
+const int LayerProto::kKernelSizeFieldNumber;
+const int LayerProto::kStridesFieldNumber;
+const int LayerProto::kPaddingFieldNumber;
+const int LayerProto::kPoolSizeFieldNumber;
+const int LayerProto::kRateFieldNumber;
+const int LayerProto::kSeedFieldNumber;
+const int LayerProto::kInputDimFieldNumber;
+const int LayerProto::kOutputDimFieldNumber;
+const int LayerProto::kInputLengthFieldNumber;
+const int LayerProto::kRecurrentActivationFieldNumber;
+const int LayerProto::kRecurrentInitializerFieldNumber;
+const int LayerProto::kUnitForgetBiasFieldNumber;
+const int LayerProto::kReturnSequencesFieldNumber;
+const int LayerProto::kGoBackwardsFieldNumber;
+const int LayerProto::kDropoutFieldNumber;
+const int LayerProto::kRecurrentDropoutFieldNumber;
+const int LayerProto::kEmbeddingsInitializerFieldNumber;
+const int LayerProto::kMaskZeroFieldNumber;
+const int LayerProto::kHashBucketsFieldNumber;
+const int LayerProto::kNumHashesFieldNumber;
+const int LayerProto::kGroupsFieldNumber;
+const int LayerProto::kDepthMultiplierFieldNumber;
+const int LayerProto::kDepthwiseInitializerFieldNumber;
+const int LayerProto::kPointwiseInitializerFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+LayerProto::LayerProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsLayerProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.LayerProto)
+}
+LayerProto::LayerProto(const LayerProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      input_shape_(from.input_shape_),
+      kernel_size_(from.kernel_size_),
+      strides_(from.strides_),
+      pool_size_(from.pool_size_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.op().size() > 0) {
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.name().size() > 0) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  activation_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.activation().size() > 0) {
+    activation_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.activation_);
+  }
+  padding_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.padding().size() > 0) {
+    padding_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.padding_);
+  }
+  recurrent_activation_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.recurrent_activation().size() > 0) {
+    recurrent_activation_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.recurrent_activation_);
+  }
+  if (from.has_kernel_initializer()) {
+    kernel_initializer_ = new ::keras::InitializerProto(*from.kernel_initializer_);
+  } else {
+    kernel_initializer_ = NULL;
+  }
+  if (from.has_bias_initializer()) {
+    bias_initializer_ = new ::keras::InitializerProto(*from.bias_initializer_);
+  } else {
+    bias_initializer_ = NULL;
+  }
+  if (from.has_recurrent_initializer()) {
+    recurrent_initializer_ = new ::keras::InitializerProto(*from.recurrent_initializer_);
+  } else {
+    recurrent_initializer_ = NULL;
+  }
+  if (from.has_embeddings_initializer()) {
+    embeddings_initializer_ = new ::keras::InitializerProto(*from.embeddings_initializer_);
+  } else {
+    embeddings_initializer_ = NULL;
+  }
+  if (from.has_depthwise_initializer()) {
+    depthwise_initializer_ = new ::keras::InitializerProto(*from.depthwise_initializer_);
+  } else {
+    depthwise_initializer_ = NULL;
+  }
+  if (from.has_pointwise_initializer()) {
+    pointwise_initializer_ = new ::keras::InitializerProto(*from.pointwise_initializer_);
+  } else {
+    pointwise_initializer_ = NULL;
+  }
+  ::memcpy(&units_, &from.units_,
+    static_cast<size_t>(reinterpret_cast<char*>(&depth_multiplier_) -
+    reinterpret_cast<char*>(&units_)) + sizeof(depth_multiplier_));
+  // @@protoc_insertion_point(copy_constructor:keras.LayerProto)
+}
+
+void LayerProto::SharedCtor() {
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  activation_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  padding_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  recurrent_activation_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&kernel_initializer_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&depth_multiplier_) -
+      reinterpret_cast<char*>(&kernel_initializer_)) + sizeof(depth_multiplier_));
+  _cached_size_ = 0;
+}
+
+LayerProto::~LayerProto() {
+  // @@protoc_insertion_point(destructor:keras.LayerProto)
+  SharedDtor();
+}
+
+void LayerProto::SharedDtor() {
+  op_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  activation_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  padding_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  recurrent_activation_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete kernel_initializer_;
+  if (this != internal_default_instance()) delete bias_initializer_;
+  if (this != internal_default_instance()) delete recurrent_initializer_;
+  if (this != internal_default_instance()) delete embeddings_initializer_;
+  if (this != internal_default_instance()) delete depthwise_initializer_;
+  if (this != internal_default_instance()) delete pointwise_initializer_;
+}
+
+void LayerProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* LayerProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const LayerProto& LayerProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsLayerProto();
+  return *internal_default_instance();
+}
+
+LayerProto* LayerProto::New(::google::protobuf::Arena* arena) const {
+  LayerProto* n = new LayerProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void LayerProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.LayerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  input_shape_.Clear();
+  kernel_size_.Clear();
+  strides_.Clear();
+  pool_size_.Clear();
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  activation_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  recurrent_activation_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && kernel_initializer_ != NULL) {
+    delete kernel_initializer_;
+  }
+  kernel_initializer_ = NULL;
+  if (GetArenaNoVirtual() == NULL && bias_initializer_ != NULL) {
+    delete bias_initializer_;
+  }
+  bias_initializer_ = NULL;
+  if (GetArenaNoVirtual() == NULL && recurrent_initializer_ != NULL) {
+    delete recurrent_initializer_;
+  }
+  recurrent_initializer_ = NULL;
+  if (GetArenaNoVirtual() == NULL && embeddings_initializer_ != NULL) {
+    delete embeddings_initializer_;
+  }
+  embeddings_initializer_ = NULL;
+  if (GetArenaNoVirtual() == NULL && depthwise_initializer_ != NULL) {
+    delete depthwise_initializer_;
+  }
+  depthwise_initializer_ = NULL;
+  if (GetArenaNoVirtual() == NULL && pointwise_initializer_ != NULL) {
+    delete pointwise_initializer_;
+  }
+  pointwise_initializer_ = NULL;
+  ::memset(&units_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&depth_multiplier_) -
+      reinterpret_cast<char*>(&units_)) + sizeof(depth_multiplier_));
+  _internal_metadata_.Clear();
+}
+
+bool LayerProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.LayerProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string op = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_op()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->op().data(), static_cast<int>(this->op().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.LayerProto.op"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string name = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->name().data(), static_cast<int>(this->name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.LayerProto.name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 input_shape = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_input_shape())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 26u, input, this->mutable_input_shape())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 units = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &units_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string activation = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_activation()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->activation().data(), static_cast<int>(this->activation().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.LayerProto.activation"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool use_bias = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &use_bias_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.InitializerProto kernel_initializer = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_kernel_initializer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.InitializerProto bias_initializer = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_bias_initializer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 filters = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &filters_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 kernel_size = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(82u /* 82 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_kernel_size())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 82u, input, this->mutable_kernel_size())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 strides = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(90u /* 90 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_strides())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(88u /* 88 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 90u, input, this->mutable_strides())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string padding = 12;
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(98u /* 98 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_padding()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->padding().data(), static_cast<int>(this->padding().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.LayerProto.padding"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 pool_size = 13;
+      case 13: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(106u /* 106 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_pool_size())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(104u /* 104 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 106u, input, this->mutable_pool_size())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double rate = 14;
+      case 14: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(113u /* 113 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &rate_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 seed = 15;
+      case 15: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(120u /* 120 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &seed_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 input_dim = 16;
+      case 16: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(128u /* 128 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &input_dim_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 output_dim = 17;
+      case 17: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(136u /* 136 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &output_dim_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 input_length = 18;
+      case 18: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(144u /* 144 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &input_length_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string recurrent_activation = 19;
+      case 19: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(154u /* 154 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_recurrent_activation()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->recurrent_activation().data(), static_cast<int>(this->recurrent_activation().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.LayerProto.recurrent_activation"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.InitializerProto recurrent_initializer = 20;
+      case 20: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(162u /* 162 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_recurrent_initializer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool unit_forget_bias = 21;
+      case 21: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(168u /* 168 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &unit_forget_bias_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool return_sequences = 22;
+      case 22: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(176u /* 176 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &return_sequences_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool go_backwards = 23;
+      case 23: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(184u /* 184 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &go_backwards_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double dropout = 24;
+      case 24: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(193u /* 193 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &dropout_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double recurrent_dropout = 25;
+      case 25: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(201u /* 201 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &recurrent_dropout_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.InitializerProto embeddings_initializer = 26;
+      case 26: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(210u /* 210 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_embeddings_initializer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool mask_zero = 27;
+      case 27: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(216u /* 216 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &mask_zero_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 hash_buckets = 28;
+      case 28: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(224u /* 224 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &hash_buckets_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 num_hashes = 29;
+      case 29: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(232u /* 232 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &num_hashes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 groups = 30;
+      case 30: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(240u /* 240 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &groups_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 depth_multiplier = 31;
+      case 31: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(248u /* 248 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &depth_multiplier_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.InitializerProto depthwise_initializer = 32;
+      case 32: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(2u /* 258 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_depthwise_initializer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.InitializerProto pointwise_initializer = 33;
+      case 33: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 266 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_pointwise_initializer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.LayerProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.LayerProto)
+  return false;
+#undef DO_
+}
+
+void LayerProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.LayerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.op");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->op(), output);
+  }
+
+  // string name = 2;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->name(), output);
+  }
+
+  // repeated int32 input_shape = 3;
+  if (this->input_shape_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _input_shape_cached_byte_size_));
+  }
+  for (int i = 0, n = this->input_shape_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->input_shape(i), output);
+  }
+
+  // uint32 units = 4;
+  if (this->units() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->units(), output);
+  }
+
+  // string activation = 5;
+  if (this->activation().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->activation().data(), static_cast<int>(this->activation().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.activation");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      5, this->activation(), output);
+  }
+
+  // bool use_bias = 6;
+  if (this->use_bias() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->use_bias(), output);
+  }
+
+  // .keras.InitializerProto kernel_initializer = 7;
+  if (this->has_kernel_initializer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->kernel_initializer_, output);
+  }
+
+  // .keras.InitializerProto bias_initializer = 8;
+  if (this->has_bias_initializer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, *this->bias_initializer_, output);
+  }
+
+  // uint32 filters = 9;
+  if (this->filters() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(9, this->filters(), output);
+  }
+
+  // repeated int32 kernel_size = 10;
+  if (this->kernel_size_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(10, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _kernel_size_cached_byte_size_));
+  }
+  for (int i = 0, n = this->kernel_size_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->kernel_size(i), output);
+  }
+
+  // repeated int32 strides = 11;
+  if (this->strides_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(11, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _strides_cached_byte_size_));
+  }
+  for (int i = 0, n = this->strides_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->strides(i), output);
+  }
+
+  // string padding = 12;
+  if (this->padding().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->padding().data(), static_cast<int>(this->padding().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.padding");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      12, this->padding(), output);
+  }
+
+  // repeated int32 pool_size = 13;
+  if (this->pool_size_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(13, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _pool_size_cached_byte_size_));
+  }
+  for (int i = 0, n = this->pool_size_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->pool_size(i), output);
+  }
+
+  // double rate = 14;
+  if (this->rate() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(14, this->rate(), output);
+  }
+
+  // uint64 seed = 15;
+  if (this->seed() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(15, this->seed(), output);
+  }
+
+  // uint32 input_dim = 16;
+  if (this->input_dim() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(16, this->input_dim(), output);
+  }
+
+  // uint32 output_dim = 17;
+  if (this->output_dim() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(17, this->output_dim(), output);
+  }
+
+  // uint32 input_length = 18;
+  if (this->input_length() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(18, this->input_length(), output);
+  }
+
+  // string recurrent_activation = 19;
+  if (this->recurrent_activation().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->recurrent_activation().data(), static_cast<int>(this->recurrent_activation().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.recurrent_activation");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      19, this->recurrent_activation(), output);
+  }
+
+  // .keras.InitializerProto recurrent_initializer = 20;
+  if (this->has_recurrent_initializer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      20, *this->recurrent_initializer_, output);
+  }
+
+  // bool unit_forget_bias = 21;
+  if (this->unit_forget_bias() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(21, this->unit_forget_bias(), output);
+  }
+
+  // bool return_sequences = 22;
+  if (this->return_sequences() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(22, this->return_sequences(), output);
+  }
+
+  // bool go_backwards = 23;
+  if (this->go_backwards() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(23, this->go_backwards(), output);
+  }
+
+  // double dropout = 24;
+  if (this->dropout() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(24, this->dropout(), output);
+  }
+
+  // double recurrent_dropout = 25;
+  if (this->recurrent_dropout() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(25, this->recurrent_dropout(), output);
+  }
+
+  // .keras.InitializerProto embeddings_initializer = 26;
+  if (this->has_embeddings_initializer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      26, *this->embeddings_initializer_, output);
+  }
+
+  // bool mask_zero = 27;
+  if (this->mask_zero() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(27, this->mask_zero(), output);
+  }
+
+  // uint32 hash_buckets = 28;
+  if (this->hash_buckets() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(28, this->hash_buckets(), output);
+  }
+
+  // uint32 num_hashes = 29;
+  if (this->num_hashes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(29, this->num_hashes(), output);
+  }
+
+  // uint32 groups = 30;
+  if (this->groups() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(30, this->groups(), output);
+  }
+
+  // uint32 depth_multiplier = 31;
+  if (this->depth_multiplier() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(31, this->depth_multiplier(), output);
+  }
+
+  // .keras.InitializerProto depthwise_initializer = 32;
+  if (this->has_depthwise_initializer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      32, *this->depthwise_initializer_, output);
+  }
+
+  // .keras.InitializerProto pointwise_initializer = 33;
+  if (this->has_pointwise_initializer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      33, *this->pointwise_initializer_, output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.LayerProto)
+}
+
+::google::protobuf::uint8* LayerProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.LayerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.op");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->op(), target);
+  }
+
+  // string name = 2;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->name(), target);
+  }
+
+  // repeated int32 input_shape = 3;
+  if (this->input_shape_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      3,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _input_shape_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->input_shape_, target);
+  }
+
+  // uint32 units = 4;
+  if (this->units() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->units(), target);
+  }
+
+  // string activation = 5;
+  if (this->activation().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->activation().data(), static_cast<int>(this->activation().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.activation");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        5, this->activation(), target);
+  }
+
+  // bool use_bias = 6;
+  if (this->use_bias() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->use_bias(), target);
+  }
+
+  // .keras.InitializerProto kernel_initializer = 7;
+  if (this->has_kernel_initializer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, *this->kernel_initializer_, deterministic, target);
+  }
+
+  // .keras.InitializerProto bias_initializer = 8;
+  if (this->has_bias_initializer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        8, *this->bias_initializer_, deterministic, target);
+  }
+
+  // uint32 filters = 9;
+  if (this->filters() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(9, this->filters(), target);
+  }
+
+  // repeated int32 kernel_size = 10;
+  if (this->kernel_size_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      10,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _kernel_size_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->kernel_size_, target);
+  }
+
+  // repeated int32 strides = 11;
+  if (this->strides_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      11,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _strides_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->strides_, target);
+  }
+
+  // string padding = 12;
+  if (this->padding().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->padding().data(), static_cast<int>(this->padding().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.padding");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        12, this->padding(), target);
+  }
+
+  // repeated int32 pool_size = 13;
+  if (this->pool_size_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      13,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _pool_size_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->pool_size_, target);
+  }
+
+  // double rate = 14;
+  if (this->rate() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(14, this->rate(), target);
+  }
+
+  // uint64 seed = 15;
+  if (this->seed() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(15, this->seed(), target);
+  }
+
+  // uint32 input_dim = 16;
+  if (this->input_dim() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(16, this->input_dim(), target);
+  }
+
+  // uint32 output_dim = 17;
+  if (this->output_dim() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(17, this->output_dim(), target);
+  }
+
+  // uint32 input_length = 18;
+  if (this->input_length() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(18, this->input_length(), target);
+  }
+
+  // string recurrent_activation = 19;
+  if (this->recurrent_activation().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->recurrent_activation().data(), static_cast<int>(this->recurrent_activation().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LayerProto.recurrent_activation");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        19, this->recurrent_activation(), target);
+  }
+
+  // .keras.InitializerProto recurrent_initializer = 20;
+  if (this->has_recurrent_initializer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        20, *this->recurrent_initializer_, deterministic, target);
+  }
+
+  // bool unit_forget_bias = 21;
+  if (this->unit_forget_bias() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(21, this->unit_forget_bias(), target);
+  }
+
+  // bool return_sequences = 22;
+  if (this->return_sequences() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(22, this->return_sequences(), target);
+  }
+
+  // bool go_backwards = 23;
+  if (this->go_backwards() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(23, this->go_backwards(), target);
+  }
+
+  // double dropout = 24;
+  if (this->dropout() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(24, this->dropout(), target);
+  }
+
+  // double recurrent_dropout = 25;
+  if (this->recurrent_dropout() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(25, this->recurrent_dropout(), target);
+  }
+
+  // .keras.InitializerProto embeddings_initializer = 26;
+  if (this->has_embeddings_initializer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        26, *this->embeddings_initializer_, deterministic, target);
+  }
+
+  // bool mask_zero = 27;
+  if (this->mask_zero() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(27, this->mask_zero(), target);
+  }
+
+  // uint32 hash_buckets = 28;
+  if (this->hash_buckets() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(28, this->hash_buckets(), target);
+  }
+
+  // uint32 num_hashes = 29;
+  if (this->num_hashes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(29, this->num_hashes(), target);
+  }
+
+  // uint32 groups = 30;
+  if (this->groups() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(30, this->groups(), target);
+  }
+
+  // uint32 depth_multiplier = 31;
+  if (this->depth_multiplier() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(31, this->depth_multiplier(), target);
+  }
+
+  // .keras.InitializerProto depthwise_initializer = 32;
+  if (this->has_depthwise_initializer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        32, *this->depthwise_initializer_, deterministic, target);
+  }
+
+  // .keras.InitializerProto pointwise_initializer = 33;
+  if (this->has_pointwise_initializer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        33, *this->pointwise_initializer_, deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.LayerProto)
+  return target;
+}
+
+size_t LayerProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.LayerProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated int32 input_shape = 3;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->input_shape_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _input_shape_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated int32 kernel_size = 10;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->kernel_size_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _kernel_size_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated int32 strides = 11;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->strides_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _strides_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated int32 pool_size = 13;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->pool_size_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _pool_size_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->op());
+  }
+
+  // string name = 2;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->name());
+  }
+
+  // string activation = 5;
+  if (this->activation().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->activation());
+  }
+
+  // string padding = 12;
+  if (this->padding().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->padding());
+  }
+
+  // string recurrent_activation = 19;
+  if (this->recurrent_activation().size() > 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->recurrent_activation());
+  }
+
+  // .keras.InitializerProto kernel_initializer = 7;
+  if (this->has_kernel_initializer()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->kernel_initializer_);
+  }
+
+  // .keras.InitializerProto bias_initializer = 8;
+  if (this->has_bias_initializer()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->bias_initializer_);
+  }
+
+  // .keras.InitializerProto recurrent_initializer = 20;
+  if (this->has_recurrent_initializer()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->recurrent_initializer_);
+  }
+
+  // .keras.InitializerProto embeddings_initializer = 26;
+  if (this->has_embeddings_initializer()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->embeddings_initializer_);
+  }
+
+  // .keras.InitializerProto depthwise_initializer = 32;
+  if (this->has_depthwise_initializer()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->depthwise_initializer_);
+  }
+
+  // .keras.InitializerProto pointwise_initializer = 33;
+  if (this->has_pointwise_initializer()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->pointwise_initializer_);
+  }
+
+  // uint32 units = 4;
+  if (this->units() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->units());
+  }
+
+  // uint32 filters = 9;
+  if (this->filters() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->filters());
+  }
+
+  // double rate = 14;
+  if (this->rate() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 seed = 15;
+  if (this->seed() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->seed());
+  }
+
+  // uint32 input_dim = 16;
+  if (this->input_dim() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->input_dim());
+  }
+
+  // uint32 output_dim = 17;
+  if (this->output_dim() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->output_dim());
+  }
+
+  // uint32 input_length = 18;
+  if (this->input_length() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->input_length());
+  }
+
+  // bool use_bias = 6;
+  if (this->use_bias() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool unit_forget_bias = 21;
+  if (this->unit_forget_bias() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool return_sequences = 22;
+  if (this->return_sequences() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool go_backwards = 23;
+  if (this->go_backwards() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // double dropout = 24;
+  if (this->dropout() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // double recurrent_dropout = 25;
+  if (this->recurrent_dropout() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // bool mask_zero = 27;
+  if (this->mask_zero() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // uint32 hash_buckets = 28;
+  if (this->hash_buckets() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->hash_buckets());
+  }
+
+  // uint32 num_hashes = 29;
+  if (this->num_hashes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->num_hashes());
+  }
+
+  // uint32 groups = 30;
+  if (this->groups() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->groups());
+  }
+
+  // uint32 depth_multiplier = 31;
+  if (this->depth_multiplier() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->depth_multiplier());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void LayerProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.LayerProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const LayerProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LayerProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.LayerProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.LayerProto)
+    MergeFrom(*source);
+  }
+}
+
+void LayerProto::MergeFrom(const LayerProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.LayerProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  input_shape_.MergeFrom(from.input_shape_);
+  kernel_size_.MergeFrom(from.kernel_size_);
+  strides_.MergeFrom(from.strides_);
+  pool_size_.MergeFrom(from.pool_size_);
+  if (from.op().size() > 0) {
+
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  if (from.name().size() > 0) {
+
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  if (from.activation().size() > 0) {
+
+    activation_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.activation_);
+  }
+  if (from.padding().size() > 0) {
+
+    padding_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.padding_);
+  }
+  if (from.recurrent_activation().size() > 0) {
+
+    recurrent_activation_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.recurrent_activation_);
+  }
+  if (from.has_kernel_initializer()) {
+    mutable_kernel_initializer()->::keras::InitializerProto::MergeFrom(from.kernel_initializer());
+  }
+  if (from.has_bias_initializer()) {
+    mutable_bias_initializer()->::keras::InitializerProto::MergeFrom(from.bias_initializer());
+  }
+  if (from.has_recurrent_initializer()) {
+    mutable_recurrent_initializer()->::keras::InitializerProto::MergeFrom(from.recurrent_initializer());
+  }
+  if (from.has_embeddings_initializer()) {
+    mutable_embeddings_initializer()->::keras::InitializerProto::MergeFrom(from.embeddings_initializer());
+  }
+  if (from.has_depthwise_initializer()) {
+    mutable_depthwise_initializer()->::keras::InitializerProto::MergeFrom(from.depthwise_initializer());
+  }
+  if (from.has_pointwise_initializer()) {
+    mutable_pointwise_initializer()->::keras::InitializerProto::MergeFrom(from.pointwise_initializer());
+  }
+  if (from.units() != 0) {
+    set_units(from.units());
+  }
+  if (from.filters() != 0) {
+    set_filters(from.filters());
+  }
+  if (from.rate() != 0) {
+    set_rate(from.rate());
+  }
+  if (from.seed() != 0) {
+    set_seed(from.seed());
+  }
+  if (from.input_dim() != 0) {
+    set_input_dim(from.input_dim());
+  }
+  if (from.output_dim() != 0) {
+    set_output_dim(from.output_dim());
+  }
+  if (from.input_length() != 0) {
+    set_input_length(from.input_length());
+  }
+  if (from.use_bias() != 0) {
+    set_use_bias(from.use_bias());
+  }
+  if (from.unit_forget_bias() != 0) {
+    set_unit_forget_bias(from.unit_forget_bias());
+  }
+  if (from.return_sequences() != 0) {
+    set_return_sequences(from.return_sequences());
+  }
+  if (from.go_backwards() != 0) {
+    set_go_backwards(from.go_backwards());
+  }
+  if (from.dropout() != 0) {
+    set_dropout(from.dropout());
+  }
+  if (from.recurrent_dropout() != 0) {
+    set_recurrent_dropout(from.recurrent_dropout());
+  }
+  if (from.mask_zero() != 0) {
+    set_mask_zero(from.mask_zero());
+  }
+  if (from.hash_buckets() != 0) {
+    set_hash_buckets(from.hash_buckets());
+  }
+  if (from.num_hashes() != 0) {
+    set_num_hashes(from.num_hashes());
+  }
+  if (from.groups() != 0) {
+    set_groups(from.groups());
+  }
+  if (from.depth_multiplier() != 0) {
+    set_depth_multiplier(from.depth_multiplier());
+  }
+}
+
+void LayerProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.LayerProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void LayerProto::CopyFrom(const LayerProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.LayerProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LayerProto::IsInitialized() const {
+  return true;
+}
+
+void LayerProto::Swap(LayerProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void LayerProto::InternalSwap(LayerProto* other) {
+  using std::swap;
+  input_shape_.InternalSwap(&other->input_shape_);
+  kernel_size_.InternalSwap(&other->kernel_size_);
+  strides_.InternalSwap(&other->strides_);
+  pool_size_.InternalSwap(&other->pool_size_);
+  op_.Swap(&other->op_);
+  name_.Swap(&other->name_);
+  activation_.Swap(&other->activation_);
+  padding_.Swap(&other->padding_);
+  recurrent_activation_.Swap(&other->recurrent_activation_);
+  swap(kernel_initializer_, other->kernel_initializer_);
+  swap(bias_initializer_, other->bias_initializer_);
+  swap(recurrent_initializer_, other->recurrent_initializer_);
+  swap(embeddings_initializer_, other->embeddings_initializer_);
+  swap(depthwise_initializer_, other->depthwise_initializer_);
+  swap(pointwise_initializer_, other->pointwise_initializer_);
+  swap(units_, other->units_);
+  swap(filters_, other->filters_);
+  swap(rate_, other->rate_);
+  swap(seed_, other->seed_);
+  swap(input_dim_, other->input_dim_);
+  swap(output_dim_, other->output_dim_);
+  swap(input_length_, other->input_length_);
+  swap(use_bias_, other->use_bias_);
+  swap(unit_forget_bias_, other->unit_forget_bias_);
+  swap(return_sequences_, other->return_sequences_);
+  swap(go_backwards_, other->go_backwards_);
+  swap(dropout_, other->dropout_);
+  swap(recurrent_dropout_, other->recurrent_dropout_);
+  swap(mask_zero_, other->mask_zero_);
+  swap(hash_buckets_, other->hash_buckets_);
+  swap(num_hashes_, other->num_hashes_);
+  swap(groups_, other->groups_);
+  swap(depth_multiplier_, other->depth_multiplier_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata LayerProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void OptimizerProto::InitAsDefaultInstance() {
+  ::keras::_OptimizerProto_default_instance_._instance.get_mutable()->schedule_ = const_cast< ::keras::LearningRateScheduleProto*>(
+      ::keras::LearningRateScheduleProto::internal_default_instance());
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int OptimizerProto::kOpFieldNumber;
+const int OptimizerProto::kLrFieldNumber;
+const int OptimizerProto::kMomentumFieldNumber;
+const int OptimizerProto::kDecayFieldNumber;
+const int OptimizerProto::kNesterovFieldNumber;
+const int OptimizerProto::kRhoFieldNumber;
+const int OptimizerProto::kEpsilonFieldNumber;
+const int OptimizerProto::kBeta1FieldNumber;
+const int OptimizerProto::kBeta2FieldNumber;
+const int OptimizerProto::kWeightDecayFieldNumber;
+const int OptimizerProto::kScheduleFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+OptimizerProto::OptimizerProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsOptimizerProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.OptimizerProto)
+}
+OptimizerProto::OptimizerProto(const OptimizerProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.op().size() > 0) {
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  if (from.has_schedule()) {
+    schedule_ = new ::keras::LearningRateScheduleProto(*from.schedule_);
+  } else {
+    schedule_ = NULL;
+  }
+  ::memcpy(&lr_, &from.lr_,
+    static_cast<size_t>(reinterpret_cast<char*>(&nesterov_) -
+    reinterpret_cast<char*>(&lr_)) + sizeof(nesterov_));
+  // @@protoc_insertion_point(copy_constructor:keras.OptimizerProto)
+}
+
+void OptimizerProto::SharedCtor() {
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&schedule_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&nesterov_) -
+      reinterpret_cast<char*>(&schedule_)) + sizeof(nesterov_));
+  _cached_size_ = 0;
+}
+
+OptimizerProto::~OptimizerProto() {
+  // @@protoc_insertion_point(destructor:keras.OptimizerProto)
+  SharedDtor();
+}
+
+void OptimizerProto::SharedDtor() {
+  op_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete schedule_;
+}
+
+void OptimizerProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* OptimizerProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const OptimizerProto& OptimizerProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsOptimizerProto();
+  return *internal_default_instance();
+}
+
+OptimizerProto* OptimizerProto::New(::google::protobuf::Arena* arena) const {
+  OptimizerProto* n = new OptimizerProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void OptimizerProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.OptimizerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && schedule_ != NULL) {
+    delete schedule_;
+  }
+  schedule_ = NULL;
+  ::memset(&lr_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&nesterov_) -
+      reinterpret_cast<char*>(&lr_)) + sizeof(nesterov_));
+  _internal_metadata_.Clear();
+}
+
+bool OptimizerProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.OptimizerProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string op = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_op()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->op().data(), static_cast<int>(this->op().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.OptimizerProto.op"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double lr = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &lr_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double momentum = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(25u /* 25 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &momentum_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double decay = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(33u /* 33 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &decay_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool nesterov = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &nesterov_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double rho = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(49u /* 49 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &rho_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double epsilon = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(57u /* 57 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &epsilon_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double beta_1 = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(65u /* 65 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &beta_1_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double beta_2 = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(73u /* 73 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &beta_2_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double weight_decay = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(81u /* 81 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &weight_decay_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .keras.LearningRateScheduleProto schedule = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(90u /* 90 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_schedule()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.OptimizerProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.OptimizerProto)
+  return false;
+#undef DO_
+}
+
+void OptimizerProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.OptimizerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.OptimizerProto.op");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->op(), output);
+  }
+
+  // double lr = 2;
+  if (this->lr() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->lr(), output);
+  }
+
+  // double momentum = 3;
+  if (this->momentum() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->momentum(), output);
+  }
+
+  // double decay = 4;
+  if (this->decay() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(4, this->decay(), output);
+  }
+
+  // bool nesterov = 5;
+  if (this->nesterov() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->nesterov(), output);
+  }
+
+  // double rho = 6;
+  if (this->rho() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(6, this->rho(), output);
+  }
+
+  // double epsilon = 7;
+  if (this->epsilon() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(7, this->epsilon(), output);
+  }
+
+  // double beta_1 = 8;
+  if (this->beta_1() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(8, this->beta_1(), output);
+  }
+
+  // double beta_2 = 9;
+  if (this->beta_2() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(9, this->beta_2(), output);
+  }
+
+  // double weight_decay = 10;
+  if (this->weight_decay() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(10, this->weight_decay(), output);
+  }
+
+  // .keras.LearningRateScheduleProto schedule = 11;
+  if (this->has_schedule()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, *this->schedule_, output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.OptimizerProto)
+}
+
+::google::protobuf::uint8* OptimizerProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.OptimizerProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.OptimizerProto.op");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->op(), target);
+  }
+
+  // double lr = 2;
+  if (this->lr() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->lr(), target);
+  }
+
+  // double momentum = 3;
+  if (this->momentum() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->momentum(), target);
+  }
+
+  // double decay = 4;
+  if (this->decay() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(4, this->decay(), target);
+  }
+
+  // bool nesterov = 5;
+  if (this->nesterov() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->nesterov(), target);
+  }
+
+  // double rho = 6;
+  if (this->rho() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(6, this->rho(), target);
+  }
+
+  // double epsilon = 7;
+  if (this->epsilon() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(7, this->epsilon(), target);
+  }
+
+  // double beta_1 = 8;
+  if (this->beta_1() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(8, this->beta_1(), target);
+  }
+
+  // double beta_2 = 9;
+  if (this->beta_2() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(9, this->beta_2(), target);
+  }
+
+  // double weight_decay = 10;
+  if (this->weight_decay() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(10, this->weight_decay(), target);
+  }
+
+  // .keras.LearningRateScheduleProto schedule = 11;
+  if (this->has_schedule()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        11, *this->schedule_, deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.OptimizerProto)
+  return target;
+}
+
+size_t OptimizerProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.OptimizerProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // string op = 1;
+  if (this->op().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->op());
+  }
+
+  // .keras.LearningRateScheduleProto schedule = 11;
+  if (this->has_schedule()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->schedule_);
+  }
+
+  // double lr = 2;
+  if (this->lr() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double momentum = 3;
+  if (this->momentum() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double decay = 4;
+  if (this->decay() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double rho = 6;
+  if (this->rho() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double epsilon = 7;
+  if (this->epsilon() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double beta_1 = 8;
+  if (this->beta_1() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double beta_2 = 9;
+  if (this->beta_2() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double weight_decay = 10;
+  if (this->weight_decay() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool nesterov = 5;
+  if (this->nesterov() != 0) {
+    total_size += 1 + 1;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void OptimizerProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.OptimizerProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const OptimizerProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const OptimizerProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.OptimizerProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.OptimizerProto)
+    MergeFrom(*source);
+  }
+}
+
+void OptimizerProto::MergeFrom(const OptimizerProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.OptimizerProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.op().size() > 0) {
+
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  if (from.has_schedule()) {
+    mutable_schedule()->::keras::LearningRateScheduleProto::MergeFrom(from.schedule());
+  }
+  if (from.lr() != 0) {
+    set_lr(from.lr());
+  }
+  if (from.momentum() != 0) {
+    set_momentum(from.momentum());
+  }
+  if (from.decay() != 0) {
+    set_decay(from.decay());
+  }
+  if (from.rho() != 0) {
+    set_rho(from.rho());
+  }
+  if (from.epsilon() != 0) {
+    set_epsilon(from.epsilon());
+  }
+  if (from.beta_1() != 0) {
+    set_beta_1(from.beta_1());
+  }
+  if (from.beta_2() != 0) {
+    set_beta_2(from.beta_2());
+  }
+  if (from.weight_decay() != 0) {
+    set_weight_decay(from.weight_decay());
+  }
+  if (from.nesterov() != 0) {
+    set_nesterov(from.nesterov());
+  }
+}
+
+void OptimizerProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.OptimizerProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void OptimizerProto::CopyFrom(const OptimizerProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.OptimizerProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OptimizerProto::IsInitialized() const {
+  return true;
+}
+
+void OptimizerProto::Swap(OptimizerProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void OptimizerProto::InternalSwap(OptimizerProto* other) {
+  using std::swap;
+  op_.Swap(&other->op_);
+  swap(schedule_, other->schedule_);
+  swap(lr_, other->lr_);
+  swap(momentum_, other->momentum_);
+  swap(decay_, other->decay_);
+  swap(rho_, other->rho_);
+  swap(epsilon_, other->epsilon_);
+  swap(beta_1_, other->beta_1_);
+  swap(beta_2_, other->beta_2_);
+  swap(weight_decay_, other->weight_decay_);
+  swap(nesterov_, other->nesterov_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata OptimizerProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void CompileParamsProto::InitAsDefaultInstance() {
+  ::keras::_CompileParamsProto_default_instance_._instance.get_mutable()->optimizer_ = const_cast< ::keras::OptimizerProto*>(
+      ::keras::OptimizerProto::internal_default_instance());
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CompileParamsProto::kOptimizerFieldNumber;
+const int CompileParamsProto::kLossFieldNumber;
+const int CompileParamsProto::kMetricsFieldNumber;
+const int CompileParamsProto::kTopKFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CompileParamsProto::CompileParamsProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsCompileParamsProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.CompileParamsProto)
+}
+CompileParamsProto::CompileParamsProto(const CompileParamsProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      metrics_(from.metrics_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  loss_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.loss().size() > 0) {
+    loss_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.loss_);
+  }
+  if (from.has_optimizer()) {
+    optimizer_ = new ::keras::OptimizerProto(*from.optimizer_);
+  } else {
+    optimizer_ = NULL;
+  }
+  top_k_ = from.top_k_;
+  // @@protoc_insertion_point(copy_constructor:keras.CompileParamsProto)
+}
+
+void CompileParamsProto::SharedCtor() {
+  loss_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&optimizer_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&top_k_) -
+      reinterpret_cast<char*>(&optimizer_)) + sizeof(top_k_));
+  _cached_size_ = 0;
+}
+
+CompileParamsProto::~CompileParamsProto() {
+  // @@protoc_insertion_point(destructor:keras.CompileParamsProto)
+  SharedDtor();
+}
+
+void CompileParamsProto::SharedDtor() {
+  loss_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete optimizer_;
+}
+
+void CompileParamsProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CompileParamsProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const CompileParamsProto& CompileParamsProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsCompileParamsProto();
+  return *internal_default_instance();
+}
+
+CompileParamsProto* CompileParamsProto::New(::google::protobuf::Arena* arena) const {
+  CompileParamsProto* n = new CompileParamsProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void CompileParamsProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.CompileParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  metrics_.Clear();
+  loss_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && optimizer_ != NULL) {
+    delete optimizer_;
+  }
+  optimizer_ = NULL;
+  top_k_ = 0u;
+  _internal_metadata_.Clear();
+}
+
+bool CompileParamsProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.CompileParamsProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .keras.OptimizerProto optimizer = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_optimizer()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string loss = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_loss()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->loss().data(), static_cast<int>(this->loss().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.CompileParamsProto.loss"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string metrics = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_metrics()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->metrics(this->metrics_size() - 1).data(),
+            static_cast<int>(this->metrics(this->metrics_size() - 1).length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.CompileParamsProto.metrics"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 top_k = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &top_k_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.CompileParamsProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.CompileParamsProto)
+  return false;
+#undef DO_
+}
+
+void CompileParamsProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.CompileParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .keras.OptimizerProto optimizer = 1;
+  if (this->has_optimizer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->optimizer_, output);
+  }
+
+  // string loss = 2;
+  if (this->loss().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->loss().data(), static_cast<int>(this->loss().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.CompileParamsProto.loss");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->loss(), output);
+  }
+
+  // repeated string metrics = 3;
+  for (int i = 0, n = this->metrics_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->metrics(i).data(), static_cast<int>(this->metrics(i).length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.CompileParamsProto.metrics");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      3, this->metrics(i), output);
+  }
+
+  // uint32 top_k = 4;
+  if (this->top_k() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->top_k(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.CompileParamsProto)
+}
+
+::google::protobuf::uint8* CompileParamsProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.CompileParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .keras.OptimizerProto optimizer = 1;
+  if (this->has_optimizer()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, *this->optimizer_, deterministic, target);
+  }
+
+  // string loss = 2;
+  if (this->loss().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->loss().data(), static_cast<int>(this->loss().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.CompileParamsProto.loss");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->loss(), target);
+  }
+
+  // repeated string metrics = 3;
+  for (int i = 0, n = this->metrics_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->metrics(i).data(), static_cast<int>(this->metrics(i).length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.CompileParamsProto.metrics");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(3, this->metrics(i), target);
+  }
+
+  // uint32 top_k = 4;
+  if (this->top_k() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->top_k(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.CompileParamsProto)
+  return target;
+}
+
+size_t CompileParamsProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.CompileParamsProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated string metrics = 3;
+  total_size += 1 *
+      ::google::protobuf::internal::FromIntSize(this->metrics_size());
+  for (int i = 0, n = this->metrics_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->metrics(i));
+  }
+
+  // string loss = 2;
+  if (this->loss().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->loss());
+  }
+
+  // .keras.OptimizerProto optimizer = 1;
+  if (this->has_optimizer()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSize(
+        *this->optimizer_);
+  }
+
+  // uint32 top_k = 4;
+  if (this->top_k() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->top_k());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CompileParamsProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.CompileParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CompileParamsProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CompileParamsProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.CompileParamsProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.CompileParamsProto)
+    MergeFrom(*source);
+  }
+}
+
+void CompileParamsProto::MergeFrom(const CompileParamsProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.CompileParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  metrics_.MergeFrom(from.metrics_);
+  if (from.loss().size() > 0) {
+
+    loss_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.loss_);
+  }
+  if (from.has_optimizer()) {
+    mutable_optimizer()->::keras::OptimizerProto::MergeFrom(from.optimizer());
+  }
+  if (from.top_k() != 0) {
+    set_top_k(from.top_k());
+  }
+}
+
+void CompileParamsProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.CompileParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CompileParamsProto::CopyFrom(const CompileParamsProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.CompileParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompileParamsProto::IsInitialized() const {
+  return true;
+}
+
+void CompileParamsProto::Swap(CompileParamsProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void CompileParamsProto::InternalSwap(CompileParamsProto* other) {
+  using std::swap;
+  metrics_.InternalSwap(&other->metrics_);
+  loss_.Swap(&other->loss_);
+  swap(optimizer_, other->optimizer_);
+  swap(top_k_, other->top_k_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata CompileParamsProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void PredictParamsProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int PredictParamsProto::kNoCacheFieldNumber;
+const int PredictParamsProto::kMaxBatchSizeFieldNumber;
+const int PredictParamsProto::kMaxWaitUsFieldNumber;
+const int PredictParamsProto::kTopKFieldNumber;
+const int PredictParamsProto::kOutputLayersFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+PredictParamsProto::PredictParamsProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsPredictParamsProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.PredictParamsProto)
+}
+PredictParamsProto::PredictParamsProto(const PredictParamsProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      output_layers_(from.output_layers_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&no_cache_, &from.no_cache_,
+    static_cast<size_t>(reinterpret_cast<char*>(&top_k_) -
+    reinterpret_cast<char*>(&no_cache_)) + sizeof(top_k_));
+  // @@protoc_insertion_point(copy_constructor:keras.PredictParamsProto)
+}
+
+void PredictParamsProto::SharedCtor() {
+  ::memset(&no_cache_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&top_k_) -
+      reinterpret_cast<char*>(&no_cache_)) + sizeof(top_k_));
+  _cached_size_ = 0;
+}
+
+PredictParamsProto::~PredictParamsProto() {
+  // @@protoc_insertion_point(destructor:keras.PredictParamsProto)
+  SharedDtor();
+}
+
+void PredictParamsProto::SharedDtor() {
+}
+
+void PredictParamsProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* PredictParamsProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const PredictParamsProto& PredictParamsProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsPredictParamsProto();
+  return *internal_default_instance();
+}
+
+PredictParamsProto* PredictParamsProto::New(::google::protobuf::Arena* arena) const {
+  PredictParamsProto* n = new PredictParamsProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void PredictParamsProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.PredictParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  output_layers_.Clear();
+  ::memset(&no_cache_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&top_k_) -
+      reinterpret_cast<char*>(&no_cache_)) + sizeof(top_k_));
+  _internal_metadata_.Clear();
+}
+
+bool PredictParamsProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.PredictParamsProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bool no_cache = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &no_cache_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 max_batch_size = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &max_batch_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 max_wait_us = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &max_wait_us_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 top_k = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &top_k_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string output_layers = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_output_layers()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->output_layers(this->output_layers_size() - 1).data(),
+            static_cast<int>(this->output_layers(this->output_layers_size() - 1).length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.PredictParamsProto.output_layers"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.PredictParamsProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.PredictParamsProto)
+  return false;
+#undef DO_
+}
+
+void PredictParamsProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.PredictParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool no_cache = 1;
+  if (this->no_cache() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->no_cache(), output);
+  }
+
+  // uint32 max_batch_size = 2;
+  if (this->max_batch_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->max_batch_size(), output);
+  }
+
+  // uint32 max_wait_us = 3;
+  if (this->max_wait_us() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->max_wait_us(), output);
+  }
+
+  // uint32 top_k = 4;
+  if (this->top_k() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->top_k(), output);
+  }
+
+  // repeated string output_layers = 5;
+  for (int i = 0, n = this->output_layers_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->output_layers(i).data(), static_cast<int>(this->output_layers(i).length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.PredictParamsProto.output_layers");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      5, this->output_layers(i), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.PredictParamsProto)
+}
+
+::google::protobuf::uint8* PredictParamsProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.PredictParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool no_cache = 1;
+  if (this->no_cache() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->no_cache(), target);
+  }
+
+  // uint32 max_batch_size = 2;
+  if (this->max_batch_size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->max_batch_size(), target);
+  }
+
+  // uint32 max_wait_us = 3;
+  if (this->max_wait_us() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->max_wait_us(), target);
+  }
+
+  // uint32 top_k = 4;
+  if (this->top_k() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->top_k(), target);
+  }
+
+  // repeated string output_layers = 5;
+  for (int i = 0, n = this->output_layers_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->output_layers(i).data(), static_cast<int>(this->output_layers(i).length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.PredictParamsProto.output_layers");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(5, this->output_layers(i), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.PredictParamsProto)
+  return target;
+}
+
+size_t PredictParamsProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.PredictParamsProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated string output_layers = 5;
+  total_size += 1 *
+      ::google::protobuf::internal::FromIntSize(this->output_layers_size());
+  for (int i = 0, n = this->output_layers_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->output_layers(i));
+  }
+
+  // bool no_cache = 1;
+  if (this->no_cache() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 max_batch_size = 2;
+  if (this->max_batch_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->max_batch_size());
+  }
+
+  // uint32 max_wait_us = 3;
+  if (this->max_wait_us() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->max_wait_us());
+  }
+
+  // uint32 top_k = 4;
+  if (this->top_k() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->top_k());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PredictParamsProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.PredictParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PredictParamsProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PredictParamsProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.PredictParamsProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.PredictParamsProto)
+    MergeFrom(*source);
+  }
+}
+
+void PredictParamsProto::MergeFrom(const PredictParamsProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.PredictParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  output_layers_.MergeFrom(from.output_layers_);
+  if (from.no_cache() != 0) {
+    set_no_cache(from.no_cache());
+  }
+  if (from.max_batch_size() != 0) {
+    set_max_batch_size(from.max_batch_size());
+  }
+  if (from.max_wait_us() != 0) {
+    set_max_wait_us(from.max_wait_us());
+  }
+  if (from.top_k() != 0) {
+    set_top_k(from.top_k());
+  }
+}
+
+void PredictParamsProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.PredictParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PredictParamsProto::CopyFrom(const PredictParamsProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.PredictParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PredictParamsProto::IsInitialized() const {
+  return true;
+}
+
+void PredictParamsProto::Swap(PredictParamsProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void PredictParamsProto::InternalSwap(PredictParamsProto* other) {
+  using std::swap;
+  output_layers_.InternalSwap(&other->output_layers_);
+  swap(no_cache_, other->no_cache_);
+  swap(max_batch_size_, other->max_batch_size_);
+  swap(max_wait_us_, other->max_wait_us_);
+  swap(top_k_, other->top_k_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata PredictParamsProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void LearningRateScheduleProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int LearningRateScheduleProto::kOpFieldNumber;
+const int LearningRateScheduleProto::kGammaFieldNumber;
+const int LearningRateScheduleProto::kStepSizeFieldNumber;
+const int LearningRateScheduleProto::kWarmupFieldNumber;
+const int LearningRateScheduleProto::kMinLrFieldNumber;
+const int LearningRateScheduleProto::kPerBatchFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+LearningRateScheduleProto::LearningRateScheduleProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsLearningRateScheduleProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.LearningRateScheduleProto)
+}
+LearningRateScheduleProto::LearningRateScheduleProto(const LearningRateScheduleProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.op().size() > 0) {
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  ::memcpy(&gamma_, &from.gamma_,
+    static_cast<size_t>(reinterpret_cast<char*>(&per_batch_) -
+    reinterpret_cast<char*>(&gamma_)) + sizeof(per_batch_));
+  // @@protoc_insertion_point(copy_constructor:keras.LearningRateScheduleProto)
+}
+
+void LearningRateScheduleProto::SharedCtor() {
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&gamma_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&per_batch_) -
+      reinterpret_cast<char*>(&gamma_)) + sizeof(per_batch_));
+  _cached_size_ = 0;
+}
+
+LearningRateScheduleProto::~LearningRateScheduleProto() {
+  // @@protoc_insertion_point(destructor:keras.LearningRateScheduleProto)
+  SharedDtor();
+}
+
+void LearningRateScheduleProto::SharedDtor() {
+  op_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void LearningRateScheduleProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* LearningRateScheduleProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const LearningRateScheduleProto& LearningRateScheduleProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsLearningRateScheduleProto();
+  return *internal_default_instance();
+}
+
+LearningRateScheduleProto* LearningRateScheduleProto::New(::google::protobuf::Arena* arena) const {
+  LearningRateScheduleProto* n = new LearningRateScheduleProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void LearningRateScheduleProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.LearningRateScheduleProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&gamma_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&per_batch_) -
+      reinterpret_cast<char*>(&gamma_)) + sizeof(per_batch_));
+  _internal_metadata_.Clear();
+}
+
+bool LearningRateScheduleProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.LearningRateScheduleProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string op = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_op()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->op().data(), static_cast<int>(this->op().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.LearningRateScheduleProto.op"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double gamma = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &gamma_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 step_size = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &step_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 warmup = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &warmup_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double min_lr = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(41u /* 41 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &min_lr_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool per_batch = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &per_batch_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.LearningRateScheduleProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.LearningRateScheduleProto)
+  return false;
+#undef DO_
+}
+
+void LearningRateScheduleProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.LearningRateScheduleProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LearningRateScheduleProto.op");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->op(), output);
+  }
+
+  // double gamma = 2;
+  if (this->gamma() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->gamma(), output);
+  }
+
+  // uint32 step_size = 3;
+  if (this->step_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->step_size(), output);
+  }
+
+  // uint32 warmup = 4;
+  if (this->warmup() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->warmup(), output);
+  }
+
+  // double min_lr = 5;
+  if (this->min_lr() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(5, this->min_lr(), output);
+  }
+
+  // bool per_batch = 6;
+  if (this->per_batch() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->per_batch(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.LearningRateScheduleProto)
+}
+
+::google::protobuf::uint8* LearningRateScheduleProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.LearningRateScheduleProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.LearningRateScheduleProto.op");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->op(), target);
+  }
+
+  // double gamma = 2;
+  if (this->gamma() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->gamma(), target);
+  }
+
+  // uint32 step_size = 3;
+  if (this->step_size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->step_size(), target);
+  }
+
+  // uint32 warmup = 4;
+  if (this->warmup() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->warmup(), target);
+  }
+
+  // double min_lr = 5;
+  if (this->min_lr() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(5, this->min_lr(), target);
+  }
+
+  // bool per_batch = 6;
+  if (this->per_batch() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->per_batch(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.LearningRateScheduleProto)
+  return target;
+}
+
+size_t LearningRateScheduleProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.LearningRateScheduleProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // string op = 1;
+  if (this->op().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->op());
+  }
+
+  // double gamma = 2;
+  if (this->gamma() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 step_size = 3;
+  if (this->step_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->step_size());
+  }
+
+  // uint32 warmup = 4;
+  if (this->warmup() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->warmup());
+  }
+
+  // double min_lr = 5;
+  if (this->min_lr() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool per_batch = 6;
+  if (this->per_batch() != 0) {
+    total_size += 1 + 1;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void LearningRateScheduleProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.LearningRateScheduleProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const LearningRateScheduleProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LearningRateScheduleProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.LearningRateScheduleProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.LearningRateScheduleProto)
+    MergeFrom(*source);
+  }
+}
+
+void LearningRateScheduleProto::MergeFrom(const LearningRateScheduleProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.LearningRateScheduleProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.op().size() > 0) {
+
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  if (from.gamma() != 0) {
+    set_gamma(from.gamma());
+  }
+  if (from.step_size() != 0) {
+    set_step_size(from.step_size());
+  }
+  if (from.warmup() != 0) {
+    set_warmup(from.warmup());
+  }
+  if (from.min_lr() != 0) {
+    set_min_lr(from.min_lr());
+  }
+  if (from.per_batch() != 0) {
+    set_per_batch(from.per_batch());
+  }
+}
+
+void LearningRateScheduleProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.LearningRateScheduleProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void LearningRateScheduleProto::CopyFrom(const LearningRateScheduleProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.LearningRateScheduleProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LearningRateScheduleProto::IsInitialized() const {
+  return true;
+}
+
+void LearningRateScheduleProto::Swap(LearningRateScheduleProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void LearningRateScheduleProto::InternalSwap(LearningRateScheduleProto* other) {
+  using std::swap;
+  op_.Swap(&other->op_);
+  swap(gamma_, other->gamma_);
+  swap(step_size_, other->step_size_);
+  swap(warmup_, other->warmup_);
+  swap(min_lr_, other->min_lr_);
+  swap(per_batch_, other->per_batch_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata LearningRateScheduleProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void DistributedParamsProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DistributedParamsProto::kOpFieldNumber;
+const int DistributedParamsProto::kDistributeAfterSamplesFieldNumber;
+const int DistributedParamsProto::kBlockSizeFieldNumber;
+const int DistributedParamsProto::kQuantizationBitsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DistributedParamsProto::DistributedParamsProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsDistributedParamsProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.DistributedParamsProto)
+}
+DistributedParamsProto::DistributedParamsProto(const DistributedParamsProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.op().size() > 0) {
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  ::memcpy(&distribute_after_samples_, &from.distribute_after_samples_,
+    static_cast<size_t>(reinterpret_cast<char*>(&quantization_bits_) -
+    reinterpret_cast<char*>(&distribute_after_samples_)) + sizeof(quantization_bits_));
+  // @@protoc_insertion_point(copy_constructor:keras.DistributedParamsProto)
+}
+
+void DistributedParamsProto::SharedCtor() {
+  op_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&distribute_after_samples_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&quantization_bits_) -
+      reinterpret_cast<char*>(&distribute_after_samples_)) + sizeof(quantization_bits_));
+  _cached_size_ = 0;
+}
+
+DistributedParamsProto::~DistributedParamsProto() {
+  // @@protoc_insertion_point(destructor:keras.DistributedParamsProto)
+  SharedDtor();
+}
+
+void DistributedParamsProto::SharedDtor() {
+  op_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void DistributedParamsProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DistributedParamsProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const DistributedParamsProto& DistributedParamsProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsDistributedParamsProto();
+  return *internal_default_instance();
+}
+
+DistributedParamsProto* DistributedParamsProto::New(::google::protobuf::Arena* arena) const {
+  DistributedParamsProto* n = new DistributedParamsProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void DistributedParamsProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.DistributedParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&distribute_after_samples_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&quantization_bits_) -
+      reinterpret_cast<char*>(&distribute_after_samples_)) + sizeof(quantization_bits_));
+  _internal_metadata_.Clear();
+}
+
+bool DistributedParamsProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.DistributedParamsProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string op = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_op()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->op().data(), static_cast<int>(this->op().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.DistributedParamsProto.op"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 distribute_after_samples = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &distribute_after_samples_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 block_size = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &block_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 quantization_bits = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &quantization_bits_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.DistributedParamsProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.DistributedParamsProto)
+  return false;
+#undef DO_
+}
+
+void DistributedParamsProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.DistributedParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.DistributedParamsProto.op");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->op(), output);
+  }
+
+  // uint64 distribute_after_samples = 2;
+  if (this->distribute_after_samples() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->distribute_after_samples(), output);
+  }
+
+  // uint64 block_size = 3;
+  if (this->block_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->block_size(), output);
+  }
+
+  // uint32 quantization_bits = 4;
+  if (this->quantization_bits() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->quantization_bits(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.DistributedParamsProto)
+}
+
+::google::protobuf::uint8* DistributedParamsProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.DistributedParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (this->op().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->op().data(), static_cast<int>(this->op().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.DistributedParamsProto.op");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->op(), target);
+  }
+
+  // uint64 distribute_after_samples = 2;
+  if (this->distribute_after_samples() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->distribute_after_samples(), target);
+  }
+
+  // uint64 block_size = 3;
+  if (this->block_size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->block_size(), target);
+  }
+
+  // uint32 quantization_bits = 4;
+  if (this->quantization_bits() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->quantization_bits(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.DistributedParamsProto)
+  return target;
+}
+
+size_t DistributedParamsProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.DistributedParamsProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // string op = 1;
+  if (this->op().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->op());
+  }
+
+  // uint64 distribute_after_samples = 2;
+  if (this->distribute_after_samples() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->distribute_after_samples());
+  }
+
+  // uint64 block_size = 3;
+  if (this->block_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->block_size());
+  }
+
+  // uint32 quantization_bits = 4;
+  if (this->quantization_bits() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->quantization_bits());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DistributedParamsProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.DistributedParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DistributedParamsProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DistributedParamsProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.DistributedParamsProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.DistributedParamsProto)
+    MergeFrom(*source);
+  }
+}
+
+void DistributedParamsProto::MergeFrom(const DistributedParamsProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.DistributedParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.op().size() > 0) {
+
+    op_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.op_);
+  }
+  if (from.distribute_after_samples() != 0) {
+    set_distribute_after_samples(from.distribute_after_samples());
+  }
+  if (from.block_size() != 0) {
+    set_block_size(from.block_size());
+  }
+  if (from.quantization_bits() != 0) {
+    set_quantization_bits(from.quantization_bits());
+  }
+}
+
+void DistributedParamsProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.DistributedParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DistributedParamsProto::CopyFrom(const DistributedParamsProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.DistributedParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DistributedParamsProto::IsInitialized() const {
+  return true;
+}
+
+void DistributedParamsProto::Swap(DistributedParamsProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DistributedParamsProto::InternalSwap(DistributedParamsProto* other) {
+  using std::swap;
+  op_.Swap(&other->op_);
+  swap(distribute_after_samples_, other->distribute_after_samples_);
+  swap(block_size_, other->block_size_);
+  swap(quantization_bits_, other->quantization_bits_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata DistributedParamsProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void CheckpointParamsProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CheckpointParamsProto::kPathFieldNumber;
+const int CheckpointParamsProto::kEveryBatchesFieldNumber;
+const int CheckpointParamsProto::kEveryMinutesFieldNumber;
+const int CheckpointParamsProto::kResumeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CheckpointParamsProto::CheckpointParamsProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsCheckpointParamsProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.CheckpointParamsProto)
+}
+CheckpointParamsProto::CheckpointParamsProto(const CheckpointParamsProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.path().size() > 0) {
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  ::memcpy(&every_minutes_, &from.every_minutes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&resume_) -
+    reinterpret_cast<char*>(&every_minutes_)) + sizeof(resume_));
+  // @@protoc_insertion_point(copy_constructor:keras.CheckpointParamsProto)
+}
+
+void CheckpointParamsProto::SharedCtor() {
+  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&every_minutes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&resume_) -
+      reinterpret_cast<char*>(&every_minutes_)) + sizeof(resume_));
+  _cached_size_ = 0;
+}
+
+CheckpointParamsProto::~CheckpointParamsProto() {
+  // @@protoc_insertion_point(destructor:keras.CheckpointParamsProto)
+  SharedDtor();
+}
+
+void CheckpointParamsProto::SharedDtor() {
+  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void CheckpointParamsProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CheckpointParamsProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const CheckpointParamsProto& CheckpointParamsProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsCheckpointParamsProto();
+  return *internal_default_instance();
+}
+
+CheckpointParamsProto* CheckpointParamsProto::New(::google::protobuf::Arena* arena) const {
+  CheckpointParamsProto* n = new CheckpointParamsProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void CheckpointParamsProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.CheckpointParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&every_minutes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&resume_) -
+      reinterpret_cast<char*>(&every_minutes_)) + sizeof(resume_));
+  _internal_metadata_.Clear();
+}
+
+bool CheckpointParamsProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.CheckpointParamsProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string path = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->path().data(), static_cast<int>(this->path().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "keras.CheckpointParamsProto.path"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 every_batches = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &every_batches_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double every_minutes = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(25u /* 25 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &every_minutes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool resume = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &resume_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.CheckpointParamsProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.CheckpointParamsProto)
+  return false;
+#undef DO_
+}
+
+void CheckpointParamsProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.CheckpointParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.CheckpointParamsProto.path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->path(), output);
+  }
+
+  // uint32 every_batches = 2;
+  if (this->every_batches() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->every_batches(), output);
+  }
+
+  // double every_minutes = 3;
+  if (this->every_minutes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->every_minutes(), output);
+  }
+
+  // bool resume = 4;
+  if (this->resume() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->resume(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.CheckpointParamsProto)
+}
+
+::google::protobuf::uint8* CheckpointParamsProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.CheckpointParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (this->path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->path().data(), static_cast<int>(this->path().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "keras.CheckpointParamsProto.path");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->path(), target);
+  }
+
+  // uint32 every_batches = 2;
+  if (this->every_batches() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->every_batches(), target);
+  }
+
+  // double every_minutes = 3;
+  if (this->every_minutes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->every_minutes(), target);
+  }
+
+  // bool resume = 4;
+  if (this->resume() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->resume(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.CheckpointParamsProto)
+  return target;
+}
+
+size_t CheckpointParamsProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.CheckpointParamsProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // string path = 1;
+  if (this->path().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->path());
+  }
+
+  // double every_minutes = 3;
+  if (this->every_minutes() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 every_batches = 2;
+  if (this->every_batches() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->every_batches());
+  }
+
+  // bool resume = 4;
+  if (this->resume() != 0) {
+    total_size += 1 + 1;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CheckpointParamsProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.CheckpointParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CheckpointParamsProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CheckpointParamsProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.CheckpointParamsProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.CheckpointParamsProto)
+    MergeFrom(*source);
+  }
+}
+
+void CheckpointParamsProto::MergeFrom(const CheckpointParamsProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.CheckpointParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.path().size() > 0) {
+
+    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  }
+  if (from.every_minutes() != 0) {
+    set_every_minutes(from.every_minutes());
+  }
+  if (from.every_batches() != 0) {
+    set_every_batches(from.every_batches());
+  }
+  if (from.resume() != 0) {
+    set_resume(from.resume());
+  }
+}
+
+void CheckpointParamsProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.CheckpointParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CheckpointParamsProto::CopyFrom(const CheckpointParamsProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.CheckpointParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CheckpointParamsProto::IsInitialized() const {
+  return true;
+}
+
+void CheckpointParamsProto::Swap(CheckpointParamsProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void CheckpointParamsProto::InternalSwap(CheckpointParamsProto* other) {
+  using std::swap;
+  path_.Swap(&other->path_);
+  swap(every_minutes_, other->every_minutes_);
+  swap(every_batches_, other->every_batches_);
+  swap(resume_, other->resume_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata CheckpointParamsProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ProgressParamsProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ProgressParamsProto::kAsyncFieldNumber;
+const int ProgressParamsProto::kEveryBatchesFieldNumber;
+const int ProgressParamsProto::kEveryMsFieldNumber;
+const int ProgressParamsProto::kEpochsOnlyFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ProgressParamsProto::ProgressParamsProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsProgressParamsProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.ProgressParamsProto)
+}
+ProgressParamsProto::ProgressParamsProto(const ProgressParamsProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&every_batches_, &from.every_batches_,
+    static_cast<size_t>(reinterpret_cast<char*>(&every_ms_) -
+    reinterpret_cast<char*>(&every_batches_)) + sizeof(every_ms_));
+  // @@protoc_insertion_point(copy_constructor:keras.ProgressParamsProto)
+}
+
+void ProgressParamsProto::SharedCtor() {
+  ::memset(&every_batches_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&every_ms_) -
+      reinterpret_cast<char*>(&every_batches_)) + sizeof(every_ms_));
+  _cached_size_ = 0;
+}
+
+ProgressParamsProto::~ProgressParamsProto() {
+  // @@protoc_insertion_point(destructor:keras.ProgressParamsProto)
+  SharedDtor();
+}
+
+void ProgressParamsProto::SharedDtor() {
+}
+
+void ProgressParamsProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ProgressParamsProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ProgressParamsProto& ProgressParamsProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsProgressParamsProto();
+  return *internal_default_instance();
+}
+
+ProgressParamsProto* ProgressParamsProto::New(::google::protobuf::Arena* arena) const {
+  ProgressParamsProto* n = new ProgressParamsProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ProgressParamsProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.ProgressParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&every_batches_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&every_ms_) -
+      reinterpret_cast<char*>(&every_batches_)) + sizeof(every_ms_));
+  _internal_metadata_.Clear();
+}
+
+bool ProgressParamsProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.ProgressParamsProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bool async = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &async_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 every_batches = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &every_batches_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 every_ms = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &every_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool epochs_only = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &epochs_only_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.ProgressParamsProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.ProgressParamsProto)
+  return false;
+#undef DO_
+}
+
+void ProgressParamsProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.ProgressParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool async = 1;
+  if (this->async() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->async(), output);
+  }
+
+  // uint32 every_batches = 2;
+  if (this->every_batches() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->every_batches(), output);
+  }
+
+  // uint32 every_ms = 3;
+  if (this->every_ms() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->every_ms(), output);
+  }
+
+  // bool epochs_only = 4;
+  if (this->epochs_only() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->epochs_only(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.ProgressParamsProto)
+}
+
+::google::protobuf::uint8* ProgressParamsProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.ProgressParamsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool async = 1;
+  if (this->async() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->async(), target);
+  }
+
+  // uint32 every_batches = 2;
+  if (this->every_batches() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->every_batches(), target);
+  }
+
+  // uint32 every_ms = 3;
+  if (this->every_ms() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->every_ms(), target);
+  }
+
+  // bool epochs_only = 4;
+  if (this->epochs_only() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->epochs_only(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.ProgressParamsProto)
+  return target;
+}
+
+size_t ProgressParamsProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.ProgressParamsProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // uint32 every_batches = 2;
+  if (this->every_batches() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->every_batches());
+  }
+
+  // bool async = 1;
+  if (this->async() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool epochs_only = 4;
+  if (this->epochs_only() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 every_ms = 3;
+  if (this->every_ms() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->every_ms());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ProgressParamsProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.ProgressParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ProgressParamsProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ProgressParamsProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.ProgressParamsProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.ProgressParamsProto)
+    MergeFrom(*source);
+  }
+}
+
+void ProgressParamsProto::MergeFrom(const ProgressParamsProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.ProgressParamsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.every_batches() != 0) {
+    set_every_batches(from.every_batches());
+  }
+  if (from.async() != 0) {
+    set_async(from.async());
+  }
+  if (from.epochs_only() != 0) {
+    set_epochs_only(from.epochs_only());
+  }
+  if (from.every_ms() != 0) {
+    set_every_ms(from.every_ms());
+  }
+}
+
+void ProgressParamsProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.ProgressParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ProgressParamsProto::CopyFrom(const ProgressParamsProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.ProgressParamsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProgressParamsProto::IsInitialized() const {
+  return true;
+}
+
+void ProgressParamsProto::Swap(ProgressParamsProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ProgressParamsProto::InternalSwap(ProgressParamsProto* other) {
+  using std::swap;
+  swap(every_batches_, other->every_batches_);
+  swap(async_, other->async_);
+  swap(epochs_only_, other->epochs_only_);
+  swap(every_ms_, other->every_ms_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ProgressParamsProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void CacheStatsProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CacheStatsProto::kHitsFieldNumber;
+const int CacheStatsProto::kMissesFieldNumber;
+const int CacheStatsProto::kEvictionsFieldNumber;
+const int CacheStatsProto::kModelsFieldNumber;
+const int CacheStatsProto::kBytesFieldNumber;
+const int CacheStatsProto::kBudgetFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CacheStatsProto::CacheStatsProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsCacheStatsProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.CacheStatsProto)
+}
+CacheStatsProto::CacheStatsProto(const CacheStatsProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&hits_, &from.hits_,
+    static_cast<size_t>(reinterpret_cast<char*>(&budget_) -
+    reinterpret_cast<char*>(&hits_)) + sizeof(budget_));
+  // @@protoc_insertion_point(copy_constructor:keras.CacheStatsProto)
+}
+
+void CacheStatsProto::SharedCtor() {
+  ::memset(&hits_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&budget_) -
+      reinterpret_cast<char*>(&hits_)) + sizeof(budget_));
+  _cached_size_ = 0;
+}
+
+CacheStatsProto::~CacheStatsProto() {
+  // @@protoc_insertion_point(destructor:keras.CacheStatsProto)
+  SharedDtor();
+}
+
+void CacheStatsProto::SharedDtor() {
+}
+
+void CacheStatsProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CacheStatsProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const CacheStatsProto& CacheStatsProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsCacheStatsProto();
+  return *internal_default_instance();
+}
+
+CacheStatsProto* CacheStatsProto::New(::google::protobuf::Arena* arena) const {
+  CacheStatsProto* n = new CacheStatsProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void CacheStatsProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.CacheStatsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&hits_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&budget_) -
+      reinterpret_cast<char*>(&hits_)) + sizeof(budget_));
+  _internal_metadata_.Clear();
+}
+
+bool CacheStatsProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.CacheStatsProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint64 hits = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &hits_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 misses = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &misses_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 evictions = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &evictions_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 models = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &models_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 bytes = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 budget = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &budget_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.CacheStatsProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.CacheStatsProto)
+  return false;
+#undef DO_
+}
+
+void CacheStatsProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.CacheStatsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 hits = 1;
+  if (this->hits() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->hits(), output);
+  }
+
+  // uint64 misses = 2;
+  if (this->misses() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->misses(), output);
+  }
+
+  // uint64 evictions = 3;
+  if (this->evictions() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->evictions(), output);
+  }
+
+  // uint64 models = 4;
+  if (this->models() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->models(), output);
+  }
+
+  // uint64 bytes = 5;
+  if (this->bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->bytes(), output);
+  }
+
+  // uint64 budget = 6;
+  if (this->budget() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->budget(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.CacheStatsProto)
+}
+
+::google::protobuf::uint8* CacheStatsProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.CacheStatsProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 hits = 1;
+  if (this->hits() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->hits(), target);
+  }
+
+  // uint64 misses = 2;
+  if (this->misses() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->misses(), target);
+  }
+
+  // uint64 evictions = 3;
+  if (this->evictions() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->evictions(), target);
+  }
+
+  // uint64 models = 4;
+  if (this->models() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->models(), target);
+  }
+
+  // uint64 bytes = 5;
+  if (this->bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->bytes(), target);
+  }
+
+  // uint64 budget = 6;
+  if (this->budget() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->budget(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.CacheStatsProto)
+  return target;
+}
+
+size_t CacheStatsProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.CacheStatsProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // uint64 hits = 1;
+  if (this->hits() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->hits());
+  }
+
+  // uint64 misses = 2;
+  if (this->misses() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->misses());
+  }
+
+  // uint64 evictions = 3;
+  if (this->evictions() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->evictions());
+  }
+
+  // uint64 models = 4;
+  if (this->models() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->models());
+  }
+
+  // uint64 bytes = 5;
+  if (this->bytes() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->bytes());
+  }
+
+  // uint64 budget = 6;
+  if (this->budget() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->budget());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CacheStatsProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.CacheStatsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CacheStatsProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CacheStatsProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.CacheStatsProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.CacheStatsProto)
+    MergeFrom(*source);
+  }
+}
+
+void CacheStatsProto::MergeFrom(const CacheStatsProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.CacheStatsProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.hits() != 0) {
+    set_hits(from.hits());
+  }
+  if (from.misses() != 0) {
+    set_misses(from.misses());
+  }
+  if (from.evictions() != 0) {
+    set_evictions(from.evictions());
+  }
+  if (from.models() != 0) {
+    set_models(from.models());
+  }
+  if (from.bytes() != 0) {
+    set_bytes(from.bytes());
+  }
+  if (from.budget() != 0) {
+    set_budget(from.budget());
+  }
+}
+
+void CacheStatsProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.CacheStatsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CacheStatsProto::CopyFrom(const CacheStatsProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.CacheStatsProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheStatsProto::IsInitialized() const {
+  return true;
+}
+
+void CacheStatsProto::Swap(CacheStatsProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void CacheStatsProto::InternalSwap(CacheStatsProto* other) {
+  using std::swap;
+  swap(hits_, other->hits_);
+  swap(misses_, other->misses_);
+  swap(evictions_, other->evictions_);
+  swap(models_, other->models_);
+  swap(bytes_, other->bytes_);
+  swap(budget_, other->budget_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata CacheStatsProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void OutputChunkProto::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int OutputChunkProto::kOffsetFieldNumber;
+const int OutputChunkProto::kOutputsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+OutputChunkProto::OutputChunkProto()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_KerasProto_2eproto::InitDefaultsOutputChunkProto();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:keras.OutputChunkProto)
+}
+OutputChunkProto::OutputChunkProto(const OutputChunkProto& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      outputs_(from.outputs_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  offset_ = from.offset_;
+  // @@protoc_insertion_point(copy_constructor:keras.OutputChunkProto)
+}
+
+void OutputChunkProto::SharedCtor() {
+  offset_ = GOOGLE_ULONGLONG(0);
+  _cached_size_ = 0;
+}
+
+OutputChunkProto::~OutputChunkProto() {
+  // @@protoc_insertion_point(destructor:keras.OutputChunkProto)
+  SharedDtor();
+}
+
+void OutputChunkProto::SharedDtor() {
+}
+
+void OutputChunkProto::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* OutputChunkProto::descriptor() {
+  ::protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const OutputChunkProto& OutputChunkProto::default_instance() {
+  ::protobuf_KerasProto_2eproto::InitDefaultsOutputChunkProto();
+  return *internal_default_instance();
+}
+
+OutputChunkProto* OutputChunkProto::New(::google::protobuf::Arena* arena) const {
+  OutputChunkProto* n = new OutputChunkProto;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void OutputChunkProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:keras.OutputChunkProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  outputs_.Clear();
+  offset_ = GOOGLE_ULONGLONG(0);
+  _internal_metadata_.Clear();
+}
+
+bool OutputChunkProto::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:keras.OutputChunkProto)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint64 offset = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &offset_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .keras.TensorProto outputs = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_outputs()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:keras.OutputChunkProto)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:keras.OutputChunkProto)
+  return false;
+#undef DO_
+}
+
+void OutputChunkProto::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:keras.OutputChunkProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 offset = 1;
+  if (this->offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->offset(), output);
+  }
+
+  // repeated .keras.TensorProto outputs = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->outputs_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->outputs(static_cast<int>(i)), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:keras.OutputChunkProto)
+}
+
+::google::protobuf::uint8* OutputChunkProto::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:keras.OutputChunkProto)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 offset = 1;
+  if (this->offset() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->offset(), target);
+  }
+
+  // repeated .keras.TensorProto outputs = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->outputs_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        2, this->outputs(static_cast<int>(i)), deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keras.OutputChunkProto)
+  return target;
+}
+
+size_t OutputChunkProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keras.OutputChunkProto)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated .keras.TensorProto outputs = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->outputs_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->outputs(static_cast<int>(i)));
+    }
+  }
+
+  // uint64 offset = 1;
+  if (this->offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->offset());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void OutputChunkProto::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:keras.OutputChunkProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  const OutputChunkProto* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const OutputChunkProto>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:keras.OutputChunkProto)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:keras.OutputChunkProto)
+    MergeFrom(*source);
+  }
+}
+
+void OutputChunkProto::MergeFrom(const OutputChunkProto& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:keras.OutputChunkProto)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  outputs_.MergeFrom(from.outputs_);
+  if (from.offset() != 0) {
+    set_offset(from.offset());
+  }
+}
+
+void OutputChunkProto::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:keras.OutputChunkProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void OutputChunkProto::CopyFrom(const OutputChunkProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keras.OutputChunkProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OutputChunkProto::IsInitialized() const {
+  return true;
+}
+
+void OutputChunkProto::Swap(OutputChunkProto* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void OutputChunkProto::InternalSwap(OutputChunkProto* other) {
+  using std::swap;
+  outputs_.InternalSwap(&other->outputs_);
+  swap(offset_, other->offset_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata OutputChunkProto::GetMetadata() const {
+  protobuf_KerasProto_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_KerasProto_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace keras
 
@@ -37,7 +37,7 @@ namespace protobuf_KerasProto_2eproto {
 struct TableStruct {
   static const ::google::protobuf::internal::ParseTableField entries[];
   static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[5];
+  static const ::google::protobuf::internal::ParseTable schema[16];
   static const ::google::protobuf::internal::FieldMetadata field_metadata[];
   static const ::google::protobuf::internal::SerializationTable serialization_table[];
   static const ::google::protobuf::uint32 offsets[];
@@ -53,21 +53,87 @@ void InitDefaultsTextDataSourceProtoImpl();
 void InitDefaultsTextDataSourceProto();
 void InitDefaultsHistoryProtoImpl();
 void InitDefaultsHistoryProto();
+void InitDefaultsInitializerProtoImpl();
+void InitDefaultsInitializerProto();
+void InitDefaultsLayerProtoImpl();
+void InitDefaultsLayerProto();
+void InitDefaultsOptimizerProtoImpl();
+void InitDefaultsOptimizerProto();
+void InitDefaultsCompileParamsProtoImpl();
+void InitDefaultsCompileParamsProto();
+void InitDefaultsPredictParamsProtoImpl();
+void InitDefaultsPredictParamsProto();
+void InitDefaultsLearningRateScheduleProtoImpl();
+void InitDefaultsLearningRateScheduleProto();
+void InitDefaultsDistributedParamsProtoImpl();
+void InitDefaultsDistributedParamsProto();
+void InitDefaultsCheckpointParamsProtoImpl();
+void InitDefaultsCheckpointParamsProto();
+void InitDefaultsProgressParamsProtoImpl();
+void InitDefaultsProgressParamsProto();
+void InitDefaultsCacheStatsProtoImpl();
+void InitDefaultsCacheStatsProto();
+void InitDefaultsOutputChunkProtoImpl();
+void InitDefaultsOutputChunkProto();
 inline void InitDefaults() {
   InitDefaultsKerasProto();
   InitDefaultsTensorProto();
   InitDefaultsStreamConfigurationProto();
   InitDefaultsTextDataSourceProto();
   InitDefaultsHistoryProto();
+  InitDefaultsInitializerProto();
+  InitDefaultsLayerProto();
+  InitDefaultsOptimizerProto();
+  InitDefaultsCompileParamsProto();
+  InitDefaultsPredictParamsProto();
+  InitDefaultsLearningRateScheduleProto();
+  InitDefaultsDistributedParamsProto();
+  InitDefaultsCheckpointParamsProto();
+  InitDefaultsProgressParamsProto();
+  InitDefaultsCacheStatsProto();
+  InitDefaultsOutputChunkProto();
 }
 }  // namespace protobuf_KerasProto_2eproto
 namespace keras {
+class CacheStatsProto;
+class CacheStatsProtoDefaultTypeInternal;
+extern CacheStatsProtoDefaultTypeInternal _CacheStatsProto_default_instance_;
+class CheckpointParamsProto;
+class CheckpointParamsProtoDefaultTypeInternal;
+extern CheckpointParamsProtoDefaultTypeInternal _CheckpointParamsProto_default_instance_;
+class CompileParamsProto;
+class CompileParamsProtoDefaultTypeInternal;
+extern CompileParamsProtoDefaultTypeInternal _CompileParamsProto_default_instance_;
+class DistributedParamsProto;
+class DistributedParamsProtoDefaultTypeInternal;
+extern DistributedParamsProtoDefaultTypeInternal _DistributedParamsProto_default_instance_;
 class HistoryProto;
 class HistoryProtoDefaultTypeInternal;
 extern HistoryProtoDefaultTypeInternal _HistoryProto_default_instance_;
+class InitializerProto;
+class InitializerProtoDefaultTypeInternal;
+extern InitializerProtoDefaultTypeInternal _InitializerProto_default_instance_;
 class KerasProto;
 class KerasProtoDefaultTypeInternal;
 extern KerasProtoDefaultTypeInternal _KerasProto_default_instance_;
+class LayerProto;
+class LayerProtoDefaultTypeInternal;
+extern LayerProtoDefaultTypeInternal _LayerProto_default_instance_;
+class LearningRateScheduleProto;
+class LearningRateScheduleProtoDefaultTypeInternal;
+extern LearningRateScheduleProtoDefaultTypeInternal _LearningRateScheduleProto_default_instance_;
+class OptimizerProto;
+class OptimizerProtoDefaultTypeInternal;
+extern OptimizerProtoDefaultTypeInternal _OptimizerProto_default_instance_;
+class OutputChunkProto;
+class OutputChunkProtoDefaultTypeInternal;
+extern OutputChunkProtoDefaultTypeInternal _OutputChunkProto_default_instance_;
+class PredictParamsProto;
+class PredictParamsProtoDefaultTypeInternal;
+extern PredictParamsProtoDefaultTypeInternal _PredictParamsProto_default_instance_;
+class ProgressParamsProto;
+class ProgressParamsProtoDefaultTypeInternal;
+extern ProgressParamsProtoDefaultTypeInternal _ProgressParamsProto_default_instance_;
 class StreamConfigurationProto;
 class StreamConfigurationProtoDefaultTypeInternal;
 extern StreamConfigurationProtoDefaultTypeInternal _StreamConfigurationProto_default_instance_;
@@ -83,12 +149,19 @@ namespace keras {
 enum KerasCommand {
   Fit = 0,
   Predict = 1,
+  Evaluate = 2,
+  UnloadModel = 3,
+  PinModel = 4,
+  UnpinModel = 5,
+  CacheStats = 6,
+  SetCacheBudget = 7,
+  ExportCpp = 8,
   KerasCommand_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   KerasCommand_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool KerasCommand_IsValid(int value);
 const KerasCommand KerasCommand_MIN = Fit;
-const KerasCommand KerasCommand_MAX = Predict;
+const KerasCommand KerasCommand_MAX = ExportCpp;
 const int KerasCommand_ARRAYSIZE = KerasCommand_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* KerasCommand_descriptor();
@@ -287,6 +360,40 @@ class KerasProto : public ::google::protobuf::Message /* @@protoc_insertion_poin
   const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
       outputs() const;
 
+  // repeated .keras.LayerProto layers = 19;
+  int layers_size() const;
+  void clear_layers();
+  static const int kLayersFieldNumber = 19;
+  const ::keras::LayerProto& layers(int index) const;
+  ::keras::LayerProto* mutable_layers(int index);
+  ::keras::LayerProto* add_layers();
+  ::google::protobuf::RepeatedPtrField< ::keras::LayerProto >*
+      mutable_layers();
+  const ::google::protobuf::RepeatedPtrField< ::keras::LayerProto >&
+      layers() const;
+
+  // repeated string frozen_layers = 27;
+  int frozen_layers_size() const;
+  void clear_frozen_layers();
+  static const int kFrozenLayersFieldNumber = 27;
+  const ::std::string& frozen_layers(int index) const;
+  ::std::string* mutable_frozen_layers(int index);
+  void set_frozen_layers(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_frozen_layers(int index, ::std::string&& value);
+  #endif
+  void set_frozen_layers(int index, const char* value);
+  void set_frozen_layers(int index, const char* value, size_t size);
+  ::std::string* add_frozen_layers();
+  void add_frozen_layers(const ::std::string& value);
+  #if LANG_CXX11
+  void add_frozen_layers(::std::string&& value);
+  #endif
+  void add_frozen_layers(const char* value);
+  void add_frozen_layers(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& frozen_layers() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_frozen_layers();
+
   // string graph = 1;
   void clear_graph();
   static const int kGraphFieldNumber = 1;
@@ -399,6 +506,111 @@ class KerasProto : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::std::string* release_path();
   void set_allocated_path(::std::string* path);
 
+  // string parallel = 23;
+  void clear_parallel();
+  static const int kParallelFieldNumber = 23;
+  const ::std::string& parallel() const;
+  void set_parallel(const ::std::string& value);
+  #if LANG_CXX11
+  void set_parallel(::std::string&& value);
+  #endif
+  void set_parallel(const char* value);
+  void set_parallel(const char* value, size_t size);
+  ::std::string* mutable_parallel();
+  ::std::string* release_parallel();
+  void set_allocated_parallel(::std::string* parallel);
+
+  // string cpp_prefix = 32;
+  void clear_cpp_prefix();
+  static const int kCppPrefixFieldNumber = 32;
+  const ::std::string& cpp_prefix() const;
+  void set_cpp_prefix(const ::std::string& value);
+  #if LANG_CXX11
+  void set_cpp_prefix(::std::string&& value);
+  #endif
+  void set_cpp_prefix(const char* value);
+  void set_cpp_prefix(const char* value, size_t size);
+  ::std::string* mutable_cpp_prefix();
+  ::std::string* release_cpp_prefix();
+  void set_allocated_cpp_prefix(::std::string* cpp_prefix);
+
+  // string cpp_source = 33;
+  void clear_cpp_source();
+  static const int kCppSourceFieldNumber = 33;
+  const ::std::string& cpp_source() const;
+  void set_cpp_source(const ::std::string& value);
+  #if LANG_CXX11
+  void set_cpp_source(::std::string&& value);
+  #endif
+  void set_cpp_source(const char* value);
+  void set_cpp_source(const char* value, size_t size);
+  ::std::string* mutable_cpp_source();
+  ::std::string* release_cpp_source();
+  void set_allocated_cpp_source(::std::string* cpp_source);
+
+  // .keras.CompileParamsProto compile = 20;
+  bool has_compile() const;
+  void clear_compile();
+  static const int kCompileFieldNumber = 20;
+  const ::keras::CompileParamsProto& compile() const;
+  ::keras::CompileParamsProto* release_compile();
+  ::keras::CompileParamsProto* mutable_compile();
+  void set_allocated_compile(::keras::CompileParamsProto* compile);
+
+  // .keras.PredictParamsProto predict = 21;
+  bool has_predict() const;
+  void clear_predict();
+  static const int kPredictFieldNumber = 21;
+  const ::keras::PredictParamsProto& predict() const;
+  ::keras::PredictParamsProto* release_predict();
+  ::keras::PredictParamsProto* mutable_predict();
+  void set_allocated_predict(::keras::PredictParamsProto* predict);
+
+  // .keras.DistributedParamsProto distributed = 24;
+  bool has_distributed() const;
+  void clear_distributed();
+  static const int kDistributedFieldNumber = 24;
+  const ::keras::DistributedParamsProto& distributed() const;
+  ::keras::DistributedParamsProto* release_distributed();
+  ::keras::DistributedParamsProto* mutable_distributed();
+  void set_allocated_distributed(::keras::DistributedParamsProto* distributed);
+
+  // .keras.CheckpointParamsProto checkpoint = 26;
+  bool has_checkpoint() const;
+  void clear_checkpoint();
+  static const int kCheckpointFieldNumber = 26;
+  const ::keras::CheckpointParamsProto& checkpoint() const;
+  ::keras::CheckpointParamsProto* release_checkpoint();
+  ::keras::CheckpointParamsProto* mutable_checkpoint();
+  void set_allocated_checkpoint(::keras::CheckpointParamsProto* checkpoint);
+
+  // .keras.ProgressParamsProto progress = 28;
+  bool has_progress() const;
+  void clear_progress();
+  static const int kProgressFieldNumber = 28;
+  const ::keras::ProgressParamsProto& progress() const;
+  ::keras::ProgressParamsProto* release_progress();
+  ::keras::ProgressParamsProto* mutable_progress();
+  void set_allocated_progress(::keras::ProgressParamsProto* progress);
+
+  // .keras.HistoryProto evaluation = 29;
+  bool has_evaluation() const;
+  void clear_evaluation();
+  static const int kEvaluationFieldNumber = 29;
+  const ::keras::HistoryProto& evaluation() const;
+  ::keras::HistoryProto* release_evaluation();
+  ::keras::HistoryProto* mutable_evaluation();
+  void set_allocated_evaluation(::keras::HistoryProto* evaluation);
+
+  // .keras.CacheStatsProto cache_stats = 31;
+  bool has_cache_stats() const;
+  void clear_cache_stats();
+  static const int kCacheStatsFieldNumber = 31;
+  const ::keras::CacheStatsProto& cache_stats() const;
+  ::keras::CacheStatsProto* release_cache_stats();
+  ::keras::CacheStatsProto* mutable_cache_stats();
+  void set_allocated_cache_stats(::keras::CacheStatsProto* cache_stats);
+
   // uint32 nsamples = 9;
   void clear_nsamples();
   static const int kNsamplesFieldNumber = 9;
@@ -447,12 +659,38 @@ class KerasProto : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::keras::KerasCommand command() const;
   void set_command(::keras::KerasCommand value);
 
+  // uint32 workers = 22;
+  void clear_workers();
+  static const int kWorkersFieldNumber = 22;
+  ::google::protobuf::uint32 workers() const;
+  void set_workers(::google::protobuf::uint32 value);
+
+  // uint64 cache_budget = 30;
+  void clear_cache_budget();
+  static const int kCacheBudgetFieldNumber = 30;
+  ::google::protobuf::uint64 cache_budget() const;
+  void set_cache_budget(::google::protobuf::uint64 value);
+
+  // uint64 output_callback = 34;
+  void clear_output_callback();
+  static const int kOutputCallbackFieldNumber = 34;
+  ::google::protobuf::uint64 output_callback() const;
+  void set_output_callback(::google::protobuf::uint64 value);
+
+  // uint32 gradient_accumulation_steps = 25;
+  void clear_gradient_accumulation_steps();
+  static const int kGradientAccumulationStepsFieldNumber = 25;
+  ::google::protobuf::uint32 gradient_accumulation_steps() const;
+  void set_gradient_accumulation_steps(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:keras.KerasProto)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::RepeatedPtrField< ::keras::TensorProto > inputs_;
   ::google::protobuf::RepeatedPtrField< ::keras::TensorProto > outputs_;
+  ::google::protobuf::RepeatedPtrField< ::keras::LayerProto > layers_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> frozen_layers_;
   ::google::protobuf::internal::ArenaStringPtr graph_;
   ::google::protobuf::internal::ArenaStringPtr model_;
   ::google::protobuf::internal::ArenaStringPtr model_path_;
@@ -461,6 +699,16 @@ class KerasProto : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::google::protobuf::internal::ArenaStringPtr fit_params_;
   ::google::protobuf::internal::ArenaStringPtr predict_params_;
   ::google::protobuf::internal::ArenaStringPtr path_;
+  ::google::protobuf::internal::ArenaStringPtr parallel_;
+  ::google::protobuf::internal::ArenaStringPtr cpp_prefix_;
+  ::google::protobuf::internal::ArenaStringPtr cpp_source_;
+  ::keras::CompileParamsProto* compile_;
+  ::keras::PredictParamsProto* predict_;
+  ::keras::DistributedParamsProto* distributed_;
+  ::keras::CheckpointParamsProto* checkpoint_;
+  ::keras::ProgressParamsProto* progress_;
+  ::keras::HistoryProto* evaluation_;
+  ::keras::CacheStatsProto* cache_stats_;
   ::google::protobuf::uint32 nsamples_;
   ::google::protobuf::uint32 nfeatures_;
   ::google::protobuf::uint32 nlabels_;
@@ -469,6 +717,10 @@ class KerasProto : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::google::protobuf::uint32 verbose_;
   ::google::protobuf::uint64 progress_callback_;
   int command_;
+  ::google::protobuf::uint32 workers_;
+  ::google::protobuf::uint64 cache_budget_;
+  ::google::protobuf::uint64 output_callback_;
+  ::google::protobuf::uint32 gradient_accumulation_steps_;
   mutable int _cached_size_;
   friend struct ::protobuf_KerasProto_2eproto::TableStruct;
   friend void ::protobuf_KerasProto_2eproto::InitDefaultsKerasProtoImpl();
@@ -581,6 +833,18 @@ class TensorProto : public ::google::protobuf::Message /* @@protoc_insertion_poi
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
       mutable_indices();
 
+  // repeated int32 sequence_lengths = 7;
+  int sequence_lengths_size() const;
+  void clear_sequence_lengths();
+  static const int kSequenceLengthsFieldNumber = 7;
+  ::google::protobuf::int32 sequence_lengths(int index) const;
+  void set_sequence_lengths(int index, ::google::protobuf::int32 value);
+  void add_sequence_lengths(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      sequence_lengths() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_sequence_lengths();
+
   // bytes data = 6;
   void clear_data();
   static const int kDataFieldNumber = 6;
@@ -621,6 +885,8 @@ class TensorProto : public ::google::protobuf::Message /* @@protoc_insertion_poi
   mutable int _shape_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > indices_;
   mutable int _indices_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > sequence_lengths_;
+  mutable int _sequence_lengths_cached_byte_size_;
   ::google::protobuf::internal::ArenaStringPtr data_;
   int type_;
   int format_;
@@ -1020,1087 +1286,5665 @@ class HistoryProto : public ::google::protobuf::Message /* @@protoc_insertion_po
   friend struct ::protobuf_KerasProto_2eproto::TableStruct;
   friend void ::protobuf_KerasProto_2eproto::InitDefaultsHistoryProtoImpl();
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class InitializerProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.InitializerProto) */ {
+ public:
+  InitializerProto();
+  virtual ~InitializerProto();
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// KerasProto
+  InitializerProto(const InitializerProto& from);
 
-// string graph = 1;
-inline void KerasProto::clear_graph() {
-  graph_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KerasProto::graph() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.graph)
-  return graph_.GetNoArena();
-}
-inline void KerasProto::set_graph(const ::std::string& value) {
-  
-  graph_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.graph)
-}
-#if LANG_CXX11
-inline void KerasProto::set_graph(::std::string&& value) {
-  
-  graph_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.graph)
-}
-#endif
-inline void KerasProto::set_graph(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  graph_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.graph)
-}
-inline void KerasProto::set_graph(const char* value, size_t size) {
-  
-  graph_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.graph)
-}
-inline ::std::string* KerasProto::mutable_graph() {
-  
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.graph)
-  return graph_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KerasProto::release_graph() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.graph)
-  
-  return graph_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KerasProto::set_allocated_graph(::std::string* graph) {
-  if (graph != NULL) {
-    
-  } else {
-    
+  inline InitializerProto& operator=(const InitializerProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  InitializerProto(InitializerProto&& from) noexcept
+    : InitializerProto() {
+    *this = ::std::move(from);
   }
-  graph_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), graph);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.graph)
-}
 
-// bytes model = 2;
-inline void KerasProto::clear_model() {
-  model_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KerasProto::model() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.model)
-  return model_.GetNoArena();
-}
-inline void KerasProto::set_model(const ::std::string& value) {
-  
-  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.model)
-}
-#if LANG_CXX11
-inline void KerasProto::set_model(::std::string&& value) {
-  
-  model_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.model)
-}
-#endif
-inline void KerasProto::set_model(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.model)
-}
-inline void KerasProto::set_model(const void* value, size_t size) {
-  
-  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.model)
-}
-inline ::std::string* KerasProto::mutable_model() {
-  
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.model)
-  return model_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KerasProto::release_model() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.model)
-  
-  return model_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KerasProto::set_allocated_model(::std::string* model) {
-  if (model != NULL) {
-    
-  } else {
-    
+  inline InitializerProto& operator=(InitializerProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  model_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.model)
-}
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const InitializerProto& default_instance();
 
-// string model_path = 3;
-inline void KerasProto::clear_model_path() {
-  model_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KerasProto::model_path() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.model_path)
-  return model_path_.GetNoArena();
-}
-inline void KerasProto::set_model_path(const ::std::string& value) {
-  
-  model_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.model_path)
-}
-#if LANG_CXX11
-inline void KerasProto::set_model_path(::std::string&& value) {
-  
-  model_path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.model_path)
-}
-#endif
-inline void KerasProto::set_model_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  model_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.model_path)
-}
-inline void KerasProto::set_model_path(const char* value, size_t size) {
-  
-  model_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.model_path)
-}
-inline ::std::string* KerasProto::mutable_model_path() {
-  
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.model_path)
-  return model_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KerasProto::release_model_path() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.model_path)
-  
-  return model_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KerasProto::set_allocated_model_path(::std::string* model_path) {
-  if (model_path != NULL) {
-    
-  } else {
-    
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const InitializerProto* internal_default_instance() {
+    return reinterpret_cast<const InitializerProto*>(
+               &_InitializerProto_default_instance_);
   }
-  model_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model_path);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.model_path)
-}
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    5;
 
-// string model_uuid = 4;
-inline void KerasProto::clear_model_uuid() {
-  model_uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KerasProto::model_uuid() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.model_uuid)
-  return model_uuid_.GetNoArena();
-}
-inline void KerasProto::set_model_uuid(const ::std::string& value) {
-  
-  model_uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.model_uuid)
-}
-#if LANG_CXX11
-inline void KerasProto::set_model_uuid(::std::string&& value) {
-  
-  model_uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.model_uuid)
-}
-#endif
-inline void KerasProto::set_model_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  model_uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.model_uuid)
-}
-inline void KerasProto::set_model_uuid(const char* value, size_t size) {
-  
-  model_uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.model_uuid)
-}
-inline ::std::string* KerasProto::mutable_model_uuid() {
-  
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.model_uuid)
-  return model_uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KerasProto::release_model_uuid() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.model_uuid)
-  
-  return model_uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KerasProto::set_allocated_model_uuid(::std::string* model_uuid) {
-  if (model_uuid != NULL) {
-    
-  } else {
-    
+  void Swap(InitializerProto* other);
+  friend void swap(InitializerProto& a, InitializerProto& b) {
+    a.Swap(&b);
   }
-  model_uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model_uuid);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.model_uuid)
-}
 
-// string compile_params = 5;
-inline void KerasProto::clear_compile_params() {
-  compile_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KerasProto::compile_params() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.compile_params)
-  return compile_params_.GetNoArena();
-}
-inline void KerasProto::set_compile_params(const ::std::string& value) {
-  
+  // implements Message ----------------------------------------------
+
+  inline InitializerProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  InitializerProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const InitializerProto& from);
+  void MergeFrom(const InitializerProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(InitializerProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string op = 1;
+  void clear_op();
+  static const int kOpFieldNumber = 1;
+  const ::std::string& op() const;
+  void set_op(const ::std::string& value);
+  #if LANG_CXX11
+  void set_op(::std::string&& value);
+  #endif
+  void set_op(const char* value);
+  void set_op(const char* value, size_t size);
+  ::std::string* mutable_op();
+  ::std::string* release_op();
+  void set_allocated_op(::std::string* op);
+
+  // double value = 2;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  double value() const;
+  void set_value(double value);
+
+  // double scale = 3;
+  void clear_scale();
+  static const int kScaleFieldNumber = 3;
+  double scale() const;
+  void set_scale(double value);
+
+  // uint64 seed = 4;
+  void clear_seed();
+  static const int kSeedFieldNumber = 4;
+  ::google::protobuf::uint64 seed() const;
+  void set_seed(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:keras.InitializerProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr op_;
+  double value_;
+  double scale_;
+  ::google::protobuf::uint64 seed_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsInitializerProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class LayerProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.LayerProto) */ {
+ public:
+  LayerProto();
+  virtual ~LayerProto();
+
+  LayerProto(const LayerProto& from);
+
+  inline LayerProto& operator=(const LayerProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LayerProto(LayerProto&& from) noexcept
+    : LayerProto() {
+    *this = ::std::move(from);
+  }
+
+  inline LayerProto& operator=(LayerProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LayerProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const LayerProto* internal_default_instance() {
+    return reinterpret_cast<const LayerProto*>(
+               &_LayerProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    6;
+
+  void Swap(LayerProto* other);
+  friend void swap(LayerProto& a, LayerProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LayerProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LayerProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LayerProto& from);
+  void MergeFrom(const LayerProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LayerProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 input_shape = 3;
+  int input_shape_size() const;
+  void clear_input_shape();
+  static const int kInputShapeFieldNumber = 3;
+  ::google::protobuf::int32 input_shape(int index) const;
+  void set_input_shape(int index, ::google::protobuf::int32 value);
+  void add_input_shape(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      input_shape() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_input_shape();
+
+  // repeated int32 kernel_size = 10;
+  int kernel_size_size() const;
+  void clear_kernel_size();
+  static const int kKernelSizeFieldNumber = 10;
+  ::google::protobuf::int32 kernel_size(int index) const;
+  void set_kernel_size(int index, ::google::protobuf::int32 value);
+  void add_kernel_size(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      kernel_size() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_kernel_size();
+
+  // repeated int32 strides = 11;
+  int strides_size() const;
+  void clear_strides();
+  static const int kStridesFieldNumber = 11;
+  ::google::protobuf::int32 strides(int index) const;
+  void set_strides(int index, ::google::protobuf::int32 value);
+  void add_strides(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      strides() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_strides();
+
+  // repeated int32 pool_size = 13;
+  int pool_size_size() const;
+  void clear_pool_size();
+  static const int kPoolSizeFieldNumber = 13;
+  ::google::protobuf::int32 pool_size(int index) const;
+  void set_pool_size(int index, ::google::protobuf::int32 value);
+  void add_pool_size(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      pool_size() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_pool_size();
+
+  // string op = 1;
+  void clear_op();
+  static const int kOpFieldNumber = 1;
+  const ::std::string& op() const;
+  void set_op(const ::std::string& value);
+  #if LANG_CXX11
+  void set_op(::std::string&& value);
+  #endif
+  void set_op(const char* value);
+  void set_op(const char* value, size_t size);
+  ::std::string* mutable_op();
+  ::std::string* release_op();
+  void set_allocated_op(::std::string* op);
+
+  // string name = 2;
+  void clear_name();
+  static const int kNameFieldNumber = 2;
+  const ::std::string& name() const;
+  void set_name(const ::std::string& value);
+  #if LANG_CXX11
+  void set_name(::std::string&& value);
+  #endif
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  ::std::string* mutable_name();
+  ::std::string* release_name();
+  void set_allocated_name(::std::string* name);
+
+  // string activation = 5;
+  void clear_activation();
+  static const int kActivationFieldNumber = 5;
+  const ::std::string& activation() const;
+  void set_activation(const ::std::string& value);
+  #if LANG_CXX11
+  void set_activation(::std::string&& value);
+  #endif
+  void set_activation(const char* value);
+  void set_activation(const char* value, size_t size);
+  ::std::string* mutable_activation();
+  ::std::string* release_activation();
+  void set_allocated_activation(::std::string* activation);
+
+  // string padding = 12;
+  void clear_padding();
+  static const int kPaddingFieldNumber = 12;
+  const ::std::string& padding() const;
+  void set_padding(const ::std::string& value);
+  #if LANG_CXX11
+  void set_padding(::std::string&& value);
+  #endif
+  void set_padding(const char* value);
+  void set_padding(const char* value, size_t size);
+  ::std::string* mutable_padding();
+  ::std::string* release_padding();
+  void set_allocated_padding(::std::string* padding);
+
+  // string recurrent_activation = 19;
+  void clear_recurrent_activation();
+  static const int kRecurrentActivationFieldNumber = 19;
+  const ::std::string& recurrent_activation() const;
+  void set_recurrent_activation(const ::std::string& value);
+  #if LANG_CXX11
+  void set_recurrent_activation(::std::string&& value);
+  #endif
+  void set_recurrent_activation(const char* value);
+  void set_recurrent_activation(const char* value, size_t size);
+  ::std::string* mutable_recurrent_activation();
+  ::std::string* release_recurrent_activation();
+  void set_allocated_recurrent_activation(::std::string* recurrent_activation);
+
+  // .keras.InitializerProto kernel_initializer = 7;
+  bool has_kernel_initializer() const;
+  void clear_kernel_initializer();
+  static const int kKernelInitializerFieldNumber = 7;
+  const ::keras::InitializerProto& kernel_initializer() const;
+  ::keras::InitializerProto* release_kernel_initializer();
+  ::keras::InitializerProto* mutable_kernel_initializer();
+  void set_allocated_kernel_initializer(::keras::InitializerProto* kernel_initializer);
+
+  // .keras.InitializerProto bias_initializer = 8;
+  bool has_bias_initializer() const;
+  void clear_bias_initializer();
+  static const int kBiasInitializerFieldNumber = 8;
+  const ::keras::InitializerProto& bias_initializer() const;
+  ::keras::InitializerProto* release_bias_initializer();
+  ::keras::InitializerProto* mutable_bias_initializer();
+  void set_allocated_bias_initializer(::keras::InitializerProto* bias_initializer);
+
+  // .keras.InitializerProto recurrent_initializer = 20;
+  bool has_recurrent_initializer() const;
+  void clear_recurrent_initializer();
+  static const int kRecurrentInitializerFieldNumber = 20;
+  const ::keras::InitializerProto& recurrent_initializer() const;
+  ::keras::InitializerProto* release_recurrent_initializer();
+  ::keras::InitializerProto* mutable_recurrent_initializer();
+  void set_allocated_recurrent_initializer(::keras::InitializerProto* recurrent_initializer);
+
+  // .keras.InitializerProto embeddings_initializer = 26;
+  bool has_embeddings_initializer() const;
+  void clear_embeddings_initializer();
+  static const int kEmbeddingsInitializerFieldNumber = 26;
+  const ::keras::InitializerProto& embeddings_initializer() const;
+  ::keras::InitializerProto* release_embeddings_initializer();
+  ::keras::InitializerProto* mutable_embeddings_initializer();
+  void set_allocated_embeddings_initializer(::keras::InitializerProto* embeddings_initializer);
+
+  // .keras.InitializerProto depthwise_initializer = 32;
+  bool has_depthwise_initializer() const;
+  void clear_depthwise_initializer();
+  static const int kDepthwiseInitializerFieldNumber = 32;
+  const ::keras::InitializerProto& depthwise_initializer() const;
+  ::keras::InitializerProto* release_depthwise_initializer();
+  ::keras::InitializerProto* mutable_depthwise_initializer();
+  void set_allocated_depthwise_initializer(::keras::InitializerProto* depthwise_initializer);
+
+  // .keras.InitializerProto pointwise_initializer = 33;
+  bool has_pointwise_initializer() const;
+  void clear_pointwise_initializer();
+  static const int kPointwiseInitializerFieldNumber = 33;
+  const ::keras::InitializerProto& pointwise_initializer() const;
+  ::keras::InitializerProto* release_pointwise_initializer();
+  ::keras::InitializerProto* mutable_pointwise_initializer();
+  void set_allocated_pointwise_initializer(::keras::InitializerProto* pointwise_initializer);
+
+  // uint32 units = 4;
+  void clear_units();
+  static const int kUnitsFieldNumber = 4;
+  ::google::protobuf::uint32 units() const;
+  void set_units(::google::protobuf::uint32 value);
+
+  // uint32 filters = 9;
+  void clear_filters();
+  static const int kFiltersFieldNumber = 9;
+  ::google::protobuf::uint32 filters() const;
+  void set_filters(::google::protobuf::uint32 value);
+
+  // double rate = 14;
+  void clear_rate();
+  static const int kRateFieldNumber = 14;
+  double rate() const;
+  void set_rate(double value);
+
+  // uint64 seed = 15;
+  void clear_seed();
+  static const int kSeedFieldNumber = 15;
+  ::google::protobuf::uint64 seed() const;
+  void set_seed(::google::protobuf::uint64 value);
+
+  // uint32 input_dim = 16;
+  void clear_input_dim();
+  static const int kInputDimFieldNumber = 16;
+  ::google::protobuf::uint32 input_dim() const;
+  void set_input_dim(::google::protobuf::uint32 value);
+
+  // uint32 output_dim = 17;
+  void clear_output_dim();
+  static const int kOutputDimFieldNumber = 17;
+  ::google::protobuf::uint32 output_dim() const;
+  void set_output_dim(::google::protobuf::uint32 value);
+
+  // uint32 input_length = 18;
+  void clear_input_length();
+  static const int kInputLengthFieldNumber = 18;
+  ::google::protobuf::uint32 input_length() const;
+  void set_input_length(::google::protobuf::uint32 value);
+
+  // bool use_bias = 6;
+  void clear_use_bias();
+  static const int kUseBiasFieldNumber = 6;
+  bool use_bias() const;
+  void set_use_bias(bool value);
+
+  // bool unit_forget_bias = 21;
+  void clear_unit_forget_bias();
+  static const int kUnitForgetBiasFieldNumber = 21;
+  bool unit_forget_bias() const;
+  void set_unit_forget_bias(bool value);
+
+  // bool return_sequences = 22;
+  void clear_return_sequences();
+  static const int kReturnSequencesFieldNumber = 22;
+  bool return_sequences() const;
+  void set_return_sequences(bool value);
+
+  // bool go_backwards = 23;
+  void clear_go_backwards();
+  static const int kGoBackwardsFieldNumber = 23;
+  bool go_backwards() const;
+  void set_go_backwards(bool value);
+
+  // double dropout = 24;
+  void clear_dropout();
+  static const int kDropoutFieldNumber = 24;
+  double dropout() const;
+  void set_dropout(double value);
+
+  // double recurrent_dropout = 25;
+  void clear_recurrent_dropout();
+  static const int kRecurrentDropoutFieldNumber = 25;
+  double recurrent_dropout() const;
+  void set_recurrent_dropout(double value);
+
+  // bool mask_zero = 27;
+  void clear_mask_zero();
+  static const int kMaskZeroFieldNumber = 27;
+  bool mask_zero() const;
+  void set_mask_zero(bool value);
+
+  // uint32 hash_buckets = 28;
+  void clear_hash_buckets();
+  static const int kHashBucketsFieldNumber = 28;
+  ::google::protobuf::uint32 hash_buckets() const;
+  void set_hash_buckets(::google::protobuf::uint32 value);
+
+  // uint32 num_hashes = 29;
+  void clear_num_hashes();
+  static const int kNumHashesFieldNumber = 29;
+  ::google::protobuf::uint32 num_hashes() const;
+  void set_num_hashes(::google::protobuf::uint32 value);
+
+  // uint32 groups = 30;
+  void clear_groups();
+  static const int kGroupsFieldNumber = 30;
+  ::google::protobuf::uint32 groups() const;
+  void set_groups(::google::protobuf::uint32 value);
+
+  // uint32 depth_multiplier = 31;
+  void clear_depth_multiplier();
+  static const int kDepthMultiplierFieldNumber = 31;
+  ::google::protobuf::uint32 depth_multiplier() const;
+  void set_depth_multiplier(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:keras.LayerProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > input_shape_;
+  mutable int _input_shape_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > kernel_size_;
+  mutable int _kernel_size_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > strides_;
+  mutable int _strides_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > pool_size_;
+  mutable int _pool_size_cached_byte_size_;
+  ::google::protobuf::internal::ArenaStringPtr op_;
+  ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::internal::ArenaStringPtr activation_;
+  ::google::protobuf::internal::ArenaStringPtr padding_;
+  ::google::protobuf::internal::ArenaStringPtr recurrent_activation_;
+  ::keras::InitializerProto* kernel_initializer_;
+  ::keras::InitializerProto* bias_initializer_;
+  ::keras::InitializerProto* recurrent_initializer_;
+  ::keras::InitializerProto* embeddings_initializer_;
+  ::keras::InitializerProto* depthwise_initializer_;
+  ::keras::InitializerProto* pointwise_initializer_;
+  ::google::protobuf::uint32 units_;
+  ::google::protobuf::uint32 filters_;
+  double rate_;
+  ::google::protobuf::uint64 seed_;
+  ::google::protobuf::uint32 input_dim_;
+  ::google::protobuf::uint32 output_dim_;
+  ::google::protobuf::uint32 input_length_;
+  bool use_bias_;
+  bool unit_forget_bias_;
+  bool return_sequences_;
+  bool go_backwards_;
+  double dropout_;
+  double recurrent_dropout_;
+  bool mask_zero_;
+  ::google::protobuf::uint32 hash_buckets_;
+  ::google::protobuf::uint32 num_hashes_;
+  ::google::protobuf::uint32 groups_;
+  ::google::protobuf::uint32 depth_multiplier_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsLayerProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class OptimizerProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.OptimizerProto) */ {
+ public:
+  OptimizerProto();
+  virtual ~OptimizerProto();
+
+  OptimizerProto(const OptimizerProto& from);
+
+  inline OptimizerProto& operator=(const OptimizerProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  OptimizerProto(OptimizerProto&& from) noexcept
+    : OptimizerProto() {
+    *this = ::std::move(from);
+  }
+
+  inline OptimizerProto& operator=(OptimizerProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const OptimizerProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const OptimizerProto* internal_default_instance() {
+    return reinterpret_cast<const OptimizerProto*>(
+               &_OptimizerProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    7;
+
+  void Swap(OptimizerProto* other);
+  friend void swap(OptimizerProto& a, OptimizerProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline OptimizerProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  OptimizerProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const OptimizerProto& from);
+  void MergeFrom(const OptimizerProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(OptimizerProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string op = 1;
+  void clear_op();
+  static const int kOpFieldNumber = 1;
+  const ::std::string& op() const;
+  void set_op(const ::std::string& value);
+  #if LANG_CXX11
+  void set_op(::std::string&& value);
+  #endif
+  void set_op(const char* value);
+  void set_op(const char* value, size_t size);
+  ::std::string* mutable_op();
+  ::std::string* release_op();
+  void set_allocated_op(::std::string* op);
+
+  // .keras.LearningRateScheduleProto schedule = 11;
+  bool has_schedule() const;
+  void clear_schedule();
+  static const int kScheduleFieldNumber = 11;
+  const ::keras::LearningRateScheduleProto& schedule() const;
+  ::keras::LearningRateScheduleProto* release_schedule();
+  ::keras::LearningRateScheduleProto* mutable_schedule();
+  void set_allocated_schedule(::keras::LearningRateScheduleProto* schedule);
+
+  // double lr = 2;
+  void clear_lr();
+  static const int kLrFieldNumber = 2;
+  double lr() const;
+  void set_lr(double value);
+
+  // double momentum = 3;
+  void clear_momentum();
+  static const int kMomentumFieldNumber = 3;
+  double momentum() const;
+  void set_momentum(double value);
+
+  // double decay = 4;
+  void clear_decay();
+  static const int kDecayFieldNumber = 4;
+  double decay() const;
+  void set_decay(double value);
+
+  // double rho = 6;
+  void clear_rho();
+  static const int kRhoFieldNumber = 6;
+  double rho() const;
+  void set_rho(double value);
+
+  // double epsilon = 7;
+  void clear_epsilon();
+  static const int kEpsilonFieldNumber = 7;
+  double epsilon() const;
+  void set_epsilon(double value);
+
+  // double beta_1 = 8;
+  void clear_beta_1();
+  static const int kBeta1FieldNumber = 8;
+  double beta_1() const;
+  void set_beta_1(double value);
+
+  // double beta_2 = 9;
+  void clear_beta_2();
+  static const int kBeta2FieldNumber = 9;
+  double beta_2() const;
+  void set_beta_2(double value);
+
+  // double weight_decay = 10;
+  void clear_weight_decay();
+  static const int kWeightDecayFieldNumber = 10;
+  double weight_decay() const;
+  void set_weight_decay(double value);
+
+  // bool nesterov = 5;
+  void clear_nesterov();
+  static const int kNesterovFieldNumber = 5;
+  bool nesterov() const;
+  void set_nesterov(bool value);
+
+  // @@protoc_insertion_point(class_scope:keras.OptimizerProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr op_;
+  ::keras::LearningRateScheduleProto* schedule_;
+  double lr_;
+  double momentum_;
+  double decay_;
+  double rho_;
+  double epsilon_;
+  double beta_1_;
+  double beta_2_;
+  double weight_decay_;
+  bool nesterov_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsOptimizerProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class CompileParamsProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.CompileParamsProto) */ {
+ public:
+  CompileParamsProto();
+  virtual ~CompileParamsProto();
+
+  CompileParamsProto(const CompileParamsProto& from);
+
+  inline CompileParamsProto& operator=(const CompileParamsProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CompileParamsProto(CompileParamsProto&& from) noexcept
+    : CompileParamsProto() {
+    *this = ::std::move(from);
+  }
+
+  inline CompileParamsProto& operator=(CompileParamsProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CompileParamsProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CompileParamsProto* internal_default_instance() {
+    return reinterpret_cast<const CompileParamsProto*>(
+               &_CompileParamsProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    8;
+
+  void Swap(CompileParamsProto* other);
+  friend void swap(CompileParamsProto& a, CompileParamsProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CompileParamsProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  CompileParamsProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const CompileParamsProto& from);
+  void MergeFrom(const CompileParamsProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(CompileParamsProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string metrics = 3;
+  int metrics_size() const;
+  void clear_metrics();
+  static const int kMetricsFieldNumber = 3;
+  const ::std::string& metrics(int index) const;
+  ::std::string* mutable_metrics(int index);
+  void set_metrics(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_metrics(int index, ::std::string&& value);
+  #endif
+  void set_metrics(int index, const char* value);
+  void set_metrics(int index, const char* value, size_t size);
+  ::std::string* add_metrics();
+  void add_metrics(const ::std::string& value);
+  #if LANG_CXX11
+  void add_metrics(::std::string&& value);
+  #endif
+  void add_metrics(const char* value);
+  void add_metrics(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& metrics() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_metrics();
+
+  // string loss = 2;
+  void clear_loss();
+  static const int kLossFieldNumber = 2;
+  const ::std::string& loss() const;
+  void set_loss(const ::std::string& value);
+  #if LANG_CXX11
+  void set_loss(::std::string&& value);
+  #endif
+  void set_loss(const char* value);
+  void set_loss(const char* value, size_t size);
+  ::std::string* mutable_loss();
+  ::std::string* release_loss();
+  void set_allocated_loss(::std::string* loss);
+
+  // .keras.OptimizerProto optimizer = 1;
+  bool has_optimizer() const;
+  void clear_optimizer();
+  static const int kOptimizerFieldNumber = 1;
+  const ::keras::OptimizerProto& optimizer() const;
+  ::keras::OptimizerProto* release_optimizer();
+  ::keras::OptimizerProto* mutable_optimizer();
+  void set_allocated_optimizer(::keras::OptimizerProto* optimizer);
+
+  // uint32 top_k = 4;
+  void clear_top_k();
+  static const int kTopKFieldNumber = 4;
+  ::google::protobuf::uint32 top_k() const;
+  void set_top_k(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:keras.CompileParamsProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> metrics_;
+  ::google::protobuf::internal::ArenaStringPtr loss_;
+  ::keras::OptimizerProto* optimizer_;
+  ::google::protobuf::uint32 top_k_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsCompileParamsProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class PredictParamsProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.PredictParamsProto) */ {
+ public:
+  PredictParamsProto();
+  virtual ~PredictParamsProto();
+
+  PredictParamsProto(const PredictParamsProto& from);
+
+  inline PredictParamsProto& operator=(const PredictParamsProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  PredictParamsProto(PredictParamsProto&& from) noexcept
+    : PredictParamsProto() {
+    *this = ::std::move(from);
+  }
+
+  inline PredictParamsProto& operator=(PredictParamsProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const PredictParamsProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PredictParamsProto* internal_default_instance() {
+    return reinterpret_cast<const PredictParamsProto*>(
+               &_PredictParamsProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    9;
+
+  void Swap(PredictParamsProto* other);
+  friend void swap(PredictParamsProto& a, PredictParamsProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PredictParamsProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  PredictParamsProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const PredictParamsProto& from);
+  void MergeFrom(const PredictParamsProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(PredictParamsProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string output_layers = 5;
+  int output_layers_size() const;
+  void clear_output_layers();
+  static const int kOutputLayersFieldNumber = 5;
+  const ::std::string& output_layers(int index) const;
+  ::std::string* mutable_output_layers(int index);
+  void set_output_layers(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_output_layers(int index, ::std::string&& value);
+  #endif
+  void set_output_layers(int index, const char* value);
+  void set_output_layers(int index, const char* value, size_t size);
+  ::std::string* add_output_layers();
+  void add_output_layers(const ::std::string& value);
+  #if LANG_CXX11
+  void add_output_layers(::std::string&& value);
+  #endif
+  void add_output_layers(const char* value);
+  void add_output_layers(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& output_layers() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_output_layers();
+
+  // bool no_cache = 1;
+  void clear_no_cache();
+  static const int kNoCacheFieldNumber = 1;
+  bool no_cache() const;
+  void set_no_cache(bool value);
+
+  // uint32 max_batch_size = 2;
+  void clear_max_batch_size();
+  static const int kMaxBatchSizeFieldNumber = 2;
+  ::google::protobuf::uint32 max_batch_size() const;
+  void set_max_batch_size(::google::protobuf::uint32 value);
+
+  // uint32 max_wait_us = 3;
+  void clear_max_wait_us();
+  static const int kMaxWaitUsFieldNumber = 3;
+  ::google::protobuf::uint32 max_wait_us() const;
+  void set_max_wait_us(::google::protobuf::uint32 value);
+
+  // uint32 top_k = 4;
+  void clear_top_k();
+  static const int kTopKFieldNumber = 4;
+  ::google::protobuf::uint32 top_k() const;
+  void set_top_k(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:keras.PredictParamsProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> output_layers_;
+  bool no_cache_;
+  ::google::protobuf::uint32 max_batch_size_;
+  ::google::protobuf::uint32 max_wait_us_;
+  ::google::protobuf::uint32 top_k_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsPredictParamsProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class LearningRateScheduleProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.LearningRateScheduleProto) */ {
+ public:
+  LearningRateScheduleProto();
+  virtual ~LearningRateScheduleProto();
+
+  LearningRateScheduleProto(const LearningRateScheduleProto& from);
+
+  inline LearningRateScheduleProto& operator=(const LearningRateScheduleProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LearningRateScheduleProto(LearningRateScheduleProto&& from) noexcept
+    : LearningRateScheduleProto() {
+    *this = ::std::move(from);
+  }
+
+  inline LearningRateScheduleProto& operator=(LearningRateScheduleProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LearningRateScheduleProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const LearningRateScheduleProto* internal_default_instance() {
+    return reinterpret_cast<const LearningRateScheduleProto*>(
+               &_LearningRateScheduleProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    10;
+
+  void Swap(LearningRateScheduleProto* other);
+  friend void swap(LearningRateScheduleProto& a, LearningRateScheduleProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LearningRateScheduleProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LearningRateScheduleProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LearningRateScheduleProto& from);
+  void MergeFrom(const LearningRateScheduleProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LearningRateScheduleProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string op = 1;
+  void clear_op();
+  static const int kOpFieldNumber = 1;
+  const ::std::string& op() const;
+  void set_op(const ::std::string& value);
+  #if LANG_CXX11
+  void set_op(::std::string&& value);
+  #endif
+  void set_op(const char* value);
+  void set_op(const char* value, size_t size);
+  ::std::string* mutable_op();
+  ::std::string* release_op();
+  void set_allocated_op(::std::string* op);
+
+  // double gamma = 2;
+  void clear_gamma();
+  static const int kGammaFieldNumber = 2;
+  double gamma() const;
+  void set_gamma(double value);
+
+  // uint32 step_size = 3;
+  void clear_step_size();
+  static const int kStepSizeFieldNumber = 3;
+  ::google::protobuf::uint32 step_size() const;
+  void set_step_size(::google::protobuf::uint32 value);
+
+  // uint32 warmup = 4;
+  void clear_warmup();
+  static const int kWarmupFieldNumber = 4;
+  ::google::protobuf::uint32 warmup() const;
+  void set_warmup(::google::protobuf::uint32 value);
+
+  // double min_lr = 5;
+  void clear_min_lr();
+  static const int kMinLrFieldNumber = 5;
+  double min_lr() const;
+  void set_min_lr(double value);
+
+  // bool per_batch = 6;
+  void clear_per_batch();
+  static const int kPerBatchFieldNumber = 6;
+  bool per_batch() const;
+  void set_per_batch(bool value);
+
+  // @@protoc_insertion_point(class_scope:keras.LearningRateScheduleProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr op_;
+  double gamma_;
+  ::google::protobuf::uint32 step_size_;
+  ::google::protobuf::uint32 warmup_;
+  double min_lr_;
+  bool per_batch_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsLearningRateScheduleProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class DistributedParamsProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.DistributedParamsProto) */ {
+ public:
+  DistributedParamsProto();
+  virtual ~DistributedParamsProto();
+
+  DistributedParamsProto(const DistributedParamsProto& from);
+
+  inline DistributedParamsProto& operator=(const DistributedParamsProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DistributedParamsProto(DistributedParamsProto&& from) noexcept
+    : DistributedParamsProto() {
+    *this = ::std::move(from);
+  }
+
+  inline DistributedParamsProto& operator=(DistributedParamsProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DistributedParamsProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DistributedParamsProto* internal_default_instance() {
+    return reinterpret_cast<const DistributedParamsProto*>(
+               &_DistributedParamsProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    11;
+
+  void Swap(DistributedParamsProto* other);
+  friend void swap(DistributedParamsProto& a, DistributedParamsProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DistributedParamsProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DistributedParamsProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DistributedParamsProto& from);
+  void MergeFrom(const DistributedParamsProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DistributedParamsProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string op = 1;
+  void clear_op();
+  static const int kOpFieldNumber = 1;
+  const ::std::string& op() const;
+  void set_op(const ::std::string& value);
+  #if LANG_CXX11
+  void set_op(::std::string&& value);
+  #endif
+  void set_op(const char* value);
+  void set_op(const char* value, size_t size);
+  ::std::string* mutable_op();
+  ::std::string* release_op();
+  void set_allocated_op(::std::string* op);
+
+  // uint64 distribute_after_samples = 2;
+  void clear_distribute_after_samples();
+  static const int kDistributeAfterSamplesFieldNumber = 2;
+  ::google::protobuf::uint64 distribute_after_samples() const;
+  void set_distribute_after_samples(::google::protobuf::uint64 value);
+
+  // uint64 block_size = 3;
+  void clear_block_size();
+  static const int kBlockSizeFieldNumber = 3;
+  ::google::protobuf::uint64 block_size() const;
+  void set_block_size(::google::protobuf::uint64 value);
+
+  // uint32 quantization_bits = 4;
+  void clear_quantization_bits();
+  static const int kQuantizationBitsFieldNumber = 4;
+  ::google::protobuf::uint32 quantization_bits() const;
+  void set_quantization_bits(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:keras.DistributedParamsProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr op_;
+  ::google::protobuf::uint64 distribute_after_samples_;
+  ::google::protobuf::uint64 block_size_;
+  ::google::protobuf::uint32 quantization_bits_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsDistributedParamsProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class CheckpointParamsProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.CheckpointParamsProto) */ {
+ public:
+  CheckpointParamsProto();
+  virtual ~CheckpointParamsProto();
+
+  CheckpointParamsProto(const CheckpointParamsProto& from);
+
+  inline CheckpointParamsProto& operator=(const CheckpointParamsProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CheckpointParamsProto(CheckpointParamsProto&& from) noexcept
+    : CheckpointParamsProto() {
+    *this = ::std::move(from);
+  }
+
+  inline CheckpointParamsProto& operator=(CheckpointParamsProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CheckpointParamsProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CheckpointParamsProto* internal_default_instance() {
+    return reinterpret_cast<const CheckpointParamsProto*>(
+               &_CheckpointParamsProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    12;
+
+  void Swap(CheckpointParamsProto* other);
+  friend void swap(CheckpointParamsProto& a, CheckpointParamsProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CheckpointParamsProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  CheckpointParamsProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const CheckpointParamsProto& from);
+  void MergeFrom(const CheckpointParamsProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(CheckpointParamsProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // string path = 1;
+  void clear_path();
+  static const int kPathFieldNumber = 1;
+  const ::std::string& path() const;
+  void set_path(const ::std::string& value);
+  #if LANG_CXX11
+  void set_path(::std::string&& value);
+  #endif
+  void set_path(const char* value);
+  void set_path(const char* value, size_t size);
+  ::std::string* mutable_path();
+  ::std::string* release_path();
+  void set_allocated_path(::std::string* path);
+
+  // double every_minutes = 3;
+  void clear_every_minutes();
+  static const int kEveryMinutesFieldNumber = 3;
+  double every_minutes() const;
+  void set_every_minutes(double value);
+
+  // uint32 every_batches = 2;
+  void clear_every_batches();
+  static const int kEveryBatchesFieldNumber = 2;
+  ::google::protobuf::uint32 every_batches() const;
+  void set_every_batches(::google::protobuf::uint32 value);
+
+  // bool resume = 4;
+  void clear_resume();
+  static const int kResumeFieldNumber = 4;
+  bool resume() const;
+  void set_resume(bool value);
+
+  // @@protoc_insertion_point(class_scope:keras.CheckpointParamsProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr path_;
+  double every_minutes_;
+  ::google::protobuf::uint32 every_batches_;
+  bool resume_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsCheckpointParamsProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class ProgressParamsProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.ProgressParamsProto) */ {
+ public:
+  ProgressParamsProto();
+  virtual ~ProgressParamsProto();
+
+  ProgressParamsProto(const ProgressParamsProto& from);
+
+  inline ProgressParamsProto& operator=(const ProgressParamsProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  ProgressParamsProto(ProgressParamsProto&& from) noexcept
+    : ProgressParamsProto() {
+    *this = ::std::move(from);
+  }
+
+  inline ProgressParamsProto& operator=(ProgressParamsProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ProgressParamsProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ProgressParamsProto* internal_default_instance() {
+    return reinterpret_cast<const ProgressParamsProto*>(
+               &_ProgressParamsProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    13;
+
+  void Swap(ProgressParamsProto* other);
+  friend void swap(ProgressParamsProto& a, ProgressParamsProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ProgressParamsProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  ProgressParamsProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const ProgressParamsProto& from);
+  void MergeFrom(const ProgressParamsProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(ProgressParamsProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 every_batches = 2;
+  void clear_every_batches();
+  static const int kEveryBatchesFieldNumber = 2;
+  ::google::protobuf::uint32 every_batches() const;
+  void set_every_batches(::google::protobuf::uint32 value);
+
+  // bool async = 1;
+  void clear_async();
+  static const int kAsyncFieldNumber = 1;
+  bool async() const;
+  void set_async(bool value);
+
+  // bool epochs_only = 4;
+  void clear_epochs_only();
+  static const int kEpochsOnlyFieldNumber = 4;
+  bool epochs_only() const;
+  void set_epochs_only(bool value);
+
+  // uint32 every_ms = 3;
+  void clear_every_ms();
+  static const int kEveryMsFieldNumber = 3;
+  ::google::protobuf::uint32 every_ms() const;
+  void set_every_ms(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:keras.ProgressParamsProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::uint32 every_batches_;
+  bool async_;
+  bool epochs_only_;
+  ::google::protobuf::uint32 every_ms_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsProgressParamsProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class CacheStatsProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.CacheStatsProto) */ {
+ public:
+  CacheStatsProto();
+  virtual ~CacheStatsProto();
+
+  CacheStatsProto(const CacheStatsProto& from);
+
+  inline CacheStatsProto& operator=(const CacheStatsProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CacheStatsProto(CacheStatsProto&& from) noexcept
+    : CacheStatsProto() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheStatsProto& operator=(CacheStatsProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CacheStatsProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CacheStatsProto* internal_default_instance() {
+    return reinterpret_cast<const CacheStatsProto*>(
+               &_CacheStatsProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    14;
+
+  void Swap(CacheStatsProto* other);
+  friend void swap(CacheStatsProto& a, CacheStatsProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CacheStatsProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  CacheStatsProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const CacheStatsProto& from);
+  void MergeFrom(const CacheStatsProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(CacheStatsProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint64 hits = 1;
+  void clear_hits();
+  static const int kHitsFieldNumber = 1;
+  ::google::protobuf::uint64 hits() const;
+  void set_hits(::google::protobuf::uint64 value);
+
+  // uint64 misses = 2;
+  void clear_misses();
+  static const int kMissesFieldNumber = 2;
+  ::google::protobuf::uint64 misses() const;
+  void set_misses(::google::protobuf::uint64 value);
+
+  // uint64 evictions = 3;
+  void clear_evictions();
+  static const int kEvictionsFieldNumber = 3;
+  ::google::protobuf::uint64 evictions() const;
+  void set_evictions(::google::protobuf::uint64 value);
+
+  // uint64 models = 4;
+  void clear_models();
+  static const int kModelsFieldNumber = 4;
+  ::google::protobuf::uint64 models() const;
+  void set_models(::google::protobuf::uint64 value);
+
+  // uint64 bytes = 5;
+  void clear_bytes();
+  static const int kBytesFieldNumber = 5;
+  ::google::protobuf::uint64 bytes() const;
+  void set_bytes(::google::protobuf::uint64 value);
+
+  // uint64 budget = 6;
+  void clear_budget();
+  static const int kBudgetFieldNumber = 6;
+  ::google::protobuf::uint64 budget() const;
+  void set_budget(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:keras.CacheStatsProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::uint64 hits_;
+  ::google::protobuf::uint64 misses_;
+  ::google::protobuf::uint64 evictions_;
+  ::google::protobuf::uint64 models_;
+  ::google::protobuf::uint64 bytes_;
+  ::google::protobuf::uint64 budget_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsCacheStatsProtoImpl();
+};
+// -------------------------------------------------------------------
+
+class OutputChunkProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:keras.OutputChunkProto) */ {
+ public:
+  OutputChunkProto();
+  virtual ~OutputChunkProto();
+
+  OutputChunkProto(const OutputChunkProto& from);
+
+  inline OutputChunkProto& operator=(const OutputChunkProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  OutputChunkProto(OutputChunkProto&& from) noexcept
+    : OutputChunkProto() {
+    *this = ::std::move(from);
+  }
+
+  inline OutputChunkProto& operator=(OutputChunkProto&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const OutputChunkProto& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const OutputChunkProto* internal_default_instance() {
+    return reinterpret_cast<const OutputChunkProto*>(
+               &_OutputChunkProto_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    15;
+
+  void Swap(OutputChunkProto* other);
+  friend void swap(OutputChunkProto& a, OutputChunkProto& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline OutputChunkProto* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  OutputChunkProto* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const OutputChunkProto& from);
+  void MergeFrom(const OutputChunkProto& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(OutputChunkProto* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .keras.TensorProto outputs = 2;
+  int outputs_size() const;
+  void clear_outputs();
+  static const int kOutputsFieldNumber = 2;
+  const ::keras::TensorProto& outputs(int index) const;
+  ::keras::TensorProto* mutable_outputs(int index);
+  ::keras::TensorProto* add_outputs();
+  ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >*
+      mutable_outputs();
+  const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
+      outputs() const;
+
+  // uint64 offset = 1;
+  void clear_offset();
+  static const int kOffsetFieldNumber = 1;
+  ::google::protobuf::uint64 offset() const;
+  void set_offset(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:keras.OutputChunkProto)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::keras::TensorProto > outputs_;
+  ::google::protobuf::uint64 offset_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_KerasProto_2eproto::TableStruct;
+  friend void ::protobuf_KerasProto_2eproto::InitDefaultsOutputChunkProtoImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// KerasProto
+
+// string graph = 1;
+inline void KerasProto::clear_graph() {
+  graph_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::graph() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.graph)
+  return graph_.GetNoArena();
+}
+inline void KerasProto::set_graph(const ::std::string& value) {
+  
+  graph_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.graph)
+}
+#if LANG_CXX11
+inline void KerasProto::set_graph(::std::string&& value) {
+  
+  graph_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.graph)
+}
+#endif
+inline void KerasProto::set_graph(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  graph_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.graph)
+}
+inline void KerasProto::set_graph(const char* value, size_t size) {
+  
+  graph_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.graph)
+}
+inline ::std::string* KerasProto::mutable_graph() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.graph)
+  return graph_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_graph() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.graph)
+  
+  return graph_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_graph(::std::string* graph) {
+  if (graph != NULL) {
+    
+  } else {
+    
+  }
+  graph_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), graph);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.graph)
+}
+
+// bytes model = 2;
+inline void KerasProto::clear_model() {
+  model_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::model() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.model)
+  return model_.GetNoArena();
+}
+inline void KerasProto::set_model(const ::std::string& value) {
+  
+  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.model)
+}
+#if LANG_CXX11
+inline void KerasProto::set_model(::std::string&& value) {
+  
+  model_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.model)
+}
+#endif
+inline void KerasProto::set_model(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.model)
+}
+inline void KerasProto::set_model(const void* value, size_t size) {
+  
+  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.model)
+}
+inline ::std::string* KerasProto::mutable_model() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.model)
+  return model_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_model() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.model)
+  
+  return model_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_model(::std::string* model) {
+  if (model != NULL) {
+    
+  } else {
+    
+  }
+  model_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.model)
+}
+
+// string model_path = 3;
+inline void KerasProto::clear_model_path() {
+  model_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::model_path() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.model_path)
+  return model_path_.GetNoArena();
+}
+inline void KerasProto::set_model_path(const ::std::string& value) {
+  
+  model_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.model_path)
+}
+#if LANG_CXX11
+inline void KerasProto::set_model_path(::std::string&& value) {
+  
+  model_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.model_path)
+}
+#endif
+inline void KerasProto::set_model_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  model_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.model_path)
+}
+inline void KerasProto::set_model_path(const char* value, size_t size) {
+  
+  model_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.model_path)
+}
+inline ::std::string* KerasProto::mutable_model_path() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.model_path)
+  return model_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_model_path() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.model_path)
+  
+  return model_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_model_path(::std::string* model_path) {
+  if (model_path != NULL) {
+    
+  } else {
+    
+  }
+  model_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model_path);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.model_path)
+}
+
+// string model_uuid = 4;
+inline void KerasProto::clear_model_uuid() {
+  model_uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::model_uuid() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.model_uuid)
+  return model_uuid_.GetNoArena();
+}
+inline void KerasProto::set_model_uuid(const ::std::string& value) {
+  
+  model_uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.model_uuid)
+}
+#if LANG_CXX11
+inline void KerasProto::set_model_uuid(::std::string&& value) {
+  
+  model_uuid_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.model_uuid)
+}
+#endif
+inline void KerasProto::set_model_uuid(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  model_uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.model_uuid)
+}
+inline void KerasProto::set_model_uuid(const char* value, size_t size) {
+  
+  model_uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.model_uuid)
+}
+inline ::std::string* KerasProto::mutable_model_uuid() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.model_uuid)
+  return model_uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_model_uuid() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.model_uuid)
+  
+  return model_uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_model_uuid(::std::string* model_uuid) {
+  if (model_uuid != NULL) {
+    
+  } else {
+    
+  }
+  model_uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model_uuid);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.model_uuid)
+}
+
+// string compile_params = 5;
+inline void KerasProto::clear_compile_params() {
+  compile_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::compile_params() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.compile_params)
+  return compile_params_.GetNoArena();
+}
+inline void KerasProto::set_compile_params(const ::std::string& value) {
+  
   compile_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
   // @@protoc_insertion_point(field_set:keras.KerasProto.compile_params)
 }
 #if LANG_CXX11
-inline void KerasProto::set_compile_params(::std::string&& value) {
+inline void KerasProto::set_compile_params(::std::string&& value) {
+  
+  compile_params_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.compile_params)
+}
+#endif
+inline void KerasProto::set_compile_params(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  compile_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.compile_params)
+}
+inline void KerasProto::set_compile_params(const char* value, size_t size) {
+  
+  compile_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.compile_params)
+}
+inline ::std::string* KerasProto::mutable_compile_params() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.compile_params)
+  return compile_params_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_compile_params() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.compile_params)
+  
+  return compile_params_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_compile_params(::std::string* compile_params) {
+  if (compile_params != NULL) {
+    
+  } else {
+    
+  }
+  compile_params_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), compile_params);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.compile_params)
+}
+
+// string fit_params = 6;
+inline void KerasProto::clear_fit_params() {
+  fit_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::fit_params() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.fit_params)
+  return fit_params_.GetNoArena();
+}
+inline void KerasProto::set_fit_params(const ::std::string& value) {
+  
+  fit_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.fit_params)
+}
+#if LANG_CXX11
+inline void KerasProto::set_fit_params(::std::string&& value) {
+  
+  fit_params_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.fit_params)
+}
+#endif
+inline void KerasProto::set_fit_params(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  fit_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.fit_params)
+}
+inline void KerasProto::set_fit_params(const char* value, size_t size) {
+  
+  fit_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.fit_params)
+}
+inline ::std::string* KerasProto::mutable_fit_params() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.fit_params)
+  return fit_params_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_fit_params() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.fit_params)
+  
+  return fit_params_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_fit_params(::std::string* fit_params) {
+  if (fit_params != NULL) {
+    
+  } else {
+    
+  }
+  fit_params_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fit_params);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.fit_params)
+}
+
+// string predict_params = 7;
+inline void KerasProto::clear_predict_params() {
+  predict_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::predict_params() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.predict_params)
+  return predict_params_.GetNoArena();
+}
+inline void KerasProto::set_predict_params(const ::std::string& value) {
+  
+  predict_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.predict_params)
+}
+#if LANG_CXX11
+inline void KerasProto::set_predict_params(::std::string&& value) {
+  
+  predict_params_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.predict_params)
+}
+#endif
+inline void KerasProto::set_predict_params(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  predict_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.predict_params)
+}
+inline void KerasProto::set_predict_params(const char* value, size_t size) {
+  
+  predict_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.predict_params)
+}
+inline ::std::string* KerasProto::mutable_predict_params() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.predict_params)
+  return predict_params_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_predict_params() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.predict_params)
+  
+  return predict_params_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_predict_params(::std::string* predict_params) {
+  if (predict_params != NULL) {
+    
+  } else {
+    
+  }
+  predict_params_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), predict_params);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.predict_params)
+}
+
+// string path = 8;
+inline void KerasProto::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::path() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.path)
+  return path_.GetNoArena();
+}
+inline void KerasProto::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.path)
+}
+#if LANG_CXX11
+inline void KerasProto::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.path)
+}
+#endif
+inline void KerasProto::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.path)
+}
+inline void KerasProto::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.path)
+}
+inline ::std::string* KerasProto::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_path() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.path)
+}
+
+// uint32 nsamples = 9;
+inline void KerasProto::clear_nsamples() {
+  nsamples_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::nsamples() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.nsamples)
+  return nsamples_;
+}
+inline void KerasProto::set_nsamples(::google::protobuf::uint32 value) {
+  
+  nsamples_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.nsamples)
+}
+
+// uint32 nfeatures = 10;
+inline void KerasProto::clear_nfeatures() {
+  nfeatures_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::nfeatures() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.nfeatures)
+  return nfeatures_;
+}
+inline void KerasProto::set_nfeatures(::google::protobuf::uint32 value) {
+  
+  nfeatures_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.nfeatures)
+}
+
+// uint32 nlabels = 11;
+inline void KerasProto::clear_nlabels() {
+  nlabels_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::nlabels() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.nlabels)
+  return nlabels_;
+}
+inline void KerasProto::set_nlabels(::google::protobuf::uint32 value) {
+  
+  nlabels_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.nlabels)
+}
+
+// uint32 batch_size = 12;
+inline void KerasProto::clear_batch_size() {
+  batch_size_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::batch_size() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.batch_size)
+  return batch_size_;
+}
+inline void KerasProto::set_batch_size(::google::protobuf::uint32 value) {
+  
+  batch_size_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.batch_size)
+}
+
+// uint32 epochs = 13;
+inline void KerasProto::clear_epochs() {
+  epochs_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::epochs() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.epochs)
+  return epochs_;
+}
+inline void KerasProto::set_epochs(::google::protobuf::uint32 value) {
+  
+  epochs_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.epochs)
+}
+
+// uint32 verbose = 14;
+inline void KerasProto::clear_verbose() {
+  verbose_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::verbose() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.verbose)
+  return verbose_;
+}
+inline void KerasProto::set_verbose(::google::protobuf::uint32 value) {
+  
+  verbose_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.verbose)
+}
+
+// repeated .keras.TensorProto inputs = 15;
+inline int KerasProto::inputs_size() const {
+  return inputs_.size();
+}
+inline void KerasProto::clear_inputs() {
+  inputs_.Clear();
+}
+inline const ::keras::TensorProto& KerasProto::inputs(int index) const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.inputs)
+  return inputs_.Get(index);
+}
+inline ::keras::TensorProto* KerasProto::mutable_inputs(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.inputs)
+  return inputs_.Mutable(index);
+}
+inline ::keras::TensorProto* KerasProto::add_inputs() {
+  // @@protoc_insertion_point(field_add:keras.KerasProto.inputs)
+  return inputs_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >*
+KerasProto::mutable_inputs() {
+  // @@protoc_insertion_point(field_mutable_list:keras.KerasProto.inputs)
+  return &inputs_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
+KerasProto::inputs() const {
+  // @@protoc_insertion_point(field_list:keras.KerasProto.inputs)
+  return inputs_;
+}
+
+// repeated .keras.TensorProto outputs = 16;
+inline int KerasProto::outputs_size() const {
+  return outputs_.size();
+}
+inline void KerasProto::clear_outputs() {
+  outputs_.Clear();
+}
+inline const ::keras::TensorProto& KerasProto::outputs(int index) const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.outputs)
+  return outputs_.Get(index);
+}
+inline ::keras::TensorProto* KerasProto::mutable_outputs(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.outputs)
+  return outputs_.Mutable(index);
+}
+inline ::keras::TensorProto* KerasProto::add_outputs() {
+  // @@protoc_insertion_point(field_add:keras.KerasProto.outputs)
+  return outputs_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >*
+KerasProto::mutable_outputs() {
+  // @@protoc_insertion_point(field_mutable_list:keras.KerasProto.outputs)
+  return &outputs_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
+KerasProto::outputs() const {
+  // @@protoc_insertion_point(field_list:keras.KerasProto.outputs)
+  return outputs_;
+}
+
+// uint64 progress_callback = 17;
+inline void KerasProto::clear_progress_callback() {
+  progress_callback_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 KerasProto::progress_callback() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.progress_callback)
+  return progress_callback_;
+}
+inline void KerasProto::set_progress_callback(::google::protobuf::uint64 value) {
+  
+  progress_callback_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.progress_callback)
+}
+
+// .keras.KerasCommand command = 18;
+inline void KerasProto::clear_command() {
+  command_ = 0;
+}
+inline ::keras::KerasCommand KerasProto::command() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.command)
+  return static_cast< ::keras::KerasCommand >(command_);
+}
+inline void KerasProto::set_command(::keras::KerasCommand value) {
+  
+  command_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.command)
+}
+
+// repeated .keras.LayerProto layers = 19;
+inline int KerasProto::layers_size() const {
+  return layers_.size();
+}
+inline void KerasProto::clear_layers() {
+  layers_.Clear();
+}
+inline const ::keras::LayerProto& KerasProto::layers(int index) const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.layers)
+  return layers_.Get(index);
+}
+inline ::keras::LayerProto* KerasProto::mutable_layers(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.layers)
+  return layers_.Mutable(index);
+}
+inline ::keras::LayerProto* KerasProto::add_layers() {
+  // @@protoc_insertion_point(field_add:keras.KerasProto.layers)
+  return layers_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::keras::LayerProto >*
+KerasProto::mutable_layers() {
+  // @@protoc_insertion_point(field_mutable_list:keras.KerasProto.layers)
+  return &layers_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::keras::LayerProto >&
+KerasProto::layers() const {
+  // @@protoc_insertion_point(field_list:keras.KerasProto.layers)
+  return layers_;
+}
+
+// .keras.CompileParamsProto compile = 20;
+inline bool KerasProto::has_compile() const {
+  return this != internal_default_instance() && compile_ != NULL;
+}
+inline void KerasProto::clear_compile() {
+  if (GetArenaNoVirtual() == NULL && compile_ != NULL) {
+    delete compile_;
+  }
+  compile_ = NULL;
+}
+inline const ::keras::CompileParamsProto& KerasProto::compile() const {
+  const ::keras::CompileParamsProto* p = compile_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.compile)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::CompileParamsProto*>(
+      &::keras::_CompileParamsProto_default_instance_);
+}
+inline ::keras::CompileParamsProto* KerasProto::release_compile() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.compile)
+  
+  ::keras::CompileParamsProto* temp = compile_;
+  compile_ = NULL;
+  return temp;
+}
+inline ::keras::CompileParamsProto* KerasProto::mutable_compile() {
+  
+  if (compile_ == NULL) {
+    compile_ = new ::keras::CompileParamsProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.compile)
+  return compile_;
+}
+inline void KerasProto::set_allocated_compile(::keras::CompileParamsProto* compile) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete compile_;
+  }
+  if (compile) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      compile = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, compile, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  compile_ = compile;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.compile)
+}
+
+// .keras.PredictParamsProto predict = 21;
+inline bool KerasProto::has_predict() const {
+  return this != internal_default_instance() && predict_ != NULL;
+}
+inline void KerasProto::clear_predict() {
+  if (GetArenaNoVirtual() == NULL && predict_ != NULL) {
+    delete predict_;
+  }
+  predict_ = NULL;
+}
+inline const ::keras::PredictParamsProto& KerasProto::predict() const {
+  const ::keras::PredictParamsProto* p = predict_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.predict)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::PredictParamsProto*>(
+      &::keras::_PredictParamsProto_default_instance_);
+}
+inline ::keras::PredictParamsProto* KerasProto::release_predict() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.predict)
+  
+  ::keras::PredictParamsProto* temp = predict_;
+  predict_ = NULL;
+  return temp;
+}
+inline ::keras::PredictParamsProto* KerasProto::mutable_predict() {
+  
+  if (predict_ == NULL) {
+    predict_ = new ::keras::PredictParamsProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.predict)
+  return predict_;
+}
+inline void KerasProto::set_allocated_predict(::keras::PredictParamsProto* predict) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete predict_;
+  }
+  if (predict) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      predict = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, predict, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  predict_ = predict;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.predict)
+}
+
+// uint32 workers = 22;
+inline void KerasProto::clear_workers() {
+  workers_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::workers() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.workers)
+  return workers_;
+}
+inline void KerasProto::set_workers(::google::protobuf::uint32 value) {
+  
+  workers_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.workers)
+}
+
+// string parallel = 23;
+inline void KerasProto::clear_parallel() {
+  parallel_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::parallel() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.parallel)
+  return parallel_.GetNoArena();
+}
+inline void KerasProto::set_parallel(const ::std::string& value) {
+  
+  parallel_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.parallel)
+}
+#if LANG_CXX11
+inline void KerasProto::set_parallel(::std::string&& value) {
+  
+  parallel_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.parallel)
+}
+#endif
+inline void KerasProto::set_parallel(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  parallel_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.parallel)
+}
+inline void KerasProto::set_parallel(const char* value, size_t size) {
+  
+  parallel_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.parallel)
+}
+inline ::std::string* KerasProto::mutable_parallel() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.parallel)
+  return parallel_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_parallel() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.parallel)
+  
+  return parallel_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_parallel(::std::string* parallel) {
+  if (parallel != NULL) {
+    
+  } else {
+    
+  }
+  parallel_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), parallel);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.parallel)
+}
+
+// .keras.DistributedParamsProto distributed = 24;
+inline bool KerasProto::has_distributed() const {
+  return this != internal_default_instance() && distributed_ != NULL;
+}
+inline void KerasProto::clear_distributed() {
+  if (GetArenaNoVirtual() == NULL && distributed_ != NULL) {
+    delete distributed_;
+  }
+  distributed_ = NULL;
+}
+inline const ::keras::DistributedParamsProto& KerasProto::distributed() const {
+  const ::keras::DistributedParamsProto* p = distributed_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.distributed)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::DistributedParamsProto*>(
+      &::keras::_DistributedParamsProto_default_instance_);
+}
+inline ::keras::DistributedParamsProto* KerasProto::release_distributed() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.distributed)
+  
+  ::keras::DistributedParamsProto* temp = distributed_;
+  distributed_ = NULL;
+  return temp;
+}
+inline ::keras::DistributedParamsProto* KerasProto::mutable_distributed() {
+  
+  if (distributed_ == NULL) {
+    distributed_ = new ::keras::DistributedParamsProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.distributed)
+  return distributed_;
+}
+inline void KerasProto::set_allocated_distributed(::keras::DistributedParamsProto* distributed) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete distributed_;
+  }
+  if (distributed) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      distributed = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, distributed, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  distributed_ = distributed;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.distributed)
+}
+
+// uint32 gradient_accumulation_steps = 25;
+inline void KerasProto::clear_gradient_accumulation_steps() {
+  gradient_accumulation_steps_ = 0u;
+}
+inline ::google::protobuf::uint32 KerasProto::gradient_accumulation_steps() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.gradient_accumulation_steps)
+  return gradient_accumulation_steps_;
+}
+inline void KerasProto::set_gradient_accumulation_steps(::google::protobuf::uint32 value) {
+  
+  gradient_accumulation_steps_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.gradient_accumulation_steps)
+}
+
+// .keras.CheckpointParamsProto checkpoint = 26;
+inline bool KerasProto::has_checkpoint() const {
+  return this != internal_default_instance() && checkpoint_ != NULL;
+}
+inline void KerasProto::clear_checkpoint() {
+  if (GetArenaNoVirtual() == NULL && checkpoint_ != NULL) {
+    delete checkpoint_;
+  }
+  checkpoint_ = NULL;
+}
+inline const ::keras::CheckpointParamsProto& KerasProto::checkpoint() const {
+  const ::keras::CheckpointParamsProto* p = checkpoint_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.checkpoint)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::CheckpointParamsProto*>(
+      &::keras::_CheckpointParamsProto_default_instance_);
+}
+inline ::keras::CheckpointParamsProto* KerasProto::release_checkpoint() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.checkpoint)
+  
+  ::keras::CheckpointParamsProto* temp = checkpoint_;
+  checkpoint_ = NULL;
+  return temp;
+}
+inline ::keras::CheckpointParamsProto* KerasProto::mutable_checkpoint() {
+  
+  if (checkpoint_ == NULL) {
+    checkpoint_ = new ::keras::CheckpointParamsProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.checkpoint)
+  return checkpoint_;
+}
+inline void KerasProto::set_allocated_checkpoint(::keras::CheckpointParamsProto* checkpoint) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete checkpoint_;
+  }
+  if (checkpoint) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      checkpoint = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, checkpoint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  checkpoint_ = checkpoint;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.checkpoint)
+}
+
+// repeated string frozen_layers = 27;
+inline int KerasProto::frozen_layers_size() const {
+  return frozen_layers_.size();
+}
+inline void KerasProto::clear_frozen_layers() {
+  frozen_layers_.Clear();
+}
+inline const ::std::string& KerasProto::frozen_layers(int index) const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.frozen_layers)
+  return frozen_layers_.Get(index);
+}
+inline ::std::string* KerasProto::mutable_frozen_layers(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.frozen_layers)
+  return frozen_layers_.Mutable(index);
+}
+inline void KerasProto::set_frozen_layers(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:keras.KerasProto.frozen_layers)
+  frozen_layers_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void KerasProto::set_frozen_layers(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:keras.KerasProto.frozen_layers)
+  frozen_layers_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void KerasProto::set_frozen_layers(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  frozen_layers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.frozen_layers)
+}
+inline void KerasProto::set_frozen_layers(int index, const char* value, size_t size) {
+  frozen_layers_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.frozen_layers)
+}
+inline ::std::string* KerasProto::add_frozen_layers() {
+  // @@protoc_insertion_point(field_add_mutable:keras.KerasProto.frozen_layers)
+  return frozen_layers_.Add();
+}
+inline void KerasProto::add_frozen_layers(const ::std::string& value) {
+  frozen_layers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keras.KerasProto.frozen_layers)
+}
+#if LANG_CXX11
+inline void KerasProto::add_frozen_layers(::std::string&& value) {
+  frozen_layers_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keras.KerasProto.frozen_layers)
+}
+#endif
+inline void KerasProto::add_frozen_layers(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  frozen_layers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keras.KerasProto.frozen_layers)
+}
+inline void KerasProto::add_frozen_layers(const char* value, size_t size) {
+  frozen_layers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keras.KerasProto.frozen_layers)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+KerasProto::frozen_layers() const {
+  // @@protoc_insertion_point(field_list:keras.KerasProto.frozen_layers)
+  return frozen_layers_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+KerasProto::mutable_frozen_layers() {
+  // @@protoc_insertion_point(field_mutable_list:keras.KerasProto.frozen_layers)
+  return &frozen_layers_;
+}
+
+// .keras.ProgressParamsProto progress = 28;
+inline bool KerasProto::has_progress() const {
+  return this != internal_default_instance() && progress_ != NULL;
+}
+inline void KerasProto::clear_progress() {
+  if (GetArenaNoVirtual() == NULL && progress_ != NULL) {
+    delete progress_;
+  }
+  progress_ = NULL;
+}
+inline const ::keras::ProgressParamsProto& KerasProto::progress() const {
+  const ::keras::ProgressParamsProto* p = progress_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.progress)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::ProgressParamsProto*>(
+      &::keras::_ProgressParamsProto_default_instance_);
+}
+inline ::keras::ProgressParamsProto* KerasProto::release_progress() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.progress)
+  
+  ::keras::ProgressParamsProto* temp = progress_;
+  progress_ = NULL;
+  return temp;
+}
+inline ::keras::ProgressParamsProto* KerasProto::mutable_progress() {
+  
+  if (progress_ == NULL) {
+    progress_ = new ::keras::ProgressParamsProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.progress)
+  return progress_;
+}
+inline void KerasProto::set_allocated_progress(::keras::ProgressParamsProto* progress) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete progress_;
+  }
+  if (progress) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      progress = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, progress, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  progress_ = progress;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.progress)
+}
+
+// .keras.HistoryProto evaluation = 29;
+inline bool KerasProto::has_evaluation() const {
+  return this != internal_default_instance() && evaluation_ != NULL;
+}
+inline void KerasProto::clear_evaluation() {
+  if (GetArenaNoVirtual() == NULL && evaluation_ != NULL) {
+    delete evaluation_;
+  }
+  evaluation_ = NULL;
+}
+inline const ::keras::HistoryProto& KerasProto::evaluation() const {
+  const ::keras::HistoryProto* p = evaluation_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.evaluation)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::HistoryProto*>(
+      &::keras::_HistoryProto_default_instance_);
+}
+inline ::keras::HistoryProto* KerasProto::release_evaluation() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.evaluation)
+  
+  ::keras::HistoryProto* temp = evaluation_;
+  evaluation_ = NULL;
+  return temp;
+}
+inline ::keras::HistoryProto* KerasProto::mutable_evaluation() {
+  
+  if (evaluation_ == NULL) {
+    evaluation_ = new ::keras::HistoryProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.evaluation)
+  return evaluation_;
+}
+inline void KerasProto::set_allocated_evaluation(::keras::HistoryProto* evaluation) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete evaluation_;
+  }
+  if (evaluation) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      evaluation = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, evaluation, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  evaluation_ = evaluation;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.evaluation)
+}
+
+// uint64 cache_budget = 30;
+inline void KerasProto::clear_cache_budget() {
+  cache_budget_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 KerasProto::cache_budget() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.cache_budget)
+  return cache_budget_;
+}
+inline void KerasProto::set_cache_budget(::google::protobuf::uint64 value) {
+  
+  cache_budget_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.cache_budget)
+}
+
+// .keras.CacheStatsProto cache_stats = 31;
+inline bool KerasProto::has_cache_stats() const {
+  return this != internal_default_instance() && cache_stats_ != NULL;
+}
+inline void KerasProto::clear_cache_stats() {
+  if (GetArenaNoVirtual() == NULL && cache_stats_ != NULL) {
+    delete cache_stats_;
+  }
+  cache_stats_ = NULL;
+}
+inline const ::keras::CacheStatsProto& KerasProto::cache_stats() const {
+  const ::keras::CacheStatsProto* p = cache_stats_;
+  // @@protoc_insertion_point(field_get:keras.KerasProto.cache_stats)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::CacheStatsProto*>(
+      &::keras::_CacheStatsProto_default_instance_);
+}
+inline ::keras::CacheStatsProto* KerasProto::release_cache_stats() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.cache_stats)
+  
+  ::keras::CacheStatsProto* temp = cache_stats_;
+  cache_stats_ = NULL;
+  return temp;
+}
+inline ::keras::CacheStatsProto* KerasProto::mutable_cache_stats() {
+  
+  if (cache_stats_ == NULL) {
+    cache_stats_ = new ::keras::CacheStatsProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.cache_stats)
+  return cache_stats_;
+}
+inline void KerasProto::set_allocated_cache_stats(::keras::CacheStatsProto* cache_stats) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete cache_stats_;
+  }
+  if (cache_stats) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      cache_stats = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, cache_stats, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  cache_stats_ = cache_stats;
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.cache_stats)
+}
+
+// string cpp_prefix = 32;
+inline void KerasProto::clear_cpp_prefix() {
+  cpp_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::cpp_prefix() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.cpp_prefix)
+  return cpp_prefix_.GetNoArena();
+}
+inline void KerasProto::set_cpp_prefix(const ::std::string& value) {
+  
+  cpp_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.cpp_prefix)
+}
+#if LANG_CXX11
+inline void KerasProto::set_cpp_prefix(::std::string&& value) {
+  
+  cpp_prefix_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.cpp_prefix)
+}
+#endif
+inline void KerasProto::set_cpp_prefix(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  cpp_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.cpp_prefix)
+}
+inline void KerasProto::set_cpp_prefix(const char* value, size_t size) {
+  
+  cpp_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.cpp_prefix)
+}
+inline ::std::string* KerasProto::mutable_cpp_prefix() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.cpp_prefix)
+  return cpp_prefix_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_cpp_prefix() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.cpp_prefix)
+  
+  return cpp_prefix_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_cpp_prefix(::std::string* cpp_prefix) {
+  if (cpp_prefix != NULL) {
+    
+  } else {
+    
+  }
+  cpp_prefix_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), cpp_prefix);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.cpp_prefix)
+}
+
+// string cpp_source = 33;
+inline void KerasProto::clear_cpp_source() {
+  cpp_source_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KerasProto::cpp_source() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.cpp_source)
+  return cpp_source_.GetNoArena();
+}
+inline void KerasProto::set_cpp_source(const ::std::string& value) {
+  
+  cpp_source_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.KerasProto.cpp_source)
+}
+#if LANG_CXX11
+inline void KerasProto::set_cpp_source(::std::string&& value) {
+  
+  cpp_source_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.cpp_source)
+}
+#endif
+inline void KerasProto::set_cpp_source(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  cpp_source_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.KerasProto.cpp_source)
+}
+inline void KerasProto::set_cpp_source(const char* value, size_t size) {
+  
+  cpp_source_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.cpp_source)
+}
+inline ::std::string* KerasProto::mutable_cpp_source() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.KerasProto.cpp_source)
+  return cpp_source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KerasProto::release_cpp_source() {
+  // @@protoc_insertion_point(field_release:keras.KerasProto.cpp_source)
+  
+  return cpp_source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KerasProto::set_allocated_cpp_source(::std::string* cpp_source) {
+  if (cpp_source != NULL) {
+    
+  } else {
+    
+  }
+  cpp_source_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), cpp_source);
+  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.cpp_source)
+}
+
+// uint64 output_callback = 34;
+inline void KerasProto::clear_output_callback() {
+  output_callback_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 KerasProto::output_callback() const {
+  // @@protoc_insertion_point(field_get:keras.KerasProto.output_callback)
+  return output_callback_;
+}
+inline void KerasProto::set_output_callback(::google::protobuf::uint64 value) {
+  
+  output_callback_ = value;
+  // @@protoc_insertion_point(field_set:keras.KerasProto.output_callback)
+}
+
+// -------------------------------------------------------------------
+
+// TensorProto
+
+// .keras.DataType type = 1;
+inline void TensorProto::clear_type() {
+  type_ = 0;
+}
+inline ::keras::DataType TensorProto::type() const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.type)
+  return static_cast< ::keras::DataType >(type_);
+}
+inline void TensorProto::set_type(::keras::DataType value) {
+  
+  type_ = value;
+  // @@protoc_insertion_point(field_set:keras.TensorProto.type)
+}
+
+// .keras.TensorFormat format = 2;
+inline void TensorProto::clear_format() {
+  format_ = 0;
+}
+inline ::keras::TensorFormat TensorProto::format() const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.format)
+  return static_cast< ::keras::TensorFormat >(format_);
+}
+inline void TensorProto::set_format(::keras::TensorFormat value) {
+  
+  format_ = value;
+  // @@protoc_insertion_point(field_set:keras.TensorProto.format)
+}
+
+// int32 count = 3;
+inline void TensorProto::clear_count() {
+  count_ = 0;
+}
+inline ::google::protobuf::int32 TensorProto::count() const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.count)
+  return count_;
+}
+inline void TensorProto::set_count(::google::protobuf::int32 value) {
+  
+  count_ = value;
+  // @@protoc_insertion_point(field_set:keras.TensorProto.count)
+}
+
+// repeated int32 shape = 4;
+inline int TensorProto::shape_size() const {
+  return shape_.size();
+}
+inline void TensorProto::clear_shape() {
+  shape_.Clear();
+}
+inline ::google::protobuf::int32 TensorProto::shape(int index) const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.shape)
+  return shape_.Get(index);
+}
+inline void TensorProto::set_shape(int index, ::google::protobuf::int32 value) {
+  shape_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.TensorProto.shape)
+}
+inline void TensorProto::add_shape(::google::protobuf::int32 value) {
+  shape_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.TensorProto.shape)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TensorProto::shape() const {
+  // @@protoc_insertion_point(field_list:keras.TensorProto.shape)
+  return shape_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TensorProto::mutable_shape() {
+  // @@protoc_insertion_point(field_mutable_list:keras.TensorProto.shape)
+  return &shape_;
+}
+
+// repeated int32 indices = 5;
+inline int TensorProto::indices_size() const {
+  return indices_.size();
+}
+inline void TensorProto::clear_indices() {
+  indices_.Clear();
+}
+inline ::google::protobuf::int32 TensorProto::indices(int index) const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.indices)
+  return indices_.Get(index);
+}
+inline void TensorProto::set_indices(int index, ::google::protobuf::int32 value) {
+  indices_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.TensorProto.indices)
+}
+inline void TensorProto::add_indices(::google::protobuf::int32 value) {
+  indices_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.TensorProto.indices)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TensorProto::indices() const {
+  // @@protoc_insertion_point(field_list:keras.TensorProto.indices)
+  return indices_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TensorProto::mutable_indices() {
+  // @@protoc_insertion_point(field_mutable_list:keras.TensorProto.indices)
+  return &indices_;
+}
+
+// bytes data = 6;
+inline void TensorProto::clear_data() {
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& TensorProto::data() const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.data)
+  return data_.GetNoArena();
+}
+inline void TensorProto::set_data(const ::std::string& value) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.TensorProto.data)
+}
+#if LANG_CXX11
+inline void TensorProto::set_data(::std::string&& value) {
+  
+  data_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.TensorProto.data)
+}
+#endif
+inline void TensorProto::set_data(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.TensorProto.data)
+}
+inline void TensorProto::set_data(const void* value, size_t size) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.TensorProto.data)
+}
+inline ::std::string* TensorProto::mutable_data() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.TensorProto.data)
+  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* TensorProto::release_data() {
+  // @@protoc_insertion_point(field_release:keras.TensorProto.data)
+  
+  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void TensorProto::set_allocated_data(::std::string* data) {
+  if (data != NULL) {
+    
+  } else {
+    
+  }
+  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  // @@protoc_insertion_point(field_set_allocated:keras.TensorProto.data)
+}
+
+// repeated int32 sequence_lengths = 7;
+inline int TensorProto::sequence_lengths_size() const {
+  return sequence_lengths_.size();
+}
+inline void TensorProto::clear_sequence_lengths() {
+  sequence_lengths_.Clear();
+}
+inline ::google::protobuf::int32 TensorProto::sequence_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:keras.TensorProto.sequence_lengths)
+  return sequence_lengths_.Get(index);
+}
+inline void TensorProto::set_sequence_lengths(int index, ::google::protobuf::int32 value) {
+  sequence_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.TensorProto.sequence_lengths)
+}
+inline void TensorProto::add_sequence_lengths(::google::protobuf::int32 value) {
+  sequence_lengths_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.TensorProto.sequence_lengths)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TensorProto::sequence_lengths() const {
+  // @@protoc_insertion_point(field_list:keras.TensorProto.sequence_lengths)
+  return sequence_lengths_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TensorProto::mutable_sequence_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:keras.TensorProto.sequence_lengths)
+  return &sequence_lengths_;
+}
+
+// -------------------------------------------------------------------
+
+// StreamConfigurationProto
+
+// string name = 1;
+inline void StreamConfigurationProto::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& StreamConfigurationProto::name() const {
+  // @@protoc_insertion_point(field_get:keras.StreamConfigurationProto.name)
+  return name_.GetNoArena();
+}
+inline void StreamConfigurationProto::set_name(const ::std::string& value) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.StreamConfigurationProto.name)
+}
+#if LANG_CXX11
+inline void StreamConfigurationProto::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.StreamConfigurationProto.name)
+}
+#endif
+inline void StreamConfigurationProto::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.StreamConfigurationProto.name)
+}
+inline void StreamConfigurationProto::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.StreamConfigurationProto.name)
+}
+inline ::std::string* StreamConfigurationProto::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.StreamConfigurationProto.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* StreamConfigurationProto::release_name() {
+  // @@protoc_insertion_point(field_release:keras.StreamConfigurationProto.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void StreamConfigurationProto::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:keras.StreamConfigurationProto.name)
+}
+
+// int64 dim = 2;
+inline void StreamConfigurationProto::clear_dim() {
+  dim_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 StreamConfigurationProto::dim() const {
+  // @@protoc_insertion_point(field_get:keras.StreamConfigurationProto.dim)
+  return dim_;
+}
+inline void StreamConfigurationProto::set_dim(::google::protobuf::int64 value) {
+  
+  dim_ = value;
+  // @@protoc_insertion_point(field_set:keras.StreamConfigurationProto.dim)
+}
+
+// bool sparse = 3;
+inline void StreamConfigurationProto::clear_sparse() {
+  sparse_ = false;
+}
+inline bool StreamConfigurationProto::sparse() const {
+  // @@protoc_insertion_point(field_get:keras.StreamConfigurationProto.sparse)
+  return sparse_;
+}
+inline void StreamConfigurationProto::set_sparse(bool value) {
+  
+  sparse_ = value;
+  // @@protoc_insertion_point(field_set:keras.StreamConfigurationProto.sparse)
+}
+
+// -------------------------------------------------------------------
+
+// TextDataSourceProto
+
+// string path = 1;
+inline void TextDataSourceProto::clear_path() {
+  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& TextDataSourceProto::path() const {
+  // @@protoc_insertion_point(field_get:keras.TextDataSourceProto.path)
+  return path_.GetNoArena();
+}
+inline void TextDataSourceProto::set_path(const ::std::string& value) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.TextDataSourceProto.path)
+}
+#if LANG_CXX11
+inline void TextDataSourceProto::set_path(::std::string&& value) {
+  
+  path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.TextDataSourceProto.path)
+}
+#endif
+inline void TextDataSourceProto::set_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.TextDataSourceProto.path)
+}
+inline void TextDataSourceProto::set_path(const char* value, size_t size) {
+  
+  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.TextDataSourceProto.path)
+}
+inline ::std::string* TextDataSourceProto::mutable_path() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.TextDataSourceProto.path)
+  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* TextDataSourceProto::release_path() {
+  // @@protoc_insertion_point(field_release:keras.TextDataSourceProto.path)
+  
+  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void TextDataSourceProto::set_allocated_path(::std::string* path) {
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  // @@protoc_insertion_point(field_set_allocated:keras.TextDataSourceProto.path)
+}
+
+// repeated .keras.StreamConfigurationProto streams = 2;
+inline int TextDataSourceProto::streams_size() const {
+  return streams_.size();
+}
+inline void TextDataSourceProto::clear_streams() {
+  streams_.Clear();
+}
+inline const ::keras::StreamConfigurationProto& TextDataSourceProto::streams(int index) const {
+  // @@protoc_insertion_point(field_get:keras.TextDataSourceProto.streams)
+  return streams_.Get(index);
+}
+inline ::keras::StreamConfigurationProto* TextDataSourceProto::mutable_streams(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.TextDataSourceProto.streams)
+  return streams_.Mutable(index);
+}
+inline ::keras::StreamConfigurationProto* TextDataSourceProto::add_streams() {
+  // @@protoc_insertion_point(field_add:keras.TextDataSourceProto.streams)
+  return streams_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::keras::StreamConfigurationProto >*
+TextDataSourceProto::mutable_streams() {
+  // @@protoc_insertion_point(field_mutable_list:keras.TextDataSourceProto.streams)
+  return &streams_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::keras::StreamConfigurationProto >&
+TextDataSourceProto::streams() const {
+  // @@protoc_insertion_point(field_list:keras.TextDataSourceProto.streams)
+  return streams_;
+}
+
+// -------------------------------------------------------------------
+
+// HistoryProto
+
+// .keras.HistoryCallbackType type = 1;
+inline void HistoryProto::clear_type() {
+  type_ = 0;
+}
+inline ::keras::HistoryCallbackType HistoryProto::type() const {
+  // @@protoc_insertion_point(field_get:keras.HistoryProto.type)
+  return static_cast< ::keras::HistoryCallbackType >(type_);
+}
+inline void HistoryProto::set_type(::keras::HistoryCallbackType value) {
+  
+  type_ = value;
+  // @@protoc_insertion_point(field_set:keras.HistoryProto.type)
+}
+
+// uint32 id = 2;
+inline void HistoryProto::clear_id() {
+  id_ = 0u;
+}
+inline ::google::protobuf::uint32 HistoryProto::id() const {
+  // @@protoc_insertion_point(field_get:keras.HistoryProto.id)
+  return id_;
+}
+inline void HistoryProto::set_id(::google::protobuf::uint32 value) {
+  
+  id_ = value;
+  // @@protoc_insertion_point(field_set:keras.HistoryProto.id)
+}
+
+// repeated string names = 3;
+inline int HistoryProto::names_size() const {
+  return names_.size();
+}
+inline void HistoryProto::clear_names() {
+  names_.Clear();
+}
+inline const ::std::string& HistoryProto::names(int index) const {
+  // @@protoc_insertion_point(field_get:keras.HistoryProto.names)
+  return names_.Get(index);
+}
+inline ::std::string* HistoryProto::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.HistoryProto.names)
+  return names_.Mutable(index);
+}
+inline void HistoryProto::set_names(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:keras.HistoryProto.names)
+  names_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void HistoryProto::set_names(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:keras.HistoryProto.names)
+  names_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void HistoryProto::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keras.HistoryProto.names)
+}
+inline void HistoryProto::set_names(int index, const char* value, size_t size) {
+  names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keras.HistoryProto.names)
+}
+inline ::std::string* HistoryProto::add_names() {
+  // @@protoc_insertion_point(field_add_mutable:keras.HistoryProto.names)
+  return names_.Add();
+}
+inline void HistoryProto::add_names(const ::std::string& value) {
+  names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keras.HistoryProto.names)
+}
+#if LANG_CXX11
+inline void HistoryProto::add_names(::std::string&& value) {
+  names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keras.HistoryProto.names)
+}
+#endif
+inline void HistoryProto::add_names(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keras.HistoryProto.names)
+}
+inline void HistoryProto::add_names(const char* value, size_t size) {
+  names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keras.HistoryProto.names)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+HistoryProto::names() const {
+  // @@protoc_insertion_point(field_list:keras.HistoryProto.names)
+  return names_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+HistoryProto::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:keras.HistoryProto.names)
+  return &names_;
+}
+
+// repeated double values = 4;
+inline int HistoryProto::values_size() const {
+  return values_.size();
+}
+inline void HistoryProto::clear_values() {
+  values_.Clear();
+}
+inline double HistoryProto::values(int index) const {
+  // @@protoc_insertion_point(field_get:keras.HistoryProto.values)
+  return values_.Get(index);
+}
+inline void HistoryProto::set_values(int index, double value) {
+  values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.HistoryProto.values)
+}
+inline void HistoryProto::add_values(double value) {
+  values_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.HistoryProto.values)
+}
+inline const ::google::protobuf::RepeatedField< double >&
+HistoryProto::values() const {
+  // @@protoc_insertion_point(field_list:keras.HistoryProto.values)
+  return values_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+HistoryProto::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:keras.HistoryProto.values)
+  return &values_;
+}
+
+// uint64 nsamples = 5;
+inline void HistoryProto::clear_nsamples() {
+  nsamples_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 HistoryProto::nsamples() const {
+  // @@protoc_insertion_point(field_get:keras.HistoryProto.nsamples)
+  return nsamples_;
+}
+inline void HistoryProto::set_nsamples(::google::protobuf::uint64 value) {
+  
+  nsamples_ = value;
+  // @@protoc_insertion_point(field_set:keras.HistoryProto.nsamples)
+}
+
+// -------------------------------------------------------------------
+
+// InitializerProto
+
+// string op = 1;
+inline void InitializerProto::clear_op() {
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& InitializerProto::op() const {
+  // @@protoc_insertion_point(field_get:keras.InitializerProto.op)
+  return op_.GetNoArena();
+}
+inline void InitializerProto::set_op(const ::std::string& value) {
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.InitializerProto.op)
+}
+#if LANG_CXX11
+inline void InitializerProto::set_op(::std::string&& value) {
+  
+  op_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.InitializerProto.op)
+}
+#endif
+inline void InitializerProto::set_op(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.InitializerProto.op)
+}
+inline void InitializerProto::set_op(const char* value, size_t size) {
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.InitializerProto.op)
+}
+inline ::std::string* InitializerProto::mutable_op() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.InitializerProto.op)
+  return op_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* InitializerProto::release_op() {
+  // @@protoc_insertion_point(field_release:keras.InitializerProto.op)
+  
+  return op_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void InitializerProto::set_allocated_op(::std::string* op) {
+  if (op != NULL) {
+    
+  } else {
+    
+  }
+  op_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), op);
+  // @@protoc_insertion_point(field_set_allocated:keras.InitializerProto.op)
+}
+
+// double value = 2;
+inline void InitializerProto::clear_value() {
+  value_ = 0;
+}
+inline double InitializerProto::value() const {
+  // @@protoc_insertion_point(field_get:keras.InitializerProto.value)
+  return value_;
+}
+inline void InitializerProto::set_value(double value) {
+  
+  value_ = value;
+  // @@protoc_insertion_point(field_set:keras.InitializerProto.value)
+}
+
+// double scale = 3;
+inline void InitializerProto::clear_scale() {
+  scale_ = 0;
+}
+inline double InitializerProto::scale() const {
+  // @@protoc_insertion_point(field_get:keras.InitializerProto.scale)
+  return scale_;
+}
+inline void InitializerProto::set_scale(double value) {
+  
+  scale_ = value;
+  // @@protoc_insertion_point(field_set:keras.InitializerProto.scale)
+}
+
+// uint64 seed = 4;
+inline void InitializerProto::clear_seed() {
+  seed_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 InitializerProto::seed() const {
+  // @@protoc_insertion_point(field_get:keras.InitializerProto.seed)
+  return seed_;
+}
+inline void InitializerProto::set_seed(::google::protobuf::uint64 value) {
+  
+  seed_ = value;
+  // @@protoc_insertion_point(field_set:keras.InitializerProto.seed)
+}
+
+// -------------------------------------------------------------------
+
+// LayerProto
+
+// string op = 1;
+inline void LayerProto::clear_op() {
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& LayerProto::op() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.op)
+  return op_.GetNoArena();
+}
+inline void LayerProto::set_op(const ::std::string& value) {
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.op)
+}
+#if LANG_CXX11
+inline void LayerProto::set_op(::std::string&& value) {
+  
+  op_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.LayerProto.op)
+}
+#endif
+inline void LayerProto::set_op(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.LayerProto.op)
+}
+inline void LayerProto::set_op(const char* value, size_t size) {
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.LayerProto.op)
+}
+inline ::std::string* LayerProto::mutable_op() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.op)
+  return op_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LayerProto::release_op() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.op)
+  
+  return op_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LayerProto::set_allocated_op(::std::string* op) {
+  if (op != NULL) {
+    
+  } else {
+    
+  }
+  op_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), op);
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.op)
+}
+
+// string name = 2;
+inline void LayerProto::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& LayerProto::name() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.name)
+  return name_.GetNoArena();
+}
+inline void LayerProto::set_name(const ::std::string& value) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.name)
+}
+#if LANG_CXX11
+inline void LayerProto::set_name(::std::string&& value) {
   
-  compile_params_.SetNoArena(
+  name_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.compile_params)
+  // @@protoc_insertion_point(field_set_rvalue:keras.LayerProto.name)
+}
+#endif
+inline void LayerProto::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.LayerProto.name)
+}
+inline void LayerProto::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.LayerProto.name)
+}
+inline ::std::string* LayerProto::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LayerProto::release_name() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LayerProto::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.name)
+}
+
+// repeated int32 input_shape = 3;
+inline int LayerProto::input_shape_size() const {
+  return input_shape_.size();
+}
+inline void LayerProto::clear_input_shape() {
+  input_shape_.Clear();
+}
+inline ::google::protobuf::int32 LayerProto::input_shape(int index) const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.input_shape)
+  return input_shape_.Get(index);
+}
+inline void LayerProto::set_input_shape(int index, ::google::protobuf::int32 value) {
+  input_shape_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.input_shape)
+}
+inline void LayerProto::add_input_shape(::google::protobuf::int32 value) {
+  input_shape_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.LayerProto.input_shape)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+LayerProto::input_shape() const {
+  // @@protoc_insertion_point(field_list:keras.LayerProto.input_shape)
+  return input_shape_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+LayerProto::mutable_input_shape() {
+  // @@protoc_insertion_point(field_mutable_list:keras.LayerProto.input_shape)
+  return &input_shape_;
+}
+
+// uint32 units = 4;
+inline void LayerProto::clear_units() {
+  units_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::units() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.units)
+  return units_;
+}
+inline void LayerProto::set_units(::google::protobuf::uint32 value) {
+  
+  units_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.units)
+}
+
+// string activation = 5;
+inline void LayerProto::clear_activation() {
+  activation_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& LayerProto::activation() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.activation)
+  return activation_.GetNoArena();
+}
+inline void LayerProto::set_activation(const ::std::string& value) {
+  
+  activation_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.activation)
+}
+#if LANG_CXX11
+inline void LayerProto::set_activation(::std::string&& value) {
+  
+  activation_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.LayerProto.activation)
+}
+#endif
+inline void LayerProto::set_activation(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  activation_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.LayerProto.activation)
+}
+inline void LayerProto::set_activation(const char* value, size_t size) {
+  
+  activation_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.LayerProto.activation)
+}
+inline ::std::string* LayerProto::mutable_activation() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.activation)
+  return activation_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LayerProto::release_activation() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.activation)
+  
+  return activation_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LayerProto::set_allocated_activation(::std::string* activation) {
+  if (activation != NULL) {
+    
+  } else {
+    
+  }
+  activation_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), activation);
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.activation)
+}
+
+// bool use_bias = 6;
+inline void LayerProto::clear_use_bias() {
+  use_bias_ = false;
+}
+inline bool LayerProto::use_bias() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.use_bias)
+  return use_bias_;
+}
+inline void LayerProto::set_use_bias(bool value) {
+  
+  use_bias_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.use_bias)
+}
+
+// .keras.InitializerProto kernel_initializer = 7;
+inline bool LayerProto::has_kernel_initializer() const {
+  return this != internal_default_instance() && kernel_initializer_ != NULL;
+}
+inline void LayerProto::clear_kernel_initializer() {
+  if (GetArenaNoVirtual() == NULL && kernel_initializer_ != NULL) {
+    delete kernel_initializer_;
+  }
+  kernel_initializer_ = NULL;
+}
+inline const ::keras::InitializerProto& LayerProto::kernel_initializer() const {
+  const ::keras::InitializerProto* p = kernel_initializer_;
+  // @@protoc_insertion_point(field_get:keras.LayerProto.kernel_initializer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::InitializerProto*>(
+      &::keras::_InitializerProto_default_instance_);
+}
+inline ::keras::InitializerProto* LayerProto::release_kernel_initializer() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.kernel_initializer)
+  
+  ::keras::InitializerProto* temp = kernel_initializer_;
+  kernel_initializer_ = NULL;
+  return temp;
+}
+inline ::keras::InitializerProto* LayerProto::mutable_kernel_initializer() {
+  
+  if (kernel_initializer_ == NULL) {
+    kernel_initializer_ = new ::keras::InitializerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.kernel_initializer)
+  return kernel_initializer_;
+}
+inline void LayerProto::set_allocated_kernel_initializer(::keras::InitializerProto* kernel_initializer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete kernel_initializer_;
+  }
+  if (kernel_initializer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      kernel_initializer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, kernel_initializer, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  kernel_initializer_ = kernel_initializer;
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.kernel_initializer)
+}
+
+// .keras.InitializerProto bias_initializer = 8;
+inline bool LayerProto::has_bias_initializer() const {
+  return this != internal_default_instance() && bias_initializer_ != NULL;
+}
+inline void LayerProto::clear_bias_initializer() {
+  if (GetArenaNoVirtual() == NULL && bias_initializer_ != NULL) {
+    delete bias_initializer_;
+  }
+  bias_initializer_ = NULL;
+}
+inline const ::keras::InitializerProto& LayerProto::bias_initializer() const {
+  const ::keras::InitializerProto* p = bias_initializer_;
+  // @@protoc_insertion_point(field_get:keras.LayerProto.bias_initializer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::InitializerProto*>(
+      &::keras::_InitializerProto_default_instance_);
+}
+inline ::keras::InitializerProto* LayerProto::release_bias_initializer() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.bias_initializer)
+  
+  ::keras::InitializerProto* temp = bias_initializer_;
+  bias_initializer_ = NULL;
+  return temp;
+}
+inline ::keras::InitializerProto* LayerProto::mutable_bias_initializer() {
+  
+  if (bias_initializer_ == NULL) {
+    bias_initializer_ = new ::keras::InitializerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.bias_initializer)
+  return bias_initializer_;
+}
+inline void LayerProto::set_allocated_bias_initializer(::keras::InitializerProto* bias_initializer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete bias_initializer_;
+  }
+  if (bias_initializer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      bias_initializer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, bias_initializer, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  bias_initializer_ = bias_initializer;
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.bias_initializer)
+}
+
+// uint32 filters = 9;
+inline void LayerProto::clear_filters() {
+  filters_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::filters() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.filters)
+  return filters_;
+}
+inline void LayerProto::set_filters(::google::protobuf::uint32 value) {
+  
+  filters_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.filters)
+}
+
+// repeated int32 kernel_size = 10;
+inline int LayerProto::kernel_size_size() const {
+  return kernel_size_.size();
+}
+inline void LayerProto::clear_kernel_size() {
+  kernel_size_.Clear();
+}
+inline ::google::protobuf::int32 LayerProto::kernel_size(int index) const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.kernel_size)
+  return kernel_size_.Get(index);
+}
+inline void LayerProto::set_kernel_size(int index, ::google::protobuf::int32 value) {
+  kernel_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.kernel_size)
+}
+inline void LayerProto::add_kernel_size(::google::protobuf::int32 value) {
+  kernel_size_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.LayerProto.kernel_size)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+LayerProto::kernel_size() const {
+  // @@protoc_insertion_point(field_list:keras.LayerProto.kernel_size)
+  return kernel_size_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+LayerProto::mutable_kernel_size() {
+  // @@protoc_insertion_point(field_mutable_list:keras.LayerProto.kernel_size)
+  return &kernel_size_;
+}
+
+// repeated int32 strides = 11;
+inline int LayerProto::strides_size() const {
+  return strides_.size();
+}
+inline void LayerProto::clear_strides() {
+  strides_.Clear();
+}
+inline ::google::protobuf::int32 LayerProto::strides(int index) const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.strides)
+  return strides_.Get(index);
+}
+inline void LayerProto::set_strides(int index, ::google::protobuf::int32 value) {
+  strides_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.strides)
+}
+inline void LayerProto::add_strides(::google::protobuf::int32 value) {
+  strides_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.LayerProto.strides)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+LayerProto::strides() const {
+  // @@protoc_insertion_point(field_list:keras.LayerProto.strides)
+  return strides_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+LayerProto::mutable_strides() {
+  // @@protoc_insertion_point(field_mutable_list:keras.LayerProto.strides)
+  return &strides_;
+}
+
+// string padding = 12;
+inline void LayerProto::clear_padding() {
+  padding_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& LayerProto::padding() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.padding)
+  return padding_.GetNoArena();
+}
+inline void LayerProto::set_padding(const ::std::string& value) {
+  
+  padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.padding)
+}
+#if LANG_CXX11
+inline void LayerProto::set_padding(::std::string&& value) {
+  
+  padding_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.LayerProto.padding)
+}
+#endif
+inline void LayerProto::set_padding(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.LayerProto.padding)
+}
+inline void LayerProto::set_padding(const char* value, size_t size) {
+  
+  padding_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.LayerProto.padding)
+}
+inline ::std::string* LayerProto::mutable_padding() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.padding)
+  return padding_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LayerProto::release_padding() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.padding)
+  
+  return padding_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LayerProto::set_allocated_padding(::std::string* padding) {
+  if (padding != NULL) {
+    
+  } else {
+    
+  }
+  padding_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), padding);
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.padding)
+}
+
+// repeated int32 pool_size = 13;
+inline int LayerProto::pool_size_size() const {
+  return pool_size_.size();
+}
+inline void LayerProto::clear_pool_size() {
+  pool_size_.Clear();
+}
+inline ::google::protobuf::int32 LayerProto::pool_size(int index) const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.pool_size)
+  return pool_size_.Get(index);
+}
+inline void LayerProto::set_pool_size(int index, ::google::protobuf::int32 value) {
+  pool_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.pool_size)
+}
+inline void LayerProto::add_pool_size(::google::protobuf::int32 value) {
+  pool_size_.Add(value);
+  // @@protoc_insertion_point(field_add:keras.LayerProto.pool_size)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+LayerProto::pool_size() const {
+  // @@protoc_insertion_point(field_list:keras.LayerProto.pool_size)
+  return pool_size_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+LayerProto::mutable_pool_size() {
+  // @@protoc_insertion_point(field_mutable_list:keras.LayerProto.pool_size)
+  return &pool_size_;
+}
+
+// double rate = 14;
+inline void LayerProto::clear_rate() {
+  rate_ = 0;
+}
+inline double LayerProto::rate() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.rate)
+  return rate_;
+}
+inline void LayerProto::set_rate(double value) {
+  
+  rate_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.rate)
+}
+
+// uint64 seed = 15;
+inline void LayerProto::clear_seed() {
+  seed_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 LayerProto::seed() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.seed)
+  return seed_;
+}
+inline void LayerProto::set_seed(::google::protobuf::uint64 value) {
+  
+  seed_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.seed)
+}
+
+// uint32 input_dim = 16;
+inline void LayerProto::clear_input_dim() {
+  input_dim_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::input_dim() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.input_dim)
+  return input_dim_;
+}
+inline void LayerProto::set_input_dim(::google::protobuf::uint32 value) {
+  
+  input_dim_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.input_dim)
+}
+
+// uint32 output_dim = 17;
+inline void LayerProto::clear_output_dim() {
+  output_dim_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::output_dim() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.output_dim)
+  return output_dim_;
+}
+inline void LayerProto::set_output_dim(::google::protobuf::uint32 value) {
+  
+  output_dim_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.output_dim)
+}
+
+// uint32 input_length = 18;
+inline void LayerProto::clear_input_length() {
+  input_length_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::input_length() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.input_length)
+  return input_length_;
+}
+inline void LayerProto::set_input_length(::google::protobuf::uint32 value) {
+  
+  input_length_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.input_length)
+}
+
+// string recurrent_activation = 19;
+inline void LayerProto::clear_recurrent_activation() {
+  recurrent_activation_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& LayerProto::recurrent_activation() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.recurrent_activation)
+  return recurrent_activation_.GetNoArena();
+}
+inline void LayerProto::set_recurrent_activation(const ::std::string& value) {
+  
+  recurrent_activation_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.LayerProto.recurrent_activation)
+}
+#if LANG_CXX11
+inline void LayerProto::set_recurrent_activation(::std::string&& value) {
+  
+  recurrent_activation_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.LayerProto.recurrent_activation)
+}
+#endif
+inline void LayerProto::set_recurrent_activation(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  recurrent_activation_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.LayerProto.recurrent_activation)
+}
+inline void LayerProto::set_recurrent_activation(const char* value, size_t size) {
+  
+  recurrent_activation_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.LayerProto.recurrent_activation)
+}
+inline ::std::string* LayerProto::mutable_recurrent_activation() {
+  
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.recurrent_activation)
+  return recurrent_activation_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LayerProto::release_recurrent_activation() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.recurrent_activation)
+  
+  return recurrent_activation_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LayerProto::set_allocated_recurrent_activation(::std::string* recurrent_activation) {
+  if (recurrent_activation != NULL) {
+    
+  } else {
+    
+  }
+  recurrent_activation_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), recurrent_activation);
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.recurrent_activation)
+}
+
+// .keras.InitializerProto recurrent_initializer = 20;
+inline bool LayerProto::has_recurrent_initializer() const {
+  return this != internal_default_instance() && recurrent_initializer_ != NULL;
+}
+inline void LayerProto::clear_recurrent_initializer() {
+  if (GetArenaNoVirtual() == NULL && recurrent_initializer_ != NULL) {
+    delete recurrent_initializer_;
+  }
+  recurrent_initializer_ = NULL;
+}
+inline const ::keras::InitializerProto& LayerProto::recurrent_initializer() const {
+  const ::keras::InitializerProto* p = recurrent_initializer_;
+  // @@protoc_insertion_point(field_get:keras.LayerProto.recurrent_initializer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::InitializerProto*>(
+      &::keras::_InitializerProto_default_instance_);
+}
+inline ::keras::InitializerProto* LayerProto::release_recurrent_initializer() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.recurrent_initializer)
+  
+  ::keras::InitializerProto* temp = recurrent_initializer_;
+  recurrent_initializer_ = NULL;
+  return temp;
+}
+inline ::keras::InitializerProto* LayerProto::mutable_recurrent_initializer() {
+  
+  if (recurrent_initializer_ == NULL) {
+    recurrent_initializer_ = new ::keras::InitializerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.recurrent_initializer)
+  return recurrent_initializer_;
+}
+inline void LayerProto::set_allocated_recurrent_initializer(::keras::InitializerProto* recurrent_initializer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete recurrent_initializer_;
+  }
+  if (recurrent_initializer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      recurrent_initializer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, recurrent_initializer, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  recurrent_initializer_ = recurrent_initializer;
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.recurrent_initializer)
+}
+
+// bool unit_forget_bias = 21;
+inline void LayerProto::clear_unit_forget_bias() {
+  unit_forget_bias_ = false;
+}
+inline bool LayerProto::unit_forget_bias() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.unit_forget_bias)
+  return unit_forget_bias_;
+}
+inline void LayerProto::set_unit_forget_bias(bool value) {
+  
+  unit_forget_bias_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.unit_forget_bias)
+}
+
+// bool return_sequences = 22;
+inline void LayerProto::clear_return_sequences() {
+  return_sequences_ = false;
+}
+inline bool LayerProto::return_sequences() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.return_sequences)
+  return return_sequences_;
+}
+inline void LayerProto::set_return_sequences(bool value) {
+  
+  return_sequences_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.return_sequences)
+}
+
+// bool go_backwards = 23;
+inline void LayerProto::clear_go_backwards() {
+  go_backwards_ = false;
+}
+inline bool LayerProto::go_backwards() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.go_backwards)
+  return go_backwards_;
+}
+inline void LayerProto::set_go_backwards(bool value) {
+  
+  go_backwards_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.go_backwards)
+}
+
+// double dropout = 24;
+inline void LayerProto::clear_dropout() {
+  dropout_ = 0;
+}
+inline double LayerProto::dropout() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.dropout)
+  return dropout_;
 }
-#endif
-inline void KerasProto::set_compile_params(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline void LayerProto::set_dropout(double value) {
   
-  compile_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.compile_params)
+  dropout_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.dropout)
 }
-inline void KerasProto::set_compile_params(const char* value, size_t size) {
+
+// double recurrent_dropout = 25;
+inline void LayerProto::clear_recurrent_dropout() {
+  recurrent_dropout_ = 0;
+}
+inline double LayerProto::recurrent_dropout() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.recurrent_dropout)
+  return recurrent_dropout_;
+}
+inline void LayerProto::set_recurrent_dropout(double value) {
   
-  compile_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.compile_params)
+  recurrent_dropout_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.recurrent_dropout)
 }
-inline ::std::string* KerasProto::mutable_compile_params() {
+
+// .keras.InitializerProto embeddings_initializer = 26;
+inline bool LayerProto::has_embeddings_initializer() const {
+  return this != internal_default_instance() && embeddings_initializer_ != NULL;
+}
+inline void LayerProto::clear_embeddings_initializer() {
+  if (GetArenaNoVirtual() == NULL && embeddings_initializer_ != NULL) {
+    delete embeddings_initializer_;
+  }
+  embeddings_initializer_ = NULL;
+}
+inline const ::keras::InitializerProto& LayerProto::embeddings_initializer() const {
+  const ::keras::InitializerProto* p = embeddings_initializer_;
+  // @@protoc_insertion_point(field_get:keras.LayerProto.embeddings_initializer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::InitializerProto*>(
+      &::keras::_InitializerProto_default_instance_);
+}
+inline ::keras::InitializerProto* LayerProto::release_embeddings_initializer() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.embeddings_initializer)
   
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.compile_params)
-  return compile_params_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::keras::InitializerProto* temp = embeddings_initializer_;
+  embeddings_initializer_ = NULL;
+  return temp;
 }
-inline ::std::string* KerasProto::release_compile_params() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.compile_params)
+inline ::keras::InitializerProto* LayerProto::mutable_embeddings_initializer() {
   
-  return compile_params_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (embeddings_initializer_ == NULL) {
+    embeddings_initializer_ = new ::keras::InitializerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.embeddings_initializer)
+  return embeddings_initializer_;
 }
-inline void KerasProto::set_allocated_compile_params(::std::string* compile_params) {
-  if (compile_params != NULL) {
+inline void LayerProto::set_allocated_embeddings_initializer(::keras::InitializerProto* embeddings_initializer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete embeddings_initializer_;
+  }
+  if (embeddings_initializer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      embeddings_initializer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, embeddings_initializer, submessage_arena);
+    }
     
   } else {
     
   }
-  compile_params_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), compile_params);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.compile_params)
+  embeddings_initializer_ = embeddings_initializer;
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.embeddings_initializer)
 }
 
-// string fit_params = 6;
-inline void KerasProto::clear_fit_params() {
-  fit_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bool mask_zero = 27;
+inline void LayerProto::clear_mask_zero() {
+  mask_zero_ = false;
 }
-inline const ::std::string& KerasProto::fit_params() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.fit_params)
-  return fit_params_.GetNoArena();
+inline bool LayerProto::mask_zero() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.mask_zero)
+  return mask_zero_;
 }
-inline void KerasProto::set_fit_params(const ::std::string& value) {
+inline void LayerProto::set_mask_zero(bool value) {
   
-  fit_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.fit_params)
+  mask_zero_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.mask_zero)
 }
-#if LANG_CXX11
-inline void KerasProto::set_fit_params(::std::string&& value) {
+
+// uint32 hash_buckets = 28;
+inline void LayerProto::clear_hash_buckets() {
+  hash_buckets_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::hash_buckets() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.hash_buckets)
+  return hash_buckets_;
+}
+inline void LayerProto::set_hash_buckets(::google::protobuf::uint32 value) {
   
-  fit_params_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.fit_params)
+  hash_buckets_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.hash_buckets)
 }
-#endif
-inline void KerasProto::set_fit_params(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+
+// uint32 num_hashes = 29;
+inline void LayerProto::clear_num_hashes() {
+  num_hashes_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::num_hashes() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.num_hashes)
+  return num_hashes_;
+}
+inline void LayerProto::set_num_hashes(::google::protobuf::uint32 value) {
   
-  fit_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.fit_params)
+  num_hashes_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.num_hashes)
 }
-inline void KerasProto::set_fit_params(const char* value, size_t size) {
+
+// uint32 groups = 30;
+inline void LayerProto::clear_groups() {
+  groups_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::groups() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.groups)
+  return groups_;
+}
+inline void LayerProto::set_groups(::google::protobuf::uint32 value) {
   
-  fit_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.fit_params)
+  groups_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.groups)
 }
-inline ::std::string* KerasProto::mutable_fit_params() {
+
+// uint32 depth_multiplier = 31;
+inline void LayerProto::clear_depth_multiplier() {
+  depth_multiplier_ = 0u;
+}
+inline ::google::protobuf::uint32 LayerProto::depth_multiplier() const {
+  // @@protoc_insertion_point(field_get:keras.LayerProto.depth_multiplier)
+  return depth_multiplier_;
+}
+inline void LayerProto::set_depth_multiplier(::google::protobuf::uint32 value) {
   
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.fit_params)
-  return fit_params_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  depth_multiplier_ = value;
+  // @@protoc_insertion_point(field_set:keras.LayerProto.depth_multiplier)
 }
-inline ::std::string* KerasProto::release_fit_params() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.fit_params)
+
+// .keras.InitializerProto depthwise_initializer = 32;
+inline bool LayerProto::has_depthwise_initializer() const {
+  return this != internal_default_instance() && depthwise_initializer_ != NULL;
+}
+inline void LayerProto::clear_depthwise_initializer() {
+  if (GetArenaNoVirtual() == NULL && depthwise_initializer_ != NULL) {
+    delete depthwise_initializer_;
+  }
+  depthwise_initializer_ = NULL;
+}
+inline const ::keras::InitializerProto& LayerProto::depthwise_initializer() const {
+  const ::keras::InitializerProto* p = depthwise_initializer_;
+  // @@protoc_insertion_point(field_get:keras.LayerProto.depthwise_initializer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::InitializerProto*>(
+      &::keras::_InitializerProto_default_instance_);
+}
+inline ::keras::InitializerProto* LayerProto::release_depthwise_initializer() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.depthwise_initializer)
   
-  return fit_params_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::keras::InitializerProto* temp = depthwise_initializer_;
+  depthwise_initializer_ = NULL;
+  return temp;
 }
-inline void KerasProto::set_allocated_fit_params(::std::string* fit_params) {
-  if (fit_params != NULL) {
+inline ::keras::InitializerProto* LayerProto::mutable_depthwise_initializer() {
+  
+  if (depthwise_initializer_ == NULL) {
+    depthwise_initializer_ = new ::keras::InitializerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.depthwise_initializer)
+  return depthwise_initializer_;
+}
+inline void LayerProto::set_allocated_depthwise_initializer(::keras::InitializerProto* depthwise_initializer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete depthwise_initializer_;
+  }
+  if (depthwise_initializer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      depthwise_initializer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, depthwise_initializer, submessage_arena);
+    }
     
   } else {
     
   }
-  fit_params_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fit_params);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.fit_params)
+  depthwise_initializer_ = depthwise_initializer;
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.depthwise_initializer)
 }
 
-// string predict_params = 7;
-inline void KerasProto::clear_predict_params() {
-  predict_params_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .keras.InitializerProto pointwise_initializer = 33;
+inline bool LayerProto::has_pointwise_initializer() const {
+  return this != internal_default_instance() && pointwise_initializer_ != NULL;
 }
-inline const ::std::string& KerasProto::predict_params() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.predict_params)
-  return predict_params_.GetNoArena();
+inline void LayerProto::clear_pointwise_initializer() {
+  if (GetArenaNoVirtual() == NULL && pointwise_initializer_ != NULL) {
+    delete pointwise_initializer_;
+  }
+  pointwise_initializer_ = NULL;
 }
-inline void KerasProto::set_predict_params(const ::std::string& value) {
+inline const ::keras::InitializerProto& LayerProto::pointwise_initializer() const {
+  const ::keras::InitializerProto* p = pointwise_initializer_;
+  // @@protoc_insertion_point(field_get:keras.LayerProto.pointwise_initializer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::InitializerProto*>(
+      &::keras::_InitializerProto_default_instance_);
+}
+inline ::keras::InitializerProto* LayerProto::release_pointwise_initializer() {
+  // @@protoc_insertion_point(field_release:keras.LayerProto.pointwise_initializer)
   
-  predict_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.predict_params)
+  ::keras::InitializerProto* temp = pointwise_initializer_;
+  pointwise_initializer_ = NULL;
+  return temp;
+}
+inline ::keras::InitializerProto* LayerProto::mutable_pointwise_initializer() {
+  
+  if (pointwise_initializer_ == NULL) {
+    pointwise_initializer_ = new ::keras::InitializerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.LayerProto.pointwise_initializer)
+  return pointwise_initializer_;
+}
+inline void LayerProto::set_allocated_pointwise_initializer(::keras::InitializerProto* pointwise_initializer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete pointwise_initializer_;
+  }
+  if (pointwise_initializer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      pointwise_initializer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, pointwise_initializer, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  pointwise_initializer_ = pointwise_initializer;
+  // @@protoc_insertion_point(field_set_allocated:keras.LayerProto.pointwise_initializer)
+}
+
+// -------------------------------------------------------------------
+
+// OptimizerProto
+
+// string op = 1;
+inline void OptimizerProto::clear_op() {
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& OptimizerProto::op() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.op)
+  return op_.GetNoArena();
+}
+inline void OptimizerProto::set_op(const ::std::string& value) {
+  
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.op)
 }
 #if LANG_CXX11
-inline void KerasProto::set_predict_params(::std::string&& value) {
+inline void OptimizerProto::set_op(::std::string&& value) {
   
-  predict_params_.SetNoArena(
+  op_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.predict_params)
+  // @@protoc_insertion_point(field_set_rvalue:keras.OptimizerProto.op)
 }
 #endif
-inline void KerasProto::set_predict_params(const char* value) {
+inline void OptimizerProto::set_op(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  predict_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.predict_params)
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.OptimizerProto.op)
 }
-inline void KerasProto::set_predict_params(const char* value, size_t size) {
+inline void OptimizerProto::set_op(const char* value, size_t size) {
   
-  predict_params_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.predict_params)
+  // @@protoc_insertion_point(field_set_pointer:keras.OptimizerProto.op)
 }
-inline ::std::string* KerasProto::mutable_predict_params() {
+inline ::std::string* OptimizerProto::mutable_op() {
   
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.predict_params)
-  return predict_params_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:keras.OptimizerProto.op)
+  return op_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* KerasProto::release_predict_params() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.predict_params)
+inline ::std::string* OptimizerProto::release_op() {
+  // @@protoc_insertion_point(field_release:keras.OptimizerProto.op)
   
-  return predict_params_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return op_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void KerasProto::set_allocated_predict_params(::std::string* predict_params) {
-  if (predict_params != NULL) {
+inline void OptimizerProto::set_allocated_op(::std::string* op) {
+  if (op != NULL) {
     
   } else {
     
   }
-  predict_params_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), predict_params);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.predict_params)
+  op_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), op);
+  // @@protoc_insertion_point(field_set_allocated:keras.OptimizerProto.op)
 }
 
-// string path = 8;
-inline void KerasProto::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// double lr = 2;
+inline void OptimizerProto::clear_lr() {
+  lr_ = 0;
 }
-inline const ::std::string& KerasProto::path() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.path)
-  return path_.GetNoArena();
+inline double OptimizerProto::lr() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.lr)
+  return lr_;
 }
-inline void KerasProto::set_path(const ::std::string& value) {
+inline void OptimizerProto::set_lr(double value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.KerasProto.path)
+  lr_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.lr)
 }
-#if LANG_CXX11
-inline void KerasProto::set_path(::std::string&& value) {
+
+// double momentum = 3;
+inline void OptimizerProto::clear_momentum() {
+  momentum_ = 0;
+}
+inline double OptimizerProto::momentum() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.momentum)
+  return momentum_;
+}
+inline void OptimizerProto::set_momentum(double value) {
   
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.KerasProto.path)
+  momentum_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.momentum)
 }
-#endif
-inline void KerasProto::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+
+// double decay = 4;
+inline void OptimizerProto::clear_decay() {
+  decay_ = 0;
+}
+inline double OptimizerProto::decay() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.decay)
+  return decay_;
+}
+inline void OptimizerProto::set_decay(double value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.KerasProto.path)
+  decay_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.decay)
 }
-inline void KerasProto::set_path(const char* value, size_t size) {
+
+// bool nesterov = 5;
+inline void OptimizerProto::clear_nesterov() {
+  nesterov_ = false;
+}
+inline bool OptimizerProto::nesterov() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.nesterov)
+  return nesterov_;
+}
+inline void OptimizerProto::set_nesterov(bool value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.KerasProto.path)
+  nesterov_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.nesterov)
 }
-inline ::std::string* KerasProto::mutable_path() {
+
+// double rho = 6;
+inline void OptimizerProto::clear_rho() {
+  rho_ = 0;
+}
+inline double OptimizerProto::rho() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.rho)
+  return rho_;
+}
+inline void OptimizerProto::set_rho(double value) {
   
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  rho_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.rho)
 }
-inline ::std::string* KerasProto::release_path() {
-  // @@protoc_insertion_point(field_release:keras.KerasProto.path)
+
+// double epsilon = 7;
+inline void OptimizerProto::clear_epsilon() {
+  epsilon_ = 0;
+}
+inline double OptimizerProto::epsilon() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.epsilon)
+  return epsilon_;
+}
+inline void OptimizerProto::set_epsilon(double value) {
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  epsilon_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.epsilon)
 }
-inline void KerasProto::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
-    
-  } else {
-    
-  }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:keras.KerasProto.path)
+
+// double beta_1 = 8;
+inline void OptimizerProto::clear_beta_1() {
+  beta_1_ = 0;
+}
+inline double OptimizerProto::beta_1() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.beta_1)
+  return beta_1_;
+}
+inline void OptimizerProto::set_beta_1(double value) {
+  
+  beta_1_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.beta_1)
 }
 
-// uint32 nsamples = 9;
-inline void KerasProto::clear_nsamples() {
-  nsamples_ = 0u;
+// double beta_2 = 9;
+inline void OptimizerProto::clear_beta_2() {
+  beta_2_ = 0;
 }
-inline ::google::protobuf::uint32 KerasProto::nsamples() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.nsamples)
-  return nsamples_;
+inline double OptimizerProto::beta_2() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.beta_2)
+  return beta_2_;
 }
-inline void KerasProto::set_nsamples(::google::protobuf::uint32 value) {
+inline void OptimizerProto::set_beta_2(double value) {
   
-  nsamples_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.nsamples)
+  beta_2_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.beta_2)
 }
 
-// uint32 nfeatures = 10;
-inline void KerasProto::clear_nfeatures() {
-  nfeatures_ = 0u;
+// double weight_decay = 10;
+inline void OptimizerProto::clear_weight_decay() {
+  weight_decay_ = 0;
 }
-inline ::google::protobuf::uint32 KerasProto::nfeatures() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.nfeatures)
-  return nfeatures_;
+inline double OptimizerProto::weight_decay() const {
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.weight_decay)
+  return weight_decay_;
 }
-inline void KerasProto::set_nfeatures(::google::protobuf::uint32 value) {
+inline void OptimizerProto::set_weight_decay(double value) {
   
-  nfeatures_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.nfeatures)
+  weight_decay_ = value;
+  // @@protoc_insertion_point(field_set:keras.OptimizerProto.weight_decay)
 }
 
-// uint32 nlabels = 11;
-inline void KerasProto::clear_nlabels() {
-  nlabels_ = 0u;
+// .keras.LearningRateScheduleProto schedule = 11;
+inline bool OptimizerProto::has_schedule() const {
+  return this != internal_default_instance() && schedule_ != NULL;
 }
-inline ::google::protobuf::uint32 KerasProto::nlabels() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.nlabels)
-  return nlabels_;
+inline void OptimizerProto::clear_schedule() {
+  if (GetArenaNoVirtual() == NULL && schedule_ != NULL) {
+    delete schedule_;
+  }
+  schedule_ = NULL;
 }
-inline void KerasProto::set_nlabels(::google::protobuf::uint32 value) {
+inline const ::keras::LearningRateScheduleProto& OptimizerProto::schedule() const {
+  const ::keras::LearningRateScheduleProto* p = schedule_;
+  // @@protoc_insertion_point(field_get:keras.OptimizerProto.schedule)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::LearningRateScheduleProto*>(
+      &::keras::_LearningRateScheduleProto_default_instance_);
+}
+inline ::keras::LearningRateScheduleProto* OptimizerProto::release_schedule() {
+  // @@protoc_insertion_point(field_release:keras.OptimizerProto.schedule)
   
-  nlabels_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.nlabels)
+  ::keras::LearningRateScheduleProto* temp = schedule_;
+  schedule_ = NULL;
+  return temp;
+}
+inline ::keras::LearningRateScheduleProto* OptimizerProto::mutable_schedule() {
+  
+  if (schedule_ == NULL) {
+    schedule_ = new ::keras::LearningRateScheduleProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.OptimizerProto.schedule)
+  return schedule_;
+}
+inline void OptimizerProto::set_allocated_schedule(::keras::LearningRateScheduleProto* schedule) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete schedule_;
+  }
+  if (schedule) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      schedule = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, schedule, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  schedule_ = schedule;
+  // @@protoc_insertion_point(field_set_allocated:keras.OptimizerProto.schedule)
 }
 
-// uint32 batch_size = 12;
-inline void KerasProto::clear_batch_size() {
-  batch_size_ = 0u;
+// -------------------------------------------------------------------
+
+// CompileParamsProto
+
+// .keras.OptimizerProto optimizer = 1;
+inline bool CompileParamsProto::has_optimizer() const {
+  return this != internal_default_instance() && optimizer_ != NULL;
 }
-inline ::google::protobuf::uint32 KerasProto::batch_size() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.batch_size)
-  return batch_size_;
+inline void CompileParamsProto::clear_optimizer() {
+  if (GetArenaNoVirtual() == NULL && optimizer_ != NULL) {
+    delete optimizer_;
+  }
+  optimizer_ = NULL;
 }
-inline void KerasProto::set_batch_size(::google::protobuf::uint32 value) {
+inline const ::keras::OptimizerProto& CompileParamsProto::optimizer() const {
+  const ::keras::OptimizerProto* p = optimizer_;
+  // @@protoc_insertion_point(field_get:keras.CompileParamsProto.optimizer)
+  return p != NULL ? *p : *reinterpret_cast<const ::keras::OptimizerProto*>(
+      &::keras::_OptimizerProto_default_instance_);
+}
+inline ::keras::OptimizerProto* CompileParamsProto::release_optimizer() {
+  // @@protoc_insertion_point(field_release:keras.CompileParamsProto.optimizer)
   
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.batch_size)
+  ::keras::OptimizerProto* temp = optimizer_;
+  optimizer_ = NULL;
+  return temp;
+}
+inline ::keras::OptimizerProto* CompileParamsProto::mutable_optimizer() {
+  
+  if (optimizer_ == NULL) {
+    optimizer_ = new ::keras::OptimizerProto;
+  }
+  // @@protoc_insertion_point(field_mutable:keras.CompileParamsProto.optimizer)
+  return optimizer_;
+}
+inline void CompileParamsProto::set_allocated_optimizer(::keras::OptimizerProto* optimizer) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete optimizer_;
+  }
+  if (optimizer) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      optimizer = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, optimizer, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optimizer_ = optimizer;
+  // @@protoc_insertion_point(field_set_allocated:keras.CompileParamsProto.optimizer)
 }
 
-// uint32 epochs = 13;
-inline void KerasProto::clear_epochs() {
-  epochs_ = 0u;
+// string loss = 2;
+inline void CompileParamsProto::clear_loss() {
+  loss_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& CompileParamsProto::loss() const {
+  // @@protoc_insertion_point(field_get:keras.CompileParamsProto.loss)
+  return loss_.GetNoArena();
 }
-inline ::google::protobuf::uint32 KerasProto::epochs() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.epochs)
-  return epochs_;
+inline void CompileParamsProto::set_loss(const ::std::string& value) {
+  
+  loss_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.CompileParamsProto.loss)
 }
-inline void KerasProto::set_epochs(::google::protobuf::uint32 value) {
+#if LANG_CXX11
+inline void CompileParamsProto::set_loss(::std::string&& value) {
   
-  epochs_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.epochs)
+  loss_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:keras.CompileParamsProto.loss)
 }
-
-// uint32 verbose = 14;
-inline void KerasProto::clear_verbose() {
-  verbose_ = 0u;
+#endif
+inline void CompileParamsProto::set_loss(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  loss_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.CompileParamsProto.loss)
 }
-inline ::google::protobuf::uint32 KerasProto::verbose() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.verbose)
-  return verbose_;
+inline void CompileParamsProto::set_loss(const char* value, size_t size) {
+  
+  loss_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:keras.CompileParamsProto.loss)
 }
-inline void KerasProto::set_verbose(::google::protobuf::uint32 value) {
+inline ::std::string* CompileParamsProto::mutable_loss() {
   
-  verbose_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.verbose)
+  // @@protoc_insertion_point(field_mutable:keras.CompileParamsProto.loss)
+  return loss_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-
-// repeated .keras.TensorProto inputs = 15;
-inline int KerasProto::inputs_size() const {
-  return inputs_.size();
+inline ::std::string* CompileParamsProto::release_loss() {
+  // @@protoc_insertion_point(field_release:keras.CompileParamsProto.loss)
+  
+  return loss_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void KerasProto::clear_inputs() {
-  inputs_.Clear();
+inline void CompileParamsProto::set_allocated_loss(::std::string* loss) {
+  if (loss != NULL) {
+    
+  } else {
+    
+  }
+  loss_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), loss);
+  // @@protoc_insertion_point(field_set_allocated:keras.CompileParamsProto.loss)
 }
-inline const ::keras::TensorProto& KerasProto::inputs(int index) const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.inputs)
-  return inputs_.Get(index);
+
+// repeated string metrics = 3;
+inline int CompileParamsProto::metrics_size() const {
+  return metrics_.size();
 }
-inline ::keras::TensorProto* KerasProto::mutable_inputs(int index) {
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.inputs)
-  return inputs_.Mutable(index);
+inline void CompileParamsProto::clear_metrics() {
+  metrics_.Clear();
 }
-inline ::keras::TensorProto* KerasProto::add_inputs() {
-  // @@protoc_insertion_point(field_add:keras.KerasProto.inputs)
-  return inputs_.Add();
+inline const ::std::string& CompileParamsProto::metrics(int index) const {
+  // @@protoc_insertion_point(field_get:keras.CompileParamsProto.metrics)
+  return metrics_.Get(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >*
-KerasProto::mutable_inputs() {
-  // @@protoc_insertion_point(field_mutable_list:keras.KerasProto.inputs)
-  return &inputs_;
+inline ::std::string* CompileParamsProto::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.CompileParamsProto.metrics)
+  return metrics_.Mutable(index);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
-KerasProto::inputs() const {
-  // @@protoc_insertion_point(field_list:keras.KerasProto.inputs)
-  return inputs_;
+inline void CompileParamsProto::set_metrics(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:keras.CompileParamsProto.metrics)
+  metrics_.Mutable(index)->assign(value);
 }
-
-// repeated .keras.TensorProto outputs = 16;
-inline int KerasProto::outputs_size() const {
-  return outputs_.size();
+#if LANG_CXX11
+inline void CompileParamsProto::set_metrics(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:keras.CompileParamsProto.metrics)
+  metrics_.Mutable(index)->assign(std::move(value));
 }
-inline void KerasProto::clear_outputs() {
-  outputs_.Clear();
+#endif
+inline void CompileParamsProto::set_metrics(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  metrics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keras.CompileParamsProto.metrics)
 }
-inline const ::keras::TensorProto& KerasProto::outputs(int index) const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.outputs)
-  return outputs_.Get(index);
+inline void CompileParamsProto::set_metrics(int index, const char* value, size_t size) {
+  metrics_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keras.CompileParamsProto.metrics)
 }
-inline ::keras::TensorProto* KerasProto::mutable_outputs(int index) {
-  // @@protoc_insertion_point(field_mutable:keras.KerasProto.outputs)
-  return outputs_.Mutable(index);
+inline ::std::string* CompileParamsProto::add_metrics() {
+  // @@protoc_insertion_point(field_add_mutable:keras.CompileParamsProto.metrics)
+  return metrics_.Add();
 }
-inline ::keras::TensorProto* KerasProto::add_outputs() {
-  // @@protoc_insertion_point(field_add:keras.KerasProto.outputs)
-  return outputs_.Add();
+inline void CompileParamsProto::add_metrics(const ::std::string& value) {
+  metrics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keras.CompileParamsProto.metrics)
 }
-inline ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >*
-KerasProto::mutable_outputs() {
-  // @@protoc_insertion_point(field_mutable_list:keras.KerasProto.outputs)
-  return &outputs_;
+#if LANG_CXX11
+inline void CompileParamsProto::add_metrics(::std::string&& value) {
+  metrics_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keras.CompileParamsProto.metrics)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
-KerasProto::outputs() const {
-  // @@protoc_insertion_point(field_list:keras.KerasProto.outputs)
-  return outputs_;
+#endif
+inline void CompileParamsProto::add_metrics(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  metrics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keras.CompileParamsProto.metrics)
 }
-
-// uint64 progress_callback = 17;
-inline void KerasProto::clear_progress_callback() {
-  progress_callback_ = GOOGLE_ULONGLONG(0);
+inline void CompileParamsProto::add_metrics(const char* value, size_t size) {
+  metrics_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keras.CompileParamsProto.metrics)
 }
-inline ::google::protobuf::uint64 KerasProto::progress_callback() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.progress_callback)
-  return progress_callback_;
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+CompileParamsProto::metrics() const {
+  // @@protoc_insertion_point(field_list:keras.CompileParamsProto.metrics)
+  return metrics_;
 }
-inline void KerasProto::set_progress_callback(::google::protobuf::uint64 value) {
-  
-  progress_callback_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.progress_callback)
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+CompileParamsProto::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:keras.CompileParamsProto.metrics)
+  return &metrics_;
 }
 
-// .keras.KerasCommand command = 18;
-inline void KerasProto::clear_command() {
-  command_ = 0;
+// uint32 top_k = 4;
+inline void CompileParamsProto::clear_top_k() {
+  top_k_ = 0u;
 }
-inline ::keras::KerasCommand KerasProto::command() const {
-  // @@protoc_insertion_point(field_get:keras.KerasProto.command)
-  return static_cast< ::keras::KerasCommand >(command_);
+inline ::google::protobuf::uint32 CompileParamsProto::top_k() const {
+  // @@protoc_insertion_point(field_get:keras.CompileParamsProto.top_k)
+  return top_k_;
 }
-inline void KerasProto::set_command(::keras::KerasCommand value) {
+inline void CompileParamsProto::set_top_k(::google::protobuf::uint32 value) {
   
-  command_ = value;
-  // @@protoc_insertion_point(field_set:keras.KerasProto.command)
+  top_k_ = value;
+  // @@protoc_insertion_point(field_set:keras.CompileParamsProto.top_k)
 }
 
 // -------------------------------------------------------------------
 
-// TensorProto
+// PredictParamsProto
 
-// .keras.DataType type = 1;
-inline void TensorProto::clear_type() {
-  type_ = 0;
+// bool no_cache = 1;
+inline void PredictParamsProto::clear_no_cache() {
+  no_cache_ = false;
 }
-inline ::keras::DataType TensorProto::type() const {
-  // @@protoc_insertion_point(field_get:keras.TensorProto.type)
-  return static_cast< ::keras::DataType >(type_);
+inline bool PredictParamsProto::no_cache() const {
+  // @@protoc_insertion_point(field_get:keras.PredictParamsProto.no_cache)
+  return no_cache_;
 }
-inline void TensorProto::set_type(::keras::DataType value) {
+inline void PredictParamsProto::set_no_cache(bool value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:keras.TensorProto.type)
+  no_cache_ = value;
+  // @@protoc_insertion_point(field_set:keras.PredictParamsProto.no_cache)
 }
 
-// .keras.TensorFormat format = 2;
-inline void TensorProto::clear_format() {
-  format_ = 0;
+// uint32 max_batch_size = 2;
+inline void PredictParamsProto::clear_max_batch_size() {
+  max_batch_size_ = 0u;
 }
-inline ::keras::TensorFormat TensorProto::format() const {
-  // @@protoc_insertion_point(field_get:keras.TensorProto.format)
-  return static_cast< ::keras::TensorFormat >(format_);
+inline ::google::protobuf::uint32 PredictParamsProto::max_batch_size() const {
+  // @@protoc_insertion_point(field_get:keras.PredictParamsProto.max_batch_size)
+  return max_batch_size_;
 }
-inline void TensorProto::set_format(::keras::TensorFormat value) {
+inline void PredictParamsProto::set_max_batch_size(::google::protobuf::uint32 value) {
   
-  format_ = value;
-  // @@protoc_insertion_point(field_set:keras.TensorProto.format)
+  max_batch_size_ = value;
+  // @@protoc_insertion_point(field_set:keras.PredictParamsProto.max_batch_size)
 }
 
-// int32 count = 3;
-inline void TensorProto::clear_count() {
-  count_ = 0;
+// uint32 max_wait_us = 3;
+inline void PredictParamsProto::clear_max_wait_us() {
+  max_wait_us_ = 0u;
 }
-inline ::google::protobuf::int32 TensorProto::count() const {
-  // @@protoc_insertion_point(field_get:keras.TensorProto.count)
-  return count_;
+inline ::google::protobuf::uint32 PredictParamsProto::max_wait_us() const {
+  // @@protoc_insertion_point(field_get:keras.PredictParamsProto.max_wait_us)
+  return max_wait_us_;
 }
-inline void TensorProto::set_count(::google::protobuf::int32 value) {
+inline void PredictParamsProto::set_max_wait_us(::google::protobuf::uint32 value) {
   
-  count_ = value;
-  // @@protoc_insertion_point(field_set:keras.TensorProto.count)
+  max_wait_us_ = value;
+  // @@protoc_insertion_point(field_set:keras.PredictParamsProto.max_wait_us)
 }
 
-// repeated int32 shape = 4;
-inline int TensorProto::shape_size() const {
-  return shape_.size();
+// uint32 top_k = 4;
+inline void PredictParamsProto::clear_top_k() {
+  top_k_ = 0u;
 }
-inline void TensorProto::clear_shape() {
-  shape_.Clear();
+inline ::google::protobuf::uint32 PredictParamsProto::top_k() const {
+  // @@protoc_insertion_point(field_get:keras.PredictParamsProto.top_k)
+  return top_k_;
 }
-inline ::google::protobuf::int32 TensorProto::shape(int index) const {
-  // @@protoc_insertion_point(field_get:keras.TensorProto.shape)
-  return shape_.Get(index);
+inline void PredictParamsProto::set_top_k(::google::protobuf::uint32 value) {
+  
+  top_k_ = value;
+  // @@protoc_insertion_point(field_set:keras.PredictParamsProto.top_k)
 }
-inline void TensorProto::set_shape(int index, ::google::protobuf::int32 value) {
-  shape_.Set(index, value);
-  // @@protoc_insertion_point(field_set:keras.TensorProto.shape)
+
+// repeated string output_layers = 5;
+inline int PredictParamsProto::output_layers_size() const {
+  return output_layers_.size();
 }
-inline void TensorProto::add_shape(::google::protobuf::int32 value) {
-  shape_.Add(value);
-  // @@protoc_insertion_point(field_add:keras.TensorProto.shape)
+inline void PredictParamsProto::clear_output_layers() {
+  output_layers_.Clear();
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-TensorProto::shape() const {
-  // @@protoc_insertion_point(field_list:keras.TensorProto.shape)
-  return shape_;
+inline const ::std::string& PredictParamsProto::output_layers(int index) const {
+  // @@protoc_insertion_point(field_get:keras.PredictParamsProto.output_layers)
+  return output_layers_.Get(index);
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-TensorProto::mutable_shape() {
-  // @@protoc_insertion_point(field_mutable_list:keras.TensorProto.shape)
-  return &shape_;
+inline ::std::string* PredictParamsProto::mutable_output_layers(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.PredictParamsProto.output_layers)
+  return output_layers_.Mutable(index);
 }
-
-// repeated int32 indices = 5;
-inline int TensorProto::indices_size() const {
-  return indices_.size();
+inline void PredictParamsProto::set_output_layers(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:keras.PredictParamsProto.output_layers)
+  output_layers_.Mutable(index)->assign(value);
 }
-inline void TensorProto::clear_indices() {
-  indices_.Clear();
+#if LANG_CXX11
+inline void PredictParamsProto::set_output_layers(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:keras.PredictParamsProto.output_layers)
+  output_layers_.Mutable(index)->assign(std::move(value));
 }
-inline ::google::protobuf::int32 TensorProto::indices(int index) const {
-  // @@protoc_insertion_point(field_get:keras.TensorProto.indices)
-  return indices_.Get(index);
+#endif
+inline void PredictParamsProto::set_output_layers(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  output_layers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keras.PredictParamsProto.output_layers)
 }
-inline void TensorProto::set_indices(int index, ::google::protobuf::int32 value) {
-  indices_.Set(index, value);
-  // @@protoc_insertion_point(field_set:keras.TensorProto.indices)
+inline void PredictParamsProto::set_output_layers(int index, const char* value, size_t size) {
+  output_layers_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keras.PredictParamsProto.output_layers)
 }
-inline void TensorProto::add_indices(::google::protobuf::int32 value) {
-  indices_.Add(value);
-  // @@protoc_insertion_point(field_add:keras.TensorProto.indices)
+inline ::std::string* PredictParamsProto::add_output_layers() {
+  // @@protoc_insertion_point(field_add_mutable:keras.PredictParamsProto.output_layers)
+  return output_layers_.Add();
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-TensorProto::indices() const {
-  // @@protoc_insertion_point(field_list:keras.TensorProto.indices)
-  return indices_;
+inline void PredictParamsProto::add_output_layers(const ::std::string& value) {
+  output_layers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keras.PredictParamsProto.output_layers)
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-TensorProto::mutable_indices() {
-  // @@protoc_insertion_point(field_mutable_list:keras.TensorProto.indices)
-  return &indices_;
+#if LANG_CXX11
+inline void PredictParamsProto::add_output_layers(::std::string&& value) {
+  output_layers_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keras.PredictParamsProto.output_layers)
+}
+#endif
+inline void PredictParamsProto::add_output_layers(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  output_layers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keras.PredictParamsProto.output_layers)
+}
+inline void PredictParamsProto::add_output_layers(const char* value, size_t size) {
+  output_layers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keras.PredictParamsProto.output_layers)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+PredictParamsProto::output_layers() const {
+  // @@protoc_insertion_point(field_list:keras.PredictParamsProto.output_layers)
+  return output_layers_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+PredictParamsProto::mutable_output_layers() {
+  // @@protoc_insertion_point(field_mutable_list:keras.PredictParamsProto.output_layers)
+  return &output_layers_;
 }
 
-// bytes data = 6;
-inline void TensorProto::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// LearningRateScheduleProto
+
+// string op = 1;
+inline void LearningRateScheduleProto::clear_op() {
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& TensorProto::data() const {
-  // @@protoc_insertion_point(field_get:keras.TensorProto.data)
-  return data_.GetNoArena();
+inline const ::std::string& LearningRateScheduleProto::op() const {
+  // @@protoc_insertion_point(field_get:keras.LearningRateScheduleProto.op)
+  return op_.GetNoArena();
 }
-inline void TensorProto::set_data(const ::std::string& value) {
+inline void LearningRateScheduleProto::set_op(const ::std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.TensorProto.data)
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.LearningRateScheduleProto.op)
 }
 #if LANG_CXX11
-inline void TensorProto::set_data(::std::string&& value) {
+inline void LearningRateScheduleProto::set_op(::std::string&& value) {
   
-  data_.SetNoArena(
+  op_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.TensorProto.data)
+  // @@protoc_insertion_point(field_set_rvalue:keras.LearningRateScheduleProto.op)
 }
 #endif
-inline void TensorProto::set_data(const char* value) {
+inline void LearningRateScheduleProto::set_op(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.TensorProto.data)
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.LearningRateScheduleProto.op)
 }
-inline void TensorProto::set_data(const void* value, size_t size) {
+inline void LearningRateScheduleProto::set_op(const char* value, size_t size) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.TensorProto.data)
+  // @@protoc_insertion_point(field_set_pointer:keras.LearningRateScheduleProto.op)
 }
-inline ::std::string* TensorProto::mutable_data() {
+inline ::std::string* LearningRateScheduleProto::mutable_op() {
   
-  // @@protoc_insertion_point(field_mutable:keras.TensorProto.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:keras.LearningRateScheduleProto.op)
+  return op_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* TensorProto::release_data() {
-  // @@protoc_insertion_point(field_release:keras.TensorProto.data)
+inline ::std::string* LearningRateScheduleProto::release_op() {
+  // @@protoc_insertion_point(field_release:keras.LearningRateScheduleProto.op)
   
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return op_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TensorProto::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void LearningRateScheduleProto::set_allocated_op(::std::string* op) {
+  if (op != NULL) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:keras.TensorProto.data)
+  op_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), op);
+  // @@protoc_insertion_point(field_set_allocated:keras.LearningRateScheduleProto.op)
+}
+
+// double gamma = 2;
+inline void LearningRateScheduleProto::clear_gamma() {
+  gamma_ = 0;
+}
+inline double LearningRateScheduleProto::gamma() const {
+  // @@protoc_insertion_point(field_get:keras.LearningRateScheduleProto.gamma)
+  return gamma_;
+}
+inline void LearningRateScheduleProto::set_gamma(double value) {
+  
+  gamma_ = value;
+  // @@protoc_insertion_point(field_set:keras.LearningRateScheduleProto.gamma)
+}
+
+// uint32 step_size = 3;
+inline void LearningRateScheduleProto::clear_step_size() {
+  step_size_ = 0u;
+}
+inline ::google::protobuf::uint32 LearningRateScheduleProto::step_size() const {
+  // @@protoc_insertion_point(field_get:keras.LearningRateScheduleProto.step_size)
+  return step_size_;
+}
+inline void LearningRateScheduleProto::set_step_size(::google::protobuf::uint32 value) {
+  
+  step_size_ = value;
+  // @@protoc_insertion_point(field_set:keras.LearningRateScheduleProto.step_size)
+}
+
+// uint32 warmup = 4;
+inline void LearningRateScheduleProto::clear_warmup() {
+  warmup_ = 0u;
+}
+inline ::google::protobuf::uint32 LearningRateScheduleProto::warmup() const {
+  // @@protoc_insertion_point(field_get:keras.LearningRateScheduleProto.warmup)
+  return warmup_;
+}
+inline void LearningRateScheduleProto::set_warmup(::google::protobuf::uint32 value) {
+  
+  warmup_ = value;
+  // @@protoc_insertion_point(field_set:keras.LearningRateScheduleProto.warmup)
+}
+
+// double min_lr = 5;
+inline void LearningRateScheduleProto::clear_min_lr() {
+  min_lr_ = 0;
+}
+inline double LearningRateScheduleProto::min_lr() const {
+  // @@protoc_insertion_point(field_get:keras.LearningRateScheduleProto.min_lr)
+  return min_lr_;
+}
+inline void LearningRateScheduleProto::set_min_lr(double value) {
+  
+  min_lr_ = value;
+  // @@protoc_insertion_point(field_set:keras.LearningRateScheduleProto.min_lr)
+}
+
+// bool per_batch = 6;
+inline void LearningRateScheduleProto::clear_per_batch() {
+  per_batch_ = false;
+}
+inline bool LearningRateScheduleProto::per_batch() const {
+  // @@protoc_insertion_point(field_get:keras.LearningRateScheduleProto.per_batch)
+  return per_batch_;
+}
+inline void LearningRateScheduleProto::set_per_batch(bool value) {
+  
+  per_batch_ = value;
+  // @@protoc_insertion_point(field_set:keras.LearningRateScheduleProto.per_batch)
 }
 
 // -------------------------------------------------------------------
 
-// StreamConfigurationProto
+// DistributedParamsProto
 
-// string name = 1;
-inline void StreamConfigurationProto::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string op = 1;
+inline void DistributedParamsProto::clear_op() {
+  op_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& StreamConfigurationProto::name() const {
-  // @@protoc_insertion_point(field_get:keras.StreamConfigurationProto.name)
-  return name_.GetNoArena();
+inline const ::std::string& DistributedParamsProto::op() const {
+  // @@protoc_insertion_point(field_get:keras.DistributedParamsProto.op)
+  return op_.GetNoArena();
 }
-inline void StreamConfigurationProto::set_name(const ::std::string& value) {
+inline void DistributedParamsProto::set_op(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.StreamConfigurationProto.name)
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:keras.DistributedParamsProto.op)
 }
 #if LANG_CXX11
-inline void StreamConfigurationProto::set_name(::std::string&& value) {
+inline void DistributedParamsProto::set_op(::std::string&& value) {
   
-  name_.SetNoArena(
+  op_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.StreamConfigurationProto.name)
+  // @@protoc_insertion_point(field_set_rvalue:keras.DistributedParamsProto.op)
 }
 #endif
-inline void StreamConfigurationProto::set_name(const char* value) {
+inline void DistributedParamsProto::set_op(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.StreamConfigurationProto.name)
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:keras.DistributedParamsProto.op)
 }
-inline void StreamConfigurationProto::set_name(const char* value, size_t size) {
+inline void DistributedParamsProto::set_op(const char* value, size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  op_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.StreamConfigurationProto.name)
+  // @@protoc_insertion_point(field_set_pointer:keras.DistributedParamsProto.op)
 }
-inline ::std::string* StreamConfigurationProto::mutable_name() {
+inline ::std::string* DistributedParamsProto::mutable_op() {
   
-  // @@protoc_insertion_point(field_mutable:keras.StreamConfigurationProto.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:keras.DistributedParamsProto.op)
+  return op_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* StreamConfigurationProto::release_name() {
-  // @@protoc_insertion_point(field_release:keras.StreamConfigurationProto.name)
+inline ::std::string* DistributedParamsProto::release_op() {
+  // @@protoc_insertion_point(field_release:keras.DistributedParamsProto.op)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return op_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void StreamConfigurationProto::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void DistributedParamsProto::set_allocated_op(::std::string* op) {
+  if (op != NULL) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:keras.StreamConfigurationProto.name)
+  op_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), op);
+  // @@protoc_insertion_point(field_set_allocated:keras.DistributedParamsProto.op)
 }
 
-// int64 dim = 2;
-inline void StreamConfigurationProto::clear_dim() {
-  dim_ = GOOGLE_LONGLONG(0);
+// uint64 distribute_after_samples = 2;
+inline void DistributedParamsProto::clear_distribute_after_samples() {
+  distribute_after_samples_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::int64 StreamConfigurationProto::dim() const {
-  // @@protoc_insertion_point(field_get:keras.StreamConfigurationProto.dim)
-  return dim_;
+inline ::google::protobuf::uint64 DistributedParamsProto::distribute_after_samples() const {
+  // @@protoc_insertion_point(field_get:keras.DistributedParamsProto.distribute_after_samples)
+  return distribute_after_samples_;
 }
-inline void StreamConfigurationProto::set_dim(::google::protobuf::int64 value) {
+inline void DistributedParamsProto::set_distribute_after_samples(::google::protobuf::uint64 value) {
   
-  dim_ = value;
-  // @@protoc_insertion_point(field_set:keras.StreamConfigurationProto.dim)
+  distribute_after_samples_ = value;
+  // @@protoc_insertion_point(field_set:keras.DistributedParamsProto.distribute_after_samples)
 }
 
-// bool sparse = 3;
-inline void StreamConfigurationProto::clear_sparse() {
-  sparse_ = false;
+// uint64 block_size = 3;
+inline void DistributedParamsProto::clear_block_size() {
+  block_size_ = GOOGLE_ULONGLONG(0);
 }
-inline bool StreamConfigurationProto::sparse() const {
-  // @@protoc_insertion_point(field_get:keras.StreamConfigurationProto.sparse)
-  return sparse_;
+inline ::google::protobuf::uint64 DistributedParamsProto::block_size() const {
+  // @@protoc_insertion_point(field_get:keras.DistributedParamsProto.block_size)
+  return block_size_;
 }
-inline void StreamConfigurationProto::set_sparse(bool value) {
+inline void DistributedParamsProto::set_block_size(::google::protobuf::uint64 value) {
   
-  sparse_ = value;
-  // @@protoc_insertion_point(field_set:keras.StreamConfigurationProto.sparse)
+  block_size_ = value;
+  // @@protoc_insertion_point(field_set:keras.DistributedParamsProto.block_size)
+}
+
+// uint32 quantization_bits = 4;
+inline void DistributedParamsProto::clear_quantization_bits() {
+  quantization_bits_ = 0u;
+}
+inline ::google::protobuf::uint32 DistributedParamsProto::quantization_bits() const {
+  // @@protoc_insertion_point(field_get:keras.DistributedParamsProto.quantization_bits)
+  return quantization_bits_;
+}
+inline void DistributedParamsProto::set_quantization_bits(::google::protobuf::uint32 value) {
+  
+  quantization_bits_ = value;
+  // @@protoc_insertion_point(field_set:keras.DistributedParamsProto.quantization_bits)
 }
 
 // -------------------------------------------------------------------
 
-// TextDataSourceProto
+// CheckpointParamsProto
 
 // string path = 1;
-inline void TextDataSourceProto::clear_path() {
+inline void CheckpointParamsProto::clear_path() {
   path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& TextDataSourceProto::path() const {
-  // @@protoc_insertion_point(field_get:keras.TextDataSourceProto.path)
+inline const ::std::string& CheckpointParamsProto::path() const {
+  // @@protoc_insertion_point(field_get:keras.CheckpointParamsProto.path)
   return path_.GetNoArena();
 }
-inline void TextDataSourceProto::set_path(const ::std::string& value) {
+inline void CheckpointParamsProto::set_path(const ::std::string& value) {
   
   path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:keras.TextDataSourceProto.path)
+  // @@protoc_insertion_point(field_set:keras.CheckpointParamsProto.path)
 }
 #if LANG_CXX11
-inline void TextDataSourceProto::set_path(::std::string&& value) {
+inline void CheckpointParamsProto::set_path(::std::string&& value) {
   
   path_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:keras.TextDataSourceProto.path)
+  // @@protoc_insertion_point(field_set_rvalue:keras.CheckpointParamsProto.path)
 }
 #endif
-inline void TextDataSourceProto::set_path(const char* value) {
+inline void CheckpointParamsProto::set_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
   path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:keras.TextDataSourceProto.path)
+  // @@protoc_insertion_point(field_set_char:keras.CheckpointParamsProto.path)
 }
-inline void TextDataSourceProto::set_path(const char* value, size_t size) {
+inline void CheckpointParamsProto::set_path(const char* value, size_t size) {
   
   path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:keras.TextDataSourceProto.path)
+  // @@protoc_insertion_point(field_set_pointer:keras.CheckpointParamsProto.path)
 }
-inline ::std::string* TextDataSourceProto::mutable_path() {
+inline ::std::string* CheckpointParamsProto::mutable_path() {
   
-  // @@protoc_insertion_point(field_mutable:keras.TextDataSourceProto.path)
+  // @@protoc_insertion_point(field_mutable:keras.CheckpointParamsProto.path)
   return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* TextDataSourceProto::release_path() {
-  // @@protoc_insertion_point(field_release:keras.TextDataSourceProto.path)
+inline ::std::string* CheckpointParamsProto::release_path() {
+  // @@protoc_insertion_point(field_release:keras.CheckpointParamsProto.path)
   
   return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TextDataSourceProto::set_allocated_path(::std::string* path) {
+inline void CheckpointParamsProto::set_allocated_path(::std::string* path) {
   if (path != NULL) {
     
   } else {
     
   }
   path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:keras.TextDataSourceProto.path)
+  // @@protoc_insertion_point(field_set_allocated:keras.CheckpointParamsProto.path)
 }
 
-// repeated .keras.StreamConfigurationProto streams = 2;
-inline int TextDataSourceProto::streams_size() const {
-  return streams_.size();
+// uint32 every_batches = 2;
+inline void CheckpointParamsProto::clear_every_batches() {
+  every_batches_ = 0u;
 }
-inline void TextDataSourceProto::clear_streams() {
-  streams_.Clear();
+inline ::google::protobuf::uint32 CheckpointParamsProto::every_batches() const {
+  // @@protoc_insertion_point(field_get:keras.CheckpointParamsProto.every_batches)
+  return every_batches_;
 }
-inline const ::keras::StreamConfigurationProto& TextDataSourceProto::streams(int index) const {
-  // @@protoc_insertion_point(field_get:keras.TextDataSourceProto.streams)
-  return streams_.Get(index);
+inline void CheckpointParamsProto::set_every_batches(::google::protobuf::uint32 value) {
+  
+  every_batches_ = value;
+  // @@protoc_insertion_point(field_set:keras.CheckpointParamsProto.every_batches)
 }
-inline ::keras::StreamConfigurationProto* TextDataSourceProto::mutable_streams(int index) {
-  // @@protoc_insertion_point(field_mutable:keras.TextDataSourceProto.streams)
-  return streams_.Mutable(index);
+
+// double every_minutes = 3;
+inline void CheckpointParamsProto::clear_every_minutes() {
+  every_minutes_ = 0;
 }
-inline ::keras::StreamConfigurationProto* TextDataSourceProto::add_streams() {
-  // @@protoc_insertion_point(field_add:keras.TextDataSourceProto.streams)
-  return streams_.Add();
+inline double CheckpointParamsProto::every_minutes() const {
+  // @@protoc_insertion_point(field_get:keras.CheckpointParamsProto.every_minutes)
+  return every_minutes_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::keras::StreamConfigurationProto >*
-TextDataSourceProto::mutable_streams() {
-  // @@protoc_insertion_point(field_mutable_list:keras.TextDataSourceProto.streams)
-  return &streams_;
+inline void CheckpointParamsProto::set_every_minutes(double value) {
+  
+  every_minutes_ = value;
+  // @@protoc_insertion_point(field_set:keras.CheckpointParamsProto.every_minutes)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::keras::StreamConfigurationProto >&
-TextDataSourceProto::streams() const {
-  // @@protoc_insertion_point(field_list:keras.TextDataSourceProto.streams)
-  return streams_;
+
+// bool resume = 4;
+inline void CheckpointParamsProto::clear_resume() {
+  resume_ = false;
+}
+inline bool CheckpointParamsProto::resume() const {
+  // @@protoc_insertion_point(field_get:keras.CheckpointParamsProto.resume)
+  return resume_;
+}
+inline void CheckpointParamsProto::set_resume(bool value) {
+  
+  resume_ = value;
+  // @@protoc_insertion_point(field_set:keras.CheckpointParamsProto.resume)
 }
 
 // -------------------------------------------------------------------
 
-// HistoryProto
+// ProgressParamsProto
 
-// .keras.HistoryCallbackType type = 1;
-inline void HistoryProto::clear_type() {
-  type_ = 0;
+// bool async = 1;
+inline void ProgressParamsProto::clear_async() {
+  async_ = false;
 }
-inline ::keras::HistoryCallbackType HistoryProto::type() const {
-  // @@protoc_insertion_point(field_get:keras.HistoryProto.type)
-  return static_cast< ::keras::HistoryCallbackType >(type_);
+inline bool ProgressParamsProto::async() const {
+  // @@protoc_insertion_point(field_get:keras.ProgressParamsProto.async)
+  return async_;
 }
-inline void HistoryProto::set_type(::keras::HistoryCallbackType value) {
+inline void ProgressParamsProto::set_async(bool value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:keras.HistoryProto.type)
+  async_ = value;
+  // @@protoc_insertion_point(field_set:keras.ProgressParamsProto.async)
 }
 
-// uint32 id = 2;
-inline void HistoryProto::clear_id() {
-  id_ = 0u;
+// uint32 every_batches = 2;
+inline void ProgressParamsProto::clear_every_batches() {
+  every_batches_ = 0u;
 }
-inline ::google::protobuf::uint32 HistoryProto::id() const {
-  // @@protoc_insertion_point(field_get:keras.HistoryProto.id)
-  return id_;
+inline ::google::protobuf::uint32 ProgressParamsProto::every_batches() const {
+  // @@protoc_insertion_point(field_get:keras.ProgressParamsProto.every_batches)
+  return every_batches_;
 }
-inline void HistoryProto::set_id(::google::protobuf::uint32 value) {
+inline void ProgressParamsProto::set_every_batches(::google::protobuf::uint32 value) {
   
-  id_ = value;
-  // @@protoc_insertion_point(field_set:keras.HistoryProto.id)
+  every_batches_ = value;
+  // @@protoc_insertion_point(field_set:keras.ProgressParamsProto.every_batches)
 }
 
-// repeated string names = 3;
-inline int HistoryProto::names_size() const {
-  return names_.size();
+// uint32 every_ms = 3;
+inline void ProgressParamsProto::clear_every_ms() {
+  every_ms_ = 0u;
 }
-inline void HistoryProto::clear_names() {
-  names_.Clear();
+inline ::google::protobuf::uint32 ProgressParamsProto::every_ms() const {
+  // @@protoc_insertion_point(field_get:keras.ProgressParamsProto.every_ms)
+  return every_ms_;
 }
-inline const ::std::string& HistoryProto::names(int index) const {
-  // @@protoc_insertion_point(field_get:keras.HistoryProto.names)
-  return names_.Get(index);
+inline void ProgressParamsProto::set_every_ms(::google::protobuf::uint32 value) {
+  
+  every_ms_ = value;
+  // @@protoc_insertion_point(field_set:keras.ProgressParamsProto.every_ms)
 }
-inline ::std::string* HistoryProto::mutable_names(int index) {
-  // @@protoc_insertion_point(field_mutable:keras.HistoryProto.names)
-  return names_.Mutable(index);
+
+// bool epochs_only = 4;
+inline void ProgressParamsProto::clear_epochs_only() {
+  epochs_only_ = false;
 }
-inline void HistoryProto::set_names(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:keras.HistoryProto.names)
-  names_.Mutable(index)->assign(value);
+inline bool ProgressParamsProto::epochs_only() const {
+  // @@protoc_insertion_point(field_get:keras.ProgressParamsProto.epochs_only)
+  return epochs_only_;
 }
-#if LANG_CXX11
-inline void HistoryProto::set_names(int index, ::std::string&& value) {
-  // @@protoc_insertion_point(field_set:keras.HistoryProto.names)
-  names_.Mutable(index)->assign(std::move(value));
+inline void ProgressParamsProto::set_epochs_only(bool value) {
+  
+  epochs_only_ = value;
+  // @@protoc_insertion_point(field_set:keras.ProgressParamsProto.epochs_only)
 }
-#endif
-inline void HistoryProto::set_names(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  names_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:keras.HistoryProto.names)
+
+// -------------------------------------------------------------------
+
+// CacheStatsProto
+
+// uint64 hits = 1;
+inline void CacheStatsProto::clear_hits() {
+  hits_ = GOOGLE_ULONGLONG(0);
 }
-inline void HistoryProto::set_names(int index, const char* value, size_t size) {
-  names_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:keras.HistoryProto.names)
+inline ::google::protobuf::uint64 CacheStatsProto::hits() const {
+  // @@protoc_insertion_point(field_get:keras.CacheStatsProto.hits)
+  return hits_;
 }
-inline ::std::string* HistoryProto::add_names() {
-  // @@protoc_insertion_point(field_add_mutable:keras.HistoryProto.names)
-  return names_.Add();
+inline void CacheStatsProto::set_hits(::google::protobuf::uint64 value) {
+  
+  hits_ = value;
+  // @@protoc_insertion_point(field_set:keras.CacheStatsProto.hits)
 }
-inline void HistoryProto::add_names(const ::std::string& value) {
-  names_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:keras.HistoryProto.names)
+
+// uint64 misses = 2;
+inline void CacheStatsProto::clear_misses() {
+  misses_ = GOOGLE_ULONGLONG(0);
 }
-#if LANG_CXX11
-inline void HistoryProto::add_names(::std::string&& value) {
-  names_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:keras.HistoryProto.names)
+inline ::google::protobuf::uint64 CacheStatsProto::misses() const {
+  // @@protoc_insertion_point(field_get:keras.CacheStatsProto.misses)
+  return misses_;
 }
-#endif
-inline void HistoryProto::add_names(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  names_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:keras.HistoryProto.names)
+inline void CacheStatsProto::set_misses(::google::protobuf::uint64 value) {
+  
+  misses_ = value;
+  // @@protoc_insertion_point(field_set:keras.CacheStatsProto.misses)
 }
-inline void HistoryProto::add_names(const char* value, size_t size) {
-  names_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:keras.HistoryProto.names)
+
+// uint64 evictions = 3;
+inline void CacheStatsProto::clear_evictions() {
+  evictions_ = GOOGLE_ULONGLONG(0);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-HistoryProto::names() const {
-  // @@protoc_insertion_point(field_list:keras.HistoryProto.names)
-  return names_;
+inline ::google::protobuf::uint64 CacheStatsProto::evictions() const {
+  // @@protoc_insertion_point(field_get:keras.CacheStatsProto.evictions)
+  return evictions_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-HistoryProto::mutable_names() {
-  // @@protoc_insertion_point(field_mutable_list:keras.HistoryProto.names)
-  return &names_;
+inline void CacheStatsProto::set_evictions(::google::protobuf::uint64 value) {
+  
+  evictions_ = value;
+  // @@protoc_insertion_point(field_set:keras.CacheStatsProto.evictions)
 }
 
-// repeated double values = 4;
-inline int HistoryProto::values_size() const {
-  return values_.size();
+// uint64 models = 4;
+inline void CacheStatsProto::clear_models() {
+  models_ = GOOGLE_ULONGLONG(0);
 }
-inline void HistoryProto::clear_values() {
-  values_.Clear();
+inline ::google::protobuf::uint64 CacheStatsProto::models() const {
+  // @@protoc_insertion_point(field_get:keras.CacheStatsProto.models)
+  return models_;
 }
-inline double HistoryProto::values(int index) const {
-  // @@protoc_insertion_point(field_get:keras.HistoryProto.values)
-  return values_.Get(index);
+inline void CacheStatsProto::set_models(::google::protobuf::uint64 value) {
+  
+  models_ = value;
+  // @@protoc_insertion_point(field_set:keras.CacheStatsProto.models)
 }
-inline void HistoryProto::set_values(int index, double value) {
-  values_.Set(index, value);
-  // @@protoc_insertion_point(field_set:keras.HistoryProto.values)
+
+// uint64 bytes = 5;
+inline void CacheStatsProto::clear_bytes() {
+  bytes_ = GOOGLE_ULONGLONG(0);
 }
-inline void HistoryProto::add_values(double value) {
-  values_.Add(value);
-  // @@protoc_insertion_point(field_add:keras.HistoryProto.values)
+inline ::google::protobuf::uint64 CacheStatsProto::bytes() const {
+  // @@protoc_insertion_point(field_get:keras.CacheStatsProto.bytes)
+  return bytes_;
 }
-inline const ::google::protobuf::RepeatedField< double >&
-HistoryProto::values() const {
-  // @@protoc_insertion_point(field_list:keras.HistoryProto.values)
-  return values_;
+inline void CacheStatsProto::set_bytes(::google::protobuf::uint64 value) {
+  
+  bytes_ = value;
+  // @@protoc_insertion_point(field_set:keras.CacheStatsProto.bytes)
 }
-inline ::google::protobuf::RepeatedField< double >*
-HistoryProto::mutable_values() {
-  // @@protoc_insertion_point(field_mutable_list:keras.HistoryProto.values)
-  return &values_;
+
+// uint64 budget = 6;
+inline void CacheStatsProto::clear_budget() {
+  budget_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CacheStatsProto::budget() const {
+  // @@protoc_insertion_point(field_get:keras.CacheStatsProto.budget)
+  return budget_;
+}
+inline void CacheStatsProto::set_budget(::google::protobuf::uint64 value) {
+  
+  budget_ = value;
+  // @@protoc_insertion_point(field_set:keras.CacheStatsProto.budget)
 }
 
-// uint64 nsamples = 5;
-inline void HistoryProto::clear_nsamples() {
-  nsamples_ = GOOGLE_ULONGLONG(0);
+// -------------------------------------------------------------------
+
+// OutputChunkProto
+
+// uint64 offset = 1;
+inline void OutputChunkProto::clear_offset() {
+  offset_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 HistoryProto::nsamples() const {
-  // @@protoc_insertion_point(field_get:keras.HistoryProto.nsamples)
-  return nsamples_;
+inline ::google::protobuf::uint64 OutputChunkProto::offset() const {
+  // @@protoc_insertion_point(field_get:keras.OutputChunkProto.offset)
+  return offset_;
 }
-inline void HistoryProto::set_nsamples(::google::protobuf::uint64 value) {
+inline void OutputChunkProto::set_offset(::google::protobuf::uint64 value) {
   
-  nsamples_ = value;
-  // @@protoc_insertion_point(field_set:keras.HistoryProto.nsamples)
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:keras.OutputChunkProto.offset)
+}
+
+// repeated .keras.TensorProto outputs = 2;
+inline int OutputChunkProto::outputs_size() const {
+  return outputs_.size();
+}
+inline void OutputChunkProto::clear_outputs() {
+  outputs_.Clear();
+}
+inline const ::keras::TensorProto& OutputChunkProto::outputs(int index) const {
+  // @@protoc_insertion_point(field_get:keras.OutputChunkProto.outputs)
+  return outputs_.Get(index);
+}
+inline ::keras::TensorProto* OutputChunkProto::mutable_outputs(int index) {
+  // @@protoc_insertion_point(field_mutable:keras.OutputChunkProto.outputs)
+  return outputs_.Mutable(index);
+}
+inline ::keras::TensorProto* OutputChunkProto::add_outputs() {
+  // @@protoc_insertion_point(field_add:keras.OutputChunkProto.outputs)
+  return outputs_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >*
+OutputChunkProto::mutable_outputs() {
+  // @@protoc_insertion_point(field_mutable_list:keras.OutputChunkProto.outputs)
+  return &outputs_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::keras::TensorProto >&
+OutputChunkProto::outputs() const {
+  // @@protoc_insertion_point(field_list:keras.OutputChunkProto.outputs)
+  return outputs_;
 }
 
 #ifdef __GNUC__
@@ -2114,6 +6958,28 @@ inline void HistoryProto::set_nsamples(::google::protobuf::uint64 value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
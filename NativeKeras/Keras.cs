@@ -2,6 +2,7 @@
 using Newtonsoft.Json;
 using Newtonsoft.Json.Linq;
 using System;
+using System.Collections.Generic;
 using System.IO;
 using System.Linq;
 using System.Runtime.InteropServices;
@@ -165,10 +166,12 @@ namespace Keras
         private int[] _strides;
         private object _activation;
         private bool _useBias;
+        private int _groups;
 
-        public Conv2D(int filters, object kernelSize, object strides = null, object activation = null, bool useBias = true, int [] inputShape = null)
+        public Conv2D(int filters, object kernelSize, object strides = null, object activation = null, bool useBias = true, int [] inputShape = null, int groups = 1)
         {
             _inputShape = inputShape;
+            _groups = groups;
             _kernelSize = KerasUtils.GetArray(kernelSize, 2);
             if (_kernelSize == null)
                 throw new ArgumentException("The kernelSize parameter type is not supported.");
@@ -191,6 +194,9 @@ namespace Keras
             jobj["strides"] = new JArray(_strides);
             jobj["use_bias"] = _useBias;
 
+            if (_groups != 1)
+                jobj["groups"] = _groups;
+
             if (_inputShape != null)
                 jobj["input_shape"] = new JArray(_inputShape);
 
@@ -203,6 +209,113 @@ namespace Keras
         }
     }
 
+    // DepthwiseConv2D(kernel_size, strides=(1, 1), padding='valid', depth_multiplier=1, activation=None, use_bias=True,
+    //   depthwise_initializer='glorot_uniform', bias_initializer='zeros')
+    [JsonObject(MemberSerialization.OptIn)]
+    public class DepthwiseConv2D : GraphOp
+    {
+        private int[] _inputShape;
+        private int[] _kernelSize;
+        private int[] _strides;
+        private string _padding;
+        private int _depthMultiplier;
+        private object _activation;
+        private bool _useBias;
+        private object _depthwiseInitializer;
+
+        public DepthwiseConv2D(object kernelSize, object strides = null, string padding = "valid", int depthMultiplier = 1, object activation = null, bool useBias = true, object depthwiseInitializer = null, int[] inputShape = null)
+        {
+            _inputShape = inputShape;
+            _kernelSize = KerasUtils.GetArray(kernelSize, 2);
+            if (_kernelSize == null)
+                throw new ArgumentException("The kernelSize parameter type is not supported.");
+            _strides = strides == null ? new int[] { 1, 1 } : KerasUtils.GetArray(strides, 2);
+            _padding = padding;
+            _depthMultiplier = depthMultiplier;
+            _activation = activation;
+            _useBias = useBias;
+            _depthwiseInitializer = depthwiseInitializer;
+        }
+
+        public override JObject ToJObject()
+        {
+            var jobj = new JObject();
+            jobj["kernel_size"] = new JArray(_kernelSize);
+            jobj["strides"] = new JArray(_strides);
+            jobj["padding"] = _padding;
+            jobj["depth_multiplier"] = _depthMultiplier;
+            jobj["use_bias"] = _useBias;
+
+            if (_inputShape != null)
+                jobj["input_shape"] = new JArray(_inputShape);
+
+            KerasUtils.AddActivation(jobj, _activation);
+            KerasUtils.AddStringOrObject(jobj, "depthwise_initializer", _depthwiseInitializer);
+
+            jobj["bias_initializer"] = "zeros";
+
+            jobj.Add("op", "DepthwiseConv2D");
+            return jobj;
+        }
+    }
+
+    // SeparableConv2D(filters, kernel_size, strides=(1, 1), padding='valid', depth_multiplier=1, activation=None, use_bias=True,
+    //   depthwise_initializer='glorot_uniform', pointwise_initializer='glorot_uniform', bias_initializer='zeros')
+    [JsonObject(MemberSerialization.OptIn)]
+    public class SeparableConv2D : GraphOp
+    {
+        private int[] _inputShape;
+        private int _filters;
+        private int[] _kernelSize;
+        private int[] _strides;
+        private string _padding;
+        private int _depthMultiplier;
+        private object _activation;
+        private bool _useBias;
+        private object _depthwiseInitializer;
+        private object _pointwiseInitializer;
+
+        public SeparableConv2D(int filters, object kernelSize, object strides = null, string padding = "valid", int depthMultiplier = 1, object activation = null, bool useBias = true,
+            object depthwiseInitializer = null, object pointwiseInitializer = null, int[] inputShape = null)
+        {
+            _inputShape = inputShape;
+            _filters = filters;
+            _kernelSize = KerasUtils.GetArray(kernelSize, 2);
+            if (_kernelSize == null)
+                throw new ArgumentException("The kernelSize parameter type is not supported.");
+            _strides = strides == null ? new int[] { 1, 1 } : KerasUtils.GetArray(strides, 2);
+            _padding = padding;
+            _depthMultiplier = depthMultiplier;
+            _activation = activation;
+            _useBias = useBias;
+            _depthwiseInitializer = depthwiseInitializer;
+            _pointwiseInitializer = pointwiseInitializer;
+        }
+
+        public override JObject ToJObject()
+        {
+            var jobj = new JObject();
+            jobj["filters"] = _filters;
+            jobj["kernel_size"] = new JArray(_kernelSize);
+            jobj["strides"] = new JArray(_strides);
+            jobj["padding"] = _padding;
+            jobj["depth_multiplier"] = _depthMultiplier;
+            jobj["use_bias"] = _useBias;
+
+            if (_inputShape != null)
+                jobj["input_shape"] = new JArray(_inputShape);
+
+            KerasUtils.AddActivation(jobj, _activation);
+            KerasUtils.AddStringOrObject(jobj, "depthwise_initializer", _depthwiseInitializer);
+            KerasUtils.AddStringOrObject(jobj, "pointwise_initializer", _pointwiseInitializer);
+
+            jobj["bias_initializer"] = "zeros";
+
+            jobj.Add("op", "SeparableConv2D");
+            return jobj;
+        }
+    }
+
     [JsonObject(MemberSerialization.OptIn)]
     public class MaxPooling1D : GraphOp
     {
@@ -362,6 +475,45 @@ namespace Keras
         }
     }
 
+    // Embedding of Int64 or String keys (see TensorUtils.CreateProto) hashed into hashBuckets rows.
+    // With numHashes > 1 each key is the sum of as many rows, which makes collisions less likely to matter.
+    [JsonObject(MemberSerialization.OptIn)]
+    public class HashedEmbedding : GraphOp
+    {
+        private ulong _hashBuckets;
+        private ulong _outputDim;
+        private uint _numHashes;
+        private object _embeddingInitializer;
+        private int[] _inputShape;
+
+        public HashedEmbedding(ulong hashBuckets, ulong outputDim, uint numHashes = 1, object embeddingInitializer = null, int[] inputShape = null)
+        {
+            _hashBuckets = hashBuckets;
+            _outputDim = outputDim;
+            _numHashes = numHashes;
+            _embeddingInitializer = embeddingInitializer ?? "uniform";
+            _inputShape = inputShape;
+        }
+
+        public override JObject ToJObject()
+        {
+            var jobj = new JObject()
+            {
+                ["hash_buckets"] = _hashBuckets,
+                ["output_dim"] = _outputDim,
+                ["num_hashes"] = _numHashes
+            };
+
+            KerasUtils.AddStringOrObject(jobj, "embedding_initializer", _embeddingInitializer);
+
+            if (_inputShape != null)
+                jobj["input_shape"] = new JArray(_inputShape);
+
+            jobj["op"] = "Embedding";
+            return jobj;
+        }
+    }
+
     // LSTM(units, activation='tanh', recurrent_activation='hard_sigmoid', use_bias=True, kernel_initializer='glorot_uniform',
     //   recurrent_initializer='orthogonal', bias_initializer='zeros', unit_forget_bias=True, kernel_regularizer=None, 
     //   recurrent_regularizer=None, bias_regularizer=None, activity_regularizer=None, kernel_constraint=None, 
@@ -399,8 +551,12 @@ namespace Keras
         private double _dropout;
         [JsonProperty(PropertyName = "recurrent_dropout", NullValueHandling = NullValueHandling.Ignore)]
         private double _recurrentDropout;
+        [JsonProperty(PropertyName = "return_sequences")]
+        private bool _returnSequences;
+        [JsonProperty(PropertyName = "go_backwards")]
+        private bool _goBackwards;
 
-        public LSTM(ulong units, object activation = null, object recurrentActivation = null, bool useBias = true, object kernelInitializer = null, object recurrentInitializer = null, object biasInitializer = null, bool unitForgetBias = true, object kernelRegularizer = null, object recurrentRegularizer = null, object biasRegularizer = null, double dropout = 0.0, double recurrentDropout = 0.0, int[] inputShape = null)
+        public LSTM(ulong units, object activation = null, object recurrentActivation = null, bool useBias = true, object kernelInitializer = null, object recurrentInitializer = null, object biasInitializer = null, bool unitForgetBias = true, object kernelRegularizer = null, object recurrentRegularizer = null, object biasRegularizer = null, double dropout = 0.0, double recurrentDropout = 0.0, int[] inputShape = null, bool returnSequences = false, bool goBackwards = false)
         {
             _units = units;
             _activation = activation ?? "tanh";
@@ -414,6 +570,9 @@ namespace Keras
 
             _dropout = dropout;
             _recurrentDropout = recurrentDropout;
+
+            _returnSequences = returnSequences;
+            _goBackwards = goBackwards;
         }
 
         public override JObject ToJObject()
@@ -443,11 +602,76 @@ namespace Keras
             jobj["dropout"] = _dropout;
             jobj["recurrent_dropout"] = _recurrentDropout;
 
+            jobj["return_sequences"] = _returnSequences;
+            jobj["go_backwards"] = _goBackwards;
+
             jobj["op"] = "LSTM";
             return jobj;
         }
     }
 
+    // GRU(units, activation='tanh', recurrent_activation='hard_sigmoid', use_bias=True, kernel_initializer='glorot_uniform',
+    //   recurrent_initializer='orthogonal', bias_initializer='zeros', dropout=0.0, recurrent_dropout=0.0,
+    //   return_sequences=False, go_backwards=False)
+    [JsonObject(MemberSerialization.OptIn)]
+    public class GRU : GraphOp
+    {
+        private ulong _units;
+        private object _activation;
+        private object _recurrentActivation;
+        private int[] _inputShape;
+        private bool _useBias;
+        private object _kernelInitializer;
+        private object _recurrentInitializer;
+        private double _dropout;
+        private double _recurrentDropout;
+        private bool _returnSequences;
+        private bool _goBackwards;
+
+        public GRU(ulong units, object activation = null, object recurrentActivation = null, bool useBias = true, object kernelInitializer = null, object recurrentInitializer = null, double dropout = 0.0, double recurrentDropout = 0.0, bool returnSequences = false, bool goBackwards = false, int[] inputShape = null)
+        {
+            _units = units;
+            _activation = activation ?? "tanh";
+            _recurrentActivation = recurrentActivation ?? "hard_sigmoid";
+            _useBias = useBias;
+            _kernelInitializer = kernelInitializer ?? "glorot_uniform";
+            _recurrentInitializer = recurrentInitializer ?? "orthogonal";
+            _inputShape = inputShape;
+
+            _dropout = dropout;
+            _recurrentDropout = recurrentDropout;
+
+            _returnSequences = returnSequences;
+            _goBackwards = goBackwards;
+        }
+
+        public override JObject ToJObject()
+        {
+            var jobj = new JObject();
+            jobj["units"] = _units;
+
+            if (_inputShape != null)
+                jobj["input_shape"] = new JArray(_inputShape);
+
+            jobj["use_bias"] = _useBias;
+
+            KerasUtils.AddActivation(jobj, _activation);
+            KerasUtils.AddActivation(jobj, "recurrent_activation", _recurrentActivation);
+
+            KerasUtils.AddStringOrObject(jobj, "kernel_initializer", _kernelInitializer);
+            KerasUtils.AddStringOrObject(jobj, "recurrent_initializer", _recurrentInitializer);
+
+            jobj["dropout"] = _dropout;
+            jobj["recurrent_dropout"] = _recurrentDropout;
+
+            jobj["return_sequences"] = _returnSequences;
+            jobj["go_backwards"] = _goBackwards;
+
+            jobj["op"] = "GRU";
+            return jobj;
+        }
+    }
+
     [JsonObject(MemberSerialization.OptIn)]
     public class SGD : GraphOp
     {
@@ -459,13 +683,123 @@ namespace Keras
         public double Decay { get; set; } = 0;
         [JsonProperty(PropertyName = "nestorov", NullValueHandling = NullValueHandling.Ignore)]
         public bool Nestorov { get; set; } = false;
+        [JsonProperty(PropertyName = "schedule", NullValueHandling = NullValueHandling.Ignore)]
+        public LearningRateSchedule Schedule { get; set; }
 
-        public SGD(double lr = 0.01, double momentum = 0.0, double decay = 0.0, bool nesterov = false)
+        public SGD(double lr = 0.01, double momentum = 0.0, double decay = 0.0, bool nesterov = false, LearningRateSchedule schedule = null)
         {
             LearningRate = lr;
             Momentum = momentum;
             Decay = decay;
             Nestorov = nesterov;
+            Schedule = schedule;
+        }
+    }
+
+    [JsonObject(MemberSerialization.OptIn)]
+    public class Adam : GraphOp
+    {
+        [JsonProperty(PropertyName = "lr", NullValueHandling = NullValueHandling.Ignore)]
+        public double LearningRate { get; set; } = 0.001;
+        [JsonProperty(PropertyName = "beta_1", NullValueHandling = NullValueHandling.Ignore)]
+        public double Beta1 { get; set; } = 0.9;
+        [JsonProperty(PropertyName = "beta_2", NullValueHandling = NullValueHandling.Ignore)]
+        public double Beta2 { get; set; } = 0.999;
+        [JsonProperty(PropertyName = "epsilon", NullValueHandling = NullValueHandling.Ignore)]
+        public double Epsilon { get; set; } = 1e-08;
+        [JsonProperty(PropertyName = "decay", NullValueHandling = NullValueHandling.Ignore)]
+        public double Decay { get; set; } = 0;
+        [JsonProperty(PropertyName = "schedule", NullValueHandling = NullValueHandling.Ignore)]
+        public LearningRateSchedule Schedule { get; set; }
+
+        public Adam(double lr = 0.001, double beta1 = 0.9, double beta2 = 0.999, double epsilon = 1e-08, double decay = 0.0, LearningRateSchedule schedule = null)
+        {
+            LearningRate = lr;
+            Beta1 = beta1;
+            Beta2 = beta2;
+            Epsilon = epsilon;
+            Decay = decay;
+            Schedule = schedule;
+        }
+    }
+
+    // Adam with decoupled weight decay: the weights are scaled by (1 - lr * weightDecay) after every update
+    [JsonObject(MemberSerialization.OptIn)]
+    public class AdamW : Adam
+    {
+        [JsonProperty(PropertyName = "weight_decay", NullValueHandling = NullValueHandling.Ignore)]
+        public double WeightDecay { get; set; } = 0.01;
+
+        public AdamW(double lr = 0.001, double weightDecay = 0.01, double beta1 = 0.9, double beta2 = 0.999, double epsilon = 1e-08, double decay = 0.0, LearningRateSchedule schedule = null)
+            : base(lr, beta1, beta2, epsilon, decay, schedule)
+        {
+            WeightDecay = weightDecay;
+        }
+    }
+
+    [JsonObject(MemberSerialization.OptIn)]
+    public class RMSprop : GraphOp
+    {
+        [JsonProperty(PropertyName = "lr", NullValueHandling = NullValueHandling.Ignore)]
+        public double LearningRate { get; set; } = 0.001;
+        [JsonProperty(PropertyName = "rho", NullValueHandling = NullValueHandling.Ignore)]
+        public double RHO { get; set; } = 0.9;
+        [JsonProperty(PropertyName = "decay", NullValueHandling = NullValueHandling.Ignore)]
+        public double Decay { get; set; } = 0;
+        [JsonProperty(PropertyName = "schedule", NullValueHandling = NullValueHandling.Ignore)]
+        public LearningRateSchedule Schedule { get; set; }
+
+        public RMSprop(double lr = 0.001, double rho = 0.9, double decay = 0.0, LearningRateSchedule schedule = null)
+        {
+            LearningRate = lr;
+            RHO = rho;
+            Decay = decay;
+            Schedule = schedule;
+        }
+    }
+
+    [JsonObject(MemberSerialization.OptIn)]
+    public class Adagrad : GraphOp
+    {
+        [JsonProperty(PropertyName = "lr", NullValueHandling = NullValueHandling.Ignore)]
+        public double LearningRate { get; set; } = 0.01;
+        [JsonProperty(PropertyName = "decay", NullValueHandling = NullValueHandling.Ignore)]
+        public double Decay { get; set; } = 0;
+        [JsonProperty(PropertyName = "schedule", NullValueHandling = NullValueHandling.Ignore)]
+        public LearningRateSchedule Schedule { get; set; }
+
+        public Adagrad(double lr = 0.01, double decay = 0.0, LearningRateSchedule schedule = null)
+        {
+            LearningRate = lr;
+            Decay = decay;
+            Schedule = schedule;
+        }
+    }
+
+    // The learning rate per epoch [or per minibatch with perBatch], after warmup linearly increasing steps:
+    //   step: lr * gamma ^ (step / stepSize), exponential: lr * gamma ^ step, cosine: from lr down to minLr
+    [JsonObject(MemberSerialization.OptIn)]
+    public class LearningRateSchedule : GraphOp
+    {
+        [JsonProperty(PropertyName = "gamma", NullValueHandling = NullValueHandling.Ignore)]
+        public double? Gamma { get; set; }
+        [JsonProperty(PropertyName = "step_size", NullValueHandling = NullValueHandling.Ignore)]
+        public uint? StepSize { get; set; }
+        [JsonProperty(PropertyName = "warmup")]
+        public uint Warmup { get; set; }
+        [JsonProperty(PropertyName = "min_lr")]
+        public double MinLearningRate { get; set; }
+        [JsonProperty(PropertyName = "per_batch")]
+        public bool PerBatch { get; set; }
+
+        public LearningRateSchedule(string op = "constant", double? gamma = null, uint? stepSize = null, uint warmup = 0, double minLr = 0.0, bool perBatch = false)
+        {
+            _op = op;
+            Gamma = gamma;
+            StepSize = stepSize;
+            Warmup = warmup;
+            MinLearningRate = minLr;
+            PerBatch = perBatch;
         }
     }
 
@@ -564,6 +898,44 @@ namespace Keras
         private string _uuid = "";
         private string _path = "";
 
+        // The loaded model Fit starts from [fine-tuning], the graph's layers go on top of it
+        private byte[] _baseModel;
+        private string _basePath = "";
+
+        // Send the graph as typed protobuf messages instead of a JSON string
+        public bool BinaryGraph { get; set; } = true;
+
+        // Local data parallel training of in-memory tensors: the number of worker threads, and either
+        // "allreduce" [the gradients are summed] or "hogwild" [lock-free updates]
+        public uint Workers { get; set; } = 1;
+        public string ParallelMode { get; set; } = "allreduce";
+
+        // The gradients of this many minibatches are summed before every update, the effective
+        // batch size is batchSize * GradientAccumulationSteps at the memory cost of batchSize
+        public uint GradientAccumulationSteps { get; set; } = 1;
+
+        // Distributed training, when the program is started as MPI ranks [mpiexec -n 4 Program.exe]
+        // and each rank calls Fit once with the same data
+        public DistributedParamsProto Distributed { get; set; }
+
+        // Periodic checkpoints of the parameters, the optimizer and the data position; with Resume
+        // set, Fit continues from the checkpoint at Path when there is one
+        public CheckpointParamsProto Checkpoint { get; set; }
+
+        // The names of the layers Fit doesn't train, e.g. the backbone of a loaded model
+        public string[] FrozenLayers { get; set; }
+
+        // Throttled and/or asynchronous progress callbacks, e.g. { Async = true, EveryMs = 500 }
+        public ProgressParamsProto Progress { get; set; }
+
+        // Concurrent Predict calls on the cached model are evaluated together, up to MaxBatchSize rows,
+        // waiting at most MaxBatchWaitMicroseconds for the batch to fill; 0 evaluates every call alone
+        public uint MaxBatchSize { get; set; } = 0;
+        public uint MaxBatchWaitMicroseconds { get; set; } = 0;
+
+        // The model in the native cache after Predict or Evaluate, see ModelCache
+        public string ModelUuid { get { return _uuid; } }
+
         public Sequential()
         {
             _graph = new JObject();
@@ -612,15 +984,44 @@ namespace Keras
             }
         }
 
-        public void Compile(object loss, object optimizer, object metrics)
+        // topK is the k of the top_k_categorical_accuracy metric
+        public void Compile(object loss, object optimizer, object metrics, uint topK = 5)
         {
             var jobj = new JObject();
             jobj["optimizer"] = ObjectAsJValue(optimizer);
             jobj["metrics"] = ObjectAsJValue(metrics);
             jobj["loss"] = ObjectAsJValue(loss);
+            jobj["top_k"] = topK;
             _graph["compile_params"] = jobj;
         }
 
+        private void SetGraph(KerasProto kerasProto)
+        {
+            if (!BinaryGraph)
+            {
+                kerasProto.Graph = _graph.ToString(Formatting.None);
+                return;
+            }
+
+            foreach (JObject jobj in (JArray)_graph["graph"])
+                kerasProto.Layers.Add(KerasUtils.ToLayerProto(jobj));
+
+            if (_graph["compile_params"] != null)
+                kerasProto.Compile = KerasUtils.ToCompileParamsProto((JObject)_graph["compile_params"]);
+        }
+
+        private void SetFitParams(KerasProto kerasProto)
+        {
+            if (_baseModel != null)
+                kerasProto.Model = ByteString.CopyFrom(_baseModel);
+            kerasProto.ModelPath = _basePath;
+
+            if (FrozenLayers != null)
+                kerasProto.FrozenLayers.Add(FrozenLayers);
+            if (Progress != null)
+                kerasProto.Progress = Progress;
+        }
+
         [DllImport(@"KerasCntk.dll")]
         public static extern void KerasFitModel(byte[] inData, uint inlen, ref IntPtr outData, ref uint outLen, ref ulong outPtr, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
 
@@ -633,7 +1034,7 @@ namespace Keras
         public void Fit(string path, uint nsamples, uint nfeatures, uint nlabels, uint batchSize, uint epochs, uint verbose = 1)
         {
             KerasProto kerasProto = new KerasProto();
-            kerasProto.Graph = _graph.ToString(Formatting.None);
+            SetGraph(kerasProto);
             kerasProto.Path = path;
             kerasProto.Nsamples = nsamples;
             kerasProto.Nfeatures = nfeatures;
@@ -644,6 +1045,10 @@ namespace Keras
 
             kerasProto.Verbose = verbose;
 
+            if (Checkpoint != null)
+                kerasProto.Checkpoint = Checkpoint;
+            SetFitParams(kerasProto);
+
             using (var stream = new MemoryStream())
             {
                 kerasProto.WriteTo(stream);
@@ -680,22 +1085,37 @@ namespace Keras
             }
         }
 
-        public void Fit(Tensor x, Tensor y, uint batchSize = 32, uint epochs = 10, uint verbose = 1)
+        public void Fit(Tensor x, Tensor y, uint batchSize = 32, uint epochs = 10, uint verbose = 1, int[] sequenceLengths = null)
+        {
+            Fit(x.GetProto(sequenceLengths), y, batchSize, epochs, verbose);
+        }
+
+        // The features as a proto, e.g. the Int64 or String keys of a HashedEmbedding
+        public void Fit(TensorProto x, Tensor y, uint batchSize = 32, uint epochs = 10, uint verbose = 1)
         {
             KerasProto kerasProto = new KerasProto();
-            kerasProto.Graph = _graph.ToString(Formatting.None);
+            SetGraph(kerasProto);
 
             kerasProto.BatchSize = batchSize;
             kerasProto.Epochs = epochs;
 
             kerasProto.Verbose = verbose;
 
-            kerasProto.Inputs.Add(x.GetProto());
+            kerasProto.Workers = Workers;
+            kerasProto.Parallel = ParallelMode;
+            kerasProto.GradientAccumulationSteps = GradientAccumulationSteps;
+            if (Distributed != null)
+                kerasProto.Distributed = Distributed;
+            if (Checkpoint != null)
+                kerasProto.Checkpoint = Checkpoint;
+            SetFitParams(kerasProto);
+
+            kerasProto.Inputs.Add(x);
             kerasProto.Inputs.Add(y.GetProto());
 
             kerasProto.Command = KerasCommand.Fit;
 
-            _state = new ProgressCallbackState(new ProgressWriter(epochs, (uint)x.Sizes[0]));
+            _state = new ProgressCallbackState(new ProgressWriter(epochs, x.SequenceLengths.Count == 0 ? (uint)x.Shape[0] : (uint)x.SequenceLengths.Count));
             _callback = new ProgressCallback(_state.Callback);
 
             kerasProto.ProgressCallback = (ulong)Marshal.GetFunctionPointerForDelegate(_callback);
@@ -723,6 +1143,9 @@ namespace Keras
 
                     var resultProto = KerasProto.Parser.ParseFrom(resultBytes);
                     _model = resultProto.Model.ToArray();
+                    // Predict uses the trained model, not the loaded one
+                    _path = "";
+                    _uuid = "";
                 }
                 else
                 {
@@ -737,24 +1160,244 @@ namespace Keras
             }
         }
 
-        public Tensor Predict(Tensor x, uint batchSize = 32, uint verbose = 1, bool cache = true)
+        // The compiled loss and metrics over x and y, computed natively: only their means come back
+        public Dictionary<string, double> Evaluate(Tensor x, Tensor y, uint batchSize = 32, uint verbose = 1, bool cache = true, int[] sequenceLengths = null)
+        {
+            return Evaluate(x.GetProto(sequenceLengths), y, batchSize, verbose, cache);
+        }
+
+        public Dictionary<string, double> Evaluate(TensorProto x, Tensor y, uint batchSize = 32, uint verbose = 1, bool cache = true)
+        {
+            KerasProto kerasProto = new KerasProto();
+            kerasProto.Inputs.Add(x);
+            kerasProto.Inputs.Add(y.GetProto());
+            return Evaluate(kerasProto, batchSize, verbose, cache);
+        }
+
+        // The dataset in CNTK's text format, as for Fit
+        public Dictionary<string, double> Evaluate(string path, uint nsamples, uint nfeatures, uint nlabels, uint batchSize = 32, uint verbose = 1, bool cache = true)
         {
             KerasProto kerasProto = new KerasProto();
+            kerasProto.Path = path;
+            kerasProto.Nsamples = nsamples;
+            kerasProto.Nfeatures = nfeatures;
+            kerasProto.Nlabels = nlabels;
+            return Evaluate(kerasProto, batchSize, verbose, cache);
+        }
+
+        private Dictionary<string, double> Evaluate(KerasProto kerasProto, uint batchSize, uint verbose, bool cache)
+        {
+            SetGraph(kerasProto);
 
             kerasProto.BatchSize = batchSize;
             kerasProto.Verbose = verbose;
 
-            var jobj = new JObject()
+            kerasProto.Predict = new PredictParamsProto() { NoCache = !cache };
+
+            if (_model != null) kerasProto.Model = ByteString.CopyFrom(_model);
+            kerasProto.ModelUuid = _uuid;
+            kerasProto.ModelPath = _path;
+
+            kerasProto.Command = KerasCommand.Evaluate;
+
+            using (var stream = new MemoryStream())
+            {
+                kerasProto.WriteTo(stream);
+                var bytes = stream.ToArray();
+
+                IntPtr outData = IntPtr.Zero;
+                uint outLen = 0;
+                ulong outPtr = 0;
+
+                IntPtr exceptionData = IntPtr.Zero;
+                uint exceptionLen = 0;
+                ulong exceptionPtr = 0;
+
+                KerasFitModel(bytes, (uint)bytes.Length, ref outData, ref outLen, ref outPtr, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+                if (exceptionLen == 0)
+                {
+                    var resultBytes = new byte[outLen];
+                    Marshal.Copy(outData, resultBytes, 0, (int)outLen);
+
+                    KerasDeletePointer(outPtr);
+
+                    var resultProto = KerasProto.Parser.ParseFrom(resultBytes);
+                    _uuid = resultProto.ModelUuid;
+                    return resultProto.Evaluation.Values();
+                }
+                else
+                {
+                    var outBytes = new byte[exceptionLen];
+                    Marshal.Copy(exceptionData, outBytes, 0, (int)exceptionLen);
+
+                    var exception = new KerasException(Encoding.ASCII.GetString(outBytes));
+                    KerasDeletePointer(exceptionPtr);
+
+                    throw exception;
+                }
+            }
+        }
+
+        // A resident model and trainer for TrainOnBatch and PredictOnBatch, built from the graph and the
+        // compile parameters [on top of the loaded model, if any]. nsamples is the epoch of the learning
+        // rate schedules, a batch when 0.
+        public Session CreateSession(uint batchSize = 32, uint nsamples = 0)
+        {
+            KerasProto kerasProto = new KerasProto();
+            SetGraph(kerasProto);
+            SetFitParams(kerasProto);
+
+            kerasProto.BatchSize = batchSize;
+            kerasProto.Nsamples = nsamples;
+
+            return new Session(kerasProto);
+        }
+
+        // Low latency inference over raw float rows, the model stays resident in the predictor
+        public Predictor CreatePredictor()
+        {
+            return new Predictor(_model ?? File.ReadAllBytes(_path));
+        }
+
+        // The model compiled into self-contained C++ source, to build as a shared library exporting
+        // <prefix>_predict, <prefix>_input_size and <prefix>_output_size. Dense, Conv2D, pooling and
+        // activation layers only.
+        public string ExportCpp(string prefix = "keras")
+        {
+            KerasProto kerasProto = new KerasProto();
+
+            if (_model != null) kerasProto.Model = ByteString.CopyFrom(_model);
+            kerasProto.ModelUuid = _uuid;
+            kerasProto.ModelPath = _path;
+            kerasProto.CppPrefix = prefix;
+
+            kerasProto.Command = KerasCommand.ExportCpp;
+
+            using (var stream = new MemoryStream())
+            {
+                kerasProto.WriteTo(stream);
+                var bytes = stream.ToArray();
+
+                IntPtr outData = IntPtr.Zero;
+                uint outLen = 0;
+                ulong outPtr = 0;
+
+                IntPtr exceptionData = IntPtr.Zero;
+                uint exceptionLen = 0;
+                ulong exceptionPtr = 0;
+
+                KerasFitModel(bytes, (uint)bytes.Length, ref outData, ref outLen, ref outPtr, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+                if (exceptionLen == 0)
+                {
+                    var resultBytes = new byte[outLen];
+                    Marshal.Copy(outData, resultBytes, 0, (int)outLen);
+
+                    KerasDeletePointer(outPtr);
+
+                    var resultProto = KerasProto.Parser.ParseFrom(resultBytes);
+                    _uuid = resultProto.ModelUuid;
+                    return resultProto.CppSource;
+                }
+                else
+                {
+                    var outBytes = new byte[exceptionLen];
+                    Marshal.Copy(exceptionData, outBytes, 0, (int)exceptionLen);
+
+                    var exception = new KerasException(Encoding.ASCII.GetString(outBytes));
+                    KerasDeletePointer(exceptionPtr);
+
+                    throw exception;
+                }
+            }
+        }
+
+        public Tensor Predict(Tensor x, uint batchSize = 32, uint verbose = 1, bool cache = true, int[] sequenceLengths = null)
+        {
+            return Predict(x.GetProto(sequenceLengths), batchSize, verbose, cache);
+        }
+
+        public Tensor Predict(TensorProto x, uint batchSize = 32, uint verbose = 1, bool cache = true)
+        {
+            return TensorUtils.Deserialize(Predict(x, batchSize, verbose, cache, 0).Outputs[0]);
+        }
+
+        // The indices of the k classes with the largest outputs of every row, the largest first, and
+        // their scores. k = 1 is the argmax.
+        public Tensor PredictTopK(Tensor x, uint k, out Tensor scores, uint batchSize = 32, uint verbose = 1, bool cache = true, int[] sequenceLengths = null)
+        {
+            return PredictTopK(x.GetProto(sequenceLengths), k, out scores, batchSize, verbose, cache);
+        }
+
+        public Tensor PredictTopK(TensorProto x, uint k, out Tensor scores, uint batchSize = 32, uint verbose = 1, bool cache = true)
+        {
+            if (k == 0)
+                throw new ArgumentException("k must be positive", nameof(k));
+
+            var resultProto = Predict(x, batchSize, verbose, cache, k);
+            scores = TensorUtils.Deserialize(resultProto.Outputs[1]);
+            return TensorUtils.Deserialize(resultProto.Outputs[0]);
+        }
+
+        // The activations of the named layers [or the nodes of a loaded model], one tensor per name,
+        // in a single pass that stops at the deepest of them
+        public Tensor[] PredictLayers(Tensor x, string[] layers, uint batchSize = 32, uint verbose = 1, bool cache = true, int[] sequenceLengths = null)
+        {
+            return PredictLayers(x.GetProto(sequenceLengths), layers, batchSize, verbose, cache);
+        }
+
+        public Tensor[] PredictLayers(TensorProto x, string[] layers, uint batchSize = 32, uint verbose = 1, bool cache = true)
+        {
+            if (layers == null || layers.Length == 0)
+                throw new ArgumentException("No layers to predict", nameof(layers));
+
+            var resultProto = Predict(x, batchSize, verbose, cache, 0, layers);
+            return resultProto.Outputs.Select(o => TensorUtils.Deserialize(o)).ToArray();
+        }
+
+        // Streamed predictions: the outputs of every batch are handed to onOutput as soon as they are
+        // computed, with the index of their first row, instead of being returned all at the end
+        public void PredictStream(Tensor x, Action<ulong, Tensor> onOutput, uint batchSize = 32, uint verbose = 1, bool cache = true, int[] sequenceLengths = null)
+        {
+            PredictStream(x.GetProto(sequenceLengths), onOutput, batchSize, verbose, cache);
+        }
+
+        public void PredictStream(TensorProto x, Action<ulong, Tensor> onOutput, uint batchSize = 32, uint verbose = 1, bool cache = true)
+        {
+            if (onOutput == null)
+                throw new ArgumentNullException(nameof(onOutput));
+
+            OutputCallback callback = (data, length) =>
             {
-                ["cache"] = cache
+                var bytes = new byte[length];
+                Marshal.Copy(data, bytes, 0, (int)length);
+
+                var chunk = OutputChunkProto.Parser.ParseFrom(bytes);
+                onOutput(chunk.Offset, TensorUtils.Deserialize(chunk.Outputs[0]));
             };
-            kerasProto.PredictParams = jobj.ToString(Formatting.None);
+
+            Predict(x, batchSize, verbose, cache, 0, null, callback);
+        }
+
+        private KerasProto Predict(TensorProto x, uint batchSize, uint verbose, bool cache, uint topK, string[] outputLayers = null, OutputCallback outputCallback = null)
+        {
+            KerasProto kerasProto = new KerasProto();
+
+            kerasProto.BatchSize = batchSize;
+            kerasProto.Verbose = verbose;
+
+            kerasProto.Predict = new PredictParamsProto() { NoCache = !cache, MaxBatchSize = MaxBatchSize, MaxWaitUs = MaxBatchWaitMicroseconds, TopK = topK };
+            if (outputLayers != null)
+                kerasProto.Predict.OutputLayers.Add(outputLayers);
+            if (outputCallback != null)
+                kerasProto.OutputCallback = (ulong)Marshal.GetFunctionPointerForDelegate(outputCallback);
 
             // TODO Consider not copying the model if we have a uuid
             if(_model != null) kerasProto.Model = ByteString.CopyFrom(_model);
             kerasProto.ModelUuid = _uuid;
             kerasProto.ModelPath = _path;
-            kerasProto.Inputs.Add(x.GetProto());
+            kerasProto.Inputs.Add(x);
 
             kerasProto.Command = KerasCommand.Predict;
 
@@ -772,6 +1415,8 @@ namespace Keras
                 ulong exceptionPtr = 0;
 
                 KerasFitModel(bytes, (uint)bytes.Length, ref outData, ref outLen, ref outPtr, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+                // The native side calls it until KerasFitModel returns
+                GC.KeepAlive(outputCallback);
 
                 if (exceptionLen == 0)
                 {
@@ -782,7 +1427,7 @@ namespace Keras
 
                     var resultProto = KerasProto.Parser.ParseFrom(resultBytes);
                     _uuid = resultProto.ModelUuid;
-                    return TensorUtils.Deserialize(resultProto.Outputs[0]);
+                    return resultProto;
                 }
                 else
                 {
@@ -817,6 +1462,7 @@ namespace Keras
         {
             var result = new Sequential();
             result._path = path;
+            result._basePath = path;
             return result;
         }
 
@@ -827,6 +1473,7 @@ namespace Keras
             {
                 stream.CopyTo(buffer);
                 result._model = buffer.ToArray();
+                result._baseModel = result._model;
             }
             return result;
         }
@@ -834,6 +1481,9 @@ namespace Keras
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         public delegate void ProgressCallback(IntPtr data, uint length);
 
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        public delegate void OutputCallback(IntPtr data, uint length);
+
         private class ProgressCallbackState
         {
             private IProgressWriter _writer;
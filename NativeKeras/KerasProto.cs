@@ -22,7 +22,7 @@ namespace Keras {
     static KerasProtoReflection() {
       byte[] descriptorData = global::System.Convert.FromBase64String(
           string.Concat(
-            "ChBLZXJhc1Byb3RvLnByb3RvEgVrZXJhcyKZAwoKS2VyYXNQcm90bxINCgVn",
+            "ChBLZXJhc1Byb3RvLnByb3RvEgVrZXJhcyK0BwoKS2VyYXNQcm90bxINCgVn",
             "cmFwaBgBIAEoCRINCgVtb2RlbBgCIAEoDBISCgptb2RlbF9wYXRoGAMgASgJ",
             "EhIKCm1vZGVsX3V1aWQYBCABKAkSFgoOY29tcGlsZV9wYXJhbXMYBSABKAkS",
             "EgoKZml0X3BhcmFtcxgGIAEoCRIWCg5wcmVkaWN0X3BhcmFtcxgHIAEoCRIM",
@@ -31,33 +31,105 @@ namespace Keras {
             "ZXBvY2hzGA0gASgNEg8KB3ZlcmJvc2UYDiABKA0SIgoGaW5wdXRzGA8gAygL",
             "MhIua2VyYXMuVGVuc29yUHJvdG8SIwoHb3V0cHV0cxgQIAMoCzISLmtlcmFz",
             "LlRlbnNvclByb3RvEhkKEXByb2dyZXNzX2NhbGxiYWNrGBEgASgEEiQKB2Nv",
-            "bW1hbmQYEiABKA4yEy5rZXJhcy5LZXJhc0NvbW1hbmQijgEKC1RlbnNvclBy",
-            "b3RvEh0KBHR5cGUYASABKA4yDy5rZXJhcy5EYXRhVHlwZRIjCgZmb3JtYXQY",
-            "AiABKA4yEy5rZXJhcy5UZW5zb3JGb3JtYXQSDQoFY291bnQYAyABKAUSDQoF",
-            "c2hhcGUYBCADKAUSDwoHaW5kaWNlcxgFIAMoBRIMCgRkYXRhGAYgASgMIkUK",
-            "GFN0cmVhbUNvbmZpZ3VyYXRpb25Qcm90bxIMCgRuYW1lGAEgASgJEgsKA2Rp",
-            "bRgCIAEoAxIOCgZzcGFyc2UYAyABKAgiVQoTVGV4dERhdGFTb3VyY2VQcm90",
-            "bxIMCgRwYXRoGAEgASgJEjAKB3N0cmVhbXMYAiADKAsyHy5rZXJhcy5TdHJl",
-            "YW1Db25maWd1cmF0aW9uUHJvdG8idQoMSGlzdG9yeVByb3RvEigKBHR5cGUY",
-            "ASABKA4yGi5rZXJhcy5IaXN0b3J5Q2FsbGJhY2tUeXBlEgoKAmlkGAIgASgN",
-            "Eg0KBW5hbWVzGAMgAygJEg4KBnZhbHVlcxgEIAMoARIQCghuc2FtcGxlcxgF",
-            "IAEoBCokCgxLZXJhc0NvbW1hbmQSBwoDRml0EAASCwoHUHJlZGljdBABKi0K",
-            "DFRlbnNvckZvcm1hdBIMCghSb3dNYWpvchAAEg8KC0NvbHVtbk1ham9yEAEq",
-            "oAEKCERhdGFUeXBlEgkKBUZsb2F0EAASCgoGRG91YmxlEAESCQoFSW50MzIQ",
-            "AhIJCgVJbnQ2NBADEgoKBlVJbnQzMhAEEgoKBlVJbnQ2NBAFEgoKBlN0cmlu",
-            "ZxAGEggKBEludDgQBxIJCgVJbnQxNhAIEgkKBVVJbnQ4EAkSCgoGVUludDE2",
-            "EAoSCAoEQm9vbBALEg0KCVVuZGVmaW5lZBAMKnUKE0hpc3RvcnlDYWxsYmFj",
-            "a1R5cGUSEQoNVHJhaW5pbmdCZWdpbhAAEg8KC1RyYWluaW5nRW5kEAESDgoK",
-            "QmF0Y2hCZWdpbhACEgwKCEJhdGNoRW5kEAMSDgoKRXBvY2hCZWdpbhAEEgwK",
-            "CEVwb2NoRW5kEAVCCKoCBUtlcmFzYgZwcm90bzM="));
+            "bW1hbmQYEiABKA4yEy5rZXJhcy5LZXJhc0NvbW1hbmQSIQoGbGF5ZXJzGBMg",
+            "AygLMhEua2VyYXMuTGF5ZXJQcm90bxIqCgdjb21waWxlGBQgASgLMhkua2Vy",
+            "YXMuQ29tcGlsZVBhcmFtc1Byb3RvEioKB3ByZWRpY3QYFSABKAsyGS5rZXJh",
+            "cy5QcmVkaWN0UGFyYW1zUHJvdG8SDwoHd29ya2VycxgWIAEoDRIQCghwYXJh",
+            "bGxlbBgXIAEoCRIyCgtkaXN0cmlidXRlZBgYIAEoCzIdLmtlcmFzLkRpc3Ry",
+            "aWJ1dGVkUGFyYW1zUHJvdG8SIwobZ3JhZGllbnRfYWNjdW11bGF0aW9uX3N0",
+            "ZXBzGBkgASgNEjAKCmNoZWNrcG9pbnQYGiABKAsyHC5rZXJhcy5DaGVja3Bv",
+            "aW50UGFyYW1zUHJvdG8SFQoNZnJvemVuX2xheWVycxgbIAMoCRIsCghwcm9n",
+            "cmVzcxgcIAEoCzIaLmtlcmFzLlByb2dyZXNzUGFyYW1zUHJvdG8SJwoKZXZh",
+            "bHVhdGlvbhgdIAEoCzITLmtlcmFzLkhpc3RvcnlQcm90bxIUCgxjYWNoZV9i",
+            "dWRnZXQYHiABKAQSKwoLY2FjaGVfc3RhdHMYHyABKAsyFi5rZXJhcy5DYWNo",
+            "ZVN0YXRzUHJvdG8SEgoKY3BwX3ByZWZpeBggIAEoCRISCgpjcHBfc291cmNl",
+            "GCEgASgJEhcKD291dHB1dF9jYWxsYmFjaxgiIAEoBCKoAQoLVGVuc29yUHJv",
+            "dG8SHQoEdHlwZRgBIAEoDjIPLmtlcmFzLkRhdGFUeXBlEiMKBmZvcm1hdBgC",
+            "IAEoDjITLmtlcmFzLlRlbnNvckZvcm1hdBINCgVjb3VudBgDIAEoBRINCgVz",
+            "aGFwZRgEIAMoBRIPCgdpbmRpY2VzGAUgAygFEgwKBGRhdGEYBiABKAwSGAoQ",
+            "c2VxdWVuY2VfbGVuZ3RocxgHIAMoBSJFChhTdHJlYW1Db25maWd1cmF0aW9u",
+            "UHJvdG8SDAoEbmFtZRgBIAEoCRILCgNkaW0YAiABKAMSDgoGc3BhcnNlGAMg",
+            "ASgIIlUKE1RleHREYXRhU291cmNlUHJvdG8SDAoEcGF0aBgBIAEoCRIwCgdz",
+            "dHJlYW1zGAIgAygLMh8ua2VyYXMuU3RyZWFtQ29uZmlndXJhdGlvblByb3Rv",
+            "InUKDEhpc3RvcnlQcm90bxIoCgR0eXBlGAEgASgOMhoua2VyYXMuSGlzdG9y",
+            "eUNhbGxiYWNrVHlwZRIKCgJpZBgCIAEoDRINCgVuYW1lcxgDIAMoCRIOCgZ2",
+            "YWx1ZXMYBCADKAESEAoIbnNhbXBsZXMYBSABKAQiSgoQSW5pdGlhbGl6ZXJQ",
+            "cm90bxIKCgJvcBgBIAEoCRINCgV2YWx1ZRgCIAEoARINCgVzY2FsZRgDIAEo",
+            "ARIMCgRzZWVkGAQgASgEIugGCgpMYXllclByb3RvEgoKAm9wGAEgASgJEgwK",
+            "BG5hbWUYAiABKAkSEwoLaW5wdXRfc2hhcGUYAyADKAUSDQoFdW5pdHMYBCAB",
+            "KA0SEgoKYWN0aXZhdGlvbhgFIAEoCRIQCgh1c2VfYmlhcxgGIAEoCBIzChJr",
+            "ZXJuZWxfaW5pdGlhbGl6ZXIYByABKAsyFy5rZXJhcy5Jbml0aWFsaXplclBy",
+            "b3RvEjEKEGJpYXNfaW5pdGlhbGl6ZXIYCCABKAsyFy5rZXJhcy5Jbml0aWFs",
+            "aXplclByb3RvEg8KB2ZpbHRlcnMYCSABKA0SEwoLa2VybmVsX3NpemUYCiAD",
+            "KAUSDwoHc3RyaWRlcxgLIAMoBRIPCgdwYWRkaW5nGAwgASgJEhEKCXBvb2xf",
+            "c2l6ZRgNIAMoBRIMCgRyYXRlGA4gASgBEgwKBHNlZWQYDyABKAQSEQoJaW5w",
+            "dXRfZGltGBAgASgNEhIKCm91dHB1dF9kaW0YESABKA0SFAoMaW5wdXRfbGVu",
+            "Z3RoGBIgASgNEhwKFHJlY3VycmVudF9hY3RpdmF0aW9uGBMgASgJEjYKFXJl",
+            "Y3VycmVudF9pbml0aWFsaXplchgUIAEoCzIXLmtlcmFzLkluaXRpYWxpemVy",
+            "UHJvdG8SGAoQdW5pdF9mb3JnZXRfYmlhcxgVIAEoCBIYChByZXR1cm5fc2Vx",
+            "dWVuY2VzGBYgASgIEhQKDGdvX2JhY2t3YXJkcxgXIAEoCBIPCgdkcm9wb3V0",
+            "GBggASgBEhkKEXJlY3VycmVudF9kcm9wb3V0GBkgASgBEjcKFmVtYmVkZGlu",
+            "Z3NfaW5pdGlhbGl6ZXIYGiABKAsyFy5rZXJhcy5Jbml0aWFsaXplclByb3Rv",
+            "EhEKCW1hc2tfemVybxgbIAEoCBIUCgxoYXNoX2J1Y2tldHMYHCABKA0SEgoK",
+            "bnVtX2hhc2hlcxgdIAEoDRIOCgZncm91cHMYHiABKA0SGAoQZGVwdGhfbXVs",
+            "dGlwbGllchgfIAEoDRI2ChVkZXB0aHdpc2VfaW5pdGlhbGl6ZXIYICABKAsy",
+            "Fy5rZXJhcy5Jbml0aWFsaXplclByb3RvEjYKFXBvaW50d2lzZV9pbml0aWFs",
+            "aXplchghIAEoCzIXLmtlcmFzLkluaXRpYWxpemVyUHJvdG8i4wEKDk9wdGlt",
+            "aXplclByb3RvEgoKAm9wGAEgASgJEgoKAmxyGAIgASgBEhAKCG1vbWVudHVt",
+            "GAMgASgBEg0KBWRlY2F5GAQgASgBEhAKCG5lc3Rlcm92GAUgASgIEgsKA3Jo",
+            "bxgGIAEoARIPCgdlcHNpbG9uGAcgASgBEg4KBmJldGFfMRgIIAEoARIOCgZi",
+            "ZXRhXzIYCSABKAESFAoMd2VpZ2h0X2RlY2F5GAogASgBEjIKCHNjaGVkdWxl",
+            "GAsgASgLMiAua2VyYXMuTGVhcm5pbmdSYXRlU2NoZWR1bGVQcm90byJsChJD",
+            "b21waWxlUGFyYW1zUHJvdG8SKAoJb3B0aW1pemVyGAEgASgLMhUua2VyYXMu",
+            "T3B0aW1pemVyUHJvdG8SDAoEbG9zcxgCIAEoCRIPCgdtZXRyaWNzGAMgAygJ",
+            "Eg0KBXRvcF9rGAQgASgNInkKElByZWRpY3RQYXJhbXNQcm90bxIQCghub19j",
+            "YWNoZRgBIAEoCBIWCg5tYXhfYmF0Y2hfc2l6ZRgCIAEoDRITCgttYXhfd2Fp",
+            "dF91cxgDIAEoDRINCgV0b3BfaxgEIAEoDRIVCg1vdXRwdXRfbGF5ZXJzGAUg",
+            "AygJInwKGUxlYXJuaW5nUmF0ZVNjaGVkdWxlUHJvdG8SCgoCb3AYASABKAkS",
+            "DQoFZ2FtbWEYAiABKAESEQoJc3RlcF9zaXplGAMgASgNEg4KBndhcm11cBgE",
+            "IAEoDRIOCgZtaW5fbHIYBSABKAESEQoJcGVyX2JhdGNoGAYgASgIInUKFkRp",
+            "c3RyaWJ1dGVkUGFyYW1zUHJvdG8SCgoCb3AYASABKAkSIAoYZGlzdHJpYnV0",
+            "ZV9hZnRlcl9zYW1wbGVzGAIgASgEEhIKCmJsb2NrX3NpemUYAyABKAQSGQoR",
+            "cXVhbnRpemF0aW9uX2JpdHMYBCABKA0iYwoVQ2hlY2twb2ludFBhcmFtc1By",
+            "b3RvEgwKBHBhdGgYASABKAkSFQoNZXZlcnlfYmF0Y2hlcxgCIAEoDRIVCg1l",
+            "dmVyeV9taW51dGVzGAMgASgBEg4KBnJlc3VtZRgEIAEoCCJiChNQcm9ncmVz",
+            "c1BhcmFtc1Byb3RvEg0KBWFzeW5jGAEgASgIEhUKDWV2ZXJ5X2JhdGNoZXMY",
+            "AiABKA0SEAoIZXZlcnlfbXMYAyABKA0SEwoLZXBvY2hzX29ubHkYBCABKAgi",
+            "cQoPQ2FjaGVTdGF0c1Byb3RvEgwKBGhpdHMYASABKAQSDgoGbWlzc2VzGAIg",
+            "ASgEEhEKCWV2aWN0aW9ucxgDIAEoBBIOCgZtb2RlbHMYBCABKAQSDQoFYnl0",
+            "ZXMYBSABKAQSDgoGYnVkZ2V0GAYgASgEIkcKEE91dHB1dENodW5rUHJvdG8S",
+            "DgoGb2Zmc2V0GAEgASgEEiMKB291dHB1dHMYAiADKAsyEi5rZXJhcy5UZW5z",
+            "b3JQcm90byqUAQoMS2VyYXNDb21tYW5kEgcKA0ZpdBAAEgsKB1ByZWRpY3QQ",
+            "ARIMCghFdmFsdWF0ZRACEg8KC1VubG9hZE1vZGVsEAMSDAoIUGluTW9kZWwQ",
+            "BBIOCgpVbnBpbk1vZGVsEAUSDgoKQ2FjaGVTdGF0cxAGEhIKDlNldENhY2hl",
+            "QnVkZ2V0EAcSDQoJRXhwb3J0Q3BwEAgqLQoMVGVuc29yRm9ybWF0EgwKCFJv",
+            "d01ham9yEAASDwoLQ29sdW1uTWFqb3IQASqgAQoIRGF0YVR5cGUSCQoFRmxv",
+            "YXQQABIKCgZEb3VibGUQARIJCgVJbnQzMhACEgkKBUludDY0EAMSCgoGVUlu",
+            "dDMyEAQSCgoGVUludDY0EAUSCgoGU3RyaW5nEAYSCAoESW50OBAHEgkKBUlu",
+            "dDE2EAgSCQoFVUludDgQCRIKCgZVSW50MTYQChIICgRCb29sEAsSDQoJVW5k",
+            "ZWZpbmVkEAwqdQoTSGlzdG9yeUNhbGxiYWNrVHlwZRIRCg1UcmFpbmluZ0Jl",
+            "Z2luEAASDwoLVHJhaW5pbmdFbmQQARIOCgpCYXRjaEJlZ2luEAISDAoIQmF0",
+            "Y2hFbmQQAxIOCgpFcG9jaEJlZ2luEAQSDAoIRXBvY2hFbmQQBUIIqgIFS2Vy",
+            "YXNiBnByb3RvMw=="));
       descriptor = pbr::FileDescriptor.FromGeneratedCode(descriptorData,
           new pbr::FileDescriptor[] { },
           new pbr::GeneratedClrTypeInfo(new[] {typeof(global::Keras.KerasCommand), typeof(global::Keras.TensorFormat), typeof(global::Keras.DataType), typeof(global::Keras.HistoryCallbackType), }, new pbr::GeneratedClrTypeInfo[] {
-            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.KerasProto), global::Keras.KerasProto.Parser, new[]{ "Graph", "Model", "ModelPath", "ModelUuid", "CompileParams", "FitParams", "PredictParams", "Path", "Nsamples", "Nfeatures", "Nlabels", "BatchSize", "Epochs", "Verbose", "Inputs", "Outputs", "ProgressCallback", "Command" }, null, null, null),
-            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.TensorProto), global::Keras.TensorProto.Parser, new[]{ "Type", "Format", "Count", "Shape", "Indices", "Data" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.KerasProto), global::Keras.KerasProto.Parser, new[]{ "Graph", "Model", "ModelPath", "ModelUuid", "CompileParams", "FitParams", "PredictParams", "Path", "Nsamples", "Nfeatures", "Nlabels", "BatchSize", "Epochs", "Verbose", "Inputs", "Outputs", "ProgressCallback", "Command", "Layers", "Compile", "Predict", "Workers", "Parallel", "Distributed", "GradientAccumulationSteps", "Checkpoint", "FrozenLayers", "Progress", "Evaluation", "CacheBudget", "CacheStats", "CppPrefix", "CppSource", "OutputCallback" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.TensorProto), global::Keras.TensorProto.Parser, new[]{ "Type", "Format", "Count", "Shape", "Indices", "Data", "SequenceLengths" }, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::Keras.StreamConfigurationProto), global::Keras.StreamConfigurationProto.Parser, new[]{ "Name", "Dim", "Sparse" }, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::Keras.TextDataSourceProto), global::Keras.TextDataSourceProto.Parser, new[]{ "Path", "Streams" }, null, null, null),
-            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.HistoryProto), global::Keras.HistoryProto.Parser, new[]{ "Type", "Id", "Names", "Values", "Nsamples" }, null, null, null)
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.HistoryProto), global::Keras.HistoryProto.Parser, new[]{ "Type", "Id", "Names", "Values", "Nsamples" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.InitializerProto), global::Keras.InitializerProto.Parser, new[]{ "Op", "Value", "Scale", "Seed" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.LayerProto), global::Keras.LayerProto.Parser, new[]{ "Op", "Name", "InputShape", "Units", "Activation", "UseBias", "KernelInitializer", "BiasInitializer", "Filters", "KernelSize", "Strides", "Padding", "PoolSize", "Rate", "Seed", "InputDim", "OutputDim", "InputLength", "RecurrentActivation", "RecurrentInitializer", "UnitForgetBias", "ReturnSequences", "GoBackwards", "Dropout", "RecurrentDropout", "EmbeddingsInitializer", "MaskZero", "HashBuckets", "NumHashes", "Groups", "DepthMultiplier", "DepthwiseInitializer", "PointwiseInitializer" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.OptimizerProto), global::Keras.OptimizerProto.Parser, new[]{ "Op", "Lr", "Momentum", "Decay", "Nesterov", "Rho", "Epsilon", "Beta1", "Beta2", "WeightDecay", "Schedule" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.CompileParamsProto), global::Keras.CompileParamsProto.Parser, new[]{ "Optimizer", "Loss", "Metrics", "TopK" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.PredictParamsProto), global::Keras.PredictParamsProto.Parser, new[]{ "NoCache", "MaxBatchSize", "MaxWaitUs", "TopK", "OutputLayers" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.LearningRateScheduleProto), global::Keras.LearningRateScheduleProto.Parser, new[]{ "Op", "Gamma", "StepSize", "Warmup", "MinLr", "PerBatch" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.DistributedParamsProto), global::Keras.DistributedParamsProto.Parser, new[]{ "Op", "DistributeAfterSamples", "BlockSize", "QuantizationBits" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.CheckpointParamsProto), global::Keras.CheckpointParamsProto.Parser, new[]{ "Path", "EveryBatches", "EveryMinutes", "Resume" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.ProgressParamsProto), global::Keras.ProgressParamsProto.Parser, new[]{ "Async", "EveryBatches", "EveryMs", "EpochsOnly" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.CacheStatsProto), global::Keras.CacheStatsProto.Parser, new[]{ "Hits", "Misses", "Evictions", "Models", "Bytes", "Budget" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Keras.OutputChunkProto), global::Keras.OutputChunkProto.Parser, new[]{ "Offset", "Outputs" }, null, null, null)
           }));
     }
     #endregion
@@ -67,6 +139,16 @@ namespace Keras {
   public enum KerasCommand {
     [pbr::OriginalName("Fit")] Fit = 0,
     [pbr::OriginalName("Predict")] Predict = 1,
+    [pbr::OriginalName("Evaluate")] Evaluate = 2,
+    /// <summary>
+    /// The model cache, model_uuid is the model
+    /// </summary>
+    [pbr::OriginalName("UnloadModel")] UnloadModel = 3,
+    [pbr::OriginalName("PinModel")] PinModel = 4,
+    [pbr::OriginalName("UnpinModel")] UnpinModel = 5,
+    [pbr::OriginalName("CacheStats")] CacheStats = 6,
+    [pbr::OriginalName("SetCacheBudget")] SetCacheBudget = 7,
+    [pbr::OriginalName("ExportCpp")] ExportCpp = 8,
   }
 
   public enum TensorFormat {
@@ -144,6 +226,22 @@ namespace Keras {
       outputs_ = other.outputs_.Clone();
       progressCallback_ = other.progressCallback_;
       command_ = other.command_;
+      layers_ = other.layers_.Clone();
+      Compile = other.compile_ != null ? other.Compile.Clone() : null;
+      Predict = other.predict_ != null ? other.Predict.Clone() : null;
+      workers_ = other.workers_;
+      parallel_ = other.parallel_;
+      Distributed = other.distributed_ != null ? other.Distributed.Clone() : null;
+      gradientAccumulationSteps_ = other.gradientAccumulationSteps_;
+      Checkpoint = other.checkpoint_ != null ? other.Checkpoint.Clone() : null;
+      frozenLayers_ = other.frozenLayers_.Clone();
+      Progress = other.progress_ != null ? other.Progress.Clone() : null;
+      Evaluation = other.evaluation_ != null ? other.Evaluation.Clone() : null;
+      cacheBudget_ = other.cacheBudget_;
+      CacheStats = other.cacheStats_ != null ? other.CacheStats.Clone() : null;
+      cppPrefix_ = other.cppPrefix_;
+      cppSource_ = other.cppSource_;
+      outputCallback_ = other.outputCallback_;
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -353,6 +451,205 @@ namespace Keras {
       }
     }
 
+    /// <summary>Field number for the "layers" field.</summary>
+    public const int LayersFieldNumber = 19;
+    private static readonly pb::FieldCodec<global::Keras.LayerProto> _repeated_layers_codec
+        = pb::FieldCodec.ForMessage(154, global::Keras.LayerProto.Parser);
+    private readonly pbc::RepeatedField<global::Keras.LayerProto> layers_ = new pbc::RepeatedField<global::Keras.LayerProto>();
+    /// <summary>
+    /// Typed alternatives to graph, compile_params and predict_params
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<global::Keras.LayerProto> Layers {
+      get { return layers_; }
+    }
+
+    /// <summary>Field number for the "compile" field.</summary>
+    public const int CompileFieldNumber = 20;
+    private global::Keras.CompileParamsProto compile_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.CompileParamsProto Compile {
+      get { return compile_; }
+      set {
+        compile_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "predict" field.</summary>
+    public const int PredictFieldNumber = 21;
+    private global::Keras.PredictParamsProto predict_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.PredictParamsProto Predict {
+      get { return predict_; }
+      set {
+        predict_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "workers" field.</summary>
+    public const int WorkersFieldNumber = 22;
+    private uint workers_;
+    /// <summary>
+    /// Local data parallel training: the number of worker threads, allreduce or hogwild
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint Workers {
+      get { return workers_; }
+      set {
+        workers_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "parallel" field.</summary>
+    public const int ParallelFieldNumber = 23;
+    private string parallel_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Parallel {
+      get { return parallel_; }
+      set {
+        parallel_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "distributed" field.</summary>
+    public const int DistributedFieldNumber = 24;
+    private global::Keras.DistributedParamsProto distributed_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.DistributedParamsProto Distributed {
+      get { return distributed_; }
+      set {
+        distributed_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "gradient_accumulation_steps" field.</summary>
+    public const int GradientAccumulationStepsFieldNumber = 25;
+    private uint gradientAccumulationSteps_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint GradientAccumulationSteps {
+      get { return gradientAccumulationSteps_; }
+      set {
+        gradientAccumulationSteps_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "checkpoint" field.</summary>
+    public const int CheckpointFieldNumber = 26;
+    private global::Keras.CheckpointParamsProto checkpoint_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.CheckpointParamsProto Checkpoint {
+      get { return checkpoint_; }
+      set {
+        checkpoint_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "frozen_layers" field.</summary>
+    public const int FrozenLayersFieldNumber = 27;
+    private static readonly pb::FieldCodec<string> _repeated_frozen_layers_codec
+        = pb::FieldCodec.ForString(218);
+    private readonly pbc::RepeatedField<string> frozenLayers_ = new pbc::RepeatedField<string>();
+    /// <summary>
+    /// Fine-tuning: the named layers are not trained
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<string> FrozenLayers {
+      get { return frozenLayers_; }
+    }
+
+    /// <summary>Field number for the "progress" field.</summary>
+    public const int ProgressFieldNumber = 28;
+    private global::Keras.ProgressParamsProto progress_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.ProgressParamsProto Progress {
+      get { return progress_; }
+      set {
+        progress_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "evaluation" field.</summary>
+    public const int EvaluationFieldNumber = 29;
+    private global::Keras.HistoryProto evaluation_;
+    /// <summary>
+    /// The output of Evaluate: the mean loss and metrics, and the number of samples
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.HistoryProto Evaluation {
+      get { return evaluation_; }
+      set {
+        evaluation_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "cache_budget" field.</summary>
+    public const int CacheBudgetFieldNumber = 30;
+    private ulong cacheBudget_;
+    /// <summary>
+    /// The model cache's memory budget in bytes for SetCacheBudget, 0 for no limit
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong CacheBudget {
+      get { return cacheBudget_; }
+      set {
+        cacheBudget_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "cache_stats" field.</summary>
+    public const int CacheStatsFieldNumber = 31;
+    private global::Keras.CacheStatsProto cacheStats_;
+    /// <summary>
+    /// The output of the model cache commands
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.CacheStatsProto CacheStats {
+      get { return cacheStats_; }
+      set {
+        cacheStats_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "cpp_prefix" field.</summary>
+    public const int CppPrefixFieldNumber = 32;
+    private string cppPrefix_ = "";
+    /// <summary>
+    /// ExportCpp: the prefix of the exported functions, keras by default, and the generated source
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string CppPrefix {
+      get { return cppPrefix_; }
+      set {
+        cppPrefix_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "cpp_source" field.</summary>
+    public const int CppSourceFieldNumber = 33;
+    private string cppSource_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string CppSource {
+      get { return cppSource_; }
+      set {
+        cppSource_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "output_callback" field.</summary>
+    public const int OutputCallbackFieldNumber = 34;
+    private ulong outputCallback_;
+    /// <summary>
+    /// Streamed Predict: every batch's outputs go to this callback as an OutputChunkProto, and
+    /// the returned outputs are empty
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong OutputCallback {
+      get { return outputCallback_; }
+      set {
+        outputCallback_ = value;
+      }
+    }
+
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     public override bool Equals(object other) {
       return Equals(other as KerasProto);
@@ -384,6 +681,22 @@ namespace Keras {
       if(!outputs_.Equals(other.outputs_)) return false;
       if (ProgressCallback != other.ProgressCallback) return false;
       if (Command != other.Command) return false;
+      if(!layers_.Equals(other.layers_)) return false;
+      if (!object.Equals(Compile, other.Compile)) return false;
+      if (!object.Equals(Predict, other.Predict)) return false;
+      if (Workers != other.Workers) return false;
+      if (Parallel != other.Parallel) return false;
+      if (!object.Equals(Distributed, other.Distributed)) return false;
+      if (GradientAccumulationSteps != other.GradientAccumulationSteps) return false;
+      if (!object.Equals(Checkpoint, other.Checkpoint)) return false;
+      if(!frozenLayers_.Equals(other.frozenLayers_)) return false;
+      if (!object.Equals(Progress, other.Progress)) return false;
+      if (!object.Equals(Evaluation, other.Evaluation)) return false;
+      if (CacheBudget != other.CacheBudget) return false;
+      if (!object.Equals(CacheStats, other.CacheStats)) return false;
+      if (CppPrefix != other.CppPrefix) return false;
+      if (CppSource != other.CppSource) return false;
+      if (OutputCallback != other.OutputCallback) return false;
       return true;
     }
 
@@ -408,6 +721,22 @@ namespace Keras {
       hash ^= outputs_.GetHashCode();
       if (ProgressCallback != 0UL) hash ^= ProgressCallback.GetHashCode();
       if (Command != 0) hash ^= Command.GetHashCode();
+      hash ^= layers_.GetHashCode();
+      if (compile_ != null) hash ^= Compile.GetHashCode();
+      if (predict_ != null) hash ^= Predict.GetHashCode();
+      if (Workers != 0) hash ^= Workers.GetHashCode();
+      if (Parallel.Length != 0) hash ^= Parallel.GetHashCode();
+      if (distributed_ != null) hash ^= Distributed.GetHashCode();
+      if (GradientAccumulationSteps != 0) hash ^= GradientAccumulationSteps.GetHashCode();
+      if (checkpoint_ != null) hash ^= Checkpoint.GetHashCode();
+      hash ^= frozenLayers_.GetHashCode();
+      if (progress_ != null) hash ^= Progress.GetHashCode();
+      if (evaluation_ != null) hash ^= Evaluation.GetHashCode();
+      if (CacheBudget != 0UL) hash ^= CacheBudget.GetHashCode();
+      if (cacheStats_ != null) hash ^= CacheStats.GetHashCode();
+      if (CppPrefix.Length != 0) hash ^= CppPrefix.GetHashCode();
+      if (CppSource.Length != 0) hash ^= CppSource.GetHashCode();
+      if (OutputCallback != 0UL) hash ^= OutputCallback.GetHashCode();
       return hash;
     }
 
@@ -484,6 +813,64 @@ namespace Keras {
         output.WriteRawTag(144, 1);
         output.WriteEnum((int) Command);
       }
+      layers_.WriteTo(output, _repeated_layers_codec);
+      if (compile_ != null) {
+        output.WriteRawTag(162, 1);
+        output.WriteMessage(Compile);
+      }
+      if (predict_ != null) {
+        output.WriteRawTag(170, 1);
+        output.WriteMessage(Predict);
+      }
+      if (Workers != 0) {
+        output.WriteRawTag(176, 1);
+        output.WriteUInt32(Workers);
+      }
+      if (Parallel.Length != 0) {
+        output.WriteRawTag(186, 1);
+        output.WriteString(Parallel);
+      }
+      if (distributed_ != null) {
+        output.WriteRawTag(194, 1);
+        output.WriteMessage(Distributed);
+      }
+      if (GradientAccumulationSteps != 0) {
+        output.WriteRawTag(200, 1);
+        output.WriteUInt32(GradientAccumulationSteps);
+      }
+      if (checkpoint_ != null) {
+        output.WriteRawTag(210, 1);
+        output.WriteMessage(Checkpoint);
+      }
+      frozenLayers_.WriteTo(output, _repeated_frozen_layers_codec);
+      if (progress_ != null) {
+        output.WriteRawTag(226, 1);
+        output.WriteMessage(Progress);
+      }
+      if (evaluation_ != null) {
+        output.WriteRawTag(234, 1);
+        output.WriteMessage(Evaluation);
+      }
+      if (CacheBudget != 0UL) {
+        output.WriteRawTag(240, 1);
+        output.WriteUInt64(CacheBudget);
+      }
+      if (cacheStats_ != null) {
+        output.WriteRawTag(250, 1);
+        output.WriteMessage(CacheStats);
+      }
+      if (CppPrefix.Length != 0) {
+        output.WriteRawTag(130, 2);
+        output.WriteString(CppPrefix);
+      }
+      if (CppSource.Length != 0) {
+        output.WriteRawTag(138, 2);
+        output.WriteString(CppSource);
+      }
+      if (OutputCallback != 0UL) {
+        output.WriteRawTag(144, 2);
+        output.WriteUInt64(OutputCallback);
+      }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -539,6 +926,50 @@ namespace Keras {
       if (Command != 0) {
         size += 2 + pb::CodedOutputStream.ComputeEnumSize((int) Command);
       }
+      size += layers_.CalculateSize(_repeated_layers_codec);
+      if (compile_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(Compile);
+      }
+      if (predict_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(Predict);
+      }
+      if (Workers != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(Workers);
+      }
+      if (Parallel.Length != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeStringSize(Parallel);
+      }
+      if (distributed_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(Distributed);
+      }
+      if (GradientAccumulationSteps != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(GradientAccumulationSteps);
+      }
+      if (checkpoint_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(Checkpoint);
+      }
+      size += frozenLayers_.CalculateSize(_repeated_frozen_layers_codec);
+      if (progress_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(Progress);
+      }
+      if (evaluation_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(Evaluation);
+      }
+      if (CacheBudget != 0UL) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt64Size(CacheBudget);
+      }
+      if (cacheStats_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(CacheStats);
+      }
+      if (CppPrefix.Length != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeStringSize(CppPrefix);
+      }
+      if (CppSource.Length != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeStringSize(CppSource);
+      }
+      if (OutputCallback != 0UL) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt64Size(OutputCallback);
+      }
       return size;
     }
 
@@ -597,6 +1028,71 @@ namespace Keras {
       if (other.Command != 0) {
         Command = other.Command;
       }
+      layers_.Add(other.layers_);
+      if (other.compile_ != null) {
+        if (compile_ == null) {
+          compile_ = new global::Keras.CompileParamsProto();
+        }
+        Compile.MergeFrom(other.Compile);
+      }
+      if (other.predict_ != null) {
+        if (predict_ == null) {
+          predict_ = new global::Keras.PredictParamsProto();
+        }
+        Predict.MergeFrom(other.Predict);
+      }
+      if (other.Workers != 0) {
+        Workers = other.Workers;
+      }
+      if (other.Parallel.Length != 0) {
+        Parallel = other.Parallel;
+      }
+      if (other.distributed_ != null) {
+        if (distributed_ == null) {
+          distributed_ = new global::Keras.DistributedParamsProto();
+        }
+        Distributed.MergeFrom(other.Distributed);
+      }
+      if (other.GradientAccumulationSteps != 0) {
+        GradientAccumulationSteps = other.GradientAccumulationSteps;
+      }
+      if (other.checkpoint_ != null) {
+        if (checkpoint_ == null) {
+          checkpoint_ = new global::Keras.CheckpointParamsProto();
+        }
+        Checkpoint.MergeFrom(other.Checkpoint);
+      }
+      frozenLayers_.Add(other.frozenLayers_);
+      if (other.progress_ != null) {
+        if (progress_ == null) {
+          progress_ = new global::Keras.ProgressParamsProto();
+        }
+        Progress.MergeFrom(other.Progress);
+      }
+      if (other.evaluation_ != null) {
+        if (evaluation_ == null) {
+          evaluation_ = new global::Keras.HistoryProto();
+        }
+        Evaluation.MergeFrom(other.Evaluation);
+      }
+      if (other.CacheBudget != 0UL) {
+        CacheBudget = other.CacheBudget;
+      }
+      if (other.cacheStats_ != null) {
+        if (cacheStats_ == null) {
+          cacheStats_ = new global::Keras.CacheStatsProto();
+        }
+        CacheStats.MergeFrom(other.CacheStats);
+      }
+      if (other.CppPrefix.Length != 0) {
+        CppPrefix = other.CppPrefix;
+      }
+      if (other.CppSource.Length != 0) {
+        CppSource = other.CppSource;
+      }
+      if (other.OutputCallback != 0UL) {
+        OutputCallback = other.OutputCallback;
+      }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -679,6 +1175,91 @@ namespace Keras {
             command_ = (global::Keras.KerasCommand) input.ReadEnum();
             break;
           }
+          case 154: {
+            layers_.AddEntriesFrom(input, _repeated_layers_codec);
+            break;
+          }
+          case 162: {
+            if (compile_ == null) {
+              compile_ = new global::Keras.CompileParamsProto();
+            }
+            input.ReadMessage(compile_);
+            break;
+          }
+          case 170: {
+            if (predict_ == null) {
+              predict_ = new global::Keras.PredictParamsProto();
+            }
+            input.ReadMessage(predict_);
+            break;
+          }
+          case 176: {
+            Workers = input.ReadUInt32();
+            break;
+          }
+          case 186: {
+            Parallel = input.ReadString();
+            break;
+          }
+          case 194: {
+            if (distributed_ == null) {
+              distributed_ = new global::Keras.DistributedParamsProto();
+            }
+            input.ReadMessage(distributed_);
+            break;
+          }
+          case 200: {
+            GradientAccumulationSteps = input.ReadUInt32();
+            break;
+          }
+          case 210: {
+            if (checkpoint_ == null) {
+              checkpoint_ = new global::Keras.CheckpointParamsProto();
+            }
+            input.ReadMessage(checkpoint_);
+            break;
+          }
+          case 218: {
+            frozenLayers_.AddEntriesFrom(input, _repeated_frozen_layers_codec);
+            break;
+          }
+          case 226: {
+            if (progress_ == null) {
+              progress_ = new global::Keras.ProgressParamsProto();
+            }
+            input.ReadMessage(progress_);
+            break;
+          }
+          case 234: {
+            if (evaluation_ == null) {
+              evaluation_ = new global::Keras.HistoryProto();
+            }
+            input.ReadMessage(evaluation_);
+            break;
+          }
+          case 240: {
+            CacheBudget = input.ReadUInt64();
+            break;
+          }
+          case 250: {
+            if (cacheStats_ == null) {
+              cacheStats_ = new global::Keras.CacheStatsProto();
+            }
+            input.ReadMessage(cacheStats_);
+            break;
+          }
+          case 258: {
+            CppPrefix = input.ReadString();
+            break;
+          }
+          case 266: {
+            CppSource = input.ReadString();
+            break;
+          }
+          case 272: {
+            OutputCallback = input.ReadUInt64();
+            break;
+          }
         }
       }
     }
@@ -715,6 +1296,7 @@ namespace Keras {
       shape_ = other.shape_.Clone();
       indices_ = other.indices_.Clone();
       data_ = other.data_;
+      sequenceLengths_ = other.sequenceLengths_.Clone();
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -778,6 +1360,9 @@ namespace Keras {
     /// <summary>Field number for the "data" field.</summary>
     public const int DataFieldNumber = 6;
     private pb::ByteString data_ = pb::ByteString.Empty;
+    /// <summary>
+    /// String tensors are '\0' terminated UTF-8 strings
+    /// </summary>
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     public pb::ByteString Data {
       get { return data_; }
@@ -786,6 +1371,19 @@ namespace Keras {
       }
     }
 
+    /// <summary>Field number for the "sequence_lengths" field.</summary>
+    public const int SequenceLengthsFieldNumber = 7;
+    private static readonly pb::FieldCodec<int> _repeated_sequence_lengths_codec
+        = pb::FieldCodec.ForInt32(58);
+    private readonly pbc::RepeatedField<int> sequenceLengths_ = new pbc::RepeatedField<int>();
+    /// <summary>
+    /// Packed sequences, the steps are along the first axis
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<int> SequenceLengths {
+      get { return sequenceLengths_; }
+    }
+
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     public override bool Equals(object other) {
       return Equals(other as TensorProto);
@@ -805,6 +1403,7 @@ namespace Keras {
       if(!shape_.Equals(other.shape_)) return false;
       if(!indices_.Equals(other.indices_)) return false;
       if (Data != other.Data) return false;
+      if(!sequenceLengths_.Equals(other.sequenceLengths_)) return false;
       return true;
     }
 
@@ -817,6 +1416,7 @@ namespace Keras {
       hash ^= shape_.GetHashCode();
       hash ^= indices_.GetHashCode();
       if (Data.Length != 0) hash ^= Data.GetHashCode();
+      hash ^= sequenceLengths_.GetHashCode();
       return hash;
     }
 
@@ -845,6 +1445,7 @@ namespace Keras {
         output.WriteRawTag(50);
         output.WriteBytes(Data);
       }
+      sequenceLengths_.WriteTo(output, _repeated_sequence_lengths_codec);
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -864,6 +1465,7 @@ namespace Keras {
       if (Data.Length != 0) {
         size += 1 + pb::CodedOutputStream.ComputeBytesSize(Data);
       }
+      size += sequenceLengths_.CalculateSize(_repeated_sequence_lengths_codec);
       return size;
     }
 
@@ -886,6 +1488,7 @@ namespace Keras {
       if (other.Data.Length != 0) {
         Data = other.Data;
       }
+      sequenceLengths_.Add(other.sequenceLengths_);
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -922,6 +1525,11 @@ namespace Keras {
             Data = input.ReadBytes();
             break;
           }
+          case 58:
+          case 56: {
+            sequenceLengths_.AddEntriesFrom(input, _repeated_sequence_lengths_codec);
+            break;
+          }
         }
       }
     }
@@ -1452,6 +2060,3355 @@ namespace Keras {
 
   }
 
+  /// <summary>
+  /// Proto3 scalars have no presence: zero values fall back to the same defaults
+  /// as a missing JSON attribute.
+  /// </summary>
+  public sealed partial class InitializerProto : pb::IMessage<InitializerProto> {
+    private static readonly pb::MessageParser<InitializerProto> _parser = new pb::MessageParser<InitializerProto>(() => new InitializerProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<InitializerProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[5]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public InitializerProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public InitializerProto(InitializerProto other) : this() {
+      op_ = other.op_;
+      value_ = other.value_;
+      scale_ = other.scale_;
+      seed_ = other.seed_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public InitializerProto Clone() {
+      return new InitializerProto(this);
+    }
+
+    /// <summary>Field number for the "op" field.</summary>
+    public const int OpFieldNumber = 1;
+    private string op_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Op {
+      get { return op_; }
+      set {
+        op_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "value" field.</summary>
+    public const int ValueFieldNumber = 2;
+    private double value_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Value {
+      get { return value_; }
+      set {
+        value_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "scale" field.</summary>
+    public const int ScaleFieldNumber = 3;
+    private double scale_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Scale {
+      get { return scale_; }
+      set {
+        scale_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "seed" field.</summary>
+    public const int SeedFieldNumber = 4;
+    private ulong seed_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Seed {
+      get { return seed_; }
+      set {
+        seed_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as InitializerProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(InitializerProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Op != other.Op) return false;
+      if (Value != other.Value) return false;
+      if (Scale != other.Scale) return false;
+      if (Seed != other.Seed) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Op.Length != 0) hash ^= Op.GetHashCode();
+      if (Value != 0D) hash ^= Value.GetHashCode();
+      if (Scale != 0D) hash ^= Scale.GetHashCode();
+      if (Seed != 0UL) hash ^= Seed.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Op.Length != 0) {
+        output.WriteRawTag(10);
+        output.WriteString(Op);
+      }
+      if (Value != 0D) {
+        output.WriteRawTag(17);
+        output.WriteDouble(Value);
+      }
+      if (Scale != 0D) {
+        output.WriteRawTag(25);
+        output.WriteDouble(Scale);
+      }
+      if (Seed != 0UL) {
+        output.WriteRawTag(32);
+        output.WriteUInt64(Seed);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Op.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Op);
+      }
+      if (Value != 0D) {
+        size += 1 + 8;
+      }
+      if (Scale != 0D) {
+        size += 1 + 8;
+      }
+      if (Seed != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Seed);
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(InitializerProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Op.Length != 0) {
+        Op = other.Op;
+      }
+      if (other.Value != 0D) {
+        Value = other.Value;
+      }
+      if (other.Scale != 0D) {
+        Scale = other.Scale;
+      }
+      if (other.Seed != 0UL) {
+        Seed = other.Seed;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            Op = input.ReadString();
+            break;
+          }
+          case 17: {
+            Value = input.ReadDouble();
+            break;
+          }
+          case 25: {
+            Scale = input.ReadDouble();
+            break;
+          }
+          case 32: {
+            Seed = input.ReadUInt64();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class LayerProto : pb::IMessage<LayerProto> {
+    private static readonly pb::MessageParser<LayerProto> _parser = new pb::MessageParser<LayerProto>(() => new LayerProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<LayerProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[6]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public LayerProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public LayerProto(LayerProto other) : this() {
+      op_ = other.op_;
+      name_ = other.name_;
+      inputShape_ = other.inputShape_.Clone();
+      units_ = other.units_;
+      activation_ = other.activation_;
+      useBias_ = other.useBias_;
+      KernelInitializer = other.kernelInitializer_ != null ? other.KernelInitializer.Clone() : null;
+      BiasInitializer = other.biasInitializer_ != null ? other.BiasInitializer.Clone() : null;
+      filters_ = other.filters_;
+      kernelSize_ = other.kernelSize_.Clone();
+      strides_ = other.strides_.Clone();
+      padding_ = other.padding_;
+      poolSize_ = other.poolSize_.Clone();
+      rate_ = other.rate_;
+      seed_ = other.seed_;
+      inputDim_ = other.inputDim_;
+      outputDim_ = other.outputDim_;
+      inputLength_ = other.inputLength_;
+      recurrentActivation_ = other.recurrentActivation_;
+      RecurrentInitializer = other.recurrentInitializer_ != null ? other.RecurrentInitializer.Clone() : null;
+      unitForgetBias_ = other.unitForgetBias_;
+      returnSequences_ = other.returnSequences_;
+      goBackwards_ = other.goBackwards_;
+      dropout_ = other.dropout_;
+      recurrentDropout_ = other.recurrentDropout_;
+      EmbeddingsInitializer = other.embeddingsInitializer_ != null ? other.EmbeddingsInitializer.Clone() : null;
+      maskZero_ = other.maskZero_;
+      hashBuckets_ = other.hashBuckets_;
+      numHashes_ = other.numHashes_;
+      groups_ = other.groups_;
+      depthMultiplier_ = other.depthMultiplier_;
+      DepthwiseInitializer = other.depthwiseInitializer_ != null ? other.DepthwiseInitializer.Clone() : null;
+      PointwiseInitializer = other.pointwiseInitializer_ != null ? other.PointwiseInitializer.Clone() : null;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public LayerProto Clone() {
+      return new LayerProto(this);
+    }
+
+    /// <summary>Field number for the "op" field.</summary>
+    public const int OpFieldNumber = 1;
+    private string op_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Op {
+      get { return op_; }
+      set {
+        op_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "name" field.</summary>
+    public const int NameFieldNumber = 2;
+    private string name_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Name {
+      get { return name_; }
+      set {
+        name_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "input_shape" field.</summary>
+    public const int InputShapeFieldNumber = 3;
+    private static readonly pb::FieldCodec<int> _repeated_input_shape_codec
+        = pb::FieldCodec.ForInt32(26);
+    private readonly pbc::RepeatedField<int> inputShape_ = new pbc::RepeatedField<int>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<int> InputShape {
+      get { return inputShape_; }
+    }
+
+    /// <summary>Field number for the "units" field.</summary>
+    public const int UnitsFieldNumber = 4;
+    private uint units_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint Units {
+      get { return units_; }
+      set {
+        units_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "activation" field.</summary>
+    public const int ActivationFieldNumber = 5;
+    private string activation_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Activation {
+      get { return activation_; }
+      set {
+        activation_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "use_bias" field.</summary>
+    public const int UseBiasFieldNumber = 6;
+    private bool useBias_;
+    /// <summary>
+    /// Always honoured, set it explicitly
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool UseBias {
+      get { return useBias_; }
+      set {
+        useBias_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "kernel_initializer" field.</summary>
+    public const int KernelInitializerFieldNumber = 7;
+    private global::Keras.InitializerProto kernelInitializer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.InitializerProto KernelInitializer {
+      get { return kernelInitializer_; }
+      set {
+        kernelInitializer_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "bias_initializer" field.</summary>
+    public const int BiasInitializerFieldNumber = 8;
+    private global::Keras.InitializerProto biasInitializer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.InitializerProto BiasInitializer {
+      get { return biasInitializer_; }
+      set {
+        biasInitializer_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "filters" field.</summary>
+    public const int FiltersFieldNumber = 9;
+    private uint filters_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint Filters {
+      get { return filters_; }
+      set {
+        filters_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "kernel_size" field.</summary>
+    public const int KernelSizeFieldNumber = 10;
+    private static readonly pb::FieldCodec<int> _repeated_kernel_size_codec
+        = pb::FieldCodec.ForInt32(82);
+    private readonly pbc::RepeatedField<int> kernelSize_ = new pbc::RepeatedField<int>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<int> KernelSize {
+      get { return kernelSize_; }
+    }
+
+    /// <summary>Field number for the "strides" field.</summary>
+    public const int StridesFieldNumber = 11;
+    private static readonly pb::FieldCodec<int> _repeated_strides_codec
+        = pb::FieldCodec.ForInt32(90);
+    private readonly pbc::RepeatedField<int> strides_ = new pbc::RepeatedField<int>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<int> Strides {
+      get { return strides_; }
+    }
+
+    /// <summary>Field number for the "padding" field.</summary>
+    public const int PaddingFieldNumber = 12;
+    private string padding_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Padding {
+      get { return padding_; }
+      set {
+        padding_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "pool_size" field.</summary>
+    public const int PoolSizeFieldNumber = 13;
+    private static readonly pb::FieldCodec<int> _repeated_pool_size_codec
+        = pb::FieldCodec.ForInt32(106);
+    private readonly pbc::RepeatedField<int> poolSize_ = new pbc::RepeatedField<int>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<int> PoolSize {
+      get { return poolSize_; }
+    }
+
+    /// <summary>Field number for the "rate" field.</summary>
+    public const int RateFieldNumber = 14;
+    private double rate_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Rate {
+      get { return rate_; }
+      set {
+        rate_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "seed" field.</summary>
+    public const int SeedFieldNumber = 15;
+    private ulong seed_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Seed {
+      get { return seed_; }
+      set {
+        seed_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "input_dim" field.</summary>
+    public const int InputDimFieldNumber = 16;
+    private uint inputDim_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint InputDim {
+      get { return inputDim_; }
+      set {
+        inputDim_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "output_dim" field.</summary>
+    public const int OutputDimFieldNumber = 17;
+    private uint outputDim_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint OutputDim {
+      get { return outputDim_; }
+      set {
+        outputDim_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "input_length" field.</summary>
+    public const int InputLengthFieldNumber = 18;
+    private uint inputLength_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint InputLength {
+      get { return inputLength_; }
+      set {
+        inputLength_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "recurrent_activation" field.</summary>
+    public const int RecurrentActivationFieldNumber = 19;
+    private string recurrentActivation_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string RecurrentActivation {
+      get { return recurrentActivation_; }
+      set {
+        recurrentActivation_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "recurrent_initializer" field.</summary>
+    public const int RecurrentInitializerFieldNumber = 20;
+    private global::Keras.InitializerProto recurrentInitializer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.InitializerProto RecurrentInitializer {
+      get { return recurrentInitializer_; }
+      set {
+        recurrentInitializer_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "unit_forget_bias" field.</summary>
+    public const int UnitForgetBiasFieldNumber = 21;
+    private bool unitForgetBias_;
+    /// <summary>
+    /// Always honoured, set it explicitly
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool UnitForgetBias {
+      get { return unitForgetBias_; }
+      set {
+        unitForgetBias_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "return_sequences" field.</summary>
+    public const int ReturnSequencesFieldNumber = 22;
+    private bool returnSequences_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool ReturnSequences {
+      get { return returnSequences_; }
+      set {
+        returnSequences_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "go_backwards" field.</summary>
+    public const int GoBackwardsFieldNumber = 23;
+    private bool goBackwards_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool GoBackwards {
+      get { return goBackwards_; }
+      set {
+        goBackwards_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "dropout" field.</summary>
+    public const int DropoutFieldNumber = 24;
+    private double dropout_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Dropout {
+      get { return dropout_; }
+      set {
+        dropout_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "recurrent_dropout" field.</summary>
+    public const int RecurrentDropoutFieldNumber = 25;
+    private double recurrentDropout_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double RecurrentDropout {
+      get { return recurrentDropout_; }
+      set {
+        recurrentDropout_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "embeddings_initializer" field.</summary>
+    public const int EmbeddingsInitializerFieldNumber = 26;
+    private global::Keras.InitializerProto embeddingsInitializer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.InitializerProto EmbeddingsInitializer {
+      get { return embeddingsInitializer_; }
+      set {
+        embeddingsInitializer_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "mask_zero" field.</summary>
+    public const int MaskZeroFieldNumber = 27;
+    private bool maskZero_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool MaskZero {
+      get { return maskZero_; }
+      set {
+        maskZero_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "hash_buckets" field.</summary>
+    public const int HashBucketsFieldNumber = 28;
+    private uint hashBuckets_;
+    /// <summary>
+    /// Hashed embedding, replaces input_dim
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint HashBuckets {
+      get { return hashBuckets_; }
+      set {
+        hashBuckets_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "num_hashes" field.</summary>
+    public const int NumHashesFieldNumber = 29;
+    private uint numHashes_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint NumHashes {
+      get { return numHashes_; }
+      set {
+        numHashes_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "groups" field.</summary>
+    public const int GroupsFieldNumber = 30;
+    private uint groups_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint Groups {
+      get { return groups_; }
+      set {
+        groups_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "depth_multiplier" field.</summary>
+    public const int DepthMultiplierFieldNumber = 31;
+    private uint depthMultiplier_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint DepthMultiplier {
+      get { return depthMultiplier_; }
+      set {
+        depthMultiplier_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "depthwise_initializer" field.</summary>
+    public const int DepthwiseInitializerFieldNumber = 32;
+    private global::Keras.InitializerProto depthwiseInitializer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.InitializerProto DepthwiseInitializer {
+      get { return depthwiseInitializer_; }
+      set {
+        depthwiseInitializer_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "pointwise_initializer" field.</summary>
+    public const int PointwiseInitializerFieldNumber = 33;
+    private global::Keras.InitializerProto pointwiseInitializer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.InitializerProto PointwiseInitializer {
+      get { return pointwiseInitializer_; }
+      set {
+        pointwiseInitializer_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as LayerProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(LayerProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Op != other.Op) return false;
+      if (Name != other.Name) return false;
+      if(!inputShape_.Equals(other.inputShape_)) return false;
+      if (Units != other.Units) return false;
+      if (Activation != other.Activation) return false;
+      if (UseBias != other.UseBias) return false;
+      if (!object.Equals(KernelInitializer, other.KernelInitializer)) return false;
+      if (!object.Equals(BiasInitializer, other.BiasInitializer)) return false;
+      if (Filters != other.Filters) return false;
+      if(!kernelSize_.Equals(other.kernelSize_)) return false;
+      if(!strides_.Equals(other.strides_)) return false;
+      if (Padding != other.Padding) return false;
+      if(!poolSize_.Equals(other.poolSize_)) return false;
+      if (Rate != other.Rate) return false;
+      if (Seed != other.Seed) return false;
+      if (InputDim != other.InputDim) return false;
+      if (OutputDim != other.OutputDim) return false;
+      if (InputLength != other.InputLength) return false;
+      if (RecurrentActivation != other.RecurrentActivation) return false;
+      if (!object.Equals(RecurrentInitializer, other.RecurrentInitializer)) return false;
+      if (UnitForgetBias != other.UnitForgetBias) return false;
+      if (ReturnSequences != other.ReturnSequences) return false;
+      if (GoBackwards != other.GoBackwards) return false;
+      if (Dropout != other.Dropout) return false;
+      if (RecurrentDropout != other.RecurrentDropout) return false;
+      if (!object.Equals(EmbeddingsInitializer, other.EmbeddingsInitializer)) return false;
+      if (MaskZero != other.MaskZero) return false;
+      if (HashBuckets != other.HashBuckets) return false;
+      if (NumHashes != other.NumHashes) return false;
+      if (Groups != other.Groups) return false;
+      if (DepthMultiplier != other.DepthMultiplier) return false;
+      if (!object.Equals(DepthwiseInitializer, other.DepthwiseInitializer)) return false;
+      if (!object.Equals(PointwiseInitializer, other.PointwiseInitializer)) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Op.Length != 0) hash ^= Op.GetHashCode();
+      if (Name.Length != 0) hash ^= Name.GetHashCode();
+      hash ^= inputShape_.GetHashCode();
+      if (Units != 0) hash ^= Units.GetHashCode();
+      if (Activation.Length != 0) hash ^= Activation.GetHashCode();
+      if (UseBias != false) hash ^= UseBias.GetHashCode();
+      if (kernelInitializer_ != null) hash ^= KernelInitializer.GetHashCode();
+      if (biasInitializer_ != null) hash ^= BiasInitializer.GetHashCode();
+      if (Filters != 0) hash ^= Filters.GetHashCode();
+      hash ^= kernelSize_.GetHashCode();
+      hash ^= strides_.GetHashCode();
+      if (Padding.Length != 0) hash ^= Padding.GetHashCode();
+      hash ^= poolSize_.GetHashCode();
+      if (Rate != 0D) hash ^= Rate.GetHashCode();
+      if (Seed != 0UL) hash ^= Seed.GetHashCode();
+      if (InputDim != 0) hash ^= InputDim.GetHashCode();
+      if (OutputDim != 0) hash ^= OutputDim.GetHashCode();
+      if (InputLength != 0) hash ^= InputLength.GetHashCode();
+      if (RecurrentActivation.Length != 0) hash ^= RecurrentActivation.GetHashCode();
+      if (recurrentInitializer_ != null) hash ^= RecurrentInitializer.GetHashCode();
+      if (UnitForgetBias != false) hash ^= UnitForgetBias.GetHashCode();
+      if (ReturnSequences != false) hash ^= ReturnSequences.GetHashCode();
+      if (GoBackwards != false) hash ^= GoBackwards.GetHashCode();
+      if (Dropout != 0D) hash ^= Dropout.GetHashCode();
+      if (RecurrentDropout != 0D) hash ^= RecurrentDropout.GetHashCode();
+      if (embeddingsInitializer_ != null) hash ^= EmbeddingsInitializer.GetHashCode();
+      if (MaskZero != false) hash ^= MaskZero.GetHashCode();
+      if (HashBuckets != 0) hash ^= HashBuckets.GetHashCode();
+      if (NumHashes != 0) hash ^= NumHashes.GetHashCode();
+      if (Groups != 0) hash ^= Groups.GetHashCode();
+      if (DepthMultiplier != 0) hash ^= DepthMultiplier.GetHashCode();
+      if (depthwiseInitializer_ != null) hash ^= DepthwiseInitializer.GetHashCode();
+      if (pointwiseInitializer_ != null) hash ^= PointwiseInitializer.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Op.Length != 0) {
+        output.WriteRawTag(10);
+        output.WriteString(Op);
+      }
+      if (Name.Length != 0) {
+        output.WriteRawTag(18);
+        output.WriteString(Name);
+      }
+      inputShape_.WriteTo(output, _repeated_input_shape_codec);
+      if (Units != 0) {
+        output.WriteRawTag(32);
+        output.WriteUInt32(Units);
+      }
+      if (Activation.Length != 0) {
+        output.WriteRawTag(42);
+        output.WriteString(Activation);
+      }
+      if (UseBias != false) {
+        output.WriteRawTag(48);
+        output.WriteBool(UseBias);
+      }
+      if (kernelInitializer_ != null) {
+        output.WriteRawTag(58);
+        output.WriteMessage(KernelInitializer);
+      }
+      if (biasInitializer_ != null) {
+        output.WriteRawTag(66);
+        output.WriteMessage(BiasInitializer);
+      }
+      if (Filters != 0) {
+        output.WriteRawTag(72);
+        output.WriteUInt32(Filters);
+      }
+      kernelSize_.WriteTo(output, _repeated_kernel_size_codec);
+      strides_.WriteTo(output, _repeated_strides_codec);
+      if (Padding.Length != 0) {
+        output.WriteRawTag(98);
+        output.WriteString(Padding);
+      }
+      poolSize_.WriteTo(output, _repeated_pool_size_codec);
+      if (Rate != 0D) {
+        output.WriteRawTag(113);
+        output.WriteDouble(Rate);
+      }
+      if (Seed != 0UL) {
+        output.WriteRawTag(120);
+        output.WriteUInt64(Seed);
+      }
+      if (InputDim != 0) {
+        output.WriteRawTag(128, 1);
+        output.WriteUInt32(InputDim);
+      }
+      if (OutputDim != 0) {
+        output.WriteRawTag(136, 1);
+        output.WriteUInt32(OutputDim);
+      }
+      if (InputLength != 0) {
+        output.WriteRawTag(144, 1);
+        output.WriteUInt32(InputLength);
+      }
+      if (RecurrentActivation.Length != 0) {
+        output.WriteRawTag(154, 1);
+        output.WriteString(RecurrentActivation);
+      }
+      if (recurrentInitializer_ != null) {
+        output.WriteRawTag(162, 1);
+        output.WriteMessage(RecurrentInitializer);
+      }
+      if (UnitForgetBias != false) {
+        output.WriteRawTag(168, 1);
+        output.WriteBool(UnitForgetBias);
+      }
+      if (ReturnSequences != false) {
+        output.WriteRawTag(176, 1);
+        output.WriteBool(ReturnSequences);
+      }
+      if (GoBackwards != false) {
+        output.WriteRawTag(184, 1);
+        output.WriteBool(GoBackwards);
+      }
+      if (Dropout != 0D) {
+        output.WriteRawTag(193, 1);
+        output.WriteDouble(Dropout);
+      }
+      if (RecurrentDropout != 0D) {
+        output.WriteRawTag(201, 1);
+        output.WriteDouble(RecurrentDropout);
+      }
+      if (embeddingsInitializer_ != null) {
+        output.WriteRawTag(210, 1);
+        output.WriteMessage(EmbeddingsInitializer);
+      }
+      if (MaskZero != false) {
+        output.WriteRawTag(216, 1);
+        output.WriteBool(MaskZero);
+      }
+      if (HashBuckets != 0) {
+        output.WriteRawTag(224, 1);
+        output.WriteUInt32(HashBuckets);
+      }
+      if (NumHashes != 0) {
+        output.WriteRawTag(232, 1);
+        output.WriteUInt32(NumHashes);
+      }
+      if (Groups != 0) {
+        output.WriteRawTag(240, 1);
+        output.WriteUInt32(Groups);
+      }
+      if (DepthMultiplier != 0) {
+        output.WriteRawTag(248, 1);
+        output.WriteUInt32(DepthMultiplier);
+      }
+      if (depthwiseInitializer_ != null) {
+        output.WriteRawTag(130, 2);
+        output.WriteMessage(DepthwiseInitializer);
+      }
+      if (pointwiseInitializer_ != null) {
+        output.WriteRawTag(138, 2);
+        output.WriteMessage(PointwiseInitializer);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Op.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Op);
+      }
+      if (Name.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Name);
+      }
+      size += inputShape_.CalculateSize(_repeated_input_shape_codec);
+      if (Units != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(Units);
+      }
+      if (Activation.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Activation);
+      }
+      if (UseBias != false) {
+        size += 1 + 1;
+      }
+      if (kernelInitializer_ != null) {
+        size += 1 + pb::CodedOutputStream.ComputeMessageSize(KernelInitializer);
+      }
+      if (biasInitializer_ != null) {
+        size += 1 + pb::CodedOutputStream.ComputeMessageSize(BiasInitializer);
+      }
+      if (Filters != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(Filters);
+      }
+      size += kernelSize_.CalculateSize(_repeated_kernel_size_codec);
+      size += strides_.CalculateSize(_repeated_strides_codec);
+      if (Padding.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Padding);
+      }
+      size += poolSize_.CalculateSize(_repeated_pool_size_codec);
+      if (Rate != 0D) {
+        size += 1 + 8;
+      }
+      if (Seed != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Seed);
+      }
+      if (InputDim != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(InputDim);
+      }
+      if (OutputDim != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(OutputDim);
+      }
+      if (InputLength != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(InputLength);
+      }
+      if (RecurrentActivation.Length != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeStringSize(RecurrentActivation);
+      }
+      if (recurrentInitializer_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(RecurrentInitializer);
+      }
+      if (UnitForgetBias != false) {
+        size += 2 + 1;
+      }
+      if (ReturnSequences != false) {
+        size += 2 + 1;
+      }
+      if (GoBackwards != false) {
+        size += 2 + 1;
+      }
+      if (Dropout != 0D) {
+        size += 2 + 8;
+      }
+      if (RecurrentDropout != 0D) {
+        size += 2 + 8;
+      }
+      if (embeddingsInitializer_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(EmbeddingsInitializer);
+      }
+      if (MaskZero != false) {
+        size += 2 + 1;
+      }
+      if (HashBuckets != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(HashBuckets);
+      }
+      if (NumHashes != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(NumHashes);
+      }
+      if (Groups != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(Groups);
+      }
+      if (DepthMultiplier != 0) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt32Size(DepthMultiplier);
+      }
+      if (depthwiseInitializer_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(DepthwiseInitializer);
+      }
+      if (pointwiseInitializer_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(PointwiseInitializer);
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(LayerProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Op.Length != 0) {
+        Op = other.Op;
+      }
+      if (other.Name.Length != 0) {
+        Name = other.Name;
+      }
+      inputShape_.Add(other.inputShape_);
+      if (other.Units != 0) {
+        Units = other.Units;
+      }
+      if (other.Activation.Length != 0) {
+        Activation = other.Activation;
+      }
+      if (other.UseBias != false) {
+        UseBias = other.UseBias;
+      }
+      if (other.kernelInitializer_ != null) {
+        if (kernelInitializer_ == null) {
+          kernelInitializer_ = new global::Keras.InitializerProto();
+        }
+        KernelInitializer.MergeFrom(other.KernelInitializer);
+      }
+      if (other.biasInitializer_ != null) {
+        if (biasInitializer_ == null) {
+          biasInitializer_ = new global::Keras.InitializerProto();
+        }
+        BiasInitializer.MergeFrom(other.BiasInitializer);
+      }
+      if (other.Filters != 0) {
+        Filters = other.Filters;
+      }
+      kernelSize_.Add(other.kernelSize_);
+      strides_.Add(other.strides_);
+      if (other.Padding.Length != 0) {
+        Padding = other.Padding;
+      }
+      poolSize_.Add(other.poolSize_);
+      if (other.Rate != 0D) {
+        Rate = other.Rate;
+      }
+      if (other.Seed != 0UL) {
+        Seed = other.Seed;
+      }
+      if (other.InputDim != 0) {
+        InputDim = other.InputDim;
+      }
+      if (other.OutputDim != 0) {
+        OutputDim = other.OutputDim;
+      }
+      if (other.InputLength != 0) {
+        InputLength = other.InputLength;
+      }
+      if (other.RecurrentActivation.Length != 0) {
+        RecurrentActivation = other.RecurrentActivation;
+      }
+      if (other.recurrentInitializer_ != null) {
+        if (recurrentInitializer_ == null) {
+          recurrentInitializer_ = new global::Keras.InitializerProto();
+        }
+        RecurrentInitializer.MergeFrom(other.RecurrentInitializer);
+      }
+      if (other.UnitForgetBias != false) {
+        UnitForgetBias = other.UnitForgetBias;
+      }
+      if (other.ReturnSequences != false) {
+        ReturnSequences = other.ReturnSequences;
+      }
+      if (other.GoBackwards != false) {
+        GoBackwards = other.GoBackwards;
+      }
+      if (other.Dropout != 0D) {
+        Dropout = other.Dropout;
+      }
+      if (other.RecurrentDropout != 0D) {
+        RecurrentDropout = other.RecurrentDropout;
+      }
+      if (other.embeddingsInitializer_ != null) {
+        if (embeddingsInitializer_ == null) {
+          embeddingsInitializer_ = new global::Keras.InitializerProto();
+        }
+        EmbeddingsInitializer.MergeFrom(other.EmbeddingsInitializer);
+      }
+      if (other.MaskZero != false) {
+        MaskZero = other.MaskZero;
+      }
+      if (other.HashBuckets != 0) {
+        HashBuckets = other.HashBuckets;
+      }
+      if (other.NumHashes != 0) {
+        NumHashes = other.NumHashes;
+      }
+      if (other.Groups != 0) {
+        Groups = other.Groups;
+      }
+      if (other.DepthMultiplier != 0) {
+        DepthMultiplier = other.DepthMultiplier;
+      }
+      if (other.depthwiseInitializer_ != null) {
+        if (depthwiseInitializer_ == null) {
+          depthwiseInitializer_ = new global::Keras.InitializerProto();
+        }
+        DepthwiseInitializer.MergeFrom(other.DepthwiseInitializer);
+      }
+      if (other.pointwiseInitializer_ != null) {
+        if (pointwiseInitializer_ == null) {
+          pointwiseInitializer_ = new global::Keras.InitializerProto();
+        }
+        PointwiseInitializer.MergeFrom(other.PointwiseInitializer);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            Op = input.ReadString();
+            break;
+          }
+          case 18: {
+            Name = input.ReadString();
+            break;
+          }
+          case 26:
+          case 24: {
+            inputShape_.AddEntriesFrom(input, _repeated_input_shape_codec);
+            break;
+          }
+          case 32: {
+            Units = input.ReadUInt32();
+            break;
+          }
+          case 42: {
+            Activation = input.ReadString();
+            break;
+          }
+          case 48: {
+            UseBias = input.ReadBool();
+            break;
+          }
+          case 58: {
+            if (kernelInitializer_ == null) {
+              kernelInitializer_ = new global::Keras.InitializerProto();
+            }
+            input.ReadMessage(kernelInitializer_);
+            break;
+          }
+          case 66: {
+            if (biasInitializer_ == null) {
+              biasInitializer_ = new global::Keras.InitializerProto();
+            }
+            input.ReadMessage(biasInitializer_);
+            break;
+          }
+          case 72: {
+            Filters = input.ReadUInt32();
+            break;
+          }
+          case 82:
+          case 80: {
+            kernelSize_.AddEntriesFrom(input, _repeated_kernel_size_codec);
+            break;
+          }
+          case 90:
+          case 88: {
+            strides_.AddEntriesFrom(input, _repeated_strides_codec);
+            break;
+          }
+          case 98: {
+            Padding = input.ReadString();
+            break;
+          }
+          case 106:
+          case 104: {
+            poolSize_.AddEntriesFrom(input, _repeated_pool_size_codec);
+            break;
+          }
+          case 113: {
+            Rate = input.ReadDouble();
+            break;
+          }
+          case 120: {
+            Seed = input.ReadUInt64();
+            break;
+          }
+          case 128: {
+            InputDim = input.ReadUInt32();
+            break;
+          }
+          case 136: {
+            OutputDim = input.ReadUInt32();
+            break;
+          }
+          case 144: {
+            InputLength = input.ReadUInt32();
+            break;
+          }
+          case 154: {
+            RecurrentActivation = input.ReadString();
+            break;
+          }
+          case 162: {
+            if (recurrentInitializer_ == null) {
+              recurrentInitializer_ = new global::Keras.InitializerProto();
+            }
+            input.ReadMessage(recurrentInitializer_);
+            break;
+          }
+          case 168: {
+            UnitForgetBias = input.ReadBool();
+            break;
+          }
+          case 176: {
+            ReturnSequences = input.ReadBool();
+            break;
+          }
+          case 184: {
+            GoBackwards = input.ReadBool();
+            break;
+          }
+          case 193: {
+            Dropout = input.ReadDouble();
+            break;
+          }
+          case 201: {
+            RecurrentDropout = input.ReadDouble();
+            break;
+          }
+          case 210: {
+            if (embeddingsInitializer_ == null) {
+              embeddingsInitializer_ = new global::Keras.InitializerProto();
+            }
+            input.ReadMessage(embeddingsInitializer_);
+            break;
+          }
+          case 216: {
+            MaskZero = input.ReadBool();
+            break;
+          }
+          case 224: {
+            HashBuckets = input.ReadUInt32();
+            break;
+          }
+          case 232: {
+            NumHashes = input.ReadUInt32();
+            break;
+          }
+          case 240: {
+            Groups = input.ReadUInt32();
+            break;
+          }
+          case 248: {
+            DepthMultiplier = input.ReadUInt32();
+            break;
+          }
+          case 258: {
+            if (depthwiseInitializer_ == null) {
+              depthwiseInitializer_ = new global::Keras.InitializerProto();
+            }
+            input.ReadMessage(depthwiseInitializer_);
+            break;
+          }
+          case 266: {
+            if (pointwiseInitializer_ == null) {
+              pointwiseInitializer_ = new global::Keras.InitializerProto();
+            }
+            input.ReadMessage(pointwiseInitializer_);
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class OptimizerProto : pb::IMessage<OptimizerProto> {
+    private static readonly pb::MessageParser<OptimizerProto> _parser = new pb::MessageParser<OptimizerProto>(() => new OptimizerProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<OptimizerProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[7]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public OptimizerProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public OptimizerProto(OptimizerProto other) : this() {
+      op_ = other.op_;
+      lr_ = other.lr_;
+      momentum_ = other.momentum_;
+      decay_ = other.decay_;
+      nesterov_ = other.nesterov_;
+      rho_ = other.rho_;
+      epsilon_ = other.epsilon_;
+      beta1_ = other.beta1_;
+      beta2_ = other.beta2_;
+      weightDecay_ = other.weightDecay_;
+      Schedule = other.schedule_ != null ? other.Schedule.Clone() : null;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public OptimizerProto Clone() {
+      return new OptimizerProto(this);
+    }
+
+    /// <summary>Field number for the "op" field.</summary>
+    public const int OpFieldNumber = 1;
+    private string op_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Op {
+      get { return op_; }
+      set {
+        op_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "lr" field.</summary>
+    public const int LrFieldNumber = 2;
+    private double lr_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Lr {
+      get { return lr_; }
+      set {
+        lr_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "momentum" field.</summary>
+    public const int MomentumFieldNumber = 3;
+    private double momentum_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Momentum {
+      get { return momentum_; }
+      set {
+        momentum_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "decay" field.</summary>
+    public const int DecayFieldNumber = 4;
+    private double decay_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Decay {
+      get { return decay_; }
+      set {
+        decay_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "nesterov" field.</summary>
+    public const int NesterovFieldNumber = 5;
+    private bool nesterov_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Nesterov {
+      get { return nesterov_; }
+      set {
+        nesterov_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "rho" field.</summary>
+    public const int RhoFieldNumber = 6;
+    private double rho_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Rho {
+      get { return rho_; }
+      set {
+        rho_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "epsilon" field.</summary>
+    public const int EpsilonFieldNumber = 7;
+    private double epsilon_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Epsilon {
+      get { return epsilon_; }
+      set {
+        epsilon_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "beta_1" field.</summary>
+    public const int Beta1FieldNumber = 8;
+    private double beta1_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Beta1 {
+      get { return beta1_; }
+      set {
+        beta1_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "beta_2" field.</summary>
+    public const int Beta2FieldNumber = 9;
+    private double beta2_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Beta2 {
+      get { return beta2_; }
+      set {
+        beta2_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "weight_decay" field.</summary>
+    public const int WeightDecayFieldNumber = 10;
+    private double weightDecay_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double WeightDecay {
+      get { return weightDecay_; }
+      set {
+        weightDecay_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "schedule" field.</summary>
+    public const int ScheduleFieldNumber = 11;
+    private global::Keras.LearningRateScheduleProto schedule_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.LearningRateScheduleProto Schedule {
+      get { return schedule_; }
+      set {
+        schedule_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as OptimizerProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(OptimizerProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Op != other.Op) return false;
+      if (Lr != other.Lr) return false;
+      if (Momentum != other.Momentum) return false;
+      if (Decay != other.Decay) return false;
+      if (Nesterov != other.Nesterov) return false;
+      if (Rho != other.Rho) return false;
+      if (Epsilon != other.Epsilon) return false;
+      if (Beta1 != other.Beta1) return false;
+      if (Beta2 != other.Beta2) return false;
+      if (WeightDecay != other.WeightDecay) return false;
+      if (!object.Equals(Schedule, other.Schedule)) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Op.Length != 0) hash ^= Op.GetHashCode();
+      if (Lr != 0D) hash ^= Lr.GetHashCode();
+      if (Momentum != 0D) hash ^= Momentum.GetHashCode();
+      if (Decay != 0D) hash ^= Decay.GetHashCode();
+      if (Nesterov != false) hash ^= Nesterov.GetHashCode();
+      if (Rho != 0D) hash ^= Rho.GetHashCode();
+      if (Epsilon != 0D) hash ^= Epsilon.GetHashCode();
+      if (Beta1 != 0D) hash ^= Beta1.GetHashCode();
+      if (Beta2 != 0D) hash ^= Beta2.GetHashCode();
+      if (WeightDecay != 0D) hash ^= WeightDecay.GetHashCode();
+      if (schedule_ != null) hash ^= Schedule.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Op.Length != 0) {
+        output.WriteRawTag(10);
+        output.WriteString(Op);
+      }
+      if (Lr != 0D) {
+        output.WriteRawTag(17);
+        output.WriteDouble(Lr);
+      }
+      if (Momentum != 0D) {
+        output.WriteRawTag(25);
+        output.WriteDouble(Momentum);
+      }
+      if (Decay != 0D) {
+        output.WriteRawTag(33);
+        output.WriteDouble(Decay);
+      }
+      if (Nesterov != false) {
+        output.WriteRawTag(40);
+        output.WriteBool(Nesterov);
+      }
+      if (Rho != 0D) {
+        output.WriteRawTag(49);
+        output.WriteDouble(Rho);
+      }
+      if (Epsilon != 0D) {
+        output.WriteRawTag(57);
+        output.WriteDouble(Epsilon);
+      }
+      if (Beta1 != 0D) {
+        output.WriteRawTag(65);
+        output.WriteDouble(Beta1);
+      }
+      if (Beta2 != 0D) {
+        output.WriteRawTag(73);
+        output.WriteDouble(Beta2);
+      }
+      if (WeightDecay != 0D) {
+        output.WriteRawTag(81);
+        output.WriteDouble(WeightDecay);
+      }
+      if (schedule_ != null) {
+        output.WriteRawTag(90);
+        output.WriteMessage(Schedule);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Op.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Op);
+      }
+      if (Lr != 0D) {
+        size += 1 + 8;
+      }
+      if (Momentum != 0D) {
+        size += 1 + 8;
+      }
+      if (Decay != 0D) {
+        size += 1 + 8;
+      }
+      if (Nesterov != false) {
+        size += 1 + 1;
+      }
+      if (Rho != 0D) {
+        size += 1 + 8;
+      }
+      if (Epsilon != 0D) {
+        size += 1 + 8;
+      }
+      if (Beta1 != 0D) {
+        size += 1 + 8;
+      }
+      if (Beta2 != 0D) {
+        size += 1 + 8;
+      }
+      if (WeightDecay != 0D) {
+        size += 1 + 8;
+      }
+      if (schedule_ != null) {
+        size += 1 + pb::CodedOutputStream.ComputeMessageSize(Schedule);
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(OptimizerProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Op.Length != 0) {
+        Op = other.Op;
+      }
+      if (other.Lr != 0D) {
+        Lr = other.Lr;
+      }
+      if (other.Momentum != 0D) {
+        Momentum = other.Momentum;
+      }
+      if (other.Decay != 0D) {
+        Decay = other.Decay;
+      }
+      if (other.Nesterov != false) {
+        Nesterov = other.Nesterov;
+      }
+      if (other.Rho != 0D) {
+        Rho = other.Rho;
+      }
+      if (other.Epsilon != 0D) {
+        Epsilon = other.Epsilon;
+      }
+      if (other.Beta1 != 0D) {
+        Beta1 = other.Beta1;
+      }
+      if (other.Beta2 != 0D) {
+        Beta2 = other.Beta2;
+      }
+      if (other.WeightDecay != 0D) {
+        WeightDecay = other.WeightDecay;
+      }
+      if (other.schedule_ != null) {
+        if (schedule_ == null) {
+          schedule_ = new global::Keras.LearningRateScheduleProto();
+        }
+        Schedule.MergeFrom(other.Schedule);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            Op = input.ReadString();
+            break;
+          }
+          case 17: {
+            Lr = input.ReadDouble();
+            break;
+          }
+          case 25: {
+            Momentum = input.ReadDouble();
+            break;
+          }
+          case 33: {
+            Decay = input.ReadDouble();
+            break;
+          }
+          case 40: {
+            Nesterov = input.ReadBool();
+            break;
+          }
+          case 49: {
+            Rho = input.ReadDouble();
+            break;
+          }
+          case 57: {
+            Epsilon = input.ReadDouble();
+            break;
+          }
+          case 65: {
+            Beta1 = input.ReadDouble();
+            break;
+          }
+          case 73: {
+            Beta2 = input.ReadDouble();
+            break;
+          }
+          case 81: {
+            WeightDecay = input.ReadDouble();
+            break;
+          }
+          case 90: {
+            if (schedule_ == null) {
+              schedule_ = new global::Keras.LearningRateScheduleProto();
+            }
+            input.ReadMessage(schedule_);
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class CompileParamsProto : pb::IMessage<CompileParamsProto> {
+    private static readonly pb::MessageParser<CompileParamsProto> _parser = new pb::MessageParser<CompileParamsProto>(() => new CompileParamsProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<CompileParamsProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[8]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CompileParamsProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CompileParamsProto(CompileParamsProto other) : this() {
+      Optimizer = other.optimizer_ != null ? other.Optimizer.Clone() : null;
+      loss_ = other.loss_;
+      metrics_ = other.metrics_.Clone();
+      topK_ = other.topK_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CompileParamsProto Clone() {
+      return new CompileParamsProto(this);
+    }
+
+    /// <summary>Field number for the "optimizer" field.</summary>
+    public const int OptimizerFieldNumber = 1;
+    private global::Keras.OptimizerProto optimizer_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public global::Keras.OptimizerProto Optimizer {
+      get { return optimizer_; }
+      set {
+        optimizer_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "loss" field.</summary>
+    public const int LossFieldNumber = 2;
+    private string loss_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Loss {
+      get { return loss_; }
+      set {
+        loss_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "metrics" field.</summary>
+    public const int MetricsFieldNumber = 3;
+    private static readonly pb::FieldCodec<string> _repeated_metrics_codec
+        = pb::FieldCodec.ForString(26);
+    private readonly pbc::RepeatedField<string> metrics_ = new pbc::RepeatedField<string>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<string> Metrics {
+      get { return metrics_; }
+    }
+
+    /// <summary>Field number for the "top_k" field.</summary>
+    public const int TopKFieldNumber = 4;
+    private uint topK_;
+    /// <summary>
+    /// The k of top_k_categorical_accuracy, 5 when unset
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint TopK {
+      get { return topK_; }
+      set {
+        topK_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as CompileParamsProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(CompileParamsProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (!object.Equals(Optimizer, other.Optimizer)) return false;
+      if (Loss != other.Loss) return false;
+      if(!metrics_.Equals(other.metrics_)) return false;
+      if (TopK != other.TopK) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (optimizer_ != null) hash ^= Optimizer.GetHashCode();
+      if (Loss.Length != 0) hash ^= Loss.GetHashCode();
+      hash ^= metrics_.GetHashCode();
+      if (TopK != 0) hash ^= TopK.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (optimizer_ != null) {
+        output.WriteRawTag(10);
+        output.WriteMessage(Optimizer);
+      }
+      if (Loss.Length != 0) {
+        output.WriteRawTag(18);
+        output.WriteString(Loss);
+      }
+      metrics_.WriteTo(output, _repeated_metrics_codec);
+      if (TopK != 0) {
+        output.WriteRawTag(32);
+        output.WriteUInt32(TopK);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (optimizer_ != null) {
+        size += 1 + pb::CodedOutputStream.ComputeMessageSize(Optimizer);
+      }
+      if (Loss.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Loss);
+      }
+      size += metrics_.CalculateSize(_repeated_metrics_codec);
+      if (TopK != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(TopK);
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(CompileParamsProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.optimizer_ != null) {
+        if (optimizer_ == null) {
+          optimizer_ = new global::Keras.OptimizerProto();
+        }
+        Optimizer.MergeFrom(other.Optimizer);
+      }
+      if (other.Loss.Length != 0) {
+        Loss = other.Loss;
+      }
+      metrics_.Add(other.metrics_);
+      if (other.TopK != 0) {
+        TopK = other.TopK;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            if (optimizer_ == null) {
+              optimizer_ = new global::Keras.OptimizerProto();
+            }
+            input.ReadMessage(optimizer_);
+            break;
+          }
+          case 18: {
+            Loss = input.ReadString();
+            break;
+          }
+          case 26: {
+            metrics_.AddEntriesFrom(input, _repeated_metrics_codec);
+            break;
+          }
+          case 32: {
+            TopK = input.ReadUInt32();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class PredictParamsProto : pb::IMessage<PredictParamsProto> {
+    private static readonly pb::MessageParser<PredictParamsProto> _parser = new pb::MessageParser<PredictParamsProto>(() => new PredictParamsProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<PredictParamsProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[9]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public PredictParamsProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public PredictParamsProto(PredictParamsProto other) : this() {
+      noCache_ = other.noCache_;
+      maxBatchSize_ = other.maxBatchSize_;
+      maxWaitUs_ = other.maxWaitUs_;
+      topK_ = other.topK_;
+      outputLayers_ = other.outputLayers_.Clone();
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public PredictParamsProto Clone() {
+      return new PredictParamsProto(this);
+    }
+
+    /// <summary>Field number for the "no_cache" field.</summary>
+    public const int NoCacheFieldNumber = 1;
+    private bool noCache_;
+    /// <summary>
+    /// Inverted so the unset field caches the model, like a missing "cache" in predict_params
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool NoCache {
+      get { return noCache_; }
+      set {
+        noCache_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "max_batch_size" field.</summary>
+    public const int MaxBatchSizeFieldNumber = 2;
+    private uint maxBatchSize_;
+    /// <summary>
+    /// Concurrent predictions on the cached model are batched when max_batch_size > 0
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint MaxBatchSize {
+      get { return maxBatchSize_; }
+      set {
+        maxBatchSize_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "max_wait_us" field.</summary>
+    public const int MaxWaitUsFieldNumber = 3;
+    private uint maxWaitUs_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint MaxWaitUs {
+      get { return maxWaitUs_; }
+      set {
+        maxWaitUs_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "top_k" field.</summary>
+    public const int TopKFieldNumber = 4;
+    private uint topK_;
+    /// <summary>
+    /// The outputs are the indices and the scores of the top_k classes of every row, argmax when 1
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint TopK {
+      get { return topK_; }
+      set {
+        topK_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "output_layers" field.</summary>
+    public const int OutputLayersFieldNumber = 5;
+    private static readonly pb::FieldCodec<string> _repeated_output_layers_codec
+        = pb::FieldCodec.ForString(42);
+    private readonly pbc::RepeatedField<string> outputLayers_ = new pbc::RepeatedField<string>();
+    /// <summary>
+    /// The activations of these layers or nodes, one output each, instead of the model's output
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<string> OutputLayers {
+      get { return outputLayers_; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as PredictParamsProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(PredictParamsProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (NoCache != other.NoCache) return false;
+      if (MaxBatchSize != other.MaxBatchSize) return false;
+      if (MaxWaitUs != other.MaxWaitUs) return false;
+      if (TopK != other.TopK) return false;
+      if(!outputLayers_.Equals(other.outputLayers_)) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (NoCache != false) hash ^= NoCache.GetHashCode();
+      if (MaxBatchSize != 0) hash ^= MaxBatchSize.GetHashCode();
+      if (MaxWaitUs != 0) hash ^= MaxWaitUs.GetHashCode();
+      if (TopK != 0) hash ^= TopK.GetHashCode();
+      hash ^= outputLayers_.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (NoCache != false) {
+        output.WriteRawTag(8);
+        output.WriteBool(NoCache);
+      }
+      if (MaxBatchSize != 0) {
+        output.WriteRawTag(16);
+        output.WriteUInt32(MaxBatchSize);
+      }
+      if (MaxWaitUs != 0) {
+        output.WriteRawTag(24);
+        output.WriteUInt32(MaxWaitUs);
+      }
+      if (TopK != 0) {
+        output.WriteRawTag(32);
+        output.WriteUInt32(TopK);
+      }
+      outputLayers_.WriteTo(output, _repeated_output_layers_codec);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (NoCache != false) {
+        size += 1 + 1;
+      }
+      if (MaxBatchSize != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(MaxBatchSize);
+      }
+      if (MaxWaitUs != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(MaxWaitUs);
+      }
+      if (TopK != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(TopK);
+      }
+      size += outputLayers_.CalculateSize(_repeated_output_layers_codec);
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(PredictParamsProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.NoCache != false) {
+        NoCache = other.NoCache;
+      }
+      if (other.MaxBatchSize != 0) {
+        MaxBatchSize = other.MaxBatchSize;
+      }
+      if (other.MaxWaitUs != 0) {
+        MaxWaitUs = other.MaxWaitUs;
+      }
+      if (other.TopK != 0) {
+        TopK = other.TopK;
+      }
+      outputLayers_.Add(other.outputLayers_);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 8: {
+            NoCache = input.ReadBool();
+            break;
+          }
+          case 16: {
+            MaxBatchSize = input.ReadUInt32();
+            break;
+          }
+          case 24: {
+            MaxWaitUs = input.ReadUInt32();
+            break;
+          }
+          case 32: {
+            TopK = input.ReadUInt32();
+            break;
+          }
+          case 42: {
+            outputLayers_.AddEntriesFrom(input, _repeated_output_layers_codec);
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class LearningRateScheduleProto : pb::IMessage<LearningRateScheduleProto> {
+    private static readonly pb::MessageParser<LearningRateScheduleProto> _parser = new pb::MessageParser<LearningRateScheduleProto>(() => new LearningRateScheduleProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<LearningRateScheduleProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[10]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public LearningRateScheduleProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public LearningRateScheduleProto(LearningRateScheduleProto other) : this() {
+      op_ = other.op_;
+      gamma_ = other.gamma_;
+      stepSize_ = other.stepSize_;
+      warmup_ = other.warmup_;
+      minLr_ = other.minLr_;
+      perBatch_ = other.perBatch_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public LearningRateScheduleProto Clone() {
+      return new LearningRateScheduleProto(this);
+    }
+
+    /// <summary>Field number for the "op" field.</summary>
+    public const int OpFieldNumber = 1;
+    private string op_ = "";
+    /// <summary>
+    /// constant, step, exponential or cosine
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Op {
+      get { return op_; }
+      set {
+        op_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "gamma" field.</summary>
+    public const int GammaFieldNumber = 2;
+    private double gamma_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double Gamma {
+      get { return gamma_; }
+      set {
+        gamma_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "step_size" field.</summary>
+    public const int StepSizeFieldNumber = 3;
+    private uint stepSize_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint StepSize {
+      get { return stepSize_; }
+      set {
+        stepSize_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "warmup" field.</summary>
+    public const int WarmupFieldNumber = 4;
+    private uint warmup_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint Warmup {
+      get { return warmup_; }
+      set {
+        warmup_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "min_lr" field.</summary>
+    public const int MinLrFieldNumber = 5;
+    private double minLr_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double MinLr {
+      get { return minLr_; }
+      set {
+        minLr_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "per_batch" field.</summary>
+    public const int PerBatchFieldNumber = 6;
+    private bool perBatch_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool PerBatch {
+      get { return perBatch_; }
+      set {
+        perBatch_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as LearningRateScheduleProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(LearningRateScheduleProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Op != other.Op) return false;
+      if (Gamma != other.Gamma) return false;
+      if (StepSize != other.StepSize) return false;
+      if (Warmup != other.Warmup) return false;
+      if (MinLr != other.MinLr) return false;
+      if (PerBatch != other.PerBatch) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Op.Length != 0) hash ^= Op.GetHashCode();
+      if (Gamma != 0D) hash ^= Gamma.GetHashCode();
+      if (StepSize != 0) hash ^= StepSize.GetHashCode();
+      if (Warmup != 0) hash ^= Warmup.GetHashCode();
+      if (MinLr != 0D) hash ^= MinLr.GetHashCode();
+      if (PerBatch != false) hash ^= PerBatch.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Op.Length != 0) {
+        output.WriteRawTag(10);
+        output.WriteString(Op);
+      }
+      if (Gamma != 0D) {
+        output.WriteRawTag(17);
+        output.WriteDouble(Gamma);
+      }
+      if (StepSize != 0) {
+        output.WriteRawTag(24);
+        output.WriteUInt32(StepSize);
+      }
+      if (Warmup != 0) {
+        output.WriteRawTag(32);
+        output.WriteUInt32(Warmup);
+      }
+      if (MinLr != 0D) {
+        output.WriteRawTag(41);
+        output.WriteDouble(MinLr);
+      }
+      if (PerBatch != false) {
+        output.WriteRawTag(48);
+        output.WriteBool(PerBatch);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Op.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Op);
+      }
+      if (Gamma != 0D) {
+        size += 1 + 8;
+      }
+      if (StepSize != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(StepSize);
+      }
+      if (Warmup != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(Warmup);
+      }
+      if (MinLr != 0D) {
+        size += 1 + 8;
+      }
+      if (PerBatch != false) {
+        size += 1 + 1;
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(LearningRateScheduleProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Op.Length != 0) {
+        Op = other.Op;
+      }
+      if (other.Gamma != 0D) {
+        Gamma = other.Gamma;
+      }
+      if (other.StepSize != 0) {
+        StepSize = other.StepSize;
+      }
+      if (other.Warmup != 0) {
+        Warmup = other.Warmup;
+      }
+      if (other.MinLr != 0D) {
+        MinLr = other.MinLr;
+      }
+      if (other.PerBatch != false) {
+        PerBatch = other.PerBatch;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            Op = input.ReadString();
+            break;
+          }
+          case 17: {
+            Gamma = input.ReadDouble();
+            break;
+          }
+          case 24: {
+            StepSize = input.ReadUInt32();
+            break;
+          }
+          case 32: {
+            Warmup = input.ReadUInt32();
+            break;
+          }
+          case 41: {
+            MinLr = input.ReadDouble();
+            break;
+          }
+          case 48: {
+            PerBatch = input.ReadBool();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  /// <summary>
+  /// Distributed training, every rank is a process started by mpiexec
+  /// </summary>
+  public sealed partial class DistributedParamsProto : pb::IMessage<DistributedParamsProto> {
+    private static readonly pb::MessageParser<DistributedParamsProto> _parser = new pb::MessageParser<DistributedParamsProto>(() => new DistributedParamsProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<DistributedParamsProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[11]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public DistributedParamsProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public DistributedParamsProto(DistributedParamsProto other) : this() {
+      op_ = other.op_;
+      distributeAfterSamples_ = other.distributeAfterSamples_;
+      blockSize_ = other.blockSize_;
+      quantizationBits_ = other.quantizationBits_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public DistributedParamsProto Clone() {
+      return new DistributedParamsProto(this);
+    }
+
+    /// <summary>Field number for the "op" field.</summary>
+    public const int OpFieldNumber = 1;
+    private string op_ = "";
+    /// <summary>
+    /// data_parallel, 1bit or block_momentum
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Op {
+      get { return op_; }
+      set {
+        op_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "distribute_after_samples" field.</summary>
+    public const int DistributeAfterSamplesFieldNumber = 2;
+    private ulong distributeAfterSamples_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong DistributeAfterSamples {
+      get { return distributeAfterSamples_; }
+      set {
+        distributeAfterSamples_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "block_size" field.</summary>
+    public const int BlockSizeFieldNumber = 3;
+    private ulong blockSize_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong BlockSize {
+      get { return blockSize_; }
+      set {
+        blockSize_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "quantization_bits" field.</summary>
+    public const int QuantizationBitsFieldNumber = 4;
+    private uint quantizationBits_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint QuantizationBits {
+      get { return quantizationBits_; }
+      set {
+        quantizationBits_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as DistributedParamsProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(DistributedParamsProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Op != other.Op) return false;
+      if (DistributeAfterSamples != other.DistributeAfterSamples) return false;
+      if (BlockSize != other.BlockSize) return false;
+      if (QuantizationBits != other.QuantizationBits) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Op.Length != 0) hash ^= Op.GetHashCode();
+      if (DistributeAfterSamples != 0UL) hash ^= DistributeAfterSamples.GetHashCode();
+      if (BlockSize != 0UL) hash ^= BlockSize.GetHashCode();
+      if (QuantizationBits != 0) hash ^= QuantizationBits.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Op.Length != 0) {
+        output.WriteRawTag(10);
+        output.WriteString(Op);
+      }
+      if (DistributeAfterSamples != 0UL) {
+        output.WriteRawTag(16);
+        output.WriteUInt64(DistributeAfterSamples);
+      }
+      if (BlockSize != 0UL) {
+        output.WriteRawTag(24);
+        output.WriteUInt64(BlockSize);
+      }
+      if (QuantizationBits != 0) {
+        output.WriteRawTag(32);
+        output.WriteUInt32(QuantizationBits);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Op.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Op);
+      }
+      if (DistributeAfterSamples != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(DistributeAfterSamples);
+      }
+      if (BlockSize != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(BlockSize);
+      }
+      if (QuantizationBits != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(QuantizationBits);
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(DistributedParamsProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Op.Length != 0) {
+        Op = other.Op;
+      }
+      if (other.DistributeAfterSamples != 0UL) {
+        DistributeAfterSamples = other.DistributeAfterSamples;
+      }
+      if (other.BlockSize != 0UL) {
+        BlockSize = other.BlockSize;
+      }
+      if (other.QuantizationBits != 0) {
+        QuantizationBits = other.QuantizationBits;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            Op = input.ReadString();
+            break;
+          }
+          case 16: {
+            DistributeAfterSamples = input.ReadUInt64();
+            break;
+          }
+          case 24: {
+            BlockSize = input.ReadUInt64();
+            break;
+          }
+          case 32: {
+            QuantizationBits = input.ReadUInt32();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class CheckpointParamsProto : pb::IMessage<CheckpointParamsProto> {
+    private static readonly pb::MessageParser<CheckpointParamsProto> _parser = new pb::MessageParser<CheckpointParamsProto>(() => new CheckpointParamsProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<CheckpointParamsProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[12]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CheckpointParamsProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CheckpointParamsProto(CheckpointParamsProto other) : this() {
+      path_ = other.path_;
+      everyBatches_ = other.everyBatches_;
+      everyMinutes_ = other.everyMinutes_;
+      resume_ = other.resume_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CheckpointParamsProto Clone() {
+      return new CheckpointParamsProto(this);
+    }
+
+    /// <summary>Field number for the "path" field.</summary>
+    public const int PathFieldNumber = 1;
+    private string path_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string Path {
+      get { return path_; }
+      set {
+        path_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "every_batches" field.</summary>
+    public const int EveryBatchesFieldNumber = 2;
+    private uint everyBatches_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint EveryBatches {
+      get { return everyBatches_; }
+      set {
+        everyBatches_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "every_minutes" field.</summary>
+    public const int EveryMinutesFieldNumber = 3;
+    private double everyMinutes_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public double EveryMinutes {
+      get { return everyMinutes_; }
+      set {
+        everyMinutes_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "resume" field.</summary>
+    public const int ResumeFieldNumber = 4;
+    private bool resume_;
+    /// <summary>
+    /// Continue from the checkpoint at path, if any
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Resume {
+      get { return resume_; }
+      set {
+        resume_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as CheckpointParamsProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(CheckpointParamsProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Path != other.Path) return false;
+      if (EveryBatches != other.EveryBatches) return false;
+      if (EveryMinutes != other.EveryMinutes) return false;
+      if (Resume != other.Resume) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Path.Length != 0) hash ^= Path.GetHashCode();
+      if (EveryBatches != 0) hash ^= EveryBatches.GetHashCode();
+      if (EveryMinutes != 0D) hash ^= EveryMinutes.GetHashCode();
+      if (Resume != false) hash ^= Resume.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Path.Length != 0) {
+        output.WriteRawTag(10);
+        output.WriteString(Path);
+      }
+      if (EveryBatches != 0) {
+        output.WriteRawTag(16);
+        output.WriteUInt32(EveryBatches);
+      }
+      if (EveryMinutes != 0D) {
+        output.WriteRawTag(25);
+        output.WriteDouble(EveryMinutes);
+      }
+      if (Resume != false) {
+        output.WriteRawTag(32);
+        output.WriteBool(Resume);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Path.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(Path);
+      }
+      if (EveryBatches != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(EveryBatches);
+      }
+      if (EveryMinutes != 0D) {
+        size += 1 + 8;
+      }
+      if (Resume != false) {
+        size += 1 + 1;
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(CheckpointParamsProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Path.Length != 0) {
+        Path = other.Path;
+      }
+      if (other.EveryBatches != 0) {
+        EveryBatches = other.EveryBatches;
+      }
+      if (other.EveryMinutes != 0D) {
+        EveryMinutes = other.EveryMinutes;
+      }
+      if (other.Resume != false) {
+        Resume = other.Resume;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 10: {
+            Path = input.ReadString();
+            break;
+          }
+          case 16: {
+            EveryBatches = input.ReadUInt32();
+            break;
+          }
+          case 25: {
+            EveryMinutes = input.ReadDouble();
+            break;
+          }
+          case 32: {
+            Resume = input.ReadBool();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  /// <summary>
+  /// The batch events are reported every every_batches batches or every_ms milliseconds, async
+  /// delivers all the events from a background thread
+  /// </summary>
+  public sealed partial class ProgressParamsProto : pb::IMessage<ProgressParamsProto> {
+    private static readonly pb::MessageParser<ProgressParamsProto> _parser = new pb::MessageParser<ProgressParamsProto>(() => new ProgressParamsProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<ProgressParamsProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[13]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ProgressParamsProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ProgressParamsProto(ProgressParamsProto other) : this() {
+      async_ = other.async_;
+      everyBatches_ = other.everyBatches_;
+      everyMs_ = other.everyMs_;
+      epochsOnly_ = other.epochsOnly_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ProgressParamsProto Clone() {
+      return new ProgressParamsProto(this);
+    }
+
+    /// <summary>Field number for the "async" field.</summary>
+    public const int AsyncFieldNumber = 1;
+    private bool async_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Async {
+      get { return async_; }
+      set {
+        async_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "every_batches" field.</summary>
+    public const int EveryBatchesFieldNumber = 2;
+    private uint everyBatches_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint EveryBatches {
+      get { return everyBatches_; }
+      set {
+        everyBatches_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "every_ms" field.</summary>
+    public const int EveryMsFieldNumber = 3;
+    private uint everyMs_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public uint EveryMs {
+      get { return everyMs_; }
+      set {
+        everyMs_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "epochs_only" field.</summary>
+    public const int EpochsOnlyFieldNumber = 4;
+    private bool epochsOnly_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool EpochsOnly {
+      get { return epochsOnly_; }
+      set {
+        epochsOnly_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as ProgressParamsProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(ProgressParamsProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Async != other.Async) return false;
+      if (EveryBatches != other.EveryBatches) return false;
+      if (EveryMs != other.EveryMs) return false;
+      if (EpochsOnly != other.EpochsOnly) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Async != false) hash ^= Async.GetHashCode();
+      if (EveryBatches != 0) hash ^= EveryBatches.GetHashCode();
+      if (EveryMs != 0) hash ^= EveryMs.GetHashCode();
+      if (EpochsOnly != false) hash ^= EpochsOnly.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Async != false) {
+        output.WriteRawTag(8);
+        output.WriteBool(Async);
+      }
+      if (EveryBatches != 0) {
+        output.WriteRawTag(16);
+        output.WriteUInt32(EveryBatches);
+      }
+      if (EveryMs != 0) {
+        output.WriteRawTag(24);
+        output.WriteUInt32(EveryMs);
+      }
+      if (EpochsOnly != false) {
+        output.WriteRawTag(32);
+        output.WriteBool(EpochsOnly);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Async != false) {
+        size += 1 + 1;
+      }
+      if (EveryBatches != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(EveryBatches);
+      }
+      if (EveryMs != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt32Size(EveryMs);
+      }
+      if (EpochsOnly != false) {
+        size += 1 + 1;
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(ProgressParamsProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Async != false) {
+        Async = other.Async;
+      }
+      if (other.EveryBatches != 0) {
+        EveryBatches = other.EveryBatches;
+      }
+      if (other.EveryMs != 0) {
+        EveryMs = other.EveryMs;
+      }
+      if (other.EpochsOnly != false) {
+        EpochsOnly = other.EpochsOnly;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 8: {
+            Async = input.ReadBool();
+            break;
+          }
+          case 16: {
+            EveryBatches = input.ReadUInt32();
+            break;
+          }
+          case 24: {
+            EveryMs = input.ReadUInt32();
+            break;
+          }
+          case 32: {
+            EpochsOnly = input.ReadBool();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  public sealed partial class CacheStatsProto : pb::IMessage<CacheStatsProto> {
+    private static readonly pb::MessageParser<CacheStatsProto> _parser = new pb::MessageParser<CacheStatsProto>(() => new CacheStatsProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<CacheStatsProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[14]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CacheStatsProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CacheStatsProto(CacheStatsProto other) : this() {
+      hits_ = other.hits_;
+      misses_ = other.misses_;
+      evictions_ = other.evictions_;
+      models_ = other.models_;
+      bytes_ = other.bytes_;
+      budget_ = other.budget_;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public CacheStatsProto Clone() {
+      return new CacheStatsProto(this);
+    }
+
+    /// <summary>Field number for the "hits" field.</summary>
+    public const int HitsFieldNumber = 1;
+    private ulong hits_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Hits {
+      get { return hits_; }
+      set {
+        hits_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "misses" field.</summary>
+    public const int MissesFieldNumber = 2;
+    private ulong misses_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Misses {
+      get { return misses_; }
+      set {
+        misses_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "evictions" field.</summary>
+    public const int EvictionsFieldNumber = 3;
+    private ulong evictions_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Evictions {
+      get { return evictions_; }
+      set {
+        evictions_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "models" field.</summary>
+    public const int ModelsFieldNumber = 4;
+    private ulong models_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Models {
+      get { return models_; }
+      set {
+        models_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "bytes" field.</summary>
+    public const int BytesFieldNumber = 5;
+    private ulong bytes_;
+    /// <summary>
+    /// The parameters of the cached models
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Bytes {
+      get { return bytes_; }
+      set {
+        bytes_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "budget" field.</summary>
+    public const int BudgetFieldNumber = 6;
+    private ulong budget_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Budget {
+      get { return budget_; }
+      set {
+        budget_ = value;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as CacheStatsProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(CacheStatsProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Hits != other.Hits) return false;
+      if (Misses != other.Misses) return false;
+      if (Evictions != other.Evictions) return false;
+      if (Models != other.Models) return false;
+      if (Bytes != other.Bytes) return false;
+      if (Budget != other.Budget) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Hits != 0UL) hash ^= Hits.GetHashCode();
+      if (Misses != 0UL) hash ^= Misses.GetHashCode();
+      if (Evictions != 0UL) hash ^= Evictions.GetHashCode();
+      if (Models != 0UL) hash ^= Models.GetHashCode();
+      if (Bytes != 0UL) hash ^= Bytes.GetHashCode();
+      if (Budget != 0UL) hash ^= Budget.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Hits != 0UL) {
+        output.WriteRawTag(8);
+        output.WriteUInt64(Hits);
+      }
+      if (Misses != 0UL) {
+        output.WriteRawTag(16);
+        output.WriteUInt64(Misses);
+      }
+      if (Evictions != 0UL) {
+        output.WriteRawTag(24);
+        output.WriteUInt64(Evictions);
+      }
+      if (Models != 0UL) {
+        output.WriteRawTag(32);
+        output.WriteUInt64(Models);
+      }
+      if (Bytes != 0UL) {
+        output.WriteRawTag(40);
+        output.WriteUInt64(Bytes);
+      }
+      if (Budget != 0UL) {
+        output.WriteRawTag(48);
+        output.WriteUInt64(Budget);
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Hits != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Hits);
+      }
+      if (Misses != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Misses);
+      }
+      if (Evictions != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Evictions);
+      }
+      if (Models != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Models);
+      }
+      if (Bytes != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Bytes);
+      }
+      if (Budget != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Budget);
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(CacheStatsProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Hits != 0UL) {
+        Hits = other.Hits;
+      }
+      if (other.Misses != 0UL) {
+        Misses = other.Misses;
+      }
+      if (other.Evictions != 0UL) {
+        Evictions = other.Evictions;
+      }
+      if (other.Models != 0UL) {
+        Models = other.Models;
+      }
+      if (other.Bytes != 0UL) {
+        Bytes = other.Bytes;
+      }
+      if (other.Budget != 0UL) {
+        Budget = other.Budget;
+      }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 8: {
+            Hits = input.ReadUInt64();
+            break;
+          }
+          case 16: {
+            Misses = input.ReadUInt64();
+            break;
+          }
+          case 24: {
+            Evictions = input.ReadUInt64();
+            break;
+          }
+          case 32: {
+            Models = input.ReadUInt64();
+            break;
+          }
+          case 40: {
+            Bytes = input.ReadUInt64();
+            break;
+          }
+          case 48: {
+            Budget = input.ReadUInt64();
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
+  /// <summary>
+  /// offset is the number of rows of the first output in the previous chunks
+  /// </summary>
+  public sealed partial class OutputChunkProto : pb::IMessage<OutputChunkProto> {
+    private static readonly pb::MessageParser<OutputChunkProto> _parser = new pb::MessageParser<OutputChunkProto>(() => new OutputChunkProto());
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pb::MessageParser<OutputChunkProto> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::Keras.KerasProtoReflection.Descriptor.MessageTypes[15]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public OutputChunkProto() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public OutputChunkProto(OutputChunkProto other) : this() {
+      offset_ = other.offset_;
+      outputs_ = other.outputs_.Clone();
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public OutputChunkProto Clone() {
+      return new OutputChunkProto(this);
+    }
+
+    /// <summary>Field number for the "offset" field.</summary>
+    public const int OffsetFieldNumber = 1;
+    private ulong offset_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public ulong Offset {
+      get { return offset_; }
+      set {
+        offset_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "outputs" field.</summary>
+    public const int OutputsFieldNumber = 2;
+    private static readonly pb::FieldCodec<global::Keras.TensorProto> _repeated_outputs_codec
+        = pb::FieldCodec.ForMessage(18, global::Keras.TensorProto.Parser);
+    private readonly pbc::RepeatedField<global::Keras.TensorProto> outputs_ = new pbc::RepeatedField<global::Keras.TensorProto>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<global::Keras.TensorProto> Outputs {
+      get { return outputs_; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override bool Equals(object other) {
+      return Equals(other as OutputChunkProto);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public bool Equals(OutputChunkProto other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (Offset != other.Offset) return false;
+      if(!outputs_.Equals(other.outputs_)) return false;
+      return true;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (Offset != 0UL) hash ^= Offset.GetHashCode();
+      hash ^= outputs_.GetHashCode();
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void WriteTo(pb::CodedOutputStream output) {
+      if (Offset != 0UL) {
+        output.WriteRawTag(8);
+        output.WriteUInt64(Offset);
+      }
+      outputs_.WriteTo(output, _repeated_outputs_codec);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public int CalculateSize() {
+      int size = 0;
+      if (Offset != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Offset);
+      }
+      size += outputs_.CalculateSize(_repeated_outputs_codec);
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(OutputChunkProto other) {
+      if (other == null) {
+        return;
+      }
+      if (other.Offset != 0UL) {
+        Offset = other.Offset;
+      }
+      outputs_.Add(other.outputs_);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public void MergeFrom(pb::CodedInputStream input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            input.SkipLastField();
+            break;
+          case 8: {
+            Offset = input.ReadUInt64();
+            break;
+          }
+          case 18: {
+            outputs_.AddEntriesFrom(input, _repeated_outputs_codec);
+            break;
+          }
+        }
+      }
+    }
+
+  }
+
   #endregion
 
 }
@@ -92,6 +92,130 @@ namespace Keras
                 jobj[name] = (obj as GraphOp).ToJObject();
         }
 
+        private static void AddInts(Google.Protobuf.Collections.RepeatedField<int> field, JToken token)
+        {
+            if (token == null)
+                return;
+
+            if (token.Type == JTokenType.Array)
+                field.Add(token.ToObject<int[]>());
+            else
+                field.Add((int)token);
+        }
+
+        public static InitializerProto ToInitializerProto(JToken token)
+        {
+            if (token.Type == JTokenType.String)
+                return new InitializerProto() { Op = (string)token };
+
+            return new InitializerProto()
+            {
+                Op = (string)token["op"],
+                Value = (double?)token["value"] ?? 0.0,
+                Scale = (double?)token["scale"] ?? 0.0,
+                Seed = (ulong?)token["seed"] ?? 0
+            };
+        }
+
+        public static LayerProto ToLayerProto(JObject jobj)
+        {
+            var op = (string)jobj["op"];
+            var proto = new LayerProto()
+            {
+                Op = op,
+                Name = (string)jobj["name"] ?? "",
+                // The native defaults for a missing use_bias
+                UseBias = (bool?)jobj["use_bias"] ?? op.ToLower() == "dense",
+                Units = (uint?)jobj["units"] ?? 0,
+                Activation = (string)jobj["activation"] ?? "",
+                Filters = (uint?)jobj["filters"] ?? 0,
+                Padding = (string)jobj["padding"] ?? "",
+                Rate = (double?)jobj["rate"] ?? 0.0,
+                Seed = (ulong?)jobj["seed"] ?? 0,
+                InputDim = (uint?)jobj["input_dim"] ?? 0,
+                OutputDim = (uint?)jobj["output_dim"] ?? 0,
+                InputLength = (uint?)jobj["input_length"] ?? 0,
+                RecurrentActivation = (string)jobj["recurrent_activation"] ?? "",
+                UnitForgetBias = (bool?)jobj["unit_forget_bias"] ?? true,
+                ReturnSequences = (bool?)jobj["return_sequences"] ?? false,
+                GoBackwards = (bool?)jobj["go_backwards"] ?? false,
+                Dropout = (double?)jobj["dropout"] ?? 0.0,
+                RecurrentDropout = (double?)jobj["recurrent_dropout"] ?? 0.0,
+                MaskZero = (bool?)jobj["mask_zero"] ?? false,
+                HashBuckets = (uint?)jobj["hash_buckets"] ?? 0,
+                NumHashes = (uint?)jobj["num_hashes"] ?? 0,
+                Groups = (uint?)jobj["groups"] ?? 0,
+                DepthMultiplier = (uint?)jobj["depth_multiplier"] ?? 0
+            };
+
+            AddInts(proto.InputShape, jobj["input_shape"]);
+            AddInts(proto.KernelSize, jobj["kernel_size"]);
+            AddInts(proto.Strides, jobj["strides"]);
+            AddInts(proto.PoolSize, jobj["pool_size"]);
+
+            if (jobj["kernel_initializer"] != null)
+                proto.KernelInitializer = ToInitializerProto(jobj["kernel_initializer"]);
+            if (jobj["bias_initializer"] != null)
+                proto.BiasInitializer = ToInitializerProto(jobj["bias_initializer"]);
+            if (jobj["recurrent_initializer"] != null)
+                proto.RecurrentInitializer = ToInitializerProto(jobj["recurrent_initializer"]);
+            if (jobj["embedding_initializer"] != null)
+                proto.EmbeddingsInitializer = ToInitializerProto(jobj["embedding_initializer"]);
+            if (jobj["depthwise_initializer"] != null)
+                proto.DepthwiseInitializer = ToInitializerProto(jobj["depthwise_initializer"]);
+            if (jobj["pointwise_initializer"] != null)
+                proto.PointwiseInitializer = ToInitializerProto(jobj["pointwise_initializer"]);
+
+            return proto;
+        }
+
+        public static CompileParamsProto ToCompileParamsProto(JObject jobj)
+        {
+            var joptimizer = jobj["optimizer"];
+            var optimizer = joptimizer.Type == JTokenType.String ? new OptimizerProto() { Op = (string)joptimizer } : new OptimizerProto()
+            {
+                Op = (string)joptimizer["op"],
+                Lr = (double?)joptimizer["lr"] ?? 0.0,
+                Momentum = (double?)joptimizer["momentum"] ?? 0.0,
+                Decay = (double?)joptimizer["decay"] ?? 0.0,
+                Nesterov = (bool?)joptimizer["nestorov"] ?? false,
+                Rho = (double?)joptimizer["rho"] ?? 0.0,
+                Epsilon = (double?)joptimizer["epsilon"] ?? 0.0,
+                Beta1 = (double?)joptimizer["beta_1"] ?? 0.0,
+                Beta2 = (double?)joptimizer["beta_2"] ?? 0.0,
+                WeightDecay = (double?)joptimizer["weight_decay"] ?? 0.0
+            };
+
+            var jschedule = joptimizer.Type == JTokenType.Object ? joptimizer["schedule"] : null;
+            if (jschedule != null)
+            {
+                optimizer.Schedule = jschedule.Type == JTokenType.String ? new LearningRateScheduleProto() { Op = (string)jschedule } : new LearningRateScheduleProto()
+                {
+                    Op = (string)jschedule["op"],
+                    Gamma = (double?)jschedule["gamma"] ?? 0.0,
+                    StepSize = (uint?)jschedule["step_size"] ?? 0,
+                    Warmup = (uint?)jschedule["warmup"] ?? 0,
+                    MinLr = (double?)jschedule["min_lr"] ?? 0.0,
+                    PerBatch = (bool?)jschedule["per_batch"] ?? false
+                };
+            }
+
+            var proto = new CompileParamsProto()
+            {
+                Optimizer = optimizer,
+                Loss = (string)jobj["loss"],
+                TopK = (uint?)jobj["top_k"] ?? 0
+            };
+
+            var metrics = jobj["metrics"];
+            if (metrics != null && metrics.Type == JTokenType.Array)
+                proto.Metrics.Add(metrics.ToObject<string[]>());
+            else if (metrics != null)
+                proto.Metrics.Add((string)metrics);
+
+            return proto;
+        }
+
         public static Dictionary<string, double> Values(this HistoryProto proto)
         {
             var result = new Dictionary<string, double>();
@@ -0,0 +1,72 @@
+﻿using Google.Protobuf;
+using System;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Keras
+{
+    // The native cache of the models Predict and Evaluate load, shared by the whole process. The
+    // models are the uuids of Sequential.ModelUuid. Every call returns the cache's stats.
+    public static class ModelCache
+    {
+        // The least recently used models are evicted when the parameters of the cached models take
+        // more bytes than this, 0 for no limit. Predict loads an evicted model again.
+        public static CacheStatsProto SetBudget(ulong bytes)
+        {
+            return Call(new KerasProto() { Command = KerasCommand.SetCacheBudget, CacheBudget = bytes });
+        }
+
+        public static CacheStatsProto Stats()
+        {
+            return Call(new KerasProto() { Command = KerasCommand.CacheStats });
+        }
+
+        public static CacheStatsProto Unload(string uuid)
+        {
+            return Call(new KerasProto() { Command = KerasCommand.UnloadModel, ModelUuid = uuid });
+        }
+
+        // Pinned models are never evicted
+        public static CacheStatsProto Pin(string uuid)
+        {
+            return Call(new KerasProto() { Command = KerasCommand.PinModel, ModelUuid = uuid });
+        }
+
+        public static CacheStatsProto Unpin(string uuid)
+        {
+            return Call(new KerasProto() { Command = KerasCommand.UnpinModel, ModelUuid = uuid });
+        }
+
+        private static CacheStatsProto Call(KerasProto kerasProto)
+        {
+            var bytes = kerasProto.ToByteArray();
+
+            IntPtr outData = IntPtr.Zero;
+            uint outLen = 0;
+            ulong outPtr = 0;
+
+            IntPtr exceptionData = IntPtr.Zero;
+            uint exceptionLen = 0;
+            ulong exceptionPtr = 0;
+
+            Sequential.KerasFitModel(bytes, (uint)bytes.Length, ref outData, ref outLen, ref outPtr, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+            if (exceptionLen != 0)
+            {
+                var outBytes = new byte[exceptionLen];
+                Marshal.Copy(exceptionData, outBytes, 0, (int)exceptionLen);
+
+                var exception = new KerasException(Encoding.ASCII.GetString(outBytes));
+                Sequential.KerasDeletePointer(exceptionPtr);
+
+                throw exception;
+            }
+
+            var resultBytes = new byte[outLen];
+            Marshal.Copy(outData, resultBytes, 0, (int)outLen);
+            Sequential.KerasDeletePointer(outPtr);
+
+            return KerasProto.Parser.ParseFrom(resultBytes).CacheStats;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Keras
+{
+    // Low latency inference: the rows go to the native model as raw floats, without the protobuf
+    // envelope. Not thread safe.
+    public class Predictor : IDisposable
+    {
+        private ulong _predictor;
+
+        public uint InputSize { get; }
+        public uint OutputSize { get; }
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasPredictorCreate(byte[] model, uint modelLen, ref ulong predictor, ref uint inputSize, ref uint outputSize, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasPredict(ulong predictor, float[] input, uint n, float[] output, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasPredictorDestroy(ulong predictor);
+
+        public Predictor(byte[] model)
+        {
+            IntPtr exceptionData = IntPtr.Zero;
+            uint exceptionLen = 0;
+            ulong exceptionPtr = 0;
+
+            uint inputSize = 0;
+            uint outputSize = 0;
+            KerasPredictorCreate(model, (uint)model.Length, ref _predictor, ref inputSize, ref outputSize, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+            if (exceptionLen != 0)
+                throw ToException(exceptionData, exceptionLen, exceptionPtr);
+
+            InputSize = inputSize;
+            OutputSize = outputSize;
+        }
+
+        ~Predictor()
+        {
+            Dispose();
+        }
+
+        public void Dispose()
+        {
+            if (_predictor != 0)
+            {
+                KerasPredictorDestroy(_predictor);
+                _predictor = 0;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        public float[] Predict(float[] input)
+        {
+            var output = new float[input.Length / InputSize * OutputSize];
+            Predict(input, output);
+            return output;
+        }
+
+        // input is [n x InputSize] in row major order, output [n x OutputSize]
+        public void Predict(float[] input, float[] output)
+        {
+            if (_predictor == 0)
+                throw new ObjectDisposedException(nameof(Predictor));
+
+            var n = (uint)input.Length / InputSize;
+            if (n * InputSize != input.Length || output.Length < n * OutputSize)
+                throw new KerasException("The buffers don't match the model's input and output sizes");
+
+            IntPtr exceptionData = IntPtr.Zero;
+            uint exceptionLen = 0;
+            ulong exceptionPtr = 0;
+
+            KerasPredict(_predictor, input, n, output, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+            if (exceptionLen != 0)
+                throw ToException(exceptionData, exceptionLen, exceptionPtr);
+        }
+
+        private static KerasException ToException(IntPtr exceptionData, uint exceptionLen, ulong exceptionPtr)
+        {
+            var outBytes = new byte[exceptionLen];
+            Marshal.Copy(exceptionData, outBytes, 0, (int)exceptionLen);
+
+            var exception = new KerasException(Encoding.ASCII.GetString(outBytes));
+            Sequential.KerasDeletePointer(exceptionPtr);
+
+            return exception;
+        }
+    }
+}
@@ -0,0 +1,134 @@
+﻿using Google.Protobuf;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Keras
+{
+    // A model and its trainer resident in the native engine for online learning: every batch is
+    // trained on, or predicted, without building the graph again. Not thread safe.
+    public class Session : IDisposable
+    {
+        private ulong _session;
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasSessionCreate(byte[] inData, uint inlen, ref ulong session, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasSessionTrainOnBatch(ulong session, byte[] inData, uint inlen, ref IntPtr outData, ref uint outLen, ref ulong outPtr, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasSessionPredictOnBatch(ulong session, byte[] inData, uint inlen, ref IntPtr outData, ref uint outLen, ref ulong outPtr, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasSessionSave(ulong session, byte[] inData, uint inlen, ref IntPtr outData, ref uint outLen, ref ulong outPtr, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        [DllImport(@"KerasCntk.dll")]
+        private static extern void KerasSessionDestroy(ulong session);
+
+        private delegate void SessionCall(ulong session, byte[] inData, uint inlen, ref IntPtr outData, ref uint outLen, ref ulong outPtr, ref IntPtr exceptionData, ref uint exceptionLen, ref ulong exceptionPtr);
+
+        internal Session(KerasProto kerasProto)
+        {
+            var bytes = kerasProto.ToByteArray();
+
+            IntPtr exceptionData = IntPtr.Zero;
+            uint exceptionLen = 0;
+            ulong exceptionPtr = 0;
+
+            KerasSessionCreate(bytes, (uint)bytes.Length, ref _session, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+            if (exceptionLen != 0)
+                throw ToException(exceptionData, exceptionLen, exceptionPtr);
+        }
+
+        ~Session()
+        {
+            Dispose();
+        }
+
+        public void Dispose()
+        {
+            if (_session != 0)
+            {
+                KerasSessionDestroy(_session);
+                _session = 0;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        // One update of the parameters, returns the loss and the metrics of the batch
+        public Dictionary<string, double> TrainOnBatch(Tensor x, Tensor y, int[] sequenceLengths = null)
+        {
+            return TrainOnBatch(x.GetProto(sequenceLengths), y.GetProto());
+        }
+
+        public Dictionary<string, double> TrainOnBatch(TensorProto x, TensorProto y)
+        {
+            var kerasProto = new KerasProto();
+            kerasProto.Inputs.Add(x);
+            kerasProto.Inputs.Add(y);
+            return Call(KerasSessionTrainOnBatch, kerasProto).Evaluation.Values();
+        }
+
+        public Tensor PredictOnBatch(Tensor x, int[] sequenceLengths = null)
+        {
+            return PredictOnBatch(x.GetProto(sequenceLengths));
+        }
+
+        public Tensor PredictOnBatch(TensorProto x)
+        {
+            var kerasProto = new KerasProto();
+            kerasProto.Inputs.Add(x);
+            return TensorUtils.Deserialize(Call(KerasSessionPredictOnBatch, kerasProto).Outputs[0]);
+        }
+
+        // A snapshot of the model, Sequential.Load reads it back
+        public void Save(Stream stream)
+        {
+            var model = Call(KerasSessionSave, new KerasProto()).Model.ToByteArray();
+            using (var writer = new BinaryWriter(stream))
+                writer.Write(model, 0, model.Length);
+        }
+
+        private KerasProto Call(SessionCall call, KerasProto kerasProto)
+        {
+            if (_session == 0)
+                throw new ObjectDisposedException(nameof(Session));
+
+            var bytes = kerasProto.ToByteArray();
+
+            IntPtr outData = IntPtr.Zero;
+            uint outLen = 0;
+            ulong outPtr = 0;
+
+            IntPtr exceptionData = IntPtr.Zero;
+            uint exceptionLen = 0;
+            ulong exceptionPtr = 0;
+
+            call(_session, bytes, (uint)bytes.Length, ref outData, ref outLen, ref outPtr, ref exceptionData, ref exceptionLen, ref exceptionPtr);
+
+            if (exceptionLen != 0)
+                throw ToException(exceptionData, exceptionLen, exceptionPtr);
+
+            var resultBytes = new byte[outLen];
+            Marshal.Copy(outData, resultBytes, 0, (int)outLen);
+            Sequential.KerasDeletePointer(outPtr);
+
+            return KerasProto.Parser.ParseFrom(resultBytes);
+        }
+
+        private static KerasException ToException(IntPtr exceptionData, uint exceptionLen, ulong exceptionPtr)
+        {
+            var outBytes = new byte[exceptionLen];
+            Marshal.Copy(exceptionData, outBytes, 0, (int)exceptionLen);
+
+            var exception = new KerasException(Encoding.ASCII.GetString(outBytes));
+            Sequential.KerasDeletePointer(exceptionPtr);
+
+            return exception;
+        }
+    }
+}
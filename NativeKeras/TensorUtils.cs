@@ -56,6 +56,43 @@ namespace Keras
             return tensor;
         }
 
+        // Keys of a HashedEmbedding: [nsamples], [nsamples x length] or packed sequences
+        public static TensorProto CreateProto(long[] values, int[] shape = null, int[] sequenceLengths = null)
+        {
+            var bytes = new byte[values.Length * sizeof(long)];
+            Buffer.BlockCopy(values, 0, bytes, 0, bytes.Length);
+            return CreateProto(DataType.Int64, values.Length, ByteString.CopyFrom(bytes), shape, sequenceLengths);
+        }
+
+        // The strings are sent as '\0' terminated UTF-8
+        public static TensorProto CreateProto(string[] values, int[] shape = null, int[] sequenceLengths = null)
+        {
+            var data = string.Concat(values.Select(s => s + '\0'));
+            return CreateProto(DataType.String, values.Length, ByteString.CopyFromUtf8(data), shape, sequenceLengths);
+        }
+
+        private static TensorProto CreateProto(DataType type, int count, ByteString data, int[] shape, int[] sequenceLengths)
+        {
+            var result = new TensorProto()
+            {
+                Type = type,
+                Format = TensorFormat.RowMajor,
+                Count = count,
+                Data = data
+            };
+            result.Shape.Add(shape ?? new int[] { count });
+
+            if (result.Shape.Aggregate((a, i) => a * i) != count)
+                throw new KerasException("The shape doesn't match the number of values.");
+            if (sequenceLengths != null)
+            {
+                if (sequenceLengths.Sum() != count)
+                    throw new KerasException("The sequence lengths don't add up to the number of values.");
+                result.SequenceLengths.Add(sequenceLengths);
+            }
+            return result;
+        }
+
         public static unsafe Tensor Deserialize(Stream stream)
         {
             var proto = TensorProto.Parser.ParseFrom(stream);
@@ -91,6 +128,19 @@ namespace Keras
             return result;
         }
 
+        // With sequence lengths the first dimension holds the steps of all the sequences, back to back
+        public static TensorProto GetProto(this Tensor tensor, int[] sequenceLengths)
+        {
+            var result = tensor.GetProto();
+            if (sequenceLengths != null)
+            {
+                if (sequenceLengths.Sum() != result.Shape[0])
+                    throw new KerasException("The sequence lengths don't add up to the first dimension of the tensor.");
+                result.SequenceLengths.Add(sequenceLengths);
+            }
+            return result;
+        }
+
         public static unsafe TensorProto GetProto(this Tensor tensor)
         {
             var result = new TensorProto();
@@ -1,6 +1,8 @@
 ﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
 using Keras;
 using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
+using System.Linq;
 
 namespace SharpKerasUnitTest
 {
@@ -41,5 +43,36 @@ namespace SharpKerasUnitTest
             var dropout = new Dropout(0.3, seed: 3984);
             jobj = dropout.ToJObject();
         }
+
+        [TestMethod]
+        public void TestToProto()
+        {
+            var dense = KerasUtils.ToLayerProto(new Dense(64, inputShape: new int[] { 20 }, activation: "relu").ToJObject());
+            Assert.AreEqual(64u, dense.Units);
+            Assert.IsTrue(dense.UseBias);
+            CollectionAssert.AreEqual(new int[] { 20 }, dense.InputShape.ToArray());
+
+            var conv = KerasUtils.ToLayerProto(new Conv1D(8, 3).ToJObject());
+            CollectionAssert.AreEqual(new int[] { 3 }, conv.KernelSize.ToArray());
+
+            var model = new Sequential();
+            model.Compile("categorical_crossentropy", new SGD(lr: 0.01, nesterov: true), new string[] { "accuracy" });
+            var compile = KerasUtils.ToCompileParamsProto(JObject.Parse(model.ToString()).Value<JObject>("compile_params"));
+            Assert.AreEqual("SGD", compile.Optimizer.Op);
+            Assert.IsTrue(compile.Optimizer.Nesterov);
+            Assert.AreEqual("accuracy", compile.Metrics[0]);
+
+            model.Compile("categorical_crossentropy", new AdamW(lr: 0.002, schedule: new LearningRateSchedule("cosine", warmup: 2)), new string[] { "accuracy" });
+            compile = KerasUtils.ToCompileParamsProto(JObject.Parse(model.ToString()).Value<JObject>("compile_params"));
+            Assert.AreEqual("AdamW", compile.Optimizer.Op);
+            Assert.AreEqual(0.01, compile.Optimizer.WeightDecay);
+            Assert.AreEqual("cosine", compile.Optimizer.Schedule.Op);
+            Assert.AreEqual(2u, compile.Optimizer.Schedule.Warmup);
+
+            model.Compile("sparse_categorical_crossentropy", "adam", new string[] { "top_k_categorical_accuracy" }, topK: 3);
+            compile = KerasUtils.ToCompileParamsProto(JObject.Parse(model.ToString()).Value<JObject>("compile_params"));
+            Assert.AreEqual("sparse_categorical_crossentropy", compile.Loss);
+            Assert.AreEqual(3u, compile.TopK);
+        }
     }
 }